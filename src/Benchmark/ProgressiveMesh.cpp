@@ -0,0 +1,121 @@
+/*
+ * ProgressiveMesh.cpp
+ *
+ *  Refinement and coarsening throughput of Utils::ProgressiveMesh in
+ *  detail records per second.
+ */
+
+#include <benchmark/benchmark_api.h>
+#include <OpenMesh/Core/Mesh/TriMesh_ArrayKernelT.hh>
+#include <OpenMesh/Tools/Decimater/DecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/ModProgMeshT.hh>
+#include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
+#include <OpenMesh/Tools/Utils/ProgressiveMesh.hh>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+typedef OpenMesh::TriMesh_ArrayKernelT<> Mesh;
+
+std::string read_file(const std::string& _filename) {
+    std::ifstream ifs(_filename.c_str(), std::ios::binary);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    ifs.close();
+    std::remove(_filename.c_str());
+    return ss.str();
+}
+
+/// Progressive mesh of a wavy 256 x 256 grid, created once, in the
+/// original and in the compact format
+const std::string& pm_data(bool _compact = false) {
+    static std::string data, compact;
+    if (!data.empty())
+        return _compact ? compact : data;
+
+    const int n = 256;
+    Mesh mesh;
+    std::vector<Mesh::VertexHandle> vhs;
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < n; ++j)
+            vhs.push_back(mesh.add_vertex(Mesh::Point(float(i), float(j),
+                    4.0f * std::sin(0.1f * float(i)) * std::cos(0.13f * float(j)))));
+    for (int i = 0; i + 1 < n; ++i)
+        for (int j = 0; j + 1 < n; ++j) {
+            const int v = i * n + j;
+            mesh.add_face(vhs[v], vhs[v + 1], vhs[v + n + 1]);
+            mesh.add_face(vhs[v], vhs[v + n + 1], vhs[v + n]);
+        }
+
+    OpenMesh::Decimater::DecimaterT<Mesh> decimater(mesh);
+    OpenMesh::Decimater::ModProgMeshT<Mesh>::Handle hModProg;
+    OpenMesh::Decimater::ModQuadricT<Mesh>::Handle hModQuadric;
+    decimater.add(hModQuadric);
+    decimater.add(hModProg);
+    decimater.initialize();
+    decimater.decimate_to(100);
+
+    const std::string filename = "benchmark_progressive_mesh.pm";
+    decimater.module(hModProg).write(filename);
+    data = read_file(filename);
+    decimater.module(hModProg).write_compact(filename);
+    compact = read_file(filename);
+
+    return _compact ? compact : data;
+}
+
+}
+
+/// Full refinement followed by full coarsening
+static void PM_refine_coarsen(benchmark::State& state) {
+    std::stringstream ss(pm_data());
+    OpenMesh::Utils::ProgressiveMesh pm;
+    pm.open(ss);
+    pm.load();
+
+    const size_t n_min = pm.n_base_vertices(), n_max = pm.n_max_vertices();
+    while (state.KeepRunning()) {
+        pm.set_n_vertices(n_max);
+        pm.set_n_vertices(n_min);
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * pm.n_details());
+}
+BENCHMARK(PM_refine_coarsen);
+
+/// Random jumps between levels of detail
+static void PM_jump(benchmark::State& state) {
+    std::stringstream ss(pm_data());
+    OpenMesh::Utils::ProgressiveMesh pm;
+    pm.open(ss);
+    pm.load();
+
+    size_t records = 0;
+    unsigned int seed = 1;
+    while (state.KeepRunning()) {
+        seed = seed * 1103515245u + 12345u;
+        const size_t n = pm.n_base_vertices() + (seed >> 8) % (pm.n_details() + 1);
+        records += (n > pm.n_vertices()) ? n - pm.n_vertices() : pm.n_vertices() - n;
+        pm.set_n_vertices(n);
+    }
+    state.SetItemsProcessed(records);
+}
+BENCHMARK(PM_jump);
+
+/// Streaming all detail records, including the replay of the splits
+static void PM_load(benchmark::State& state) {
+    const std::string& data = pm_data(state.range(0) != 0);
+    size_t records = 0;
+    while (state.KeepRunning()) {
+        std::stringstream ss(data);
+        OpenMesh::Utils::ProgressiveMesh pm;
+        pm.open(ss);
+        records += pm.load();
+    }
+    state.SetItemsProcessed(records);
+}
+BENCHMARK(PM_load)->Arg(0)->Arg(1);
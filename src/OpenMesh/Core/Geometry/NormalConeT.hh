@@ -98,6 +98,12 @@ public:
   //! merge _cone; this instance will then enclose both former cones
   void merge(const NormalConeT&);
 
+  /** Size of the cone (radius in radians) after merging a unit vector,
+      without computing the new center. _dotp is the dot product of the
+      vector with center_normal(), so several vectors can be handled with
+      dot_n(). Equals angle() after merge(NormalConeT(vector)). */
+  Scalar merged_angle(Scalar _dotp) const;
+
   //! returns center normal
   const Vec3& center_normal() const { return center_normal_; }
 
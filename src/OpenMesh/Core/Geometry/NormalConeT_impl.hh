@@ -146,6 +146,25 @@ merge(const NormalConeT& _cone)
 }
 
 
+//----------------------------------------------------------------------------
+
+
+template <typename Vector>
+typename NormalConeT<Vector>::Scalar
+NormalConeT<Vector>::
+merged_angle(Scalar _dotp) const
+{
+  // same cases as merge() with a cone of angle 0
+  if (fabs(_dotp) < 0.99999f)
+  {
+    Scalar centerAngle = acos(_dotp);
+    return centerAngle > angle_ ? (angle_ + centerAngle) * Scalar(0.5f) : angle_;
+  }
+
+  return _dotp > 0.0f ? angle_ : Scalar(2.0f * M_PI);
+}
+
+
 //=============================================================================
 } // namespace OpenMesh
 //=============================================================================
@@ -0,0 +1,409 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+//=============================================================================
+//
+//  Batch operations on arrays of vectors
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_VECTORBATCHT_HH
+#define OPENMESH_VECTORBATCHT_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+#include <cstddef>
+
+#if defined(__GNUC__) && defined(__SSE2__)
+#define OM_VECTOR_BATCH_SSE
+#include <emmintrin.h>
+#endif
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+
+
+//== FUNCTION DEFINITIONS =====================================================
+
+
+/** \name Batch vector operations
+
+    These functions apply the same operation to _n vectors stored
+    contiguously, e.g. in a std::vector or in a mesh property. The generic
+    versions simply loop over the single vector operations. For Vec3f,
+    Vec4f, Vec3d and Vec4d there are overloads that process several
+    vectors per SSE instruction if the compiler targets SSE2, and fall back
+    to the generic loop otherwise.
+
+    The results are identical to the single vector operations: the SSE
+    code performs the same IEEE operations in the same order.
+*/
+//@{
+
+/// _out[i] = (_a[i] | _b[i]) for i in [0,_n)
+template <typename Scalar, int DIM>
+void dot_n(const VectorT<Scalar, DIM>* _a, const VectorT<Scalar, DIM>* _b,
+           Scalar* _out, size_t _n)
+{
+  for (size_t i = 0; i < _n; ++i)
+    _out[i] = (_a[i] | _b[i]);
+}
+
+/// _out[i] = (_a[i] % _b[i]) for i in [0,_n). _out may alias _a or _b.
+template <typename Scalar>
+void cross_n(const VectorT<Scalar, 3>* _a, const VectorT<Scalar, 3>* _b,
+             VectorT<Scalar, 3>* _out, size_t _n)
+{
+  for (size_t i = 0; i < _n; ++i)
+    _out[i] = (_a[i] % _b[i]);
+}
+
+/// _v[i].normalize_cond() for i in [0,_n), i.e. zero vectors are left untouched
+template <typename Scalar, int DIM>
+void normalize_n(VectorT<Scalar, DIM>* _v, size_t _n)
+{
+  for (size_t i = 0; i < _n; ++i)
+    _v[i].normalize_cond();
+}
+
+//@}
+
+
+#ifdef OM_VECTOR_BATCH_SSE
+
+namespace Detail {
+
+static_assert(sizeof(Vec3f) == 3 * sizeof(float), "Vec3f must be packed");
+static_assert(sizeof(Vec4f) == 4 * sizeof(float), "Vec4f must be packed");
+static_assert(sizeof(Vec3d) == 3 * sizeof(double), "Vec3d must be packed");
+static_assert(sizeof(Vec4d) == 4 * sizeof(double), "Vec4d must be packed");
+
+// Four Vec3f (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) to x, y, z registers
+inline void load_vec3f_x4(const float* _p, __m128& _x, __m128& _y, __m128& _z)
+{
+  const __m128 m0 = _mm_loadu_ps(_p);
+  const __m128 m1 = _mm_loadu_ps(_p + 4);
+  const __m128 m2 = _mm_loadu_ps(_p + 8);
+
+  _x = _mm_shuffle_ps(_mm_shuffle_ps(m0, m0, _MM_SHUFFLE(3,3,0,0)),
+                      _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(1,1,2,2)),
+                      _MM_SHUFFLE(2,0,2,0));
+  _y = _mm_shuffle_ps(_mm_shuffle_ps(m0, m1, _MM_SHUFFLE(0,0,1,1)),
+                      _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(2,2,3,3)),
+                      _MM_SHUFFLE(2,0,2,0));
+  _z = _mm_shuffle_ps(_mm_shuffle_ps(m0, m1, _MM_SHUFFLE(1,1,2,2)),
+                      _mm_shuffle_ps(m2, m2, _MM_SHUFFLE(3,3,0,0)),
+                      _MM_SHUFFLE(2,0,2,0));
+}
+
+// Inverse of load_vec3f_x4()
+inline void store_vec3f_x4(float* _p, __m128 _x, __m128 _y, __m128 _z)
+{
+  const __m128 xy_lo = _mm_unpacklo_ps(_x, _y);   // x0 y0 x1 y1
+  const __m128 xy_hi = _mm_unpackhi_ps(_x, _y);   // x2 y2 x3 y3
+
+  _mm_storeu_ps(_p,     _mm_shuffle_ps(xy_lo, _mm_shuffle_ps(_z, _x, _MM_SHUFFLE(1,1,0,0)),
+                                       _MM_SHUFFLE(2,0,1,0)));
+  _mm_storeu_ps(_p + 4, _mm_shuffle_ps(_mm_shuffle_ps(_y, _z, _MM_SHUFFLE(1,1,1,1)), xy_hi,
+                                       _MM_SHUFFLE(1,0,2,0)));
+  _mm_storeu_ps(_p + 8, _mm_shuffle_ps(_mm_shuffle_ps(_z, _x, _MM_SHUFFLE(3,3,2,2)),
+                                       _mm_shuffle_ps(_y, _z, _MM_SHUFFLE(3,3,3,3)),
+                                       _MM_SHUFFLE(2,0,2,0)));
+}
+
+// Four Vec4f to x, y, z, w registers
+inline void load_vec4f_x4(const float* _p, __m128& _x, __m128& _y, __m128& _z, __m128& _w)
+{
+  _x = _mm_loadu_ps(_p);
+  _y = _mm_loadu_ps(_p + 4);
+  _z = _mm_loadu_ps(_p + 8);
+  _w = _mm_loadu_ps(_p + 12);
+  _MM_TRANSPOSE4_PS(_x, _y, _z, _w);
+}
+
+// Inverse of load_vec4f_x4()
+inline void store_vec4f_x4(float* _p, __m128 _x, __m128 _y, __m128 _z, __m128 _w)
+{
+  _MM_TRANSPOSE4_PS(_x, _y, _z, _w);
+  _mm_storeu_ps(_p,      _x);
+  _mm_storeu_ps(_p + 4,  _y);
+  _mm_storeu_ps(_p + 8,  _z);
+  _mm_storeu_ps(_p + 12, _w);
+}
+
+// Two Vec3d (x0 y0 | z0 x1 | y1 z1) to x, y, z registers
+inline void load_vec3d_x2(const double* _p, __m128d& _x, __m128d& _y, __m128d& _z)
+{
+  const __m128d m0 = _mm_loadu_pd(_p);
+  const __m128d m1 = _mm_loadu_pd(_p + 2);
+  const __m128d m2 = _mm_loadu_pd(_p + 4);
+
+  _x = _mm_shuffle_pd(m0, m1, 2);
+  _y = _mm_shuffle_pd(m0, m2, 1);
+  _z = _mm_shuffle_pd(m1, m2, 2);
+}
+
+// Inverse of load_vec3d_x2()
+inline void store_vec3d_x2(double* _p, __m128d _x, __m128d _y, __m128d _z)
+{
+  _mm_storeu_pd(_p,     _mm_shuffle_pd(_x, _y, 0));
+  _mm_storeu_pd(_p + 2, _mm_shuffle_pd(_z, _x, 2));
+  _mm_storeu_pd(_p + 4, _mm_shuffle_pd(_y, _z, 3));
+}
+
+// Two Vec4d to x, y, z, w registers
+inline void load_vec4d_x2(const double* _p, __m128d& _x, __m128d& _y, __m128d& _z, __m128d& _w)
+{
+  const __m128d a0 = _mm_loadu_pd(_p),     a1 = _mm_loadu_pd(_p + 2);
+  const __m128d b0 = _mm_loadu_pd(_p + 4), b1 = _mm_loadu_pd(_p + 6);
+
+  _x = _mm_unpacklo_pd(a0, b0);
+  _y = _mm_unpackhi_pd(a0, b0);
+  _z = _mm_unpacklo_pd(a1, b1);
+  _w = _mm_unpackhi_pd(a1, b1);
+}
+
+// Inverse of load_vec4d_x2()
+inline void store_vec4d_x2(double* _p, __m128d _x, __m128d _y, __m128d _z, __m128d _w)
+{
+  _mm_storeu_pd(_p,     _mm_unpacklo_pd(_x, _y));
+  _mm_storeu_pd(_p + 2, _mm_unpacklo_pd(_z, _w));
+  _mm_storeu_pd(_p + 4, _mm_unpackhi_pd(_x, _y));
+  _mm_storeu_pd(_p + 6, _mm_unpackhi_pd(_z, _w));
+}
+
+// _v / |_v| where |_v| != 0, _v otherwise
+inline __m128 normalize_mask(__m128 _v, __m128 _norm)
+{
+  const __m128 nonzero = _mm_cmpneq_ps(_norm, _mm_setzero_ps());
+  return _mm_or_ps(_mm_and_ps(nonzero, _mm_div_ps(_v, _norm)),
+                   _mm_andnot_ps(nonzero, _v));
+}
+
+inline __m128d normalize_mask(__m128d _v, __m128d _norm)
+{
+  const __m128d nonzero = _mm_cmpneq_pd(_norm, _mm_setzero_pd());
+  return _mm_or_pd(_mm_and_pd(nonzero, _mm_div_pd(_v, _norm)),
+                   _mm_andnot_pd(nonzero, _v));
+}
+
+} // namespace Detail
+
+
+//-----------------------------------------------------------------------------
+
+
+inline void dot_n(const Vec3f* _a, const Vec3f* _b, float* _out, size_t _n)
+{
+  size_t i = 0;
+  for (; i + 4 <= _n; i += 4) {
+    __m128 ax, ay, az, bx, by, bz;
+    Detail::load_vec3f_x4(_a[i].data(), ax, ay, az);
+    Detail::load_vec3f_x4(_b[i].data(), bx, by, bz);
+    __m128 d = _mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by));
+    d = _mm_add_ps(d, _mm_mul_ps(az, bz));
+    _mm_storeu_ps(_out + i, d);
+  }
+  dot_n<float, 3>(_a + i, _b + i, _out + i, _n - i);
+}
+
+inline void cross_n(const Vec3f* _a, const Vec3f* _b, Vec3f* _out, size_t _n)
+{
+  size_t i = 0;
+  for (; i + 4 <= _n; i += 4) {
+    __m128 ax, ay, az, bx, by, bz;
+    Detail::load_vec3f_x4(_a[i].data(), ax, ay, az);
+    Detail::load_vec3f_x4(_b[i].data(), bx, by, bz);
+    Detail::store_vec3f_x4(_out[i].data(),
+                           _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)),
+                           _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)),
+                           _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+  }
+  cross_n<float>(_a + i, _b + i, _out + i, _n - i);
+}
+
+inline void normalize_n(Vec3f* _v, size_t _n)
+{
+  size_t i = 0;
+  for (; i + 4 <= _n; i += 4) {
+    __m128 x, y, z;
+    Detail::load_vec3f_x4(_v[i].data(), x, y, z);
+    __m128 sqr = _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
+    sqr = _mm_add_ps(sqr, _mm_mul_ps(z, z));
+    const __m128 norm = _mm_sqrt_ps(sqr);
+    Detail::store_vec3f_x4(_v[i].data(),
+                           Detail::normalize_mask(x, norm),
+                           Detail::normalize_mask(y, norm),
+                           Detail::normalize_mask(z, norm));
+  }
+  normalize_n<float, 3>(_v + i, _n - i);
+}
+
+inline void dot_n(const Vec4f* _a, const Vec4f* _b, float* _out, size_t _n)
+{
+  size_t i = 0;
+  for (; i + 4 <= _n; i += 4) {
+    __m128 ax, ay, az, aw, bx, by, bz, bw;
+    Detail::load_vec4f_x4(_a[i].data(), ax, ay, az, aw);
+    Detail::load_vec4f_x4(_b[i].data(), bx, by, bz, bw);
+    __m128 d = _mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by));
+    d = _mm_add_ps(d, _mm_mul_ps(az, bz));
+    d = _mm_add_ps(d, _mm_mul_ps(aw, bw));
+    _mm_storeu_ps(_out + i, d);
+  }
+  dot_n<float, 4>(_a + i, _b + i, _out + i, _n - i);
+}
+
+inline void normalize_n(Vec4f* _v, size_t _n)
+{
+  size_t i = 0;
+  for (; i + 4 <= _n; i += 4) {
+    __m128 x, y, z, w;
+    Detail::load_vec4f_x4(_v[i].data(), x, y, z, w);
+    __m128 sqr = _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
+    sqr = _mm_add_ps(sqr, _mm_mul_ps(z, z));
+    sqr = _mm_add_ps(sqr, _mm_mul_ps(w, w));
+    const __m128 norm = _mm_sqrt_ps(sqr);
+    Detail::store_vec4f_x4(_v[i].data(),
+                           Detail::normalize_mask(x, norm),
+                           Detail::normalize_mask(y, norm),
+                           Detail::normalize_mask(z, norm),
+                           Detail::normalize_mask(w, norm));
+  }
+  normalize_n<float, 4>(_v + i, _n - i);
+}
+
+inline void dot_n(const Vec3d* _a, const Vec3d* _b, double* _out, size_t _n)
+{
+  size_t i = 0;
+  for (; i + 2 <= _n; i += 2) {
+    __m128d ax, ay, az, bx, by, bz;
+    Detail::load_vec3d_x2(_a[i].data(), ax, ay, az);
+    Detail::load_vec3d_x2(_b[i].data(), bx, by, bz);
+    __m128d d = _mm_add_pd(_mm_mul_pd(ax, bx), _mm_mul_pd(ay, by));
+    d = _mm_add_pd(d, _mm_mul_pd(az, bz));
+    _mm_storeu_pd(_out + i, d);
+  }
+  dot_n<double, 3>(_a + i, _b + i, _out + i, _n - i);
+}
+
+inline void cross_n(const Vec3d* _a, const Vec3d* _b, Vec3d* _out, size_t _n)
+{
+  size_t i = 0;
+  for (; i + 2 <= _n; i += 2) {
+    __m128d ax, ay, az, bx, by, bz;
+    Detail::load_vec3d_x2(_a[i].data(), ax, ay, az);
+    Detail::load_vec3d_x2(_b[i].data(), bx, by, bz);
+    Detail::store_vec3d_x2(_out[i].data(),
+                           _mm_sub_pd(_mm_mul_pd(ay, bz), _mm_mul_pd(az, by)),
+                           _mm_sub_pd(_mm_mul_pd(az, bx), _mm_mul_pd(ax, bz)),
+                           _mm_sub_pd(_mm_mul_pd(ax, by), _mm_mul_pd(ay, bx)));
+  }
+  cross_n<double>(_a + i, _b + i, _out + i, _n - i);
+}
+
+inline void normalize_n(Vec3d* _v, size_t _n)
+{
+  size_t i = 0;
+  for (; i + 2 <= _n; i += 2) {
+    __m128d x, y, z;
+    Detail::load_vec3d_x2(_v[i].data(), x, y, z);
+    __m128d sqr = _mm_add_pd(_mm_mul_pd(x, x), _mm_mul_pd(y, y));
+    sqr = _mm_add_pd(sqr, _mm_mul_pd(z, z));
+    const __m128d norm = _mm_sqrt_pd(sqr);
+    Detail::store_vec3d_x2(_v[i].data(),
+                           Detail::normalize_mask(x, norm),
+                           Detail::normalize_mask(y, norm),
+                           Detail::normalize_mask(z, norm));
+  }
+  normalize_n<double, 3>(_v + i, _n - i);
+}
+
+inline void dot_n(const Vec4d* _a, const Vec4d* _b, double* _out, size_t _n)
+{
+  size_t i = 0;
+  for (; i + 2 <= _n; i += 2) {
+    __m128d ax, ay, az, aw, bx, by, bz, bw;
+    Detail::load_vec4d_x2(_a[i].data(), ax, ay, az, aw);
+    Detail::load_vec4d_x2(_b[i].data(), bx, by, bz, bw);
+    __m128d d = _mm_add_pd(_mm_mul_pd(ax, bx), _mm_mul_pd(ay, by));
+    d = _mm_add_pd(d, _mm_mul_pd(az, bz));
+    d = _mm_add_pd(d, _mm_mul_pd(aw, bw));
+    _mm_storeu_pd(_out + i, d);
+  }
+  dot_n<double, 4>(_a + i, _b + i, _out + i, _n - i);
+}
+
+inline void normalize_n(Vec4d* _v, size_t _n)
+{
+  size_t i = 0;
+  for (; i + 2 <= _n; i += 2) {
+    __m128d x, y, z, w;
+    Detail::load_vec4d_x2(_v[i].data(), x, y, z, w);
+    __m128d sqr = _mm_add_pd(_mm_mul_pd(x, x), _mm_mul_pd(y, y));
+    sqr = _mm_add_pd(sqr, _mm_mul_pd(z, z));
+    sqr = _mm_add_pd(sqr, _mm_mul_pd(w, w));
+    const __m128d norm = _mm_sqrt_pd(sqr);
+    Detail::store_vec4d_x2(_v[i].data(),
+                           Detail::normalize_mask(x, norm),
+                           Detail::normalize_mask(y, norm),
+                           Detail::normalize_mask(z, norm),
+                           Detail::normalize_mask(w, norm));
+  }
+  normalize_n<double, 4>(_v + i, _n - i);
+}
+
+#endif // OM_VECTOR_BATCH_SSE
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_VECTORBATCHT_HH defined
+//=============================================================================
@@ -0,0 +1,333 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+//=============================================================================
+//
+//  CLASS AsciiOutBuffer - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+
+// -------------------- STL
+#include <algorithm>
+#include <clocale>
+#include <cstdio>
+#include <iostream>
+#include <locale>
+#if (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L) || __cplusplus >= 201703L
+#  include <charconv>
+#endif
+// -------------------- OpenMesh
+#include <OpenMesh/Core/IO/AsciiOutBuffer.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace IO {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+AsciiOutBuffer::
+AsciiOutBuffer(std::ostream& _out, size_t _capacity)
+  : os_(&_out), text_(0), good_(true), size_(0),
+    buffer_(std::max(_capacity, size_t(1024)))
+{
+  init(_out);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+AsciiOutBuffer::
+AsciiOutBuffer(const std::ostream& _format, std::string& _text, size_t _capacity)
+  : os_(0), text_(&_text), good_(true), size_(0),
+    buffer_(std::max(_capacity, size_t(1024)))
+{
+  init(_format);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+AsciiOutBuffer::
+~AsciiOutBuffer()
+{
+  flush();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+AsciiOutBuffer::
+init(const std::ostream& _format)
+{
+  format_.copyfmt(_format);
+  format_.exceptions(std::ios_base::goodbit);
+
+  precision_ = int(_format.precision());
+
+  const std::ios_base::fmtflags flags      = _format.flags();
+  const std::ios_base::fmtflags floatfield = flags & std::ios_base::floatfield;
+  const std::ios_base::fmtflags supported  =
+      std::ios_base::dec | std::ios_base::skipws | std::ios_base::boolalpha |
+      std::ios_base::adjustfield | std::ios_base::unitbuf |
+      std::ios_base::floatfield;
+
+  if (floatfield == std::ios_base::fixed)
+    float_field_ = Fixed;
+  else if (floatfield == std::ios_base::scientific)
+    float_field_ = Scientific;
+  else
+    float_field_ = General;
+
+  const std::numpunct<char>& punct = std::use_facet< std::numpunct<char> >(_format.getloc());
+
+  native_ = !(flags & ~supported) &&
+            floatfield != (std::ios_base::fixed | std::ios_base::scientific) &&
+            _format.width() == 0 &&
+            precision_ >= 0 && precision_ <= 64 &&
+            punct.decimal_point() == '.' &&
+            punct.grouping().empty();
+
+#if !defined(__cpp_lib_to_chars)
+  // snprintf uses the decimal point of the C locale
+  native_ = native_ && std::localeconv()->decimal_point[0] == '.';
+#endif
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool
+AsciiOutBuffer::
+flush()
+{
+  if (size_ > 0)
+  {
+    if (os_)
+      good_ = os_->write(buffer_.data(), std::streamsize(size_)).good() && good_;
+    else
+      text_->append(buffer_.data(), size_);
+    size_ = 0;
+  }
+  return good_;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+AsciiOutBuffer::
+put(const char* _s, size_t _n)
+{
+  if (_n > buffer_.size())
+  {
+    // large blocks bypass the buffer
+    flush();
+    if (os_)
+      good_ = os_->write(_s, std::streamsize(_n)).good() && good_;
+    else
+      text_->append(_s, _n);
+  }
+  else if (_n > 0)
+    std::memcpy(reserve(_n), _s, _n);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+AsciiOutBuffer::
+put(double _d)
+{
+  if (!native_)
+  {
+    put_stream(_d);
+    return;
+  }
+
+  // fixed notation of the largest double plus the requested digits
+  const size_t max_len = 330 + size_t(precision_);
+  char* dst = reserve(max_len);
+
+#if defined(__cpp_lib_to_chars)
+  std::chars_format format = std::chars_format::general;
+  if (float_field_ == Fixed)
+    format = std::chars_format::fixed;
+  else if (float_field_ == Scientific)
+    format = std::chars_format::scientific;
+
+  const std::to_chars_result res = std::to_chars(dst, dst + max_len, _d, format, precision_);
+  const size_t len = size_t(res.ptr - dst);
+#else
+  const char* format = "%.*g";
+  if (float_field_ == Fixed)
+    format = "%.*f";
+  else if (float_field_ == Scientific)
+    format = "%.*e";
+
+  const size_t len = size_t(snprintf(dst, max_len, format, precision_, _d));
+#endif
+
+  size_ -= max_len - len;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+AsciiOutBuffer::
+put_signed(long long _i)
+{
+  if (!native_)
+  {
+    put_stream(_i);
+    return;
+  }
+
+  char  digits[24];
+  char* end = digits + sizeof(digits);
+  char* p   = end;
+
+  unsigned long long u = _i < 0 ? 0ull - static_cast<unsigned long long>(_i)
+                                : static_cast<unsigned long long>(_i);
+  do
+  {
+    *--p = char('0' + u % 10);
+    u /= 10;
+  } while (u);
+
+  if (_i < 0)
+    *--p = '-';
+
+  put(p, size_t(end - p));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void
+AsciiOutBuffer::
+put_unsigned(unsigned long long _i)
+{
+  if (!native_)
+  {
+    put_stream(_i);
+    return;
+  }
+
+  char  digits[24];
+  char* end = digits + sizeof(digits);
+  char* p   = end;
+
+  do
+  {
+    *--p = char('0' + _i % 10);
+    _i /= 10;
+  } while (_i);
+
+  put(p, size_t(end - p));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void format_parallel(AsciiOutBuffer& _out, size_t _n,
+                     const std::function<void(AsciiOutBuffer&, size_t, size_t)>& _format,
+                     size_t _chunk, unsigned int _threads)
+{
+  _chunk = std::max(_chunk, size_t(1));
+  const size_t n_threads = ThreadPool::global().max_threads(_threads);
+
+  if (n_threads < 2 || _n <= _chunk)
+  {
+    _format(_out, 0, _n);
+    return;
+  }
+
+  std::vector<std::string> texts(n_threads);
+
+  // format n_threads chunks at once, then write them in order
+  for (size_t first = 0; first < _n; first += n_threads * _chunk)
+  {
+    const size_t n_chunks = std::min(n_threads, (_n - first + _chunk - 1) / _chunk);
+
+    parallel_for(n_chunks, 1, [&](size_t _first_chunk, size_t _last_chunk) {
+      for (size_t t = _first_chunk; t < _last_chunk; ++t)
+      {
+        const size_t begin = first + t * _chunk;
+        texts[t].clear();
+        AsciiOutBuffer buffer(_out.format(), texts[t]);
+        _format(buffer, begin, std::min(begin + _chunk, _n));
+      }
+    }, _threads);
+
+    for (size_t t = 0; t < n_chunks; ++t)
+      _out.put(texts[t]);
+  }
+}
+
+
+//=============================================================================
+} // namespace IO
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,231 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+//=============================================================================
+//
+//  CLASS AsciiOutBuffer
+//
+//=============================================================================
+
+#ifndef OPENMESH_IO_ASCIIOUTBUFFER_HH
+#define OPENMESH_IO_ASCIIOUTBUFFER_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+// -------------------- STL
+#include <cstring>
+#include <functional>
+#include <iosfwd>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace IO {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Buffered text output shared by the ASCII writers.
+
+    Numbers are formatted exactly like the target stream would format
+    them (precision, fixed/scientific/default float field), but without
+    going through the locale aware stream machinery: floating point
+    values use std::to_chars (or snprintf without C++17), integers a
+    plain digit loop. Streams with flags that cannot be reproduced
+    (showpos, hex, a locale with another decimal point, ...) fall back
+    to formatting each number through a stream with the same settings,
+    so the output is always the same as writing to the stream directly.
+
+    The text is collected in a buffer and written in large blocks. Data
+    written to the stream directly must be preceded by a flush().
+    The buffer captures the stream format on construction, later
+    changes of the stream flags are not seen.
+*/
+class OPENMESHDLLEXPORT AsciiOutBuffer
+{
+public:
+
+  /// Buffer writing to \c _out, using its number format.
+  explicit AsciiOutBuffer(std::ostream& _out, size_t _capacity = 1 << 16);
+
+  /// Buffer appending to \c _text, using the number format of \c _format.
+  AsciiOutBuffer(const std::ostream& _format, std::string& _text,
+                 size_t _capacity = 1 << 16);
+
+  /// Flushes the remaining text.
+  ~AsciiOutBuffer();
+
+  /// Write the buffered text to the target. Returns false on write errors.
+  bool flush();
+
+  /// Can numbers be formatted without the stream?
+  bool native() const { return native_; }
+
+  /// Stream holding the captured number format
+  const std::ostream& format() const { return format_; }
+
+public:
+
+  void put(char _c)
+  {
+    *reserve(1) = _c;
+  }
+
+  void put(const char* _s)
+  {
+    put(_s, std::strlen(_s));
+  }
+
+  void put(const std::string& _s)
+  {
+    put(_s.data(), _s.size());
+  }
+
+  void put(const char* _s, size_t _n);
+
+  void put(int _i)                { put_signed(_i); }
+  void put(long _i)               { put_signed(_i); }
+  void put(long long _i)          { put_signed(_i); }
+  void put(unsigned int _i)       { put_unsigned(_i); }
+  void put(unsigned long _i)      { put_unsigned(_i); }
+  void put(unsigned long long _i) { put_unsigned(_i); }
+
+  /// Floats are formatted like doubles, as std::ostream does.
+  void put(float _f)  { put(double(_f)); }
+  void put(double _d);
+
+  /// Space separated components, as operator<< of VectorT
+  template <typename Scalar, int N>
+  void put(const VectorT<Scalar, N>& _v)
+  {
+    put(_v[0]);
+    for (int i = 1; i < N; ++i)
+    {
+      put(' ');
+      put(_v[i]);
+    }
+  }
+
+private:
+
+  void put_signed(long long _i);
+  void put_unsigned(unsigned long long _i);
+
+  /// Format through the stream with the captured settings
+  template <typename T>
+  void put_stream(const T& _value)
+  {
+    format_.str(std::string());
+    format_ << _value;
+    put(format_.str());
+  }
+
+  /// Make room for \c _n bytes and return the write position.
+  char* reserve(size_t _n)
+  {
+    if (size_ + _n > buffer_.size())
+    {
+      flush();
+      if (_n > buffer_.size())
+        buffer_.resize(_n);
+    }
+    char* dst = &buffer_[size_];
+    size_ += _n;
+    return dst;
+  }
+
+  void init(const std::ostream& _format);
+
+  AsciiOutBuffer(const AsciiOutBuffer&);
+  AsciiOutBuffer& operator=(const AsciiOutBuffer&);
+
+private:
+
+  enum FloatField { General, Fixed, Scientific };
+
+  std::ostream*      os_;
+  std::string*       text_;
+  bool               good_;
+  bool               native_;
+  FloatField         float_field_;
+  int                precision_;
+  size_t             size_;
+  std::vector<char>  buffer_;
+  std::ostringstream format_;
+};
+
+
+//-----------------------------------------------------------------------------
+
+
+/** Format the records [0, _n) with \c _format(buffer, first, last) and
+    append them to \c _out in order.
+
+    The range is split into chunks of \c _chunk records which are
+    formatted in parallel into separate buffers and then written in
+    sequence, so the output is the same as for a single call
+    \c _format(_out, 0, _n). \c _format is called concurrently and must
+    only read shared data. The chunks are formatted on the global
+    ThreadPool using at most \c _threads threads (0: no limit).
+*/
+OPENMESHDLLEXPORT
+void format_parallel(AsciiOutBuffer& _out, size_t _n,
+                     const std::function<void(AsciiOutBuffer&, size_t, size_t)>& _format,
+                     size_t _chunk = 1 << 14, unsigned int _threads = 0);
+
+
+//=============================================================================
+} // namespace IO
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_IO_ASCIIOUTBUFFER_HH defined
+//=============================================================================
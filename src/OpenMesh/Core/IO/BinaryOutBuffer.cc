@@ -0,0 +1,227 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+//=============================================================================
+//
+//  CLASS BinaryOutBuffer - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+
+// -------------------- STL
+#include <algorithm>
+#include <iostream>
+#include <stdint.h>
+// -------------------- OpenMesh
+#include <OpenMesh/Core/IO/BinaryOutBuffer.hh>
+// -------------------- SIMD
+#if defined(__GNUC__) && defined(__SSSE3__)
+#  include <tmmintrin.h>
+#endif
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace IO {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+namespace {
+
+#if defined(__GNUC__) && defined(__SSSE3__)
+
+// Reverse the bytes of all _size byte lanes of 16 byte blocks, returns
+// the number of values processed.
+size_t swap_bytes_sse(unsigned char* _data, size_t _n, size_t _size)
+{
+  __m128i mask;
+  switch (_size)
+  {
+    case 2:  mask = _mm_setr_epi8(1,0, 3,2, 5,4, 7,6, 9,8, 11,10, 13,12, 15,14); break;
+    case 4:  mask = _mm_setr_epi8(3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12);     break;
+    case 8:  mask = _mm_setr_epi8(7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8);       break;
+    default: return 0;
+  }
+
+  const size_t per_block = 16 / _size;
+  const size_t n_blocks  = _n / per_block;
+
+  for (size_t i = 0; i < n_blocks; ++i, _data += 16)
+  {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_data));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(_data), _mm_shuffle_epi8(v, mask));
+  }
+
+  return n_blocks * per_block;
+}
+
+#endif
+
+} // anonymous namespace
+
+
+//-----------------------------------------------------------------------------
+
+
+void swap_bytes(void* _data, size_t _n, size_t _size)
+{
+  unsigned char* data = static_cast<unsigned char*>(_data);
+
+  if (_size < 2)
+    return;
+
+#if defined(__GNUC__) && defined(__SSSE3__)
+  const size_t done = swap_bytes_sse(data, _n, _size);
+  data += done * _size;
+  _n   -= done;
+#endif
+
+  switch (_size)
+  {
+    case 4:
+      // written with shifts so that the compiler can vectorize it
+      for (size_t i = 0; i < _n; ++i, data += 4)
+      {
+        uint32_t v;
+        std::memcpy(&v, data, 4);
+        v = (v >> 24) | ((v >> 8) & 0x0000ff00u) | ((v << 8) & 0x00ff0000u) | (v << 24);
+        std::memcpy(data, &v, 4);
+      }
+      break;
+
+    default:
+      for (size_t i = 0; i < _n; ++i, data += _size)
+        std::reverse(data, data + _size);
+      break;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+BinaryOutBuffer::
+BinaryOutBuffer(std::ostream& _out, bool _swap, size_t _capacity)
+  : os_(&_out), file_(0), swap_(_swap), good_(true),
+    capacity_(std::max(_capacity, size_t(64))), size_(0),
+    buffer_(capacity_)
+{
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+BinaryOutBuffer::
+BinaryOutBuffer(FILE* _out, bool _swap, size_t _capacity)
+  : os_(0), file_(_out), swap_(_swap), good_(true),
+    capacity_(std::max(_capacity, size_t(64))), size_(0),
+    buffer_(capacity_)
+{
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+BinaryOutBuffer::
+~BinaryOutBuffer()
+{
+  flush();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool
+BinaryOutBuffer::
+flush()
+{
+  if (size_ > 0)
+  {
+    if (os_)
+      good_ = os_->write(buffer_.data(), std::streamsize(size_)).good() && good_;
+    else
+      good_ = fwrite(buffer_.data(), 1, size_, file_) == size_ && good_;
+    size_ = 0;
+  }
+  return good_;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+size_t
+BinaryOutBuffer::
+put_bytes(const void* _data, size_t _n)
+{
+  if (_n > capacity_)
+  {
+    // large blocks bypass the buffer
+    flush();
+    if (os_)
+      good_ = os_->write(static_cast<const char*>(_data), std::streamsize(_n)).good() && good_;
+    else
+      good_ = fwrite(_data, 1, _n, file_) == _n && good_;
+  }
+  else
+    std::memcpy(reserve(_n), _data, _n);
+
+  return _n;
+}
+
+
+//=============================================================================
+} // namespace IO
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,211 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+//=============================================================================
+//
+//  CLASS BinaryOutBuffer
+//
+//=============================================================================
+
+#ifndef OPENMESH_IO_BINARYOUTBUFFER_HH
+#define OPENMESH_IO_BINARYOUTBUFFER_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+// -------------------- STL
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iosfwd>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace IO {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Reverse the byte order of \c _n consecutive values of \c _size bytes
+    each in place. Values of 2, 4 and 8 bytes are swapped with SSSE3
+    shuffles when available.
+*/
+OPENMESHDLLEXPORT
+void swap_bytes(void* _data, size_t _n, size_t _size);
+
+
+/** Buffered binary output shared by the binary writers.
+
+    Values are collected in a byte buffer, byte swapped block wise if
+    required and handed to the target stream or file in large writes,
+    instead of one stream call per scalar.
+
+    \code
+    BinaryOutBuffer out(_os, swap);
+    for (size_t i = 0; i < n; ++i)
+      bytes += out.put(points[i]);
+    out.flush();
+    \endcode
+
+    The buffer is flushed on destruction. Data written to the target
+    directly must be preceded by a flush().
+*/
+class OPENMESHDLLEXPORT BinaryOutBuffer
+{
+public:
+
+  /// Buffer writing to a stream.
+  explicit BinaryOutBuffer(std::ostream& _out, bool _swap = false,
+                           size_t _capacity = 1 << 16);
+
+  /// Buffer writing to a file opened with fopen().
+  explicit BinaryOutBuffer(FILE* _out, bool _swap = false,
+                           size_t _capacity = 1 << 16);
+
+  /// Flushes the remaining data.
+  ~BinaryOutBuffer();
+
+  /// Write the buffered data to the target. Returns false on write errors.
+  bool flush();
+
+  /// Are values byte swapped?
+  bool swap() const { return swap_; }
+
+  /// Did all writes to the target succeed so far?
+  bool good() const { return good_; }
+
+public:
+
+  /// Append \c _n values. Returns the number of bytes written.
+  template <typename T>
+  size_t put(const T* _values, size_t _n)
+  {
+    const size_t bytes = _n * sizeof(T);
+    const size_t chunk = capacity_ / sizeof(T);
+
+    if (chunk == 0)
+    {
+      // values larger than the buffer bypass it one by one
+      if (!swap_)
+        return put_bytes(_values, bytes);
+
+      std::vector<char> value(sizeof(T));
+      for (size_t i = 0; i < _n; ++i)
+      {
+        std::memcpy(value.data(), _values + i, sizeof(T));
+        swap_bytes(value.data(), 1, sizeof(T));
+        put_bytes(value.data(), sizeof(T));
+      }
+      return bytes;
+    }
+
+    while (_n > 0)
+    {
+      const size_t n = std::min(_n, chunk);
+      char* dst = reserve(n * sizeof(T));
+      std::memcpy(dst, _values, n * sizeof(T));
+      if (swap_ && sizeof(T) > 1)
+        swap_bytes(dst, n, sizeof(T));
+      _values += n;
+      _n      -= n;
+    }
+    return bytes;
+  }
+
+  /// Append a single value.
+  template <typename T>
+  size_t put(const T& _value)
+  {
+    return put(&_value, 1);
+  }
+
+  /// Append all components of a vector.
+  template <typename Scalar, int N>
+  size_t put(const VectorT<Scalar, N>& _v)
+  {
+    return put(_v.data(), N);
+  }
+
+  /// Append raw bytes, never swapped.
+  size_t put_bytes(const void* _data, size_t _n);
+
+private:
+
+  /// Make room for \c _n bytes and return the write position.
+  char* reserve(size_t _n)
+  {
+    if (size_ + _n > capacity_)
+      flush();
+    char* dst = &buffer_[size_];
+    size_ += _n;
+    return dst;
+  }
+
+  BinaryOutBuffer(const BinaryOutBuffer&);
+  BinaryOutBuffer& operator=(const BinaryOutBuffer&);
+
+private:
+
+  std::ostream*     os_;
+  FILE*             file_;
+  bool              swap_;
+  bool              good_;
+  size_t            capacity_;
+  size_t            size_;
+  std::vector<char> buffer_;
+};
+
+
+//=============================================================================
+} // namespace IO
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_IO_BINARYOUTBUFFER_HH defined
+//=============================================================================
@@ -324,9 +324,9 @@ struct FunctorRestore {
   bool          swap_;
 };
 
-template <typename T>
-struct binary< std::vector< T >, typename std::enable_if<std::is_default_constructible<T>::value>::type > {
-  typedef std::vector< T >       value_type;
+template <typename T, typename A>
+struct binary< std::vector< T, A >, typename std::enable_if<std::is_default_constructible<T>::value && !std::is_same<T, bool>::value>::type > {
+  typedef std::vector< T, A >    value_type;
   typedef typename value_type::value_type elem_type;
 
   static const bool is_streamable = binary<T>::is_streamable;
@@ -1,8 +1,8 @@
 
-template <> struct binary< std::vector<bool> >
+template <typename A> struct binary< std::vector<bool, A> >
 {
-  typedef std::vector< bool >    value_type;
-  typedef value_type::value_type elem_type;
+  typedef std::vector< bool, A >          value_type;
+  typedef typename value_type::value_type elem_type;
 
   static const bool is_streamable = true;
 
@@ -89,9 +89,9 @@ template <typename T> inline
 size_t size_of( const T& _v ) 
 { return binary< T >::size_of(_v); }
 
-template <typename T> inline
-size_t size_of( const std::vector<T> & _v, bool _store_size = true)
-{ return binary< std::vector<T> >::size_of(_v, _store_size); }
+template <typename T, typename A> inline
+size_t size_of( const std::vector<T, A> & _v, bool _store_size = true)
+{ return binary< std::vector<T, A> >::size_of(_v, _store_size); }
 
 template <typename T> inline
 size_t size_of(void) 
@@ -105,17 +105,17 @@ template <typename T> inline
 size_t store( std::ostream& _os, const T& _v, bool _swap  =false)
 { return binary< T >::store( _os, _v, _swap ); }
 
-template <typename T> inline
-size_t store( std::ostream& _os, const std::vector<T>& _v, bool _swap=false, bool _store_size = true)
-{ return binary< std::vector<T> >::store( _os, _v, _swap, _store_size); }
+template <typename T, typename A> inline
+size_t store( std::ostream& _os, const std::vector<T, A>& _v, bool _swap=false, bool _store_size = true)
+{ return binary< std::vector<T, A> >::store( _os, _v, _swap, _store_size); }
 
 template <typename T> inline
 size_t restore( std::istream& _is, T& _v, bool _swap = false)
 { return binary< T >::restore( _is, _v, _swap ); }
 
-template <typename T> inline
-size_t restore( std::istream& _is, std::vector<T>& _v, bool _swap=false, bool _restore_size = true)
-{ return binary< std::vector<T> >::restore( _is, _v, _swap, _restore_size); }
+template <typename T, typename A> inline
+size_t restore( std::istream& _is, std::vector<T, A>& _v, bool _swap=false, bool _restore_size = true)
+{ return binary< std::vector<T, A> >::restore( _is, _v, _swap, _restore_size); }
 
 //@}
 
@@ -57,6 +57,7 @@
 
 
 // STL
+#include <algorithm>
 #include <vector>
 
 // OpenMesh
@@ -170,6 +171,209 @@ public:
   virtual bool has_face_normals()     const { return false; }
   virtual bool has_face_colors()      const { return false; }
   virtual bool has_face_status()      const { return false; }
+
+  /** May the writers call the const functions of this interface from
+   *  several threads at once? The ASCII writers format the vertices on the
+   *  global ThreadPool if so. Exporters whose accessors modify shared
+   *  state keep the default and are written serially, ExporterT only
+   *  reads the mesh and enables it.
+   */
+  virtual bool concurrent_access()    const { return false; }
+
+
+  // --- bulk access ---
+  //
+  // Copy the data of the elements [_first, _first+_n) to _out, which has
+  // room for _n entries. The defaults use the single element functions
+  // above, ExporterT overrides them with direct loops over the mesh. Use
+  // BulkReaderT to iterate over elements with them.
+
+  // get vertex data
+  virtual void points(size_t _first, size_t _n, Vec3f* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = point(vh(_first + i)); }
+  virtual void points(size_t _first, size_t _n, Vec3d* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = pointd(vh(_first + i)); }
+  virtual void normals(size_t _first, size_t _n, Vec3f* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = normal(vh(_first + i)); }
+  virtual void normals(size_t _first, size_t _n, Vec3d* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = normald(vh(_first + i)); }
+  virtual void colors(size_t _first, size_t _n, Vec3uc* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = color(vh(_first + i)); }
+  virtual void colors(size_t _first, size_t _n, Vec4uc* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = colorA(vh(_first + i)); }
+  virtual void colors(size_t _first, size_t _n, Vec3ui* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = colori(vh(_first + i)); }
+  virtual void colors(size_t _first, size_t _n, Vec4ui* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = colorAi(vh(_first + i)); }
+  virtual void colors(size_t _first, size_t _n, Vec3f* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = colorf(vh(_first + i)); }
+  virtual void colors(size_t _first, size_t _n, Vec4f* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = colorAf(vh(_first + i)); }
+  virtual void texcoords(size_t _first, size_t _n, Vec2f* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = texcoord(vh(_first + i)); }
+
+  // get face data
+  virtual void face_normals(size_t _first, size_t _n, Vec3f* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = normal(fh(_first + i)); }
+  virtual void face_normals(size_t _first, size_t _n, Vec3d* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = normald(fh(_first + i)); }
+  virtual void face_colors(size_t _first, size_t _n, Vec3uc* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = color(fh(_first + i)); }
+  virtual void face_colors(size_t _first, size_t _n, Vec4uc* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = colorA(fh(_first + i)); }
+  virtual void face_colors(size_t _first, size_t _n, Vec3ui* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = colori(fh(_first + i)); }
+  virtual void face_colors(size_t _first, size_t _n, Vec4ui* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = colorAi(fh(_first + i)); }
+  virtual void face_colors(size_t _first, size_t _n, Vec3f* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = colorf(fh(_first + i)); }
+  virtual void face_colors(size_t _first, size_t _n, Vec4f* _out) const
+  { for (size_t i = 0; i < _n; ++i) _out[i] = colorAf(fh(_first + i)); }
+
+  /** Vertex indices of the faces [_first, _first+_n). Face i has the
+   *  indices [_offsets[i], _offsets[i+1]) of _indices, _offsets gets _n+1
+   *  entries.
+   */
+  virtual void face_indices(size_t _first, size_t _n,
+                            std::vector<size_t>& _offsets,
+                            std::vector<int>& _indices) const
+  {
+    std::vector<VertexHandle> vhandles;
+    _offsets.assign(1, 0);
+    _indices.clear();
+    for (size_t i = 0; i < _n; ++i)
+    {
+      get_vhandles(fh(_first + i), vhandles);
+      for (size_t j = 0; j < vhandles.size(); ++j)
+        _indices.push_back(vhandles[j].idx());
+      _offsets.push_back(_indices.size());
+    }
+  }
+
+  /** Triangle fast path of face_indices(), writes three vertex indices
+   *  per face to _out. Returns false if one of the faces is not a
+   *  triangle or, for ExporterT, deleted, the content of _out is undefined
+   *  then.
+   */
+  virtual bool triangle_indices(size_t _first, size_t _n, int* _out) const
+  {
+    std::vector<VertexHandle> vhandles;
+    for (size_t i = 0; i < _n; ++i, _out += 3)
+    {
+      if (get_vhandles(fh(_first + i), vhandles) != 3)
+        return false;
+      _out[0] = vhandles[0].idx();
+      _out[1] = vhandles[1].idx();
+      _out[2] = vhandles[2].idx();
+    }
+    return true;
+  }
+
+protected:
+
+  static VertexHandle vh(size_t _idx) { return VertexHandle(int(_idx)); }
+  static FaceHandle   fh(size_t _idx) { return FaceHandle(int(_idx)); }
+};
+
+
+//=== BULK READERS ============================================================
+
+
+/** Sequential access to one of the bulk functions of BaseExporter.
+ *
+ *  The data is fetched in chunks on demand, so writers keep their loops
+ *  over the elements but pay one virtual call per chunk instead of one
+ *  per element.
+ *
+ *  \code
+ *  BulkReaderT<Vec3f> points(_be, &BaseExporter::points, _be.n_vertices());
+ *  for (size_t i = 0; i < _be.n_vertices(); ++i)
+ *    write(points[i]);
+ *  \endcode
+ */
+template <class T>
+class BulkReaderT
+{
+public:
+
+  typedef void (BaseExporter::*Function)(size_t, size_t, T*) const;
+
+  BulkReaderT(const BaseExporter& _be, Function _function, size_t _n,
+              size_t _chunk_size = 4096)
+  : be_(_be), function_(_function), n_(_n), chunk_size_(_chunk_size),
+    first_(0), count_(0)
+  {}
+
+  /// Data of element _idx, sequential access is fastest
+  const T& operator[](size_t _idx)
+  {
+    if (_idx < first_ || _idx >= first_ + count_)
+    {
+      // allocated on first use, unused readers cost nothing
+      data_.resize(std::min(n_, chunk_size_));
+      first_ = _idx;
+      count_ = std::min(data_.size(), n_ - _idx);
+      (be_.*function_)(first_, count_, data_.data());
+    }
+    return data_[_idx - first_];
+  }
+
+private:
+
+  const BaseExporter& be_;
+  Function            function_;
+  size_t              n_, chunk_size_, first_, count_;
+  std::vector<T>      data_;
+};
+
+
+/** Sequential access to the vertex indices of the faces, see
+ *  BaseExporter::face_indices(). Uses the triangle fast path for
+ *  triangle meshes.
+ */
+class FaceIndexReader
+{
+public:
+
+  explicit FaceIndexReader(const BaseExporter& _be, size_t _chunk_size = 4096)
+  : be_(_be), n_(_be.n_faces()), chunk_size_(_chunk_size), first_(0), count_(0),
+    triangles_(_be.is_triangle_mesh())
+  {}
+
+  /// Number of vertices of face _idx, _indices points to their indices
+  unsigned int get(size_t _idx, const int*& _indices)
+  {
+    if (_idx < first_ || _idx >= first_ + count_)
+    {
+      first_ = _idx;
+      count_ = std::min(chunk_size_, n_ - _idx);
+
+      if (triangles_)
+      {
+        indices_.resize(3 * count_);
+        triangles_ = be_.triangle_indices(first_, count_, indices_.data());
+      }
+      if (!triangles_)
+        be_.face_indices(first_, count_, offsets_, indices_);
+    }
+
+    const size_t i = _idx - first_;
+    if (triangles_)
+    {
+      _indices = indices_.data() + 3 * i;
+      return 3;
+    }
+    _indices = indices_.data() + offsets_[i];
+    return static_cast<unsigned int>(offsets_[i+1] - offsets_[i]);
+  }
+
+private:
+
+  const BaseExporter&  be_;
+  size_t               n_, chunk_size_, first_, count_;
+  bool                 triangles_;
+  std::vector<size_t>  offsets_;
+  std::vector<int>     indices_;
 };
 
 
@@ -408,6 +408,89 @@ public:
   bool has_face_colors()      const override { return mesh_.has_face_colors();      }
   bool has_face_status()      const override { return mesh_.has_face_status();      }
 
+  bool concurrent_access()    const override { return true; }
+
+
+  // bulk access, non-virtual calls of the single element functions
+
+  void points(size_t _first, size_t _n, Vec3f* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::point(vh(_first + i)); }
+  void points(size_t _first, size_t _n, Vec3d* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::pointd(vh(_first + i)); }
+  void normals(size_t _first, size_t _n, Vec3f* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::normal(vh(_first + i)); }
+  void normals(size_t _first, size_t _n, Vec3d* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::normald(vh(_first + i)); }
+  void colors(size_t _first, size_t _n, Vec3uc* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::color(vh(_first + i)); }
+  void colors(size_t _first, size_t _n, Vec4uc* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::colorA(vh(_first + i)); }
+  void colors(size_t _first, size_t _n, Vec3ui* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::colori(vh(_first + i)); }
+  void colors(size_t _first, size_t _n, Vec4ui* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::colorAi(vh(_first + i)); }
+  void colors(size_t _first, size_t _n, Vec3f* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::colorf(vh(_first + i)); }
+  void colors(size_t _first, size_t _n, Vec4f* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::colorAf(vh(_first + i)); }
+  void texcoords(size_t _first, size_t _n, Vec2f* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::texcoord(vh(_first + i)); }
+
+  void face_normals(size_t _first, size_t _n, Vec3f* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::normal(fh(_first + i)); }
+  void face_normals(size_t _first, size_t _n, Vec3d* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::normald(fh(_first + i)); }
+  void face_colors(size_t _first, size_t _n, Vec3uc* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::color(fh(_first + i)); }
+  void face_colors(size_t _first, size_t _n, Vec4uc* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::colorA(fh(_first + i)); }
+  void face_colors(size_t _first, size_t _n, Vec3ui* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::colori(fh(_first + i)); }
+  void face_colors(size_t _first, size_t _n, Vec4ui* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::colorAi(fh(_first + i)); }
+  void face_colors(size_t _first, size_t _n, Vec3f* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::colorf(fh(_first + i)); }
+  void face_colors(size_t _first, size_t _n, Vec4f* _out) const override
+  { for (size_t i = 0; i < _n; ++i) _out[i] = ExporterT::colorAf(fh(_first + i)); }
+
+  void face_indices(size_t _first, size_t _n,
+                    std::vector<size_t>& _offsets,
+                    std::vector<int>& _indices) const override
+  {
+    _offsets.resize(_n + 1);
+    _offsets[0] = 0;
+    _indices.clear();
+    for (size_t i = 0; i < _n; ++i)
+    {
+      for (typename Mesh::CFVIter fv_it=mesh_.cfv_iter(fh(_first + i)); fv_it.is_valid(); ++fv_it)
+        _indices.push_back((*fv_it).idx());
+      _offsets[i+1] = _indices.size();
+    }
+  }
+
+  bool triangle_indices(size_t _first, size_t _n, int* _out) const override
+  {
+    for (size_t i = 0; i < _n; ++i, _out += 3)
+    {
+      // the halfedges of deleted faces may have been relinked, leave
+      // them to face_indices()
+      if (mesh_.has_face_status() && mesh_.status(fh(_first + i)).deleted())
+        return false;
+
+      // same order as the face vertex circulator
+      typename Mesh::HalfedgeHandle heh = mesh_.halfedge_handle(fh(_first + i));
+      _out[0] = mesh_.to_vertex_handle(heh).idx();
+      heh = mesh_.next_halfedge_handle(heh);
+      _out[1] = mesh_.to_vertex_handle(heh).idx();
+      heh = mesh_.next_halfedge_handle(heh);
+      _out[2] = mesh_.to_vertex_handle(heh).idx();
+
+      if (!Mesh::is_triangles() && mesh_.next_halfedge_handle(heh) != mesh_.halfedge_handle(fh(_first + i)))
+        return false;
+    }
+    return true;
+  }
+
 private:
 
    const Mesh& mesh_;
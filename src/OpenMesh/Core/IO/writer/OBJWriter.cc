@@ -50,6 +50,7 @@
 #include <limits>
 
 // OpenMesh
+#include <OpenMesh/Core/IO/AsciiOutBuffer.hh>
 #include <OpenMesh/Core/IO/BinaryHelper.hh>
 #include <OpenMesh/Core/IO/writer/OBJWriter.hh>
 #include <OpenMesh/Core/IO/IOManager.hh>
@@ -166,6 +167,9 @@ writeMaterial(std::ostream& _out, BaseExporter& _be, Options _opt) const
   OpenMesh::Vec3f c;
   OpenMesh::Vec4f cA;
 
+  BulkReaderT<Vec3uc> colors (_be, &BaseExporter::face_colors, _be.n_faces());
+  BulkReaderT<Vec4uc> colorsA(_be, &BaseExporter::face_colors, _be.n_faces());
+
   material_.clear();
   material_idx_.clear();
   materialA_.clear();
@@ -176,11 +180,11 @@ writeMaterial(std::ostream& _out, BaseExporter& _be, Options _opt) const
   {
     //color with alpha
     if ( _opt.color_has_alpha() ){
-      cA  = color_cast<OpenMesh::Vec4f> (_be.colorA( FaceHandle(int(i)) ));
+      cA  = color_cast<OpenMesh::Vec4f> (colorsA[i]);
       getMaterial(cA);
     }else{
     //and without alpha
-      c  = color_cast<OpenMesh::Vec3f> (_be.color( FaceHandle(int(i)) ));
+      c  = color_cast<OpenMesh::Vec3f> (colors[i]);
       getMaterial(c);
     }
   }
@@ -216,8 +220,7 @@ _OBJWriter_::
 write(std::ostream& _out, BaseExporter& _be, const Options& _writeOptions, std::streamsize _precision) const
 {
   unsigned int idx;
-  VertexHandle vh;
-  std::vector<VertexHandle> vhandles;
+  const int* vidx;
   bool useMatrial = false;
   OpenMesh::Vec3f c;
   OpenMesh::Vec4f cA;
@@ -275,6 +278,8 @@ write(std::ostream& _out, BaseExporter& _be, const Options& _writeOptions, std::
   if ( (useMatrial &&  _writeOptions.check(Options::FaceColor)) || _writeOptions.texture_file != "")
     _out << "mtllib " << objName_ << _writeOptions.material_file_extension << '\n';
 
+  AsciiOutBuffer out(_out);
+
   std::map<Vec2f,int> texMap;
   //collect Texturevertices from halfedges
   if(_writeOptions.check(Options::FaceTexCoord))
@@ -291,10 +296,10 @@ write(std::ostream& _out, BaseExporter& _be, const Options& _writeOptions, std::
   //collect Texture coordinates from vertices
   if(_writeOptions.check(Options::VertexTexCoord))
   {
+    BulkReaderT<Vec2f> texcoords(_be, &BaseExporter::texcoords, _be.n_vertices());
     for (size_t i=0, nV=_be.n_vertices(); i<nV; ++i)
     {
-      vh = VertexHandle(static_cast<int>(i));
-      Vec2f t  = _be.texcoord(vh);
+      Vec2f t  = texcoords[i];
       texMap[t] = static_cast<int>(i);
     }
   }
@@ -306,33 +311,44 @@ write(std::ostream& _out, BaseExporter& _be, const Options& _writeOptions, std::
     int texCount = 0;
     for(std::map<Vec2f,int>::iterator it = texMap.begin(); it != texMap.end() ; ++it)
     {
-      _out << "vt " << it->first[0] << " " << it->first[1] << '\n';
+      out.put("vt ");
+      out.put(it->first);
+      out.put('\n');
       it->second = ++texCount;
     }
   }
 
+  // vertices, formatted in parallel
   const bool normal_double = _be.is_normal_double();
   const bool point_double = _be.is_point_double();
-  for (size_t i=0, nV=_be.n_vertices(); i<nV; ++i)
+  const bool vertex_normal = _writeOptions.check(Options::VertexNormal);
+
+  format_parallel(out, _be.n_vertices(), [&](AsciiOutBuffer& _buf, size_t _first, size_t _last)
   {
-      vh = VertexHandle(int(i));
-      if (point_double) {
-          auto v = _be.pointd(vh);
-          _out << "v " << v[0] <<" "<< v[1] <<" "<< v[2] << '\n';
-      } else {
-          auto v = _be.point(vh);
-          _out << "v " << v[0] <<" "<< v[1] <<" "<< v[2] << '\n';
-      }
-      if (_writeOptions.check(Options::VertexNormal)) {
-        if (normal_double) {
-            auto n = _be.normald(vh);
-            _out << "vn " << n[0] <<" "<< n[1] <<" "<< n[2] << '\n';
-        } else {
-            auto n = _be.normal(vh);
-            _out << "vn " << n[0] <<" "<< n[1] <<" "<< n[2] << '\n';
-        }
+    BulkReaderT<Vec3f> points  (_be, &BaseExporter::points,  _be.n_vertices());
+    BulkReaderT<Vec3d> pointsd (_be, &BaseExporter::points,  _be.n_vertices());
+    BulkReaderT<Vec3f> normals (_be, &BaseExporter::normals, _be.n_vertices());
+    BulkReaderT<Vec3d> normalsd(_be, &BaseExporter::normals, _be.n_vertices());
+
+    for (size_t i=_first; i<_last; ++i)
+    {
+      _buf.put("v ");
+      if (point_double)
+        _buf.put(pointsd[i]);
+      else
+        _buf.put(points[i]);
+      _buf.put('\n');
+
+      if (vertex_normal) {
+        _buf.put("vn ");
+        if (normal_double)
+          _buf.put(normalsd[i]);
+        else
+          _buf.put(normals[i]);
+        _buf.put('\n');
       }
-  }
+    }
+  }, 1 << 14, _be.concurrent_access() ? 0 : 1);
 
   size_t lastMat = std::numeric_limits<std::size_t>::max();
 
@@ -341,6 +357,10 @@ write(std::ostream& _out, BaseExporter& _be, const Options& _writeOptions, std::
                       && !_writeOptions.check(Options::VertexNormal)
                       && !_writeOptions.check(Options::FaceTexCoord);
 
+  BulkReaderT<Vec3uc> fcolors (_be, &BaseExporter::face_colors, _be.n_faces());
+  BulkReaderT<Vec4uc> fcolorsA(_be, &BaseExporter::face_colors, _be.n_faces());
+  FaceIndexReader     faces(_be);
+
   // faces (indices starting at 1 not 0)
   for (size_t i=0, nF=_be.n_faces(); i<nF; ++i)
   {
@@ -350,61 +370,67 @@ write(std::ostream& _out, BaseExporter& _be, const Options& _writeOptions, std::
 
       //color with alpha
       if ( _writeOptions.color_has_alpha() ){
-        cA  = color_cast<OpenMesh::Vec4f> (_be.colorA( FaceHandle(int(i)) ));
+        cA  = color_cast<OpenMesh::Vec4f> (fcolorsA[i]);
         material = getMaterial(cA);
       } else{
       //and without alpha
-        c  = color_cast<OpenMesh::Vec3f> (_be.color( FaceHandle(int(i)) ));
+        c  = color_cast<OpenMesh::Vec3f> (fcolors[i]);
         material = getMaterial(c);
       }
 
       // if we are ina a new material block, specify in the file which material to use
       if(lastMat != material) {
-        _out << "usemtl mat" << material << '\n';
+        out.put("usemtl mat");
+        out.put(material);
+        out.put('\n');
         lastMat = material;
       }
     }
 
-    _out << "f";
+    out.put('f');
 
-    _be.get_vhandles(FaceHandle(int(i)), vhandles);
+    const unsigned int nV = faces.get(i, vidx);
 
-    for (size_t j=0; j< vhandles.size(); ++j)
+    for (size_t j=0; j< nV; ++j)
     {
 
       // Write vertex index
-      idx = vhandles[j].idx() + 1;
-      _out << " " << idx;
+      idx = vidx[j] + 1;
+      out.put(' ');
+      out.put(idx);
 
       if (!onlyVertices) {
         // write separator
-        _out << "/" ;
+        out.put('/');
 
         //write texCoords index from halfedge
         if(_writeOptions.check(Options::FaceTexCoord))
         {
-          _out << texMap[_be.texcoord(_be.getHeh(FaceHandle(int(i)),vhandles[j]))];
+          out.put(texMap[_be.texcoord(_be.getHeh(FaceHandle(int(i)),VertexHandle(vidx[j])))]);
         }
 
         else
         {
           // write vertex texture coordinate index
           if (_writeOptions.check(Options::VertexTexCoord))
-            _out  << texMap[_be.texcoord(vhandles[j])];
+            out.put(texMap[_be.texcoord(VertexHandle(vidx[j]))]);
         }
 
         // write vertex normal index
         if ( _writeOptions.check(Options::VertexNormal) ) {
           // write separator
-          _out << "/" ;
-          _out << idx;
+          out.put('/');
+          out.put(idx);
         }
       }
     }
 
-    _out << '\n';
+    out.put('\n');
   }
 
+  if (!out.flush())
+    return false;
+
   material_.clear();
   material_idx_.clear();
   materialA_.clear();
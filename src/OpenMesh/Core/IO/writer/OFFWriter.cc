@@ -49,7 +49,8 @@
 #include <OpenMesh/Core/System/omstream.hh>
 #include <OpenMesh/Core/Utils/Endian.hh>
 #include <OpenMesh/Core/IO/IOManager.hh>
-#include <OpenMesh/Core/IO/BinaryHelper.hh>
+#include <OpenMesh/Core/IO/AsciiOutBuffer.hh>
+#include <OpenMesh/Core/IO/BinaryOutBuffer.hh>
 #include <OpenMesh/Core/IO/writer/OFFWriter.hh>
 
 //=== NAMESPACES ==============================================================
@@ -140,14 +141,13 @@ write_ascii(std::ostream& _out, BaseExporter& _be, const Options& _writeOptions)
 {
 
   unsigned int i, nV, nF;
-  Vec3f v, n;
-  Vec2f t;
-  OpenMesh::Vec3i c;
-  OpenMesh::Vec4i cA;
-  OpenMesh::Vec3f cf;
-  OpenMesh::Vec4f cAf;
-  VertexHandle vh;
-  std::vector<VertexHandle> vhandles;
+  const int* idx;
+
+  BulkReaderT<Vec3uc> fcolors  (_be, &BaseExporter::face_colors, _be.n_faces());
+  BulkReaderT<Vec4uc> fcolorsA (_be, &BaseExporter::face_colors, _be.n_faces());
+  BulkReaderT<Vec3f>  fcolorsf (_be, &BaseExporter::face_colors, _be.n_faces());
+  BulkReaderT<Vec4f>  fcolorsAf(_be, &BaseExporter::face_colors, _be.n_faces());
+  FaceIndexReader     faces(_be);
 
 
   // #vertices, #faces
@@ -158,157 +158,110 @@ write_ascii(std::ostream& _out, BaseExporter& _be, const Options& _writeOptions)
   if (_writeOptions.color_is_float())
     _out << std::fixed;
 
+  AsciiOutBuffer out(_out);
 
-  // vertex data (point, normals, colors, texcoords)
-  for (i=0, nV=int(_be.n_vertices()); i<nV; ++i)
+  // vertex data (point, normals, colors, texcoords), formatted in parallel
+  format_parallel(out, _be.n_vertices(), [&](AsciiOutBuffer& _buf, size_t _first, size_t _last)
   {
-    vh = VertexHandle(i);
-    v  = _be.point(vh);
-
-    //Vertex
-    _out << v[0] << " " << v[1] << " " << v[2];
-
-    // VertexNormal
-    if ( _writeOptions.vertex_has_normal() ) {
-      n  = _be.normal(vh);
-      _out << " " << n[0] << " " << n[1] << " " << n[2];
-    }
+    BulkReaderT<Vec3f>  points   (_be, &BaseExporter::points,      _be.n_vertices());
+    BulkReaderT<Vec3f>  normals  (_be, &BaseExporter::normals,     _be.n_vertices());
+    BulkReaderT<Vec3uc> colors   (_be, &BaseExporter::colors,      _be.n_vertices());
+    BulkReaderT<Vec4uc> colorsA  (_be, &BaseExporter::colors,      _be.n_vertices());
+    BulkReaderT<Vec3f>  colorsf  (_be, &BaseExporter::colors,      _be.n_vertices());
+    BulkReaderT<Vec4f>  colorsAf (_be, &BaseExporter::colors,      _be.n_vertices());
+    BulkReaderT<Vec2f>  texcoords(_be, &BaseExporter::texcoords,   _be.n_vertices());
+
+    for (size_t i=_first; i<_last; ++i)
+    {
+      //Vertex
+      _buf.put(points[i]);
 
-    // VertexColor
-    if ( _writeOptions.vertex_has_color() ) {
-      if ( _writeOptions.color_is_float() ) {
-        //with alpha
-        if ( _writeOptions.color_has_alpha() ){
-          cAf  = _be.colorAf(vh);
-          _out << " " << cAf;
-        }else{
-          //without alpha
-          cf  = _be.colorf(vh);
-          _out << " " << cf;
-        }
-      } else {
-        //with alpha
-        if ( _writeOptions.color_has_alpha() ){
-          cA  = _be.colorA(vh);
-          _out << " " << cA;
-        }else{
-          //without alpha
-          c  = _be.color(vh);
-          _out << " " << c;
-        }
+      // VertexNormal
+      if ( _writeOptions.vertex_has_normal() ) {
+        _buf.put(' ');
+        _buf.put(normals[i]);
       }
-    }
-
-    // TexCoord
-    if (_writeOptions.vertex_has_texcoord() ) {
-      t  = _be.texcoord(vh);
-      _out << " " << t[0] << " " << t[1];
-    }
-
-    _out << '\n';
-
-  }
 
-  // faces (indices starting at 0)
-  if (_be.is_triangle_mesh())
-  {
-    for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
-    {
-      _be.get_vhandles(FaceHandle(i), vhandles);
-      _out << 3 << " ";
-      _out << vhandles[0].idx()  << " ";
-      _out << vhandles[1].idx()  << " ";
-      _out << vhandles[2].idx();
-
-      //face color
-      if ( _writeOptions.face_has_color() ){
+      // VertexColor
+      if ( _writeOptions.vertex_has_color() ) {
+        _buf.put(' ');
         if ( _writeOptions.color_is_float() ) {
           //with alpha
-          if ( _writeOptions.color_has_alpha() ){
-            cAf  = _be.colorAf( FaceHandle(i) );
-            _out << " " << cAf;
-          }else{
-            //without alpha
-            cf  = _be.colorf( FaceHandle(i) );
-            _out << " " << cf;
-          }
+          if ( _writeOptions.color_has_alpha() )
+            _buf.put(colorsAf[i]);
+          else
+            _buf.put(colorsf[i]);
         } else {
           //with alpha
-          if ( _writeOptions.color_has_alpha() ){
-            cA  = _be.colorA( FaceHandle(i) );
-            _out << " " << cA;
-          }else{
-            //without alpha
-            c  = _be.color( FaceHandle(i) );
-            _out << " " << c;
-          }
+          if ( _writeOptions.color_has_alpha() )
+            _buf.put(colorsA[i]);
+          else
+            _buf.put(colors[i]);
         }
       }
-      _out << '\n';
-    }
-  }
-  else
-  {
-    for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
-    {
-      nV = _be.get_vhandles(FaceHandle(i), vhandles);
-      _out << nV << " ";
-      for (size_t j=0; j<vhandles.size(); ++j)
-	       _out << vhandles[j].idx() << " ";
 
-      //face color
-      if ( _writeOptions.face_has_color() ){
-        if ( _writeOptions.color_is_float() ) {
-          //with alpha
-          if ( _writeOptions.color_has_alpha() ){
-            cAf  = _be.colorAf( FaceHandle(i) );
-            _out << " " << cAf;
-          }else{
-            //without alpha
-            cf  = _be.colorf( FaceHandle(i) );
-            _out << " " << cf;
-          }
-        } else {
-          //with alpha
-          if ( _writeOptions.color_has_alpha() ){
-            cA  = _be.colorA( FaceHandle(i) );
-            _out << " " << cA;
-          }else{
-            //without alpha
-            c  = _be.color( FaceHandle(i) );
-            _out << " " << c;
-          }
-        }
+      // TexCoord
+      if (_writeOptions.vertex_has_texcoord() ) {
+        _buf.put(' ');
+        _buf.put(texcoords[i]);
       }
 
-      _out << '\n';
+      _buf.put('\n');
     }
-  }
-
-
-  return true;
-}
+  }, 1 << 14, _be.concurrent_access() ? 0 : 1);
 
+  // faces (indices starting at 0)
+  for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
+  {
+    nV = faces.get(i, idx);
 
-//-----------------------------------------------------------------------------
+    if (_be.is_triangle_mesh())
+    {
+      out.put(3);
+      out.put(' ');
+      out.put(idx[0]);
+      out.put(' ');
+      out.put(idx[1]);
+      out.put(' ');
+      out.put(idx[2]);
+    }
+    else
+    {
+      out.put(nV);
+      out.put(' ');
+      for (size_t j=0; j<nV; ++j) {
+        out.put(idx[j]);
+        out.put(' ');
+      }
+    }
 
-void _OFFWriter_::writeValue(std::ostream& _out, int value) const {
+    //face color
+    if ( _writeOptions.face_has_color() ){
+      out.put(' ');
+      if ( _writeOptions.color_is_float() ) {
+        //with alpha
+        if ( _writeOptions.color_has_alpha() )
+          out.put(fcolorsAf[i]);
+        else
+          out.put(fcolorsf[i]);
+      } else {
+        //with alpha
+        if ( _writeOptions.color_has_alpha() )
+          out.put(fcolorsA[i]);
+        else
+          out.put(fcolors[i]);
+      }
+    }
 
-  uint32_t tmp = value;
-  store(_out, tmp, false);
-}
+    out.put('\n');
+  }
 
-void _OFFWriter_::writeValue(std::ostream& _out, unsigned int value) const {
 
-  uint32_t tmp = value;
-  store(_out, tmp, false);
+  return out.flush();
 }
 
-void _OFFWriter_::writeValue(std::ostream& _out, float value) const {
 
-  float32_t tmp = value;
-  store(_out, tmp, false);
-}
+//-----------------------------------------------------------------------------
 
 bool
 _OFFWriter_::
@@ -316,133 +269,75 @@ write_binary(std::ostream& _out, BaseExporter& _be, const Options& _writeOptions
 {
 
   unsigned int i, nV, nF;
-  Vec3f v, n;
-  Vec2f t;
   OpenMesh::Vec4i c;
   OpenMesh::Vec4f cf;
-  VertexHandle vh;
-  std::vector<VertexHandle> vhandles;
+  const int* idx;
+
+  BulkReaderT<Vec3f>  points   (_be, &BaseExporter::points,      _be.n_vertices());
+  BulkReaderT<Vec3f>  normals  (_be, &BaseExporter::normals,     _be.n_vertices());
+  BulkReaderT<Vec4uc> colorsA  (_be, &BaseExporter::colors,      _be.n_vertices());
+  BulkReaderT<Vec4f>  colorsAf (_be, &BaseExporter::colors,      _be.n_vertices());
+  BulkReaderT<Vec2f>  texcoords(_be, &BaseExporter::texcoords,   _be.n_vertices());
+  BulkReaderT<Vec4uc> fcolorsA (_be, &BaseExporter::face_colors, _be.n_faces());
+  BulkReaderT<Vec4f>  fcolorsAf(_be, &BaseExporter::face_colors, _be.n_faces());
+  FaceIndexReader     faces(_be);
+
+  BinaryOutBuffer buffer(_out);
+
+  // number of color components
+  const size_t nC = _writeOptions.color_has_alpha() ? 4 : 3;
 
   // #vertices, #faces
-  writeValue(_out, (uint)_be.n_vertices() );
-  writeValue(_out, (uint) _be.n_faces() );
-  writeValue(_out, 0 );
+  buffer.put(uint32_t(_be.n_vertices()));
+  buffer.put(uint32_t(_be.n_faces()));
+  buffer.put(uint32_t(0));
 
   // vertex data (point, normals, texcoords)
   for (i=0, nV=int(_be.n_vertices()); i<nV; ++i)
   {
-    vh = VertexHandle(i);
-    v  = _be.point(vh);
-
     //vertex
-    writeValue(_out, v[0]);
-    writeValue(_out, v[1]);
-    writeValue(_out, v[2]);
+    buffer.put(points[i]);
 
     // vertex normal
-    if ( _writeOptions.vertex_has_normal() ) {
-      n  = _be.normal(vh);
-      writeValue(_out, n[0]);
-      writeValue(_out, n[1]);
-      writeValue(_out, n[2]);
-    }
+    if ( _writeOptions.vertex_has_normal() )
+      buffer.put(normals[i]);
+
     // vertex color
     if ( _writeOptions.vertex_has_color() ) {
       if ( _writeOptions.color_is_float() ) {
-        cf  = _be.colorAf(vh);
-        writeValue(_out, cf[0]);
-        writeValue(_out, cf[1]);
-        writeValue(_out, cf[2]);
-
-        if ( _writeOptions.color_has_alpha() )
-          writeValue(_out, cf[3]);
+        cf  = colorsAf[i];
+        buffer.put(cf.data(), nC);
       } else {
-        c  = _be.colorA(vh);
-        writeValue(_out, c[0]);
-        writeValue(_out, c[1]);
-        writeValue(_out, c[2]);
-
-        if ( _writeOptions.color_has_alpha() )
-          writeValue(_out, c[3]);
+        c  = colorsA[i];
+        buffer.put(c.data(), nC);
       }
     }
     // texCoords
-    if (_writeOptions.vertex_has_texcoord() ) {
-      t  = _be.texcoord(vh);
-      writeValue(_out, t[0]);
-      writeValue(_out, t[1]);
-    }
-
+    if (_writeOptions.vertex_has_texcoord() )
+      buffer.put(texcoords[i]);
   }
 
   // faces (indices starting at 0)
-  if (_be.is_triangle_mesh())
+  for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
   {
-    for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
-    {
-      //face
-      _be.get_vhandles(FaceHandle(i), vhandles);
-      writeValue(_out, 3);
-      writeValue(_out, vhandles[0].idx());
-      writeValue(_out, vhandles[1].idx());
-      writeValue(_out, vhandles[2].idx());
-
-      //face color
-      if ( _writeOptions.face_has_color() ){
-        if ( _writeOptions.color_is_float() ) {
-          cf  = _be.colorAf( FaceHandle(i) );
-          writeValue(_out, cf[0]);
-          writeValue(_out, cf[1]);
-          writeValue(_out, cf[2]);
-
-          if ( _writeOptions.color_has_alpha() )
-            writeValue(_out, cf[3]);
-        } else {
-          c  = _be.colorA( FaceHandle(i) );
-          writeValue(_out, c[0]);
-          writeValue(_out, c[1]);
-          writeValue(_out, c[2]);
-
-          if ( _writeOptions.color_has_alpha() )
-            writeValue(_out, c[3]);
-        }
-      }
-    }
-  }
-  else
-  {
-    for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
-    {
-      //face
-      nV = _be.get_vhandles(FaceHandle(i), vhandles);
-      writeValue(_out, nV);
-      for (size_t j=0; j<vhandles.size(); ++j)
-        writeValue(_out, vhandles[j].idx() );
-
-      //face color
-      if ( _writeOptions.face_has_color() ){
-        if ( _writeOptions.color_is_float() ) {
-          cf  = _be.colorAf( FaceHandle(i) );
-          writeValue(_out, cf[0]);
-          writeValue(_out, cf[1]);
-          writeValue(_out, cf[2]);
-
-          if ( _writeOptions.color_has_alpha() )
-            writeValue(_out, cf[3]);
-        } else {
-          c  = _be.colorA( FaceHandle(i) );
-          writeValue(_out, c[0]);
-          writeValue(_out, c[1]);
-          writeValue(_out, c[2]);
+    //face
+    nV = faces.get(i, idx);
+    buffer.put(nV);
+    buffer.put(idx, nV);
 
-          if ( _writeOptions.color_has_alpha() )
-            writeValue(_out, c[3]);
-        }
+    //face color
+    if ( _writeOptions.face_has_color() ){
+      if ( _writeOptions.color_is_float() ) {
+        cf  = fcolorsAf[i];
+        buffer.put(cf.data(), nC);
+      } else {
+        c  = fcolorsA[i];
+        buffer.put(c.data(), nC);
       }
     }
   }
 
-  return true;
+  return buffer.flush();
 }
 
 // ----------------------------------------------------------------------------
@@ -497,10 +392,11 @@ binary_size(BaseExporter& _be, const Options& _writeOptions) const
   else
   {
     unsigned int i, nF;
-    std::vector<VertexHandle> vhandles;
+    const int* idx;
+    FaceIndexReader faces(_be);
 
     for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
-      data += _be.get_vhandles(FaceHandle(i), vhandles) * sizeof(unsigned int);
+      data += faces.get(i, idx) * sizeof(unsigned int);
 
   }
 
@@ -108,10 +108,6 @@ public:
 
 
 protected:
-  void writeValue(std::ostream& _out, int value) const;
-  void writeValue(std::ostream& _out, unsigned int value) const;
-  void writeValue(std::ostream& _out, float value) const;
-
   bool write_ascii(std::ostream& _in, BaseExporter&, const Options& _writeOptions) const;
   bool write_binary(std::ostream& _in, BaseExporter&, const Options& _writeOptions) const;
 };
@@ -58,6 +58,7 @@
 #include <vector>
 
 // -------------------- OpenMesh
+#include <OpenMesh/Core/IO/BinaryOutBuffer.hh>
 #include <OpenMesh/Core/IO/OMFormat.hh>
 #include <OpenMesh/Core/IO/exporter/BaseExporter.hh>
 #include <OpenMesh/Core/IO/writer/OMWriter.hh>
@@ -80,6 +81,24 @@ _OMWriter_& OMWriter() { return __OMWriterInstance; }
 //=== IMPLEMENTATION ==========================================================
 
 
+namespace {
+
+/// Append a signed integer with the number of bytes given by \c _b
+size_t put_integer(BinaryOutBuffer& _buffer, int _val, OMFormat::Chunk::Integer_Size _b)
+{
+  switch (_b)
+  {
+    case OMFormat::Chunk::Integer_8:  return _buffer.put(static_cast<OMFormat::int8>(_val));
+    case OMFormat::Chunk::Integer_16: return _buffer.put(static_cast<OMFormat::int16>(_val));
+    case OMFormat::Chunk::Integer_32: return _buffer.put(static_cast<OMFormat::int32>(_val));
+    case OMFormat::Chunk::Integer_64: return _buffer.put(static_cast<OMFormat::int64>(_val));
+  }
+  return 0;
+}
+
+} // anonymous namespace
+
+
 const OMFormat::uchar _OMWriter_::magic_[3] = "OM";
 const OMFormat::uint8 _OMWriter_::version_  = OMFormat::mk_version(2,2);
 
@@ -236,11 +255,23 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
 
     bytes += store( _os, chunk_header, swap_required );
     if (_be.is_point_double())
+    {
+      BinaryOutBuffer buffer(_os, swap_required);
+      BulkReaderT<Vec3d> points(_be, &BaseExporter::points, header.n_vertices_);
       for (i=0, nV=header.n_vertices_; i<nV; ++i)
-        bytes += vector_store( _os, _be.pointd(VertexHandle(i)), swap_required );
+        bytes += buffer.put(points[i]);
+      if (!buffer.flush())
+        return false;
+    }
     else
+    {
+      BinaryOutBuffer buffer(_os, swap_required);
+      BulkReaderT<Vec3f> points(_be, &BaseExporter::points, header.n_vertices_);
       for (i=0, nV=header.n_vertices_; i<nV; ++i)
-        bytes += vector_store( _os, _be.point(VertexHandle(i)), swap_required );
+        bytes += buffer.put(points[i]);
+      if (!buffer.flush())
+        return false;
+    }
   }
 
 
@@ -270,11 +301,23 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
 
     bytes += store( _os, chunk_header, swap_required );
     if (_be.is_normal_double())
+    {
+      BinaryOutBuffer buffer(_os, swap_required);
+      BulkReaderT<Vec3d> normals(_be, &BaseExporter::normals, header.n_vertices_);
       for (i=0, nV=header.n_vertices_; i<nV; ++i)
-        bytes += vector_store( _os, _be.normald(VertexHandle(i)), swap_required );
+        bytes += buffer.put(normals[i]);
+      if (!buffer.flush())
+        return false;
+    }
     else
+    {
+      BinaryOutBuffer buffer(_os, swap_required);
+      BulkReaderT<Vec3f> normals(_be, &BaseExporter::normals, header.n_vertices_);
       for (i=0, nV=header.n_vertices_; i<nV; ++i)
-        bytes += vector_store( _os, _be.normal(VertexHandle(i)), swap_required );
+        bytes += buffer.put(normals[i]);
+      if (!buffer.flush())
+        return false;
+    }
 
   }
 
@@ -292,8 +335,12 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
     chunk_header.bits_     = OMFormat::bits( c[0] );
 
     bytes += store( _os, chunk_header, swap_required );
+    BinaryOutBuffer buffer(_os, swap_required);
+    BulkReaderT<Vec3uc> colors(_be, &BaseExporter::colors, header.n_vertices_);
     for (i=0, nV=header.n_vertices_; i<nV; ++i)
-      bytes += vector_store( _os, _be.color(VertexHandle(i)), swap_required );
+      bytes += buffer.put(colors[i]);
+    if (!buffer.flush())
+      return false;
   }
 
   // ---------- write vertex texture coords
@@ -311,8 +358,12 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
 
     bytes += store(_os, chunk_header, swap_required);
 
+    BinaryOutBuffer buffer(_os, swap_required);
+    BulkReaderT<Vec2f> texcoords(_be, &BaseExporter::texcoords, header.n_vertices_);
     for (i = 0, nV = header.n_vertices_; i < nV; ++i)
-      bytes += vector_store(_os, _be.texcoord(VertexHandle(i)), swap_required);
+      bytes += buffer.put(texcoords[i]);
+    if (!buffer.flush())
+      return false;
 
   }
 
@@ -329,6 +380,7 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
     chunk_header.bits_     = OMFormat::needed_bits(_be.n_edges()*4); // *2 due to halfedge ids being stored, *2 due to signedness
 
     bytes += store( _os, chunk_header, swap_required );
+    BinaryOutBuffer buffer(_os, swap_required);
     auto nE=header.n_edges_*2;
     for (i=0; i<nE; ++i)
     {
@@ -336,10 +388,12 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
       auto to_vertex_id = _be.get_to_vertex_id(HalfedgeHandle(static_cast<int>(i)));
       auto face_id      = _be.get_face_id(HalfedgeHandle(static_cast<int>(i)));
 
-      bytes += store( _os, next_id,      OMFormat::Chunk::Integer_Size(chunk_header.bits_), swap_required );
-      bytes += store( _os, to_vertex_id, OMFormat::Chunk::Integer_Size(chunk_header.bits_), swap_required );
-      bytes += store( _os, face_id,      OMFormat::Chunk::Integer_Size(chunk_header.bits_), swap_required );
+      bytes += put_integer( buffer, next_id,      OMFormat::Chunk::Integer_Size(chunk_header.bits_) );
+      bytes += put_integer( buffer, to_vertex_id, OMFormat::Chunk::Integer_Size(chunk_header.bits_) );
+      bytes += put_integer( buffer, face_id,      OMFormat::Chunk::Integer_Size(chunk_header.bits_) );
     }
+    if (!buffer.flush())
+      return false;
   }
 
 
@@ -359,9 +413,12 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
 
     bytes += store(_os, chunk_header, swap_required);
 
+    BinaryOutBuffer buffer(_os, swap_required);
     unsigned int nHE;
     for (i = 0, nHE = header.n_edges_*2; i < nHE; ++i)
-      bytes += vector_store(_os, _be.texcoord(HalfedgeHandle(i)), swap_required);
+      bytes += buffer.put(_be.texcoord(HalfedgeHandle(i)));
+    if (!buffer.flush())
+      return false;
 
   }
   //---------------------------------------------------------------
@@ -379,8 +436,11 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
     chunk_header.bits_     = OMFormat::needed_bits(_be.n_edges()*4); // *2 due to halfedge ids being stored, *2 due to signedness
 
     bytes += store( _os, chunk_header, swap_required );
+    BinaryOutBuffer buffer(_os, swap_required);
     for (i=0, nV=header.n_vertices_; i<nV; ++i)
-      bytes += store( _os, _be.get_halfedge_id(VertexHandle(i)), OMFormat::Chunk::Integer_Size(chunk_header.bits_), swap_required );
+      bytes += put_integer( buffer, _be.get_halfedge_id(VertexHandle(i)), OMFormat::Chunk::Integer_Size(chunk_header.bits_) );
+    if (!buffer.flush())
+      return false;
   }
 
 
@@ -398,11 +458,14 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
 
     bytes += store( _os, chunk_header, swap_required );
 
+    BinaryOutBuffer buffer(_os, swap_required);
     for (i=0, nF=header.n_faces_; i<nF; ++i)
     {
       auto size = OMFormat::Chunk::Integer_Size(chunk_header.bits_);
-      bytes += store( _os, _be.get_halfedge_id(FaceHandle(i)), size, swap_required);
+      bytes += put_integer( buffer, _be.get_halfedge_id(FaceHandle(i)), size );
     }
+    if (!buffer.flush())
+      return false;
   }
 
   // ---------- write face normals
@@ -441,11 +504,23 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
       bytes += store( _os, chunk_header, swap_required );
 #if !NEW_STYLE
       if (_be.is_normal_double())
+      {
+        BinaryOutBuffer buffer(_os, swap_required);
+        BulkReaderT<Vec3d> normals(_be, &BaseExporter::face_normals, header.n_faces_);
         for (i=0, nF=header.n_faces_; i<nF; ++i)
-          bytes += vector_store( _os, _be.normald(FaceHandle(i)), swap_required );
+          bytes += buffer.put(normals[i]);
+        if (!buffer.flush())
+          return false;
+      }
       else
+      {
+        BinaryOutBuffer buffer(_os, swap_required);
+        BulkReaderT<Vec3f> normals(_be, &BaseExporter::face_normals, header.n_faces_);
         for (i=0, nF=header.n_faces_; i<nF; ++i)
-          bytes += vector_store( _os, _be.normal(FaceHandle(i)), swap_required );
+          bytes += buffer.put(normals[i]);
+        if (!buffer.flush())
+          return false;
+      }
 
 #else
       bytes += bp->store(_os, swap );
@@ -480,8 +555,12 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
 
       bytes += store( _os, chunk_header, swap_required );
 #if !NEW_STYLE
+      BinaryOutBuffer buffer(_os, swap_required);
+      BulkReaderT<Vec3uc> colors(_be, &BaseExporter::face_colors, header.n_faces_);
       for (i=0, nF=header.n_faces_; i<nF; ++i)
-        bytes += vector_store( _os, _be.color(FaceHandle(i)), swap_required );
+        bytes += buffer.put(colors[i]);
+      if (!buffer.flush())
+        return false;
 #else
       bytes += bp->store(_os, swap);
     }
@@ -48,7 +48,9 @@
 #include <OpenMesh/Core/System/omstream.hh>
 #include <OpenMesh/Core/Utils/Endian.hh>
 #include <OpenMesh/Core/IO/IOManager.hh>
+#include <OpenMesh/Core/IO/AsciiOutBuffer.hh>
 #include <OpenMesh/Core/IO/BinaryHelper.hh>
+#include <OpenMesh/Core/IO/BinaryOutBuffer.hh>
 #include <OpenMesh/Core/IO/writer/PLYWriter.hh>
 
 #include <iostream>
@@ -146,11 +148,22 @@ write(std::ostream& _os, BaseExporter& _be, const Options& _writeOptions, std::s
 
 //-----------------------------------------------------------------------------
 
-// helper function for casting a property
+// helper function checking the value type of a property, the property
+// vector may use either allocator (see DefaultTraits::PropertyAllocator)
 template<typename T>
-const PropertyT<T>* castProperty(const BaseProperty* _prop)
+bool isPropertyOfType(const BaseProperty* _prop)
 {
-  return dynamic_cast< const PropertyT<T>* >(_prop);
+  return dynamic_cast< const PropertyT<T>* >(_prop) != 0
+      || dynamic_cast< const PropertyT<T, ResourceAllocatorT<T> >* >(_prop) != 0;
+}
+
+// helper function returning the element array of a property of type T
+template<typename T>
+const T* propertyData(const BaseProperty* _prop)
+{
+  if (const PropertyT<T>* prop = dynamic_cast< const PropertyT<T>* >(_prop))
+    return prop->data();
+  return static_cast< const PropertyT<T, ResourceAllocatorT<T> >* >(_prop)->data();
 }
 
 //-----------------------------------------------------------------------------
@@ -177,18 +190,18 @@ std::vector<_PLYWriter_::CustomProperty> _PLYWriter_::writeCustomTypeHeader(std:
       assert_compile(sizeof(char) == 1);
       //check, if prop is a char or unsigned char by dynamic_cast
       //char, unsigned char and signed char are 3 distinct types
-      if (castProperty<signed char>(prop) != 0 || castProperty<char>(prop) != 0) //treat char as signed char
+      if (isPropertyOfType<signed char>(prop) || isPropertyOfType<char>(prop)) //treat char as signed char
         cProp.type = ValueTypeCHAR;
-      else if (castProperty<unsigned char>(prop) != 0)
+      else if (isPropertyOfType<unsigned char>(prop))
         cProp.type = ValueTypeUCHAR;
       break;
     }
     case 2:
     {
       assert_compile (sizeof(short) == 2);
-      if (castProperty<signed short>(prop) != 0)
+      if (isPropertyOfType<signed short>(prop))
         cProp.type = ValueTypeSHORT;
-      else if (castProperty<unsigned short>(prop) != 0)
+      else if (isPropertyOfType<unsigned short>(prop))
         cProp.type = ValueTypeUSHORT;
       break;
     }
@@ -196,18 +209,18 @@ std::vector<_PLYWriter_::CustomProperty> _PLYWriter_::writeCustomTypeHeader(std:
     {
       assert_compile (sizeof(int) == 4);
       assert_compile (sizeof(float) == 4);
-      if (castProperty<signed int>(prop) != 0)
+      if (isPropertyOfType<signed int>(prop))
         cProp.type = ValueTypeINT;
-      else if (castProperty<unsigned int>(prop) != 0)
+      else if (isPropertyOfType<unsigned int>(prop))
         cProp.type = ValueTypeUINT;
-      else if (castProperty<float>(prop) != 0)
+      else if (isPropertyOfType<float>(prop))
         cProp.type = ValueTypeFLOAT;
       break;
 
     }
     case 8:
       assert_compile (sizeof(double) == 8);
-      if (castProperty<double>(prop) != 0)
+      if (isPropertyOfType<double>(prop))
         cProp.type = ValueTypeDOUBLE;
       break;
     default:
@@ -230,21 +243,21 @@ template<bool binary>
 void _PLYWriter_::write_customProp(std::ostream& _out, const CustomProperty& _prop, size_t _index) const
 {
   if (_prop.type == ValueTypeCHAR)
-    writeProxy(_prop.type,_out, castProperty<signed char>(_prop.property)->data()[_index], OpenMesh::GenProg::Bool2Type<binary>());
+    writeProxy(_prop.type,_out, propertyData<signed char>(_prop.property)[_index], OpenMesh::GenProg::Bool2Type<binary>());
   else if (_prop.type == ValueTypeUCHAR || _prop.type == ValueTypeUINT8)
-    writeProxy(_prop.type,_out, castProperty<unsigned char>(_prop.property)->data()[_index], OpenMesh::GenProg::Bool2Type<binary>());
+    writeProxy(_prop.type,_out, propertyData<unsigned char>(_prop.property)[_index], OpenMesh::GenProg::Bool2Type<binary>());
   else if (_prop.type == ValueTypeSHORT)
-    writeProxy(_prop.type,_out, castProperty<signed short>(_prop.property)->data()[_index], OpenMesh::GenProg::Bool2Type<binary>());
+    writeProxy(_prop.type,_out, propertyData<signed short>(_prop.property)[_index], OpenMesh::GenProg::Bool2Type<binary>());
   else if (_prop.type == ValueTypeUSHORT)
-    writeProxy(_prop.type,_out, castProperty<unsigned short>(_prop.property)->data()[_index], OpenMesh::GenProg::Bool2Type<binary>());
+    writeProxy(_prop.type,_out, propertyData<unsigned short>(_prop.property)[_index], OpenMesh::GenProg::Bool2Type<binary>());
   else if (_prop.type == ValueTypeUINT)
-    writeProxy(_prop.type,_out, castProperty<unsigned int>(_prop.property)->data()[_index], OpenMesh::GenProg::Bool2Type<binary>());
+    writeProxy(_prop.type,_out, propertyData<unsigned int>(_prop.property)[_index], OpenMesh::GenProg::Bool2Type<binary>());
   else if (_prop.type == ValueTypeINT || _prop.type == ValueTypeINT32)
-    writeProxy(_prop.type,_out, castProperty<signed int>(_prop.property)->data()[_index], OpenMesh::GenProg::Bool2Type<binary>());
+    writeProxy(_prop.type,_out, propertyData<signed int>(_prop.property)[_index], OpenMesh::GenProg::Bool2Type<binary>());
   else if (_prop.type == ValueTypeFLOAT || _prop.type == ValueTypeFLOAT32)
-    writeProxy(_prop.type,_out, castProperty<float>(_prop.property)->data()[_index], OpenMesh::GenProg::Bool2Type<binary>());
+    writeProxy(_prop.type,_out, propertyData<float>(_prop.property)[_index], OpenMesh::GenProg::Bool2Type<binary>());
   else if (_prop.type == ValueTypeDOUBLE)
-    writeProxy(_prop.type,_out, castProperty<double>(_prop.property)->data()[_index], OpenMesh::GenProg::Bool2Type<binary>());
+    writeProxy(_prop.type,_out, propertyData<double>(_prop.property)[_index], OpenMesh::GenProg::Bool2Type<binary>());
 }
 
 
@@ -344,15 +357,13 @@ write_ascii(std::ostream& _out, BaseExporter& _be, Options _opt) const
 {
   
   unsigned int i, nV, nF;
-  Vec3f v, n;
-  OpenMesh::Vec3ui c;
-  OpenMesh::Vec4ui cA;
-  OpenMesh::Vec3f cf;
-  OpenMesh::Vec4f cAf;
-  OpenMesh::Vec2f t;
-  VertexHandle vh;
-  FaceHandle fh;
-  std::vector<VertexHandle> vhandles;
+  const int* idx;
+
+  BulkReaderT<Vec3ui> fcolorsi (_be, &BaseExporter::face_colors, _be.n_faces());
+  BulkReaderT<Vec4ui> fcolorsAi(_be, &BaseExporter::face_colors, _be.n_faces());
+  BulkReaderT<Vec3f>  fcolorsf (_be, &BaseExporter::face_colors, _be.n_faces());
+  BulkReaderT<Vec4f>  fcolorsAf(_be, &BaseExporter::face_colors, _be.n_faces());
+  FaceIndexReader     faces(_be);
 
   std::vector<CustomProperty> vProps;
   std::vector<CustomProperty> fProps;
@@ -362,100 +373,111 @@ write_ascii(std::ostream& _out, BaseExporter& _be, Options _opt) const
   if (_opt.color_is_float())
     _out << std::fixed;
 
+  AsciiOutBuffer out(_out);
+
   // vertex data (point, normals, colors, texcoords)
-  for (i=0, nV=int(_be.n_vertices()); i<nV; ++i)
+  auto write_vertices = [&](AsciiOutBuffer& _buf, size_t _first, size_t _last)
   {
-    vh = VertexHandle(i);
-    v  = _be.point(vh);
-
-    //Vertex
-    _out << v[0] << " " << v[1] << " " << v[2];
+    BulkReaderT<Vec3f>  points   (_be, &BaseExporter::points,      _be.n_vertices());
+    BulkReaderT<Vec3f>  normals  (_be, &BaseExporter::normals,     _be.n_vertices());
+    BulkReaderT<Vec2f>  texcoords(_be, &BaseExporter::texcoords,   _be.n_vertices());
+    BulkReaderT<Vec3ui> colorsi  (_be, &BaseExporter::colors,      _be.n_vertices());
+    BulkReaderT<Vec4ui> colorsAi (_be, &BaseExporter::colors,      _be.n_vertices());
+    BulkReaderT<Vec3f>  colorsf  (_be, &BaseExporter::colors,      _be.n_vertices());
+    BulkReaderT<Vec4f>  colorsAf (_be, &BaseExporter::colors,      _be.n_vertices());
+
+    for (size_t i=_first; i<_last; ++i)
+    {
+      //Vertex
+      _buf.put(points[i]);
 
-    // Vertex Normals
-    if ( _opt.vertex_has_normal() ){
-      n = _be.normal(vh);
-      _out << " " << n[0] << " " << n[1] << " " << n[2];
-    }
+      // Vertex Normals
+      if ( _opt.vertex_has_normal() ){
+        _buf.put(' ');
+        _buf.put(normals[i]);
+      }
 
-    // Vertex TexCoords
-    if ( _opt.vertex_has_texcoord() ) {
-    	t = _be.texcoord(vh);
-    	_out << " " << t[0] << " " << t[1];
-    }
+      // Vertex TexCoords
+      if ( _opt.vertex_has_texcoord() ) {
+        _buf.put(' ');
+        _buf.put(texcoords[i]);
+      }
 
-    // VertexColor
-    if ( _opt.vertex_has_color() ) {
-      //with alpha
-      if ( _opt.color_has_alpha() ){
-        if (_opt.color_is_float()) {
-          cAf = _be.colorAf(vh);
-          _out << " " << cAf;
-        } else {
-          cA  = _be.colorAi(vh);
-          _out << " " << cA;
-        }
-      }else{
-        //without alpha
-        if (_opt.color_is_float()) {
-          cf = _be.colorf(vh);
-          _out << " " << cf;
-        } else {
-          c  = _be.colori(vh);
-          _out << " " << c;
+      // VertexColor
+      if ( _opt.vertex_has_color() ) {
+        _buf.put(' ');
+        //with alpha
+        if ( _opt.color_has_alpha() ){
+          if (_opt.color_is_float())
+            _buf.put(colorsAf[i]);
+          else
+            _buf.put(colorsAi[i]);
+        }else{
+          //without alpha
+          if (_opt.color_is_float())
+            _buf.put(colorsf[i]);
+          else
+            _buf.put(colorsi[i]);
         }
       }
-    }
 
+      // write custom properties for vertices
+      if (!vProps.empty()) {
+        _buf.flush();
+        for (std::vector<CustomProperty>::iterator iter = vProps.begin(); iter < vProps.end(); ++iter)
+          write_customProp<false>(_out,*iter,i);
+      }
 
-    // write custom properties for vertices
-    for (std::vector<CustomProperty>::iterator iter = vProps.begin(); iter < vProps.end(); ++iter)
-      write_customProp<false>(_out,*iter,i);
+      _buf.put('\n');
+    }
+  };
 
-    _out << "\n";
-  }
+  // custom properties are written to the stream and need serial output
+  if (vProps.empty())
+    format_parallel(out, _be.n_vertices(), write_vertices, 1 << 14, _be.concurrent_access() ? 0 : 1);
+  else
+    write_vertices(out, 0, _be.n_vertices());
 
   // faces (indices starting at 0)
   for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
   {
-    fh = FaceHandle(i);
-
     // write vertex indices per face
-    nV = _be.get_vhandles(fh, vhandles);
-    _out << nV;
-    for (size_t j=0; j<vhandles.size(); ++j)
-      _out << " " << vhandles[j].idx();
+    nV = faces.get(i, idx);
+    out.put(nV);
+    for (size_t j=0; j<nV; ++j) {
+      out.put(' ');
+      out.put(idx[j]);
+    }
 
     // FaceColor
     if ( _opt.face_has_color() ) {
+      out.put(' ');
       //with alpha
       if ( _opt.color_has_alpha() ){
-        if (_opt.color_is_float()) {
-          cAf = _be.colorAf(fh);
-          _out << " " << cAf;
-        } else {
-          cA  = _be.colorAi(fh);
-          _out << " " << cA;
-        }
+        if (_opt.color_is_float())
+          out.put(fcolorsAf[i]);
+        else
+          out.put(fcolorsAi[i]);
       }else{
         //without alpha
-        if (_opt.color_is_float()) {
-          cf = _be.colorf(fh);
-          _out << " " << cf;
-        } else {
-          c  = _be.colori(fh);
-          _out << " " << c;
-        }
+        if (_opt.color_is_float())
+          out.put(fcolorsf[i]);
+        else
+          out.put(fcolorsi[i]);
       }
     }
 
     // write custom props
-    for (std::vector<CustomProperty>::iterator iter = fProps.begin(); iter < fProps.end(); ++iter)
-      write_customProp<false>(_out,*iter,i);
-    _out << "\n";
+    if (!fProps.empty()) {
+      out.flush();
+      for (std::vector<CustomProperty>::iterator iter = fProps.begin(); iter < fProps.end(); ++iter)
+        write_customProp<false>(_out,*iter,i);
+    }
+    out.put('\n');
   }
 
 
-  return true;
+  return out.flush();
 }
 
 
@@ -599,13 +621,18 @@ write_binary(std::ostream& _out, BaseExporter& _be, Options _opt) const
 {
   
   unsigned int i, nV, nF;
-  Vec3f v, n;
-  Vec2f t;
   OpenMesh::Vec4uc c;
   OpenMesh::Vec4f cf;
-  VertexHandle vh;
-  FaceHandle fh;
-  std::vector<VertexHandle> vhandles;
+  const int* idx;
+
+  BulkReaderT<Vec3f>  points   (_be, &BaseExporter::points,      _be.n_vertices());
+  BulkReaderT<Vec3f>  normals  (_be, &BaseExporter::normals,     _be.n_vertices());
+  BulkReaderT<Vec2f>  texcoords(_be, &BaseExporter::texcoords,   _be.n_vertices());
+  BulkReaderT<Vec4uc> colorsA  (_be, &BaseExporter::colors,      _be.n_vertices());
+  BulkReaderT<Vec4f>  colorsAf (_be, &BaseExporter::colors,      _be.n_vertices());
+  BulkReaderT<Vec4uc> fcolorsA (_be, &BaseExporter::face_colors, _be.n_faces());
+  BulkReaderT<Vec4f>  fcolorsAf(_be, &BaseExporter::face_colors, _be.n_faces());
+  FaceIndexReader     faces(_be);
 
   // vProps and fProps will be empty, until custom properties are supported by the binary writer
   std::vector<CustomProperty> vProps;
@@ -613,94 +640,70 @@ write_binary(std::ostream& _out, BaseExporter& _be, Options _opt) const
 
   write_header(_out, _be, _opt, vProps, fProps);
 
+  BinaryOutBuffer buffer(_out, _opt.check(Options::MSB));
+
+  // number of color components
+  const size_t nC = _opt.color_has_alpha() ? 4 : 3;
+
   // vertex data (point, normals, texcoords)
   for (i=0, nV=int(_be.n_vertices()); i<nV; ++i)
   {
-    vh = VertexHandle(i);
-    v  = _be.point(vh);
-
     //vertex
-    writeValue(ValueTypeFLOAT, _out, v[0]);
-    writeValue(ValueTypeFLOAT, _out, v[1]);
-    writeValue(ValueTypeFLOAT, _out, v[2]);
+    buffer.put(points[i]);
 
     // Vertex Normal
-    if ( _opt.vertex_has_normal() ){
-      n = _be.normal(vh);
-      writeValue(ValueTypeFLOAT, _out, n[0]);
-      writeValue(ValueTypeFLOAT, _out, n[1]);
-      writeValue(ValueTypeFLOAT, _out, n[2]);
-    }
+    if ( _opt.vertex_has_normal() )
+      buffer.put(normals[i]);
 
     // Vertex TexCoords
-    if ( _opt.vertex_has_texcoord() ) {
-    	t = _be.texcoord(vh);
-    	writeValue(ValueTypeFLOAT, _out, t[0]);
-    	writeValue(ValueTypeFLOAT, _out, t[1]);
-    }
+    if ( _opt.vertex_has_texcoord() )
+      buffer.put(texcoords[i]);
 
     // vertex color
     if ( _opt.vertex_has_color() ) {
         if ( _opt.color_is_float() ) {
-          cf  = _be.colorAf(vh);
-          writeValue(ValueTypeFLOAT, _out, cf[0]);
-          writeValue(ValueTypeFLOAT, _out, cf[1]);
-          writeValue(ValueTypeFLOAT, _out, cf[2]);
-
-          if ( _opt.color_has_alpha() )
-            writeValue(ValueTypeFLOAT, _out, cf[3]);
+          cf  = colorsAf[i];
+          buffer.put(cf.data(), nC);
         } else {
-          c  = _be.colorA(vh);
-          writeValue(ValueTypeUCHAR, _out, (int)c[0]);
-          writeValue(ValueTypeUCHAR, _out, (int)c[1]);
-          writeValue(ValueTypeUCHAR, _out, (int)c[2]);
-
-          if ( _opt.color_has_alpha() )
-            writeValue(ValueTypeUCHAR, _out, (int)c[3]);
+          c  = colorsA[i];
+          buffer.put(c.data(), nC);
         }
     }
 
-    for (std::vector<CustomProperty>::iterator iter = vProps.begin(); iter < vProps.end(); ++iter)
-      write_customProp<true>(_out,*iter,i);
+    if (!vProps.empty()) {
+      buffer.flush();
+      for (std::vector<CustomProperty>::iterator iter = vProps.begin(); iter < vProps.end(); ++iter)
+        write_customProp<true>(_out,*iter,i);
+    }
   }
 
 
   for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
   {
-    fh = FaceHandle(i);
-
     //face
-    nV = _be.get_vhandles(fh, vhandles);
-    writeValue(ValueTypeUINT8, _out, nV);
-    for (size_t j=0; j<vhandles.size(); ++j)
-      writeValue(ValueTypeINT32, _out, vhandles[j].idx() );
+    nV = faces.get(i, idx);
+    buffer.put(uint8_t(nV));
+    buffer.put(idx, nV);
 
     // face color
     if ( _opt.face_has_color() ) {
         if ( _opt.color_is_float() ) {
-          cf  = _be.colorAf(fh);
-          writeValue(ValueTypeFLOAT, _out, cf[0]);
-          writeValue(ValueTypeFLOAT, _out, cf[1]);
-          writeValue(ValueTypeFLOAT, _out, cf[2]);
-
-          if ( _opt.color_has_alpha() )
-            writeValue(ValueTypeFLOAT, _out, cf[3]);
+          cf  = fcolorsAf[i];
+          buffer.put(cf.data(), nC);
         } else {
-          c  = _be.colorA(fh);
-          writeValue(ValueTypeUCHAR, _out, (int)c[0]);
-          writeValue(ValueTypeUCHAR, _out, (int)c[1]);
-          writeValue(ValueTypeUCHAR, _out, (int)c[2]);
-
-          if ( _opt.color_has_alpha() )
-            writeValue(ValueTypeUCHAR, _out, (int)c[3]);
+          c  = fcolorsA[i];
+          buffer.put(c.data(), nC);
         }
     }
 
-    for (std::vector<CustomProperty>::iterator iter = fProps.begin(); iter < fProps.end(); ++iter)
-      write_customProp<true>(_out,*iter,i);
+    if (!fProps.empty()) {
+      buffer.flush();
+      for (std::vector<CustomProperty>::iterator iter = fProps.begin(); iter < fProps.end(); ++iter)
+        write_customProp<true>(_out,*iter,i);
+    }
   }
 
-  return true;
+  return buffer.flush();
 }
 
 // ----------------------------------------------------------------------------
@@ -755,11 +758,12 @@ binary_size(BaseExporter& _be, const Options& _writeOptions) const
   else
   {
     unsigned int i, nF;
-    std::vector<VertexHandle> vhandles;
+    const int* idx;
+    FaceIndexReader faces(_be);
 
     for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
     {
-      data += _be.get_vhandles(FaceHandle(i), vhandles) * sizeof(unsigned int);
+      data += faces.get(i, idx) * sizeof(unsigned int);
 
     }
   }
@@ -47,11 +47,12 @@
 
 //STL
 #include <fstream>
+#include <vector>
 
 // OpenMesh
 #include <OpenMesh/Core/System/omstream.hh>
 #include <OpenMesh/Core/Geometry/VectorT.hh>
-#include <OpenMesh/Core/IO/BinaryHelper.hh>
+#include <OpenMesh/Core/IO/BinaryOutBuffer.hh>
 #include <OpenMesh/Core/IO/IOManager.hh>
 #include <OpenMesh/Core/IO/writer/STLWriter.hh>
 
@@ -78,6 +79,19 @@ _STLWriter_::_STLWriter_() { IOManager().register_module(this); }
 //-----------------------------------------------------------------------------
 
 
+/// All vertex positions, the faces refer to them in random order
+static std::vector<Vec3f> read_points(const BaseExporter& _be)
+{
+  std::vector<Vec3f> points(_be.n_vertices());
+  if (!points.empty())
+    _be.points(0, points.size(), points.data());
+  return points;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
 bool
 _STLWriter_::
 write(const std::string& _filename, BaseExporter& _be, const Options& _writeOptions, std::streamsize _precision) const
@@ -157,8 +171,11 @@ write_stla(const std::string& _filename, const BaseExporter& _be, Options /* _op
 
   int i, nF(int(_be.n_faces()));
   Vec3f  a, b, c, n;
-  std::vector<VertexHandle> vhandles;
-  FaceHandle fh;
+  const int* idx;
+
+  BulkReaderT<Vec3f> normals(_be, &BaseExporter::face_normals, _be.n_faces());
+  FaceIndexReader    faces(_be);
+  const std::vector<Vec3f> points = read_points(_be);
 
 
   // header
@@ -168,16 +185,15 @@ write_stla(const std::string& _filename, const BaseExporter& _be, Options /* _op
   // write face set
   for (i=0; i<nF; ++i)
   {
-    fh = FaceHandle(i);
-    const int nV = _be.get_vhandles(fh, vhandles);
+    const int nV = faces.get(i, idx);
 
     if (nV == 3)
     {
-      a = _be.point(vhandles[0]);
-      b = _be.point(vhandles[1]);
-      c = _be.point(vhandles[2]);
+      a = points[idx[0]];
+      b = points[idx[1]];
+      c = points[idx[2]];
       n = (_be.has_face_normals() ?
-     _be.normal(fh) :
+     normals[i] :
      ((c-b) % (a-b)).normalize());
 
       fprintf(out, "facet normal %f %f %f\nouter loop\n", n[0], n[1], n[2]);
@@ -210,8 +226,11 @@ write_stla(std::ostream& _out, const BaseExporter& _be, Options /* _opt */, std:
 
   int i, nF(int(_be.n_faces()));
   Vec3f  a, b, c, n;
-  std::vector<VertexHandle> vhandles;
-  FaceHandle fh;
+  const int* idx;
+
+  BulkReaderT<Vec3f> normals(_be, &BaseExporter::face_normals, _be.n_faces());
+  FaceIndexReader    faces(_be);
+  const std::vector<Vec3f> points = read_points(_be);
   _out.precision(_precision);
 
 
@@ -222,16 +241,15 @@ write_stla(std::ostream& _out, const BaseExporter& _be, Options /* _opt */, std:
   // write face set
   for (i=0; i<nF; ++i)
   {
-    fh = FaceHandle(i);
-    const int nV = _be.get_vhandles(fh, vhandles);
+    const int nV = faces.get(i, idx);
 
     if (nV == 3)
     {
-      a = _be.point(vhandles[0]);
-      b = _be.point(vhandles[1]);
-      c = _be.point(vhandles[2]);
+      a = points[idx[0]];
+      b = points[idx[1]];
+      c = points[idx[2]];
       n = (_be.has_face_normals() ?
-     _be.normal(fh) :
+     normals[i] :
      ((c-b) % (a-b)).normalize());
 
       _out << "facet normal " << n[0] << " " << n[1] << " " << n[2] << "\nouter loop\n";
@@ -272,8 +290,11 @@ write_stlb(const std::string& _filename, const BaseExporter& _be, Options /* _op
 
   int i, nF(int(_be.n_faces()));
   Vec3f  a, b, c, n;
-  std::vector<VertexHandle> vhandles;
-  FaceHandle fh;
+  const int* idx;
+
+  BulkReaderT<Vec3f> normals(_be, &BaseExporter::face_normals, _be.n_faces());
+  FaceIndexReader    faces(_be);
+  const std::vector<Vec3f> points = read_points(_be);
 
 
    // write header
@@ -284,52 +305,43 @@ write_stlb(const std::string& _filename, const BaseExporter& _be, Options /* _op
 
 
   // number of faces
-  write_int( int(_be.n_faces()), out);
+  BinaryOutBuffer buffer(out);
+  buffer.put(int(_be.n_faces()));
 
 
   // write face set
   for (i=0; i<nF; ++i)
   {
-    fh = FaceHandle(i);
-    const int nV = _be.get_vhandles(fh, vhandles);
+    const int nV = faces.get(i, idx);
 
     if (nV == 3)
     {
-      a = _be.point(vhandles[0]);
-      b = _be.point(vhandles[1]);
-      c = _be.point(vhandles[2]);
+      a = points[idx[0]];
+      b = points[idx[1]];
+      c = points[idx[2]];
       n = (_be.has_face_normals() ?
-     _be.normal(fh) :
+     normals[i] :
      ((c-b) % (a-b)).normalize());
 
       // face normal
-      write_float(n[0], out);
-      write_float(n[1], out);
-      write_float(n[2], out);
+      buffer.put(n);
 
       // face vertices
-      write_float(a[0], out);
-      write_float(a[1], out);
-      write_float(a[2], out);
-
-      write_float(b[0], out);
-      write_float(b[1], out);
-      write_float(b[2], out);
-
-      write_float(c[0], out);
-      write_float(c[1], out);
-      write_float(c[2], out);
+      buffer.put(a);
+      buffer.put(b);
+      buffer.put(c);
 
       // space filler
-      write_short(0, out);
+      buffer.put(short(0));
     }
     else
       omerr() << "[STLWriter] : Warning: Skipped non-triangle data!\n";
   }
 
 
+  const bool ok = buffer.flush();
   fclose(out);
-  return true;
+  return ok;
 }
 
 //-----------------------------------------------------------------------------
@@ -343,8 +355,11 @@ write_stlb(std::ostream& _out, const BaseExporter& _be, Options /* _opt */, std:
 
   int i, nF(int(_be.n_faces()));
   Vec3f  a, b, c, n;
-  std::vector<VertexHandle> vhandles;
-  FaceHandle fh;
+  const int* idx;
+
+  BulkReaderT<Vec3f> normals(_be, &BaseExporter::face_normals, _be.n_faces());
+  FaceIndexReader    faces(_be);
+  const std::vector<Vec3f> points = read_points(_be);
   _out.precision(_precision);
 
 
@@ -356,51 +371,41 @@ write_stlb(std::ostream& _out, const BaseExporter& _be, Options /* _opt */, std:
 
 
   // number of faces
-  write_int(int(_be.n_faces()), _out);
+  BinaryOutBuffer buffer(_out);
+  buffer.put(int(_be.n_faces()));
 
 
   // write face set
   for (i=0; i<nF; ++i)
   {
-    fh = FaceHandle(i);
-    const int nV = _be.get_vhandles(fh, vhandles);
+    const int nV = faces.get(i, idx);
 
     if (nV == 3)
     {
-      a = _be.point(vhandles[0]);
-      b = _be.point(vhandles[1]);
-      c = _be.point(vhandles[2]);
+      a = points[idx[0]];
+      b = points[idx[1]];
+      c = points[idx[2]];
       n = (_be.has_face_normals() ?
-     _be.normal(fh) :
+     normals[i] :
      ((c-b) % (a-b)).normalize());
 
       // face normal
-      write_float(n[0], _out);
-      write_float(n[1], _out);
-      write_float(n[2], _out);
+      buffer.put(n);
 
       // face vertices
-      write_float(a[0], _out);
-      write_float(a[1], _out);
-      write_float(a[2], _out);
-
-      write_float(b[0], _out);
-      write_float(b[1], _out);
-      write_float(b[2], _out);
-
-      write_float(c[0], _out);
-      write_float(c[1], _out);
-      write_float(c[2], _out);
+      buffer.put(a);
+      buffer.put(b);
+      buffer.put(c);
 
       // space filler
-      write_short(0, _out);
+      buffer.put(short(0));
     }
     else
       omerr() << "[STLWriter] : Warning: Skipped non-triangle data!\n";
   }
 
 
-  return true;
+  return buffer.flush();
 }
 
 
@@ -419,10 +424,11 @@ binary_size(BaseExporter& _be, const Options& /* _opt */) const
 
 
   int i, nF(int(_be.n_faces()));
-  std::vector<VertexHandle> vhandles;
+  const int* idx;
+  FaceIndexReader faces(_be);
 
   for (i=0; i<nF; ++i)
-    if (_be.get_vhandles(FaceHandle(i), vhandles) == 3)
+    if (faces.get(i, idx) == 3)
       bytes += _12floats + sizeof(short);
     else
       omerr() << "[STLWriter] : Warning: Skipped non-triangle data!\n";
@@ -3,6 +3,7 @@
 #include <fstream>
 #include <limits>
 
+#include <OpenMesh/Core/IO/AsciiOutBuffer.hh>
 #include <OpenMesh/Core/IO/BinaryHelper.hh>
 #include <OpenMesh/Core/IO/writer/VTKWriter.hh>
 #include <OpenMesh/Core/IO/IOManager.hh>
@@ -54,11 +55,12 @@ bool _VTKWriter_::write(std::ostream& _out, BaseExporter& _be, const Options& _w
     omlog() << "[VTKWriter] : write file\n";
     _out.precision(_precision);
 
-    std::vector<VertexHandle> vhandles;
+    const int* idx;
+    FaceIndexReader faces(_be);
     size_t polygon_table_size = 0;
     size_t nf = _be.n_faces();
     for (size_t i = 0; i < nf; ++i) {
-        polygon_table_size += _be.get_vhandles(FaceHandle(int(i)), vhandles);
+        polygon_table_size += faces.get(i, idx);
     }
     polygon_table_size += nf;
 
@@ -68,27 +70,37 @@ bool _VTKWriter_::write(std::ostream& _out, BaseExporter& _be, const Options& _w
     _out << "ASCII\n";
     _out << "DATASET POLYDATA\n";
 
-    // points
+    // points, formatted in parallel
     _out << "POINTS " << _be.n_vertices() << " float\n";
     size_t nv = _be.n_vertices();
-    for (size_t i = 0; i < nv; ++i) {
-        const Vec3f v = _be.point(VertexHandle(int(i)));
-        _out << v[0] << ' ' << v[1] << ' ' << v[2] << '\n';
-    }
+    AsciiOutBuffer out(_out);
+    format_parallel(out, nv, [&](AsciiOutBuffer& _buf, size_t _first, size_t _last) {
+        BulkReaderT<Vec3f> points(_be, &BaseExporter::points, nv);
+        for (size_t i = _first; i < _last; ++i) {
+            _buf.put(points[i]);
+            _buf.put('\n');
+        }
+    }, 1 << 14, _be.concurrent_access() ? 0 : 1);
 
     // faces
-    _out << "POLYGONS " << nf << ' ' << polygon_table_size << '\n';
+    out.put("POLYGONS ");
+    out.put(nf);
+    out.put(' ');
+    out.put(polygon_table_size);
+    out.put('\n');
     for (size_t i = 0; i < nf; ++i) {
-        _be.get_vhandles(FaceHandle(int(i)), vhandles);
+        const size_t nv_face = faces.get(i, idx);
 
-        _out << vhandles.size() << ' ';
-        for (size_t j = 0; j < vhandles.size(); ++j) {
-            _out << " " << vhandles[j].idx();
+        out.put(nv_face);
+        out.put(' ');
+        for (size_t j = 0; j < nv_face; ++j) {
+            out.put(' ');
+            out.put(idx[j]);
         }
-        _out << '\n';
+        out.put('\n');
     }
 
-    return true;
+    return out.flush();
 }
 
 //=============================================================================
@@ -48,7 +48,8 @@ namespace OpenMesh
 
 ArrayKernel::ArrayKernel()
 : refcount_vstatus_(0), refcount_hstatus_(0),
-  refcount_estatus_(0), refcount_fstatus_(0)
+  refcount_estatus_(0), refcount_fstatus_(0),
+  refcount_journal_(0)
 {
   init_bit_masks(); //Status bit masks initialization
 }
@@ -70,9 +71,15 @@ ArrayKernel::~ArrayKernel()
 
 void ArrayKernel::assign_connectivity(const ArrayKernel& _other)
 {
+  // shares the arrays if copy-on-write is enabled in _other, the setting
+  // of this kernel is kept
+  const bool cow = copy_on_write();
   vertices_ = _other.vertices_;
   edges_ = _other.edges_;
   faces_ = _other.faces_;
+  vertices_.enable(cow);
+  edges_.enable(cow);
+  faces_.enable(cow);
   
   vprops_resize(n_vertices());
   hprops_resize(n_halfedges());
@@ -93,12 +100,45 @@ void ArrayKernel::assign_connectivity(const ArrayKernel& _other)
   refcount_vstatus_ = _other.refcount_vstatus_ > 0 ? 1 : 0;
   refcount_hstatus_ = _other.refcount_hstatus_ > 0 ? 1 : 0;
   refcount_fstatus_ = _other.refcount_fstatus_ > 0 ? 1 : 0;
+
+  // the journal of this kernel does not describe the new connectivity
+  journal_.reset();
+}
+
+void ArrayKernel::set_copy_on_write(bool _yn)
+{
+  BaseKernel::set_copy_on_write(_yn);
+
+  vertices_.enable(_yn);
+  edges_.enable(_yn);
+  faces_.enable(_yn);
+
+  halfedge_bit_masks_.enable(_yn);
+  edge_bit_masks_.enable(_yn);
+  vertex_bit_masks_.enable(_yn);
+  face_bit_masks_.enable(_yn);
+}
+
+bool ArrayKernel::set_memory_resource(MemoryResource* _resource)
+{
+  if (!BaseKernel::set_memory_resource(_resource))
+    return false;
+
+  rehome(vertices_, _resource);
+  rehome(edges_, _resource);
+  rehome(faces_, _resource);
+
+  rehome(halfedge_bit_masks_, _resource);
+  rehome(edge_bit_masks_, _resource);
+  rehome(vertex_bit_masks_, _resource);
+  rehome(face_bit_masks_, _resource);
+  return true;
 }
 
 // --- handle -> item ---
 VertexHandle ArrayKernel::handle(const Vertex& _v) const
 {
-   return VertexHandle( int( &_v - &vertices_.front()));
+   return VertexHandle( int( &_v - &vertices_.read().front()));
 }
 
 HalfedgeHandle ArrayKernel::handle(const Halfedge& _he) const
@@ -107,21 +147,21 @@ HalfedgeHandle ArrayKernel::handle(const Halfedge& _he) const
   // There are two halfedges stored per edge
   // Get memory position inside edge vector and devide by size of an edge
   // to get the corresponding edge for the requested halfedge
-  size_t eh = ( (char*)&_he - (char*)&edges_.front() ) /  sizeof(Edge)  ;
-  assert((&_he == &edges_[eh].halfedges_[0]) ||
-         (&_he == &edges_[eh].halfedges_[1]));
-  return ((&_he == &edges_[eh].halfedges_[0]) ?
+  size_t eh = ( (char*)&_he - (char*)&edges_.read().front() ) /  sizeof(Edge)  ;
+  assert((&_he == &edges_.read()[eh].halfedges_[0]) ||
+         (&_he == &edges_.read()[eh].halfedges_[1]));
+  return ((&_he == &edges_.read()[eh].halfedges_[0]) ?
                     HalfedgeHandle( int(eh)<<1) : HalfedgeHandle((int(eh)<<1)+1));
 }
 
 EdgeHandle ArrayKernel::handle(const Edge& _e) const
 {
-  return EdgeHandle( int(&_e - &edges_.front() ) );
+  return EdgeHandle( int(&_e - &edges_.read().front() ) );
 }
 
 FaceHandle ArrayKernel::handle(const Face& _f) const
 {
-  return FaceHandle( int(&_f - &faces_.front()) );
+  return FaceHandle( int(&_f - &faces_.read().front()) );
 }
 
 #define SIGNED(x) signed( (x) )
@@ -157,6 +197,7 @@ unsigned int ArrayKernel::delete_isolated_vertices()
     if (is_isolated(handle(*v_it)))
     {
       status(handle(*v_it)).set_deleted(true);
+      journal_.deleted(handle(*v_it));
       n_isolated++;
     }
   }
@@ -171,27 +212,150 @@ void ArrayKernel::garbage_collection(bool _v, bool _e, bool _f)
   garbage_collection( empty_vh,empty_hh,empty_fh,_v, _e, _f);
 }
 
+namespace {
+
+// Apply the permutation _order (new -> old) by swapping elements in place.
+// _swap(i, j) exchanges the elements at positions i and j.
+template <class HandleT, class SwapT>
+void apply_permutation(const std::vector<HandleT>& _order, SwapT _swap)
+{
+  const int n = int(_order.size());
+
+  // where[old] = current position of old element, who[pos] = old element at pos
+  std::vector<int> where(n), who(n);
+  for (int i = 0; i < n; ++i)
+    where[i] = who[i] = i;
+
+  for (int i = 0; i < n; ++i)
+  {
+    const int j = where[_order[i].idx()];
+    if (j == i)
+      continue;
+
+    _swap(i, j);
+
+    std::swap(who[i], who[j]);
+    where[who[i]] = i;
+    where[who[j]] = j;
+  }
+}
+
+}
+
+void ArrayKernel::permute(const std::vector<VertexHandle>& _vertex_order,
+                          const std::vector<EdgeHandle>&   _edge_order,
+                          const std::vector<FaceHandle>&   _face_order)
+{
+  assert(_vertex_order.empty() || _vertex_order.size() == n_vertices());
+  assert(_edge_order.empty()   || _edge_order.size()   == n_edges());
+  assert(_face_order.empty()   || _face_order.size()   == n_faces());
+
+  // old index -> new handle
+  std::vector<VertexHandle>   vh_map(n_vertices());
+  std::vector<HalfedgeHandle> hh_map(n_halfedges());
+  std::vector<FaceHandle>     fh_map(n_faces());
+
+  for (size_t i = 0; i < vh_map.size(); ++i)
+    vh_map[_vertex_order.empty() ? i : _vertex_order[i].idx()] = VertexHandle(int(i));
+  for (size_t i = 0; i < n_edges(); ++i)
+  {
+    const size_t e = _edge_order.empty() ? i : _edge_order[i].idx();
+    hh_map[2*e]   = HalfedgeHandle(int(2*i));
+    hh_map[2*e+1] = HalfedgeHandle(int(2*i+1));
+  }
+  for (size_t i = 0; i < fh_map.size(); ++i)
+    fh_map[_face_order.empty() ? i : _face_order[i].idx()] = FaceHandle(int(i));
+
+  VertexContainer& vertices = vertices_.write();
+  EdgeContainer&   edges    = edges_.write();
+  FaceContainer&   faces    = faces_.write();
+
+  // move the elements and their properties
+  if (!_vertex_order.empty())
+  {
+    apply_permutation(_vertex_order, [&](int _i, int _j)
+    {
+      std::swap(vertices[_i], vertices[_j]);
+      vprops_swap(_i, _j);
+    });
+  }
+
+  if (!_edge_order.empty())
+  {
+    apply_permutation(_edge_order, [&](int _i, int _j)
+    {
+      std::swap(edges[_i], edges[_j]);
+      eprops_swap(_i, _j);
+      hprops_swap(2*_i,   2*_j);
+      hprops_swap(2*_i+1, 2*_j+1);
+    });
+  }
+
+  if (!_face_order.empty())
+  {
+    apply_permutation(_face_order, [&](int _i, int _j)
+    {
+      std::swap(faces[_i], faces[_j]);
+      fprops_swap(_i, _j);
+    });
+  }
+
+  // update the connectivity
+  for (size_t i = 0; i < vertices.size(); ++i)
+  {
+    HalfedgeHandle& hh = vertices[i].halfedge_handle_;
+    if (hh.is_valid())
+      hh = hh_map[hh.idx()];
+  }
+
+  for (size_t i = 0; i < edges.size(); ++i)
+  {
+    for (int k = 0; k < 2; ++k)
+    {
+      Halfedge& he = edges[i].halfedges_[k];
+      if (he.vertex_handle_.is_valid())
+        he.vertex_handle_ = vh_map[he.vertex_handle_.idx()];
+      if (he.face_handle_.is_valid())
+        he.face_handle_ = fh_map[he.face_handle_.idx()];
+      if (he.next_halfedge_handle_.is_valid())
+        he.next_halfedge_handle_ = hh_map[he.next_halfedge_handle_.idx()];
+      if (he.prev_halfedge_handle_.is_valid())
+        he.prev_halfedge_handle_ = hh_map[he.prev_halfedge_handle_.idx()];
+    }
+  }
+
+  for (size_t i = 0; i < faces.size(); ++i)
+  {
+    HalfedgeHandle& hh = faces[i].halfedge_handle_;
+    if (hh.is_valid())
+      hh = hh_map[hh.idx()];
+  }
+
+  journal_.reset();
+}
+
 void ArrayKernel::clean_keep_reservation()
 {
-    vertices_.clear();
+    vertices_.write().clear();
 
-    edges_.clear();
+    edges_.write().clear();
 
-    faces_.clear();
+    faces_.write().clear();
+
+    journal_.reset();
 
 }
 
 void ArrayKernel::clean()
 {
 
-  vertices_.clear();
-  VertexContainer().swap( vertices_ );
+  vertices_.release();
+
+  edges_.release();
 
-  edges_.clear();
-  EdgeContainer().swap( edges_ );
+  faces_.release();
 
-  faces_.clear();
-  FaceContainer().swap( faces_ );
+  journal_.reset();
 
 }
 
@@ -210,21 +374,23 @@ void ArrayKernel::clear()
 
 void ArrayKernel::resize( size_t _n_vertices, size_t _n_edges, size_t _n_faces )
 {
-  vertices_.resize(_n_vertices);
-  edges_.resize(_n_edges);
-  faces_.resize(_n_faces);
+  vertices_.write().resize(_n_vertices);
+  edges_.write().resize(_n_edges);
+  faces_.write().resize(_n_faces);
 
   vprops_resize(n_vertices());
   hprops_resize(n_halfedges());
   eprops_resize(n_edges());
   fprops_resize(n_faces());
+
+  journal_.reset();
 }
 
 void ArrayKernel::reserve(size_t _n_vertices, size_t _n_edges, size_t _n_faces )
 {
-  vertices_.reserve(_n_vertices);
-  edges_.reserve(_n_edges);
-  faces_.reserve(_n_faces);
+  vertices_.write().reserve(_n_vertices);
+  edges_.write().reserve(_n_edges);
+  faces_.write().reserve(_n_faces);
 
   vprops_reserve(_n_vertices);
   hprops_reserve(_n_edges*2);
@@ -243,10 +409,10 @@ void ArrayKernel::init_bit_masks(BitMaskContainer& _bmc)
 
 void ArrayKernel::init_bit_masks()
 {
-  init_bit_masks(vertex_bit_masks_);
-  edge_bit_masks_ = vertex_bit_masks_;//init_bit_masks(edge_bit_masks_);
-  face_bit_masks_ = vertex_bit_masks_;//init_bit_masks(face_bit_masks_);
-  halfedge_bit_masks_= vertex_bit_masks_;//init_bit_masks(halfedge_bit_masks_);
+  init_bit_masks(vertex_bit_masks_.write());
+  edge_bit_masks_.write() = vertex_bit_masks_.read();//init_bit_masks(edge_bit_masks_);
+  face_bit_masks_.write() = vertex_bit_masks_.read();//init_bit_masks(face_bit_masks_);
+  halfedge_bit_masks_.write() = vertex_bit_masks_.read();//init_bit_masks(halfedge_bit_masks_);
 }
 
 
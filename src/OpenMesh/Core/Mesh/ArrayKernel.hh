@@ -58,10 +58,14 @@
 
 #include <OpenMesh/Core/System/config.h>
 #include <OpenMesh/Core/Utils/GenProg.hh>
+#include <OpenMesh/Core/Utils/BitOps.hh>
+#include <OpenMesh/Core/Utils/CopyOnWriteT.hh>
+#include <OpenMesh/Core/Utils/MemoryResource.hh>
 
 #include <OpenMesh/Core/Mesh/ArrayItems.hh>
 #include <OpenMesh/Core/Mesh/BaseKernel.hh>
 #include <OpenMesh/Core/Mesh/Status.hh>
+#include <OpenMesh/Core/Mesh/TopologyJournal.hh>
 
 //== NAMESPACES ===============================================================
 namespace OpenMesh {
@@ -75,7 +79,8 @@ namespace OpenMesh {
     This mesh kernel uses the std::vector as container to store the
     mesh items. Therefore all handle types are internally represented
     by integers. To get the index from a handle use the handle's \c
-    idx() method.
+    idx() method. The vectors allocate through ResourceAllocatorT, see
+    BaseKernel::set_memory_resource().
 
     \note For a description of the minimal kernel interface see
     OpenMesh::Mesh::BaseKernel.
@@ -98,6 +103,8 @@ public:
   typedef HPropHandleT<StatusInfo>          HalfedgeStatusPropertyHandle;
   typedef EPropHandleT<StatusInfo>          EdgeStatusPropertyHandle;
   typedef FPropHandleT<StatusInfo>          FaceStatusPropertyHandle;
+  /// Class of the status properties, the same for all traits (see PropertyTypeT)
+  typedef PropertyTypeT<StatusInfo, false>::type StatusProperty;
 
 public:
 
@@ -107,12 +114,21 @@ public:
 
   /** ArrayKernel uses the default copy constructor and assignment operator, which means
       that the connectivity and all properties are copied, including reference
-      counters, allocated bit status masks, etc.. In contrast assign_connectivity
+      counters, allocated bit status masks, etc.. With set_copy_on_write() the copy
+      shares all of these arrays with the original instead. In contrast assign_connectivity
       copies only the connectivity, i.e. vertices, edges, faces and their status fields.
       NOTE: The geometry (the points property) is NOT copied. Poly/TriConnectivity
       override(and hide) that function to provide connectivity consistence.*/
   void assign_connectivity(const ArrayKernel& _other);
 
+  /// Enables copy-on-write for the properties and the connectivity
+  /// arrays, see BaseKernel::set_copy_on_write().
+  void set_copy_on_write(bool _yn) override;
+
+  /// Moves the properties and the connectivity arrays into \p _resource,
+  /// see BaseKernel::set_memory_resource().
+  bool set_memory_resource(MemoryResource* _resource) override;
+
   // --- handle -> item ---
   VertexHandle handle(const Vertex& _v) const;
 
@@ -140,55 +156,55 @@ public:
   const Vertex& vertex(VertexHandle _vh) const
   {
     assert(is_valid_handle(_vh));
-    return vertices_[_vh.idx()];
+    return vertices_.read()[_vh.idx()];
   }
 
   Vertex& vertex(VertexHandle _vh)
   {
     assert(is_valid_handle(_vh));
-    return vertices_[_vh.idx()];
+    return vertices_.write()[_vh.idx()];
   }
 
   const Halfedge& halfedge(HalfedgeHandle _heh) const
   {
     assert(is_valid_handle(_heh));
-    return edges_[_heh.idx() >> 1].halfedges_[_heh.idx() & 1];
+    return edges_.read()[_heh.idx() >> 1].halfedges_[_heh.idx() & 1];
   }
 
   Halfedge& halfedge(HalfedgeHandle _heh)
   {
     assert(is_valid_handle(_heh));
-    return edges_[_heh.idx() >> 1].halfedges_[_heh.idx() & 1];
+    return edges_.write()[_heh.idx() >> 1].halfedges_[_heh.idx() & 1];
   }
 
   const Edge& edge(EdgeHandle _eh) const
   {
     assert(is_valid_handle(_eh));
-    return edges_[_eh.idx()];
+    return edges_.read()[_eh.idx()];
   }
 
   Edge& edge(EdgeHandle _eh)
   {
     assert(is_valid_handle(_eh));
-    return edges_[_eh.idx()];
+    return edges_.write()[_eh.idx()];
   }
 
   const Face& face(FaceHandle _fh) const
   {
     assert(is_valid_handle(_fh));
-    return faces_[_fh.idx()];
+    return faces_.read()[_fh.idx()];
   }
 
   Face& face(FaceHandle _fh)
   {
     assert(is_valid_handle(_fh));
-    return faces_[_fh.idx()];
+    return faces_.write()[_fh.idx()];
   }
 
   // --- get i'th items ---
 
   VertexHandle vertex_handle(unsigned int _i) const
-  { return (_i < n_vertices()) ? handle( vertices_[_i] ) : VertexHandle(); }
+  { return (_i < n_vertices()) ? handle( vertices_.read()[_i] ) : VertexHandle(); }
 
   HalfedgeHandle halfedge_handle(unsigned int _i) const
   {
@@ -197,10 +213,10 @@ public:
   }
 
   EdgeHandle edge_handle(unsigned int _i) const
-  { return (_i < n_edges()) ? handle(edges_[_i]) : EdgeHandle(); }
+  { return (_i < n_edges()) ? handle(edges_.read()[_i]) : EdgeHandle(); }
 
   FaceHandle face_handle(unsigned int _i) const
-  { return (_i < n_faces()) ? handle(faces_[_i]) : FaceHandle(); }
+  { return (_i < n_faces()) ? handle(faces_.read()[_i]) : FaceHandle(); }
 
 public:
 
@@ -215,10 +231,12 @@ public:
    */
   inline VertexHandle new_vertex()
   {
-    vertices_.push_back(Vertex());
+    vertices_.write().push_back(Vertex());
     vprops_resize(n_vertices());//TODO:should it be push_back()?
 
-    return handle(vertices_.back());
+    const VertexHandle vh = handle(vertices_.read().back());
+    journal_.created(vh);
+    return vh;
   }
 
   /**
@@ -233,20 +251,23 @@ public:
    */
   inline VertexHandle new_vertex_dirty()
   {
-    vertices_.push_back(Vertex());
+    vertices_.write().push_back(Vertex());
     vprops_resize_if_smaller(n_vertices());//TODO:should it be push_back()?
 
-    return handle(vertices_.back());
+    const VertexHandle vh = handle(vertices_.read().back());
+    journal_.created(vh);
+    return vh;
   }
 
   inline HalfedgeHandle new_edge(VertexHandle _start_vh, VertexHandle _end_vh)
   {
 //     assert(_start_vh != _end_vh);
-    edges_.push_back(Edge());
+    edges_.write().push_back(Edge());
     eprops_resize(n_edges());//TODO:should it be push_back()?
     hprops_resize(n_halfedges());//TODO:should it be push_back()?
 
-    EdgeHandle eh(handle(edges_.back()));
+    EdgeHandle eh(handle(edges_.read().back()));
+    journal_.created(eh);
     HalfedgeHandle heh0(halfedge_handle(eh, 0));
     HalfedgeHandle heh1(halfedge_handle(eh, 1));
     set_vertex_handle(heh0, _end_vh);
@@ -256,16 +277,20 @@ public:
 
   inline FaceHandle new_face()
   {
-    faces_.push_back(Face());
+    faces_.write().push_back(Face());
     fprops_resize(n_faces());
-    return handle(faces_.back());
+    const FaceHandle fh = handle(faces_.read().back());
+    journal_.created(fh);
+    return fh;
   }
 
   inline FaceHandle new_face(const Face& _f)
   {
-    faces_.push_back(_f);
+    faces_.write().push_back(_f);
     fprops_resize(n_faces());
-    return handle(faces_.back());
+    const FaceHandle fh = handle(faces_.read().back());
+    journal_.created(fh);
+    return fh;
   }
 
 public:
@@ -318,6 +343,24 @@ public:
                           std_API_Container_FHandlePointer& fh_to_update,
                           bool _v=true, bool _e=true, bool _f=true);
 
+  // --- reordering ---
+  /** \brief Permute vertices, edges and faces
+   *
+   * \c _vertex_order[i] is the vertex which gets index \c i, analogously for
+   * edges and faces. Each order has to be a permutation of all elements of
+   * its type (including deleted ones), an empty vector leaves the elements
+   * of that type in place. The halfedges follow their edges.
+   *
+   * All properties, including the status, are permuted along with the
+   * elements and the connectivity is updated accordingly.
+   *
+   * \note Permuting invalidates all handles, see OpenMesh::Utils::MeshReorderT
+   *       for a tool that also reports the handle mapping.
+   */
+  void permute(const std::vector<VertexHandle>& _vertex_order,
+               const std::vector<EdgeHandle>&   _edge_order,
+               const std::vector<FaceHandle>&   _face_order);
+
   /// \brief Does the same as clean() and in addition erases all properties.
   void clear();
 
@@ -342,15 +385,15 @@ public:
   void clean_keep_reservation();
 
   // --- number of items ---
-  size_t n_vertices()  const override  { return vertices_.size(); }
-  size_t n_halfedges() const override { return 2*edges_.size(); }
-  size_t n_edges()     const override { return edges_.size(); }
-  size_t n_faces()     const override { return faces_.size(); }
+  size_t n_vertices()  const override  { return vertices_.read().size(); }
+  size_t n_halfedges() const override { return 2*edges_.read().size(); }
+  size_t n_edges()     const override { return edges_.read().size(); }
+  size_t n_faces()     const override { return faces_.read().size(); }
 
-  bool vertices_empty()  const { return vertices_.empty(); }
-  bool halfedges_empty() const { return edges_.empty(); }
-  bool edges_empty()     const { return edges_.empty(); }
-  bool faces_empty()     const { return faces_.empty(); }
+  bool vertices_empty()  const { return vertices_.read().empty(); }
+  bool halfedges_empty() const { return edges_.read().empty(); }
+  bool edges_empty()     const { return edges_.read().empty(); }
+  bool faces_empty()     const { return faces_.read().empty(); }
 
   // --- vertex connectivity ---
 
@@ -361,13 +404,17 @@ public:
   {
 //     assert(is_valid_handle(_heh));
     vertex(_vh).halfedge_handle_ = _heh;
+    journal_.touch(_vh);
   }
 
   bool is_isolated(VertexHandle _vh) const
   { return !halfedge_handle(_vh).is_valid(); }
 
   void set_isolated(VertexHandle _vh)
-  { vertex(_vh).halfedge_handle_.invalidate(); }
+  {
+    vertex(_vh).halfedge_handle_.invalidate();
+    journal_.touch(_vh);
+  }
 
   unsigned int delete_isolated_vertices();
 
@@ -382,6 +429,8 @@ public:
   {
 //     assert(is_valid_handle(_vh));
     halfedge(_heh).vertex_handle_ = _vh;
+    journal_.touch(_heh);
+    journal_.touch(_vh);
   }
 
   FaceHandle face_handle(HalfedgeHandle _heh) const
@@ -391,10 +440,15 @@ public:
   {
 //     assert(is_valid_handle(_fh));
     halfedge(_heh).face_handle_ = _fh;
+    journal_.touch(_heh);
+    journal_.touch(_fh);
   }
 
   void set_boundary(HalfedgeHandle _heh)
-  { halfedge(_heh).face_handle_.invalidate(); }
+  {
+    halfedge(_heh).face_handle_.invalidate();
+    journal_.touch(_heh);
+  }
 
   /// Is halfedge _heh a boundary halfedge (is its face handle invalid) ?
   bool is_boundary(HalfedgeHandle _heh) const
@@ -409,6 +463,10 @@ public:
 //     assert(to_vertex_handle(_heh) == from_vertex_handle(_nheh));
     halfedge(_heh).next_halfedge_handle_ = _nheh;
     set_prev_halfedge_handle(_nheh, _heh);
+    journal_.touch(_heh);
+    journal_.touch(_nheh);
+    journal_.touch(halfedge(_heh).vertex_handle_);
+    journal_.touch(halfedge(_heh).face_handle_);
   }
 
 
@@ -496,46 +554,46 @@ public:
   {
 //     assert(is_valid_handle(_heh));
     face(_fh).halfedge_handle_ = _heh;
+    journal_.touch(_fh);
   }
 
   /// Status Query API
   //------------------------------------------------------------ vertex status
   const StatusInfo&                         status(VertexHandle _vh) const
-  { return property(vertex_status_, _vh); }
+  { return property(vertex_status_)[_vh.idx()]; }
 
   StatusInfo&                               status(VertexHandle _vh)
-  { return property(vertex_status_, _vh); }
+  { return property(vertex_status_)[_vh.idx()]; }
 
   /**
    * Reinitializes the status of all vertices using the StatusInfo default
    * constructor, i.e. all flags will be set to false.
    */
   void reset_status() {
-      PropertyT<StatusInfo> &status_prop = property(vertex_status_);
-      PropertyT<StatusInfo>::vector_type &sprop_v = status_prop.data_vector();
+      StatusProperty::vector_type &sprop_v = property(vertex_status_).data_vector();
       std::fill(sprop_v.begin(), sprop_v.begin() + n_vertices(), StatusInfo());
   }
 
   //----------------------------------------------------------- halfedge status
   const StatusInfo&                         status(HalfedgeHandle _hh) const
-  { return property(halfedge_status_, _hh);  }
+  { return property(halfedge_status_)[_hh.idx()]; }
 
   StatusInfo&                               status(HalfedgeHandle _hh)
-  { return property(halfedge_status_, _hh); }
+  { return property(halfedge_status_)[_hh.idx()]; }
 
   //--------------------------------------------------------------- edge status
   const StatusInfo&                         status(EdgeHandle _eh) const
-  { return property(edge_status_, _eh); }
+  { return property(edge_status_)[_eh.idx()]; }
 
   StatusInfo&                               status(EdgeHandle _eh)
-  { return property(edge_status_, _eh); }
+  { return property(edge_status_)[_eh.idx()]; }
 
   //--------------------------------------------------------------- face status
   const StatusInfo&                         status(FaceHandle _fh) const
-  { return property(face_status_, _fh); }
+  { return property(face_status_)[_fh.idx()]; }
 
   StatusInfo&                               status(FaceHandle _fh)
-  { return property(face_status_, _fh); }
+  { return property(face_status_)[_fh.idx()]; }
 
   inline bool                               has_vertex_status() const
   { return vertex_status_.is_valid();    }
@@ -624,6 +682,69 @@ public:
       remove_property(face_status_);
   }
 
+  /** \name Topology journal
+   *
+   * If requested, all changes of the connectivity are recorded in a
+   * TopologyJournal, see there. Requests are reference counted like the
+   * status requests.
+   */
+  //@{
+
+  void request_journal()
+  {
+    if (!refcount_journal_++)
+      journal_.enable(true);
+  }
+
+  void release_journal()
+  {
+    if ((refcount_journal_ > 0) && (! --refcount_journal_))
+      journal_.enable(false);
+  }
+
+  bool has_journal() const { return journal_.enabled(); }
+
+  TopologyJournal&       journal()       { return journal_; }
+  const TopologyJournal& journal() const { return journal_; }
+
+  //@}
+
+  /// --- Bulk status API ---
+
+  /*!
+  Operations on the status of all elements of one type at once. The element
+  type is selected by the (unused) handle argument, e.g.
+  \code
+  mesh.set_status_bits(VertexHandle(), Attributes::SELECTED, false);
+  \endcode
+  clears the selection of all vertices. The loops run over the raw status
+  words and are vectorized by the compiler, so they are bound by memory
+  bandwidth. Without status for the element type nothing is changed and
+  no bits are reported.
+  */
+
+  /// Set (or clear, if \p _value is false) \p _bits on the elements with index in [\p _begin, \p _end).
+  template <class HandleT>
+  void set_status_bits(HandleT _hnd, unsigned int _bits, bool _value = true,
+                       size_t _begin = 0, size_t _end = size_t(-1));
+
+  /// Number of elements with at least one of \p _bits set.
+  template <class HandleT>
+  size_t count_status_bits(HandleT _hnd, unsigned int _bits) const;
+
+  /// Returns true if at least one element has one of \p _bits set.
+  template <class HandleT>
+  bool any_status_bits(HandleT _hnd, unsigned int _bits) const;
+
+  /** Store for each element whether one of \p _bits is set, packed into
+      \p _words with 64 elements per word (bit i%64 of word i/64). */
+  template <class HandleT>
+  void pack_status_bits(HandleT _hnd, unsigned int _bits, std::vector<uint64_t>& _words) const;
+
+  /// Call \p _f(handle) for each element with one of \p _bits set, in ascending order.
+  template <class HandleT, class Functor>
+  void for_each_status_bits(HandleT _hnd, unsigned int _bits, Functor _f) const;
+
   /// --- StatusSet API ---
 
   /*! 
@@ -664,25 +785,11 @@ public:
 
     //! Note: 0(n) complexity
     size_t size() const
-    {
-      const int n = kernel_.status_pph(Handle()).is_valid() ?
-       (int)kernel_.property(kernel_.status_pph(Handle())).n_elements() : 0;
- 
-      size_t sz = 0;
-      for (int i = 0; i < n; ++i)
-        sz += (size_t)is_in(Handle(i));
-      return sz;
-    }
+    { return kernel_.count_status_bits(Handle(), bit_mask_); }
 
     //! Note: O(n) complexity
     void clear()
-    {
-      const int n = kernel_.status_pph(Handle()).is_valid() ?
-       (int)kernel_.property(kernel_.status_pph(Handle())).n_elements() : 0;
-
-      for (int i = 0; i < n; ++i)
-        erase(Handle(i));
-    }
+    { kernel_.set_status_bits(Handle(), bit_mask_, false); }
   };
 
   friend class StatusSetT<VertexHandle>;
@@ -820,42 +927,42 @@ public:
 
 private:
   // iterators
-  typedef std::vector<Vertex>                VertexContainer;
-  typedef std::vector<Edge>                  EdgeContainer;
-  typedef std::vector<Face>                  FaceContainer;
+  typedef std::vector<Vertex, ResourceAllocatorT<Vertex> > VertexContainer;
+  typedef std::vector<Edge, ResourceAllocatorT<Edge> >     EdgeContainer;
+  typedef std::vector<Face, ResourceAllocatorT<Face> >     FaceContainer;
   typedef VertexContainer::iterator          KernelVertexIter;
   typedef VertexContainer::const_iterator    KernelConstVertexIter;
   typedef EdgeContainer::iterator            KernelEdgeIter;
   typedef EdgeContainer::const_iterator      KernelConstEdgeIter;
   typedef FaceContainer::iterator            KernelFaceIter;
   typedef FaceContainer::const_iterator      KernelConstFaceIter;
-  typedef std::vector<unsigned int>          BitMaskContainer;
+  typedef std::vector<unsigned int, ResourceAllocatorT<unsigned int> > BitMaskContainer;
 
 
-  KernelVertexIter      vertices_begin()        { return vertices_.begin(); }
-  KernelConstVertexIter vertices_begin() const  { return vertices_.begin(); }
-  KernelVertexIter      vertices_end()          { return vertices_.end(); }
-  KernelConstVertexIter vertices_end() const    { return vertices_.end(); }
+  KernelVertexIter      vertices_begin()        { return vertices_.write().begin(); }
+  KernelConstVertexIter vertices_begin() const  { return vertices_.read().begin(); }
+  KernelVertexIter      vertices_end()          { return vertices_.write().end(); }
+  KernelConstVertexIter vertices_end() const    { return vertices_.read().end(); }
 
-  KernelEdgeIter        edges_begin()           { return edges_.begin(); }
-  KernelConstEdgeIter   edges_begin() const     { return edges_.begin(); }
-  KernelEdgeIter        edges_end()             { return edges_.end(); }
-  KernelConstEdgeIter   edges_end() const       { return edges_.end(); }
+  KernelEdgeIter        edges_begin()           { return edges_.write().begin(); }
+  KernelConstEdgeIter   edges_begin() const     { return edges_.read().begin(); }
+  KernelEdgeIter        edges_end()             { return edges_.write().end(); }
+  KernelConstEdgeIter   edges_end() const       { return edges_.read().end(); }
 
-  KernelFaceIter        faces_begin()           { return faces_.begin(); }
-  KernelConstFaceIter   faces_begin() const     { return faces_.begin(); }
-  KernelFaceIter        faces_end()             { return faces_.end(); }
-  KernelConstFaceIter   faces_end() const       { return faces_.end(); }
+  KernelFaceIter        faces_begin()           { return faces_.write().begin(); }
+  KernelConstFaceIter   faces_begin() const     { return faces_.read().begin(); }
+  KernelFaceIter        faces_end()             { return faces_.write().end(); }
+  KernelConstFaceIter   faces_end() const       { return faces_.read().end(); }
 
   /// bit mask container by handle
   inline BitMaskContainer&                  bit_masks(VertexHandle /*_dummy_hnd*/)
-  { return vertex_bit_masks_; }
+  { return vertex_bit_masks_.write(); }
   inline BitMaskContainer&                  bit_masks(EdgeHandle /*_dummy_hnd*/)
-  { return edge_bit_masks_; }
+  { return edge_bit_masks_.write(); }
   inline BitMaskContainer&                  bit_masks(FaceHandle /*_dummy_hnd*/)
-  { return face_bit_masks_; }
+  { return face_bit_masks_.write(); }
   inline BitMaskContainer&                  bit_masks(HalfedgeHandle /*_dummy_hnd*/)
-  { return halfedge_bit_masks_; }
+  { return halfedge_bit_masks_.write(); }
 
   template <class Handle>
   unsigned int                              pop_bit_mask(Handle _hnd)
@@ -889,15 +996,18 @@ protected:
   unsigned int                              refcount_estatus_;
   unsigned int                              refcount_fstatus_;
 
+  TopologyJournal                           journal_;
+  unsigned int                              refcount_journal_;
+
 private:
-  VertexContainer                           vertices_;
-  EdgeContainer                             edges_;
-  FaceContainer                             faces_;
-
-  BitMaskContainer                          halfedge_bit_masks_;
-  BitMaskContainer                          edge_bit_masks_;
-  BitMaskContainer                          vertex_bit_masks_;
-  BitMaskContainer                          face_bit_masks_;
+  CopyOnWriteT<VertexContainer>             vertices_;
+  CopyOnWriteT<EdgeContainer>               edges_;
+  CopyOnWriteT<FaceContainer>               faces_;
+
+  CopyOnWriteT<BitMaskContainer>            halfedge_bit_masks_;
+  CopyOnWriteT<BitMaskContainer>            edge_bit_masks_;
+  CopyOnWriteT<BitMaskContainer>            vertex_bit_masks_;
+  CopyOnWriteT<BitMaskContainer>            face_bit_masks_;
 };
 
 
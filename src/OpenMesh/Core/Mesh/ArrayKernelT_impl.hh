@@ -104,6 +104,7 @@ void ArrayKernel::garbage_collection(std_API_Container_VHandlePointer& vh_to_upd
   // remove deleted vertices
   if (_v && n_vertices() > 0 && this->has_vertex_status() )
   {
+    VertexContainer& vertices = vertices_.write();
     i0=0;  i1=nV-1;
 
     while (1)
@@ -121,12 +122,12 @@ void ArrayKernel::garbage_collection(std_API_Container_VHandlePointer& vh_to_upd
       }
 
       // swap
-      std::swap(vertices_[i0], vertices_[i1]);
+      std::swap(vertices[i0], vertices[i1]);
       std::swap(vh_map[i0],  vh_map[i1]);
       vprops_swap(i0, i1);
     };
 
-    vertices_.resize(status(VertexHandle(i0)).deleted() ? i0 : i0+1);
+    vertices.resize(status(VertexHandle(i0)).deleted() ? i0 : i0+1);
     vprops_resize(n_vertices());
   }
 
@@ -134,6 +135,7 @@ void ArrayKernel::garbage_collection(std_API_Container_VHandlePointer& vh_to_upd
   // remove deleted edges
   if (_e && n_edges() > 0 && this->has_edge_status() )
   {
+    EdgeContainer& edges = edges_.write();
     i0=0;  i1=nE-1;
 
     while (1)
@@ -154,7 +156,7 @@ void ArrayKernel::garbage_collection(std_API_Container_VHandlePointer& vh_to_upd
       }
 
       // swap
-      std::swap(edges_[i0], edges_[i1]);
+      std::swap(edges[i0], edges[i1]);
       std::swap(hh_map[2*i0], hh_map[2*i1]);
       std::swap(hh_map[2*i0+1], hh_map[2*i1+1]);
       eprops_swap(i0, i1);
@@ -162,7 +164,7 @@ void ArrayKernel::garbage_collection(std_API_Container_VHandlePointer& vh_to_upd
       hprops_swap(2*i0+1, 2*i1+1);
     };
 
-    edges_.resize(status(EdgeHandle(i0)).deleted() ? i0 : i0+1);
+    edges.resize(status(EdgeHandle(i0)).deleted() ? i0 : i0+1);
     eprops_resize(n_edges());
     hprops_resize(n_halfedges());
   }
@@ -171,6 +173,7 @@ void ArrayKernel::garbage_collection(std_API_Container_VHandlePointer& vh_to_upd
   // remove deleted faces
   if (_f && n_faces() > 0 && this->has_face_status() )
   {
+    FaceContainer& faces = faces_.write();
     i0=0;  i1=nF-1;
 
     while (1)
@@ -188,12 +191,12 @@ void ArrayKernel::garbage_collection(std_API_Container_VHandlePointer& vh_to_upd
       }
 
       // swap
-      std::swap(faces_[i0], faces_[i1]);
+      std::swap(faces[i0], faces[i1]);
       std::swap(fh_map[i0], fh_map[i1]);
       fprops_swap(i0, i1);
     };
 
-    faces_.resize(status(FaceHandle(i0)).deleted() ? i0 : i0+1);
+    faces.resize(status(FaceHandle(i0)).deleted() ? i0 : i0+1);
     fprops_resize(n_faces());
   }
 
@@ -252,9 +255,9 @@ void ArrayKernel::garbage_collection(std_API_Container_VHandlePointer& vh_to_upd
     }
   }
 
-  const int vertexCount   = int(vertices_.size());
-  const int halfedgeCount = int(edges_.size() * 2);
-  const int faceCount     = int(faces_.size());
+  const int vertexCount   = int(vertices_.read().size());
+  const int halfedgeCount = int(edges_.read().size() * 2);
+  const int faceCount     = int(faces_.read().size());
 
   // Update the vertex handles in the vertex handle vector
   typename std_API_Container_VHandlePointer::iterator v_it(vh_to_update.begin()), v_it_end(vh_to_update.end());
@@ -302,6 +305,124 @@ void ArrayKernel::garbage_collection(std_API_Container_VHandlePointer& vh_to_upd
     }
 
   }
+
+  // handles changed, recorded changes are meaningless now
+  journal_.reset();
+}
+
+//-----------------------------------------------------------------------------
+
+template <class HandleT>
+void ArrayKernel::set_status_bits(HandleT _hnd, unsigned int _bits, bool _value,
+                                  size_t _begin, size_t _end)
+{
+  if (!status_pph(_hnd).is_valid())
+    return;
+
+  StatusProperty::vector_type& status = property(status_pph(_hnd)).data_vector();
+  StatusInfo* s = status.data();
+  _end = std::min(_end, status.size());
+
+  if (_value)
+    for (size_t i = _begin; i < _end; ++i)
+      s[i].set_bit(_bits);
+  else
+    for (size_t i = _begin; i < _end; ++i)
+      s[i].unset_bit(_bits);
+}
+
+//-----------------------------------------------------------------------------
+
+template <class HandleT>
+size_t ArrayKernel::count_status_bits(HandleT _hnd, unsigned int _bits) const
+{
+  if (!status_pph(_hnd).is_valid())
+    return 0;
+
+  const StatusProperty::vector_type& status = property(status_pph(_hnd)).data_vector();
+  const StatusInfo* s = status.data();
+  const size_t n = status.size();
+
+  size_t count = 0;
+  for (size_t i = 0; i < n; ++i)
+    count += (s[i].bits() & _bits) ? 1 : 0;
+  return count;
+}
+
+//-----------------------------------------------------------------------------
+
+template <class HandleT>
+bool ArrayKernel::any_status_bits(HandleT _hnd, unsigned int _bits) const
+{
+  if (!status_pph(_hnd).is_valid())
+    return false;
+
+  const StatusProperty::vector_type& status = property(status_pph(_hnd)).data_vector();
+  const StatusInfo* s = status.data();
+  const size_t n = status.size();
+
+  // or together blocks of 64 status words, then test once per block
+  for (size_t b = 0; b < n; b += 64)
+  {
+    const size_t e = std::min(n, b + 64);
+    unsigned int acc = 0;
+    for (size_t i = b; i < e; ++i)
+      acc |= s[i].bits();
+    if (acc & _bits)
+      return true;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+
+template <class HandleT>
+void ArrayKernel::pack_status_bits(HandleT _hnd, unsigned int _bits,
+                                   std::vector<uint64_t>& _words) const
+{
+  if (!status_pph(_hnd).is_valid())
+  {
+    _words.assign((n_elements<HandleT>() + 63) / 64, 0);
+    return;
+  }
+
+  const StatusProperty::vector_type& status = property(status_pph(_hnd)).data_vector();
+  const StatusInfo* s = status.data();
+  const size_t n = status.size();
+
+  _words.resize((n + 63) / 64);
+  for (size_t w = 0; w < _words.size(); ++w)
+  {
+    const size_t b = 64 * w;
+    const size_t e = std::min(n, b + 64);
+    uint64_t m = 0;
+    for (size_t i = b; i < e; ++i)
+      m |= uint64_t((s[i].bits() & _bits) != 0) << (i - b);
+    _words[w] = m;
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+template <class HandleT, class Functor>
+void ArrayKernel::for_each_status_bits(HandleT _hnd, unsigned int _bits, Functor _f) const
+{
+  if (!status_pph(_hnd).is_valid())
+    return;
+
+  const size_t n = property(status_pph(_hnd)).n_elements();
+
+  for (size_t b = 0; b < n; b += 64)
+  {
+    // fetched per block, _f may modify the mesh
+    const StatusInfo* s = property(status_pph(_hnd)).data_vector().data();
+    const size_t e = std::min(n, b + 64);
+    uint64_t m = 0;
+    for (size_t i = b; i < e; ++i)
+      m |= uint64_t((s[i].bits() & _bits) != 0) << (i - b);
+
+    Utils::for_each_set_bit(&m, 1, [&_f, b](size_t _i) { _f(HandleT(static_cast<int>(b + _i))); });
+  }
 }
 
 }
@@ -52,6 +52,8 @@
 #include <OpenMesh/Core/Utils/vector_traits.hh>
 #include <vector>
 #include <algorithm>
+#include <memory>
+#include <type_traits>
 
 //== NAMESPACES ===============================================================
 
@@ -160,6 +162,7 @@ public:
     refcount_fcolors_(0),
     refcount_ftextureIndex_(0)
   {
+    this->set_resource_allocation(ResourceAllocation);
     this->add_property( points_, "v:points" );
 
     if (VAttribs & Attributes::Normal)
@@ -256,6 +259,125 @@ public:
         initializeStandardProperties();
   }
 
+  //--------------------------------------------------------- typed properties
+
+  /// True if Traits::PropertyAllocator selects ResourceAllocatorT.
+  static const bool ResourceAllocation = std::is_same<
+    typename std::allocator_traits<typename MeshItems::PropertyAllocator>::template rebind_alloc<char>,
+    ResourceAllocatorT<char> >::value;
+
+  static_assert(ResourceAllocation || std::is_same<
+    typename std::allocator_traits<typename MeshItems::PropertyAllocator>::template rebind_alloc<char>,
+    std::allocator<char> >::value,
+    "Traits::PropertyAllocator has to be std::allocator or ResourceAllocatorT");
+
+  /// PropertyT class of the properties of type \p T, see PropertyTypeT.
+  template <class T>
+  using PropertyType = typename PropertyTypeT<T, ResourceAllocation>::type;
+
+  /// \name Typed property access
+  /// These hide the overloads of BaseKernel to access the properties
+  /// with the PropertyT class selected by the traits.
+  //@{
+
+  template <class T>
+  PropertyType<T>& property(VPropHandleT<T> _ph)
+  { return Connectivity::template property<T, typename PropertyType<T>::allocator_type>(_ph); }
+
+  template <class T>
+  const PropertyType<T>& property(VPropHandleT<T> _ph) const
+  { return Connectivity::template property<T, typename PropertyType<T>::allocator_type>(_ph); }
+
+  template <class T>
+  PropertyType<T>& property(HPropHandleT<T> _ph)
+  { return Connectivity::template property<T, typename PropertyType<T>::allocator_type>(_ph); }
+
+  template <class T>
+  const PropertyType<T>& property(HPropHandleT<T> _ph) const
+  { return Connectivity::template property<T, typename PropertyType<T>::allocator_type>(_ph); }
+
+  template <class T>
+  PropertyType<T>& property(EPropHandleT<T> _ph)
+  { return Connectivity::template property<T, typename PropertyType<T>::allocator_type>(_ph); }
+
+  template <class T>
+  const PropertyType<T>& property(EPropHandleT<T> _ph) const
+  { return Connectivity::template property<T, typename PropertyType<T>::allocator_type>(_ph); }
+
+  template <class T>
+  PropertyType<T>& property(FPropHandleT<T> _ph)
+  { return Connectivity::template property<T, typename PropertyType<T>::allocator_type>(_ph); }
+
+  template <class T>
+  const PropertyType<T>& property(FPropHandleT<T> _ph) const
+  { return Connectivity::template property<T, typename PropertyType<T>::allocator_type>(_ph); }
+
+  template <class T>
+  PropertyType<T>& mproperty(MPropHandleT<T> _ph)
+  { return Connectivity::template mproperty<T, typename PropertyType<T>::allocator_type>(_ph); }
+
+  template <class T>
+  const PropertyType<T>& mproperty(MPropHandleT<T> _ph) const
+  { return Connectivity::template mproperty<T, typename PropertyType<T>::allocator_type>(_ph); }
+
+  template <class T>
+  typename PropertyType<T>::reference property(VPropHandleT<T> _ph, VertexHandle _vh)
+  { return property(_ph)[_vh.idx()]; }
+
+  template <class T>
+  typename PropertyType<T>::const_reference property(VPropHandleT<T> _ph, VertexHandle _vh) const
+  { return property(_ph)[_vh.idx()]; }
+
+  template <class T>
+  typename PropertyType<T>::reference property(HPropHandleT<T> _ph, HalfedgeHandle _hh)
+  { return property(_ph)[_hh.idx()]; }
+
+  template <class T>
+  typename PropertyType<T>::const_reference property(HPropHandleT<T> _ph, HalfedgeHandle _hh) const
+  { return property(_ph)[_hh.idx()]; }
+
+  template <class T>
+  typename PropertyType<T>::reference property(EPropHandleT<T> _ph, EdgeHandle _eh)
+  { return property(_ph)[_eh.idx()]; }
+
+  template <class T>
+  typename PropertyType<T>::const_reference property(EPropHandleT<T> _ph, EdgeHandle _eh) const
+  { return property(_ph)[_eh.idx()]; }
+
+  template <class T>
+  typename PropertyType<T>::reference property(FPropHandleT<T> _ph, FaceHandle _fh)
+  { return property(_ph)[_fh.idx()]; }
+
+  template <class T>
+  typename PropertyType<T>::const_reference property(FPropHandleT<T> _ph, FaceHandle _fh) const
+  { return property(_ph)[_fh.idx()]; }
+
+  template <class T>
+  typename PropertyType<T>::reference property(MPropHandleT<T> _ph)
+  { return mproperty(_ph)[0]; }
+
+  template <class T>
+  typename PropertyType<T>::const_reference property(MPropHandleT<T> _ph) const
+  { return mproperty(_ph)[0]; }
+
+  template <class T>
+  void copy_property(VPropHandleT<T>& _ph, VertexHandle _vh_from, VertexHandle _vh_to)
+  { if (_vh_from.is_valid() && _vh_to.is_valid()) property(_ph, _vh_to) = property(_ph, _vh_from); }
+
+  template <class T>
+  void copy_property(HPropHandleT<T> _ph, HalfedgeHandle _hh_from, HalfedgeHandle _hh_to)
+  { if (_hh_from.is_valid() && _hh_to.is_valid()) property(_ph, _hh_to) = property(_ph, _hh_from); }
+
+  template <class T>
+  void copy_property(EPropHandleT<T> _ph, EdgeHandle _eh_from, EdgeHandle _eh_to)
+  { if (_eh_from.is_valid() && _eh_to.is_valid()) property(_ph, _eh_to) = property(_ph, _eh_from); }
+
+  template <class T>
+  void copy_property(FPropHandleT<T> _ph, FaceHandle _fh_from, FaceHandle _fh_to)
+  { if (_fh_from.is_valid() && _fh_to.is_valid()) property(_ph, _fh_to) = property(_ph, _fh_from); }
+
+  //@}
+
   //-------------------------------------------------------------------- points
 
   const Point* points() const
@@ -268,7 +390,10 @@ public:
   { return this->property(points_, _vh); }
 
   void set_point(VertexHandle _vh, const Point& _p)
-  { this->property(points_, _vh) = _p; }
+  {
+    this->property(points_, _vh) = _p;
+    this->journal_.touch(_vh);
+  }
 
   const PointsPropertyHandle& points_property_handle() const
   { return points_; }
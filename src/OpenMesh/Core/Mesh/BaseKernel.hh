@@ -125,6 +125,8 @@ public: //-------------------------------------------------- add new properties
    *  is invalid.
    *  On success the handle must be used to access the property data with
    *  property().
+   *  If the mesh traits select ResourceAllocatorT the property storage
+   *  uses it, see DefaultTraits::PropertyAllocator and PropertyTypeT.
    *
    *  \param  _ph   A property handle defining the data type to bind to mesh.
    *                On success the handle is valid else invalid.
@@ -302,53 +304,60 @@ public: //--------------------------------------------------- access properties
    *  This method returns a reference to property. The property handle
    *  must be valid! The result is unpredictable if the handle is invalid!
    *
+   *  \p Alloc has to match the allocator the property was created with,
+   *  otherwise std::logic_error is thrown. The mesh selects it according
+   *  to its traits, these overloads are hidden by the ones of
+   *  AttribKernelT. Code working on a %BaseKernel or on the connectivity
+   *  kernels without knowing the traits should use the element accessors
+   *  below, which work for all properties.
+   *
    *  \param  _ph     A \em valid (!) property handle.
    *  \return The wanted property if the handle is valid.
    */
 
-  template <class T>
-  PropertyT<T>& property(VPropHandleT<T> _ph) {
-    return vprops_.property(_ph);
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  PropertyT<T, Alloc>& property(VPropHandleT<T> _ph) {
+    return vprops_.property<T, Alloc>(_ph);
   }
-  template <class T>
-  const PropertyT<T>& property(VPropHandleT<T> _ph) const {
-    return vprops_.property(_ph);
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  const PropertyT<T, Alloc>& property(VPropHandleT<T> _ph) const {
+    return vprops_.property<T, Alloc>(_ph);
   }
 
-  template <class T>
-  PropertyT<T>& property(HPropHandleT<T> _ph) {
-    return hprops_.property(_ph);
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  PropertyT<T, Alloc>& property(HPropHandleT<T> _ph) {
+    return hprops_.property<T, Alloc>(_ph);
   }
-  template <class T>
-  const PropertyT<T>& property(HPropHandleT<T> _ph) const {
-    return hprops_.property(_ph);
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  const PropertyT<T, Alloc>& property(HPropHandleT<T> _ph) const {
+    return hprops_.property<T, Alloc>(_ph);
   }
 
-  template <class T>
-  PropertyT<T>& property(EPropHandleT<T> _ph) {
-    return eprops_.property(_ph);
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  PropertyT<T, Alloc>& property(EPropHandleT<T> _ph) {
+    return eprops_.property<T, Alloc>(_ph);
   }
-  template <class T>
-  const PropertyT<T>& property(EPropHandleT<T> _ph) const {
-    return eprops_.property(_ph);
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  const PropertyT<T, Alloc>& property(EPropHandleT<T> _ph) const {
+    return eprops_.property<T, Alloc>(_ph);
   }
 
-  template <class T>
-  PropertyT<T>& property(FPropHandleT<T> _ph) {
-    return fprops_.property(_ph);
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  PropertyT<T, Alloc>& property(FPropHandleT<T> _ph) {
+    return fprops_.property<T, Alloc>(_ph);
   }
-  template <class T>
-  const PropertyT<T>& property(FPropHandleT<T> _ph) const {
-    return fprops_.property(_ph);
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  const PropertyT<T, Alloc>& property(FPropHandleT<T> _ph) const {
+    return fprops_.property<T, Alloc>(_ph);
   }
 
-  template <class T>
-  PropertyT<T>& mproperty(MPropHandleT<T> _ph) {
-    return mprops_.property(_ph);
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  PropertyT<T, Alloc>& mproperty(MPropHandleT<T> _ph) {
+    return mprops_.property<T, Alloc>(_ph);
   }
-  template <class T>
-  const PropertyT<T>& mproperty(MPropHandleT<T> _ph) const {
-    return mprops_.property(_ph);
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  const PropertyT<T, Alloc>& mproperty(MPropHandleT<T> _ph) const {
+    return mprops_.property<T, Alloc>(_ph);
   }
 
   //@}
@@ -361,71 +370,72 @@ public: //-------------------------------------------- access property elements
   /** You should not use this function directly. Instead, use the convenient
    *  PropertyManager wrapper.
    *
-   *  Return value of property for an item
+   *  Return value of property for an item. Works for properties using
+   *  either allocator, see PropertyTypeT.
    */
 
   template <class T>
   typename VPropHandleT<T>::reference
   property(VPropHandleT<T> _ph, VertexHandle _vh) {
-    return vprops_.property(_ph)[_vh.idx()];
+    return vprops_.element(_ph, _vh.idx());
   }
 
   template <class T>
   typename VPropHandleT<T>::const_reference
   property(VPropHandleT<T> _ph, VertexHandle _vh) const {
-    return vprops_.property(_ph)[_vh.idx()];
+    return vprops_.element(_ph, _vh.idx());
   }
 
 
   template <class T>
   typename HPropHandleT<T>::reference
   property(HPropHandleT<T> _ph, HalfedgeHandle _hh) {
-    return hprops_.property(_ph)[_hh.idx()];
+    return hprops_.element(_ph, _hh.idx());
   }
 
   template <class T>
   typename HPropHandleT<T>::const_reference
   property(HPropHandleT<T> _ph, HalfedgeHandle _hh) const {
-    return hprops_.property(_ph)[_hh.idx()];
+    return hprops_.element(_ph, _hh.idx());
   }
 
 
   template <class T>
   typename EPropHandleT<T>::reference
   property(EPropHandleT<T> _ph, EdgeHandle _eh) {
-    return eprops_.property(_ph)[_eh.idx()];
+    return eprops_.element(_ph, _eh.idx());
   }
 
   template <class T>
   typename EPropHandleT<T>::const_reference
   property(EPropHandleT<T> _ph, EdgeHandle _eh) const {
-    return eprops_.property(_ph)[_eh.idx()];
+    return eprops_.element(_ph, _eh.idx());
   }
 
 
   template <class T>
   typename FPropHandleT<T>::reference
   property(FPropHandleT<T> _ph, FaceHandle _fh) {
-    return fprops_.property(_ph)[_fh.idx()];
+    return fprops_.element(_ph, _fh.idx());
   }
 
   template <class T>
   typename FPropHandleT<T>::const_reference
   property(FPropHandleT<T> _ph, FaceHandle _fh) const {
-    return fprops_.property(_ph)[_fh.idx()];
+    return fprops_.element(_ph, _fh.idx());
   }
 
 
   template <class T>
   typename MPropHandleT<T>::reference
   property(MPropHandleT<T> _ph) {
-    return mprops_.property(_ph)[0];
+    return mprops_.element(_ph, 0);
   }
 
   template <class T>
   typename MPropHandleT<T>::const_reference
   property(MPropHandleT<T> _ph) const {
-    return mprops_.property(_ph)[0];
+    return mprops_.element(_ph, 0);
   }
 
   //@}
@@ -446,7 +456,7 @@ public: //------------------------------------------------ copy property
   template <class T>
   void copy_property(VPropHandleT<T>& _ph, VertexHandle _vh_from, VertexHandle _vh_to) {
     if(_vh_from.is_valid() && _vh_to.is_valid())
-      vprops_.property(_ph)[_vh_to.idx()] = vprops_.property(_ph)[_vh_from.idx()];
+      vprops_.element(_ph, _vh_to.idx()) = vprops_.element(_ph, _vh_from.idx());
   }
 
   /** You should not use this function directly. Instead, use the convenient
@@ -462,7 +472,7 @@ public: //------------------------------------------------ copy property
   template <class T>
   void copy_property(HPropHandleT<T> _ph, HalfedgeHandle _hh_from, HalfedgeHandle _hh_to) {
     if(_hh_from.is_valid() && _hh_to.is_valid())
-      hprops_.property(_ph)[_hh_to.idx()] = hprops_.property(_ph)[_hh_from.idx()];
+      hprops_.element(_ph, _hh_to.idx()) = hprops_.element(_ph, _hh_from.idx());
   }
 
   /** You should not use this function directly. Instead, use the convenient
@@ -478,7 +488,7 @@ public: //------------------------------------------------ copy property
   template <class T>
   void copy_property(EPropHandleT<T> _ph, EdgeHandle _eh_from, EdgeHandle _eh_to) {
     if(_eh_from.is_valid() && _eh_to.is_valid())
-      eprops_.property(_ph)[_eh_to.idx()] = eprops_.property(_ph)[_eh_from.idx()];
+      eprops_.element(_ph, _eh_to.idx()) = eprops_.element(_ph, _eh_from.idx());
   }
 
   /** You should not use this function directly. Instead, use the convenient
@@ -494,7 +504,7 @@ public: //------------------------------------------------ copy property
   template <class T>
   void copy_property(FPropHandleT<T> _ph, FaceHandle _fh_from, FaceHandle _fh_to) {
     if(_fh_from.is_valid() && _fh_to.is_valid())
-      fprops_.property(_ph)[_fh_to.idx()] = fprops_.property(_ph)[_fh_from.idx()];
+      fprops_.element(_ph, _fh_to.idx()) = fprops_.element(_ph, _fh_from.idx());
   }
 
 
@@ -590,6 +600,92 @@ public:
     this->fprops_ = _other.fprops_;
   }
 
+public: //---------------------------------------------------- copy-on-write
+
+  /** \brief Enable or disable copy-on-write for the mesh storage.
+   *
+   * With copy-on-write enabled, copying the kernel (e.g. via the copy
+   * constructor or assignment operator of the mesh) does not copy the
+   * mesh data. The copy shares the property buffers and, for ArrayKernel,
+   * the connectivity arrays with the original, each array is duplicated
+   * only on its first non-const access, in either of the two kernels. A
+   * snapshot thus costs O(number of properties), independent of the size
+   * of the mesh.
+   *
+   * The setting also applies to properties added later on and is
+   * inherited by copies of the kernel.
+   */
+  virtual void set_copy_on_write(bool _yn)
+  {
+    vprops_.set_copy_on_write(_yn);
+    hprops_.set_copy_on_write(_yn);
+    eprops_.set_copy_on_write(_yn);
+    fprops_.set_copy_on_write(_yn);
+    mprops_.set_copy_on_write(_yn);
+  }
+
+  /// Returns true if copy-on-write is enabled, see set_copy_on_write().
+  bool copy_on_write() const { return vprops_.copy_on_write(); }
+
+public: //---------------------------------------------------- memory resource
+
+  /** \brief Allocate the mesh storage from \p _resource.
+   *
+   * Only possible for meshes whose traits select ResourceAllocatorT as
+   * PropertyAllocator, for all other meshes the call changes nothing and
+   * returns false. Existing data is moved into the new resource, properties
+   * added later on and the growth of the arrays in new_vertex(), new_face(),
+   * etc. are served from it as well. For ArrayKernel this includes the
+   * connectivity arrays and the status flags, bool properties stay on the
+   * default heap, see PropertyTypeT. Pass nullptr to return to the default
+   * new/delete resource.
+   *
+   * The resource is not inherited: a copy constructed kernel uses the
+   * default resource and an assigned kernel keeps its own one.
+   *
+   * The resource must outlive the kernel, e.g.
+   * \code
+   * struct ArenaTraits : public OpenMesh::DefaultTraits
+   * {
+   *   typedef OpenMesh::ResourceAllocatorT<char> PropertyAllocator;
+   * };
+   * OpenMesh::ArenaMemoryResource arena;
+   * OpenMesh::TriMesh_ArrayKernelT<ArenaTraits> mesh;
+   * mesh.set_memory_resource(&arena);
+   * \endcode
+   */
+  virtual bool set_memory_resource(MemoryResource* _resource)
+  {
+    if (!resource_allocation())
+      return false;
+
+    vprops_.set_memory_resource(_resource);
+    hprops_.set_memory_resource(_resource);
+    eprops_.set_memory_resource(_resource);
+    fprops_.set_memory_resource(_resource);
+    mprops_.set_memory_resource(_resource);
+    return true;
+  }
+
+  /// Returns the resource set by set_memory_resource() or nullptr.
+  MemoryResource* memory_resource() const { return vprops_.memory_resource(); }
+
+  /// Returns true if the traits select ResourceAllocatorT for the properties.
+  bool resource_allocation() const { return vprops_.resource_allocation(); }
+
+protected:
+
+  /// Called by the mesh to create properties added later on with
+  /// ResourceAllocatorT, see DefaultTraits::PropertyAllocator.
+  void set_resource_allocation(bool _yn)
+  {
+    vprops_.set_resource_allocation(_yn);
+    hprops_.set_resource_allocation(_yn);
+    eprops_.set_resource_allocation(_yn);
+    fprops_.set_resource_allocation(_yn);
+    mprops_.set_resource_allocation(_yn);
+  }
+
 protected: //------------------------------------------------- low-level access
 
 public: // used by non-native kernel and MeshIO, should be protected
@@ -634,6 +730,13 @@ public: // used by non-native kernel and MeshIO, should be protected
   const BaseProperty* _get_mprop( const std::string& _name) const
   { return mprops_.property(_name); }
 
+  /// Untyped access to the property of \p _ph, independent of its allocator.
+  template <class T> BaseProperty& _property( VPropHandleT<T> _ph ) { return vprops_._property( _ph.idx() ); }
+  template <class T> BaseProperty& _property( HPropHandleT<T> _ph ) { return hprops_._property( _ph.idx() ); }
+  template <class T> BaseProperty& _property( EPropHandleT<T> _ph ) { return eprops_._property( _ph.idx() ); }
+  template <class T> BaseProperty& _property( FPropHandleT<T> _ph ) { return fprops_._property( _ph.idx() ); }
+  template <class T> BaseProperty& _property( MPropHandleT<T> _ph ) { return mprops_._property( _ph.idx() ); }
+
   BaseProperty& _vprop( size_t _idx ) { return vprops_._property( _idx ); }
   BaseProperty& _eprop( size_t _idx ) { return eprops_._property( _idx ); }
   BaseProperty& _hprop( size_t _idx ) { return hprops_._property( _idx ); }
@@ -0,0 +1,250 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  CLASS CSRAdjacency - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/Mesh/CSRAdjacency.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+namespace {
+
+/// Turn per element counts stored at _offsets[i+1] into offsets.
+void prefix_sum(std::vector<unsigned int>& _offsets)
+{
+  for (size_t i = 1; i < _offsets.size(); ++i)
+    _offsets[i] += _offsets[i - 1];
+}
+
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+CSRAdjacency::CSRAdjacency()
+  : mesh_(nullptr)
+{
+}
+
+
+CSRAdjacency::CSRAdjacency(const PolyConnectivity& _mesh, unsigned int _threads)
+  : mesh_(nullptr)
+{
+  build(_mesh, _threads);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void CSRAdjacency::clear()
+{
+  mesh_ = nullptr;
+  std::vector<unsigned int>().swap(vv_offsets_);
+  std::vector<int>().swap(vv_indices_);
+  std::vector<unsigned int>().swap(vf_offsets_);
+  std::vector<int>().swap(vf_indices_);
+  std::vector<unsigned int>().swap(fv_offsets_);
+  std::vector<int>().swap(fv_indices_);
+  std::vector<int>().swap(ev_indices_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void CSRAdjacency::build(const PolyConnectivity& _mesh, unsigned int _threads)
+{
+  // elements per parallel block
+  const size_t grain = 4096;
+
+  mesh_ = &_mesh;
+
+  const size_t nv = _mesh.n_vertices();
+  const size_t ne = _mesh.n_edges();
+  const size_t nf = _mesh.n_faces();
+
+  const bool v_status = _mesh.has_vertex_status();
+  const bool e_status = _mesh.has_edge_status();
+  const bool f_status = _mesh.has_face_status();
+
+  // 1. count the neighbors of every element
+  vv_offsets_.assign(nv + 1, 0);
+  vf_offsets_.assign(nv + 1, 0);
+  fv_offsets_.assign(nf + 1, 0);
+
+  parallel_for(nv, grain, [&](size_t _first, size_t _last) {
+    for (size_t i = _first; i < _last; ++i)
+    {
+      const VertexHandle vh = VertexHandle(int(i));
+      if (v_status && _mesh.status(vh).deleted())
+        continue;
+
+      const HalfedgeHandle start = _mesh.halfedge_handle(vh);
+      if (!start.is_valid())
+        continue;
+
+      unsigned int n_vv = 0, n_vf = 0;
+      HalfedgeHandle heh = start;
+      do
+      {
+        ++n_vv;
+        if (_mesh.face_handle(heh).is_valid())
+          ++n_vf;
+        heh = _mesh.cw_rotated_halfedge_handle(heh);
+      } while (heh != start);
+
+      vv_offsets_[i + 1] = n_vv;
+      vf_offsets_[i + 1] = n_vf;
+    }
+  }, _threads);
+
+  parallel_for(nf, grain, [&](size_t _first, size_t _last) {
+    for (size_t i = _first; i < _last; ++i)
+    {
+      const FaceHandle fh = FaceHandle(int(i));
+      if (f_status && _mesh.status(fh).deleted())
+        continue;
+
+      const HalfedgeHandle start = _mesh.halfedge_handle(fh);
+      unsigned int n_fv = 0;
+      HalfedgeHandle heh = start;
+      do
+      {
+        ++n_fv;
+        heh = _mesh.next_halfedge_handle(heh);
+      } while (heh != start);
+
+      fv_offsets_[i + 1] = n_fv;
+    }
+  }, _threads);
+
+  // 2. offsets
+  prefix_sum(vv_offsets_);
+  prefix_sum(vf_offsets_);
+  prefix_sum(fv_offsets_);
+
+  vv_indices_.resize(vv_offsets_.back());
+  vf_indices_.resize(vf_offsets_.back());
+  fv_indices_.resize(fv_offsets_.back());
+  ev_indices_.assign(2 * ne, -1);
+
+  // 3. fill in the neighbors
+  parallel_for(nv, grain, [&](size_t _first, size_t _last) {
+    for (size_t i = _first; i < _last; ++i)
+    {
+      if (vv_offsets_[i] == vv_offsets_[i + 1])
+        continue;
+
+      int* vv = vv_indices_.data() + vv_offsets_[i];
+      int* vf = vf_indices_.data() + vf_offsets_[i];
+
+      const HalfedgeHandle start = _mesh.halfedge_handle(VertexHandle(int(i)));
+      HalfedgeHandle heh = start;
+      do
+      {
+        *vv++ = _mesh.to_vertex_handle(heh).idx();
+        const FaceHandle fh = _mesh.face_handle(heh);
+        if (fh.is_valid())
+          *vf++ = fh.idx();
+        heh = _mesh.cw_rotated_halfedge_handle(heh);
+      } while (heh != start);
+    }
+  }, _threads);
+
+  parallel_for(nf, grain, [&](size_t _first, size_t _last) {
+    for (size_t i = _first; i < _last; ++i)
+    {
+      if (fv_offsets_[i] == fv_offsets_[i + 1])
+        continue;
+
+      int* fv = fv_indices_.data() + fv_offsets_[i];
+
+      const HalfedgeHandle start = _mesh.halfedge_handle(FaceHandle(int(i)));
+      HalfedgeHandle heh = start;
+      do
+      {
+        *fv++ = _mesh.to_vertex_handle(heh).idx();
+        heh = _mesh.next_halfedge_handle(heh);
+      } while (heh != start);
+    }
+  }, _threads);
+
+  parallel_for(ne, grain, [&](size_t _first, size_t _last) {
+    for (size_t i = _first; i < _last; ++i)
+    {
+      const EdgeHandle eh = EdgeHandle(int(i));
+      if (e_status && _mesh.status(eh).deleted())
+        continue;
+
+      const HalfedgeHandle heh = _mesh.halfedge_handle(eh, 0);
+      ev_indices_[2 * i]     = _mesh.from_vertex_handle(heh).idx();
+      ev_indices_[2 * i + 1] = _mesh.to_vertex_handle(heh).idx();
+    }
+  }, _threads);
+}
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
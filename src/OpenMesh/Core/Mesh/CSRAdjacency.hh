@@ -0,0 +1,256 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  CLASS CSRAdjacency
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_CSRADJACENCY_HH
+#define OPENMESH_CSRADJACENCY_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Mesh/PolyConnectivity.hh>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Range over a contiguous block of element indices of a CSRAdjacency.
+ *
+ *  Dereferencing yields smart handles of the mesh the adjacency was built
+ *  from, and all SmartRangeT operations (sum, to_vector, filtered, ...)
+ *  are available.
+ */
+template <typename SmartHandleT>
+class CSRRangeT : public SmartRangeT<CSRRangeT<SmartHandleT>, SmartHandleT>
+{
+public:
+
+  class iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef SmartHandleT              value_type;
+    typedef std::ptrdiff_t            difference_type;
+    typedef const SmartHandleT*       pointer;
+    typedef SmartHandleT              reference;
+
+    iterator(const int* _p = nullptr, const PolyConnectivity* _mesh = nullptr)
+      : p_(_p), mesh_(_mesh) {}
+
+    SmartHandleT operator*() const { return SmartHandleT(*p_, mesh_); }
+
+    iterator& operator++() { ++p_; return *this; }
+    iterator operator++(int) { iterator tmp(*this); ++p_; return tmp; }
+
+    bool operator==(const iterator& _rhs) const { return p_ == _rhs.p_; }
+    bool operator!=(const iterator& _rhs) const { return p_ != _rhs.p_; }
+
+  private:
+    const int*              p_;
+    const PolyConnectivity* mesh_;
+  };
+
+  typedef iterator const_iterator;
+
+  CSRRangeT(const int* _begin = nullptr, const int* _end = nullptr,
+            const PolyConnectivity* _mesh = nullptr)
+    : begin_(_begin), end_(_end), mesh_(_mesh) {}
+
+  iterator begin() const { return iterator(begin_, mesh_); }
+  iterator end()   const { return iterator(end_, mesh_); }
+
+  size_t size()  const { return size_t(end_ - begin_); }
+  bool   empty() const { return begin_ == end_; }
+
+  SmartHandleT operator[](size_t _i) const { return SmartHandleT(begin_[_i], mesh_); }
+
+private:
+  const int*              begin_;
+  const int*              end_;
+  const PolyConnectivity* mesh_;
+};
+
+
+/** Immutable compressed sparse row (CSR) snapshot of the adjacency of a mesh.
+ *
+ *  Analytics which walk the one-rings of all vertices many times (smoothing,
+ *  curvature, geodesics, ...) pay for the halfedge chasing of the
+ *  circulators in every iteration. CSRAdjacency stores the vertex-vertex,
+ *  vertex-face and face-vertex relations as one offset and one index array
+ *  each, plus the two vertices of every edge, so that these walks become
+ *  linear scans.
+ *
+ *  The snapshot is built in parallel and is not updated when the mesh
+ *  changes. Rebuild it after topological changes. The order of the
+ *  neighbors is the same as the one of vv_range(), vf_range(), fv_range()
+ *  and the edge vertices are (v0, v1) as in SmartEdgeHandle. Deleted
+ *  vertices and faces have no neighbors, deleted edges invalid vertices.
+ *
+ *  \code
+ *  OpenMesh::CSRAdjacency adj(mesh);
+ *  for (auto vh : mesh.vertices())
+ *    laplace[vh] = adj.vv_range(vh).avg([&](OpenMesh::VertexHandle _vh) { return mesh.point(_vh); });
+ *  \endcode
+ */
+class OPENMESHDLLEXPORT CSRAdjacency
+{
+public:
+
+  typedef CSRRangeT<SmartVertexHandle> VertexRange;
+  typedef CSRRangeT<SmartFaceHandle>   FaceRange;
+
+public:
+
+  /// construct an empty snapshot
+  CSRAdjacency();
+
+  /// construct the snapshot of \c _mesh, see build()
+  explicit CSRAdjacency(const PolyConnectivity& _mesh, unsigned int _threads = 0);
+
+  /** (Re)build the snapshot of \c _mesh on the global ThreadPool using at
+   *  most \c _threads threads (0: no limit). */
+  void build(const PolyConnectivity& _mesh, unsigned int _threads = 0);
+
+  /// release all memory
+  void clear();
+
+  /// mesh the snapshot was built from
+  const PolyConnectivity* mesh() const { return mesh_; }
+
+  size_t n_vertices() const { return vv_offsets_.empty() ? 0 : vv_offsets_.size() - 1; }
+  size_t n_edges()    const { return ev_indices_.size() / 2; }
+  size_t n_faces()    const { return fv_offsets_.empty() ? 0 : fv_offsets_.size() - 1; }
+
+  //--- ranges ---
+
+  /// vertices adjacent to \c _vh
+  VertexRange vv_range(VertexHandle _vh) const
+  { return range<VertexRange>(vv_offsets_, vv_indices_, _vh.idx()); }
+
+  /// faces incident to \c _vh
+  FaceRange vf_range(VertexHandle _vh) const
+  { return range<FaceRange>(vf_offsets_, vf_indices_, _vh.idx()); }
+
+  /// vertices of \c _fh
+  VertexRange fv_range(FaceHandle _fh) const
+  { return range<VertexRange>(fv_offsets_, fv_indices_, _fh.idx()); }
+
+  /// the two vertices of \c _eh
+  VertexRange ev_range(EdgeHandle _eh) const
+  {
+    const int* p = ev_indices_.data() + 2 * _eh.idx();
+    return VertexRange(p, p + 2, mesh_);
+  }
+
+  /// number of vertices adjacent to \c _vh
+  size_t valence(VertexHandle _vh) const
+  { return vv_offsets_[_vh.idx() + 1] - vv_offsets_[_vh.idx()]; }
+
+  /// number of vertices of \c _fh
+  size_t valence(FaceHandle _fh) const
+  { return fv_offsets_[_fh.idx() + 1] - fv_offsets_[_fh.idx()]; }
+
+  //--- raw arrays ---
+
+  /** \name Raw CSR arrays
+   *  The neighbors of element \c i are indices[offsets[i]] ... indices[offsets[i+1]-1].
+   */
+  //@{
+  const std::vector<unsigned int>& vv_offsets() const { return vv_offsets_; }
+  const std::vector<int>&          vv_indices() const { return vv_indices_; }
+  const std::vector<unsigned int>& vf_offsets() const { return vf_offsets_; }
+  const std::vector<int>&          vf_indices() const { return vf_indices_; }
+  const std::vector<unsigned int>& fv_offsets() const { return fv_offsets_; }
+  const std::vector<int>&          fv_indices() const { return fv_indices_; }
+  /// v0 and v1 of edge \c i are at 2*i and 2*i+1
+  const std::vector<int>&          ev_indices() const { return ev_indices_; }
+  //@}
+
+private:
+
+  template <class RangeT>
+  RangeT range(const std::vector<unsigned int>& _offsets,
+               const std::vector<int>& _indices, int _idx) const
+  {
+    const int* p = _indices.data();
+    return RangeT(p + _offsets[_idx], p + _offsets[_idx + 1], mesh_);
+  }
+
+private:
+
+  const PolyConnectivity* mesh_;
+
+  std::vector<unsigned int> vv_offsets_;
+  std::vector<int>          vv_indices_;
+  std::vector<unsigned int> vf_offsets_;
+  std::vector<int>          vf_indices_;
+  std::vector<unsigned int> fv_offsets_;
+  std::vector<int>          fv_indices_;
+  std::vector<int>          ev_indices_;
+};
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_CSRADJACENCY_HH defined
+//=============================================================================
@@ -52,6 +52,7 @@
 #include <OpenMesh/Core/Utils/GenProg.hh>
 #include <OpenMesh/Core/Utils/vector_traits.hh>
 #include <OpenMesh/Core/Mesh/Handles.hh>
+#include <memory>
 
 
 //== NAMESPACES ===============================================================
@@ -123,6 +124,15 @@ struct FinalMeshItemsT
   typedef typename Traits::template HalfedgeT<ITraits, Refs>    HalfedgeData;
   typedef typename Traits::template EdgeT<ITraits, Refs>        EdgeData;
   typedef typename Traits::template FaceT<ITraits, Refs>        FaceData;
+
+  //--- get property allocator from Traits (optional) ---
+  template <class T>
+  static typename T::PropertyAllocator traits_property_allocator(int);
+
+  template <class T>
+  static std::allocator<char> traits_property_allocator(long);
+
+  typedef decltype(traits_property_allocator<Traits>(0)) PropertyAllocator;
 };
 
 
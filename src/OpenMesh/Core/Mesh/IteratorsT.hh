@@ -224,6 +224,11 @@ class GenericIteratorT {
             skip_bits_ = 0;
         }
 
+        /// Is skipping of deleted/hidden elements enabled?
+        bool skipping_enabled() const {
+            return skip_bits_ != 0;
+        }
+
     private:
 
         void skip_fwd() {
@@ -498,6 +498,7 @@ void PolyConnectivity::delete_vertex(VertexHandle _vh, bool _delete_isolated_ver
     delete_face(delete_fh_it, _delete_isolated_vertices);
 
   status(_vh).set_deleted(true);
+  journal_.deleted(_vh);
 }
 
 //-----------------------------------------------------------------------------
@@ -516,6 +517,7 @@ void PolyConnectivity::delete_edge(EdgeHandle _eh, bool _delete_isolated_vertice
     // mark edge deleted if the mesh has a edge status
     if ( has_edge_status() )
       status(_eh).set_deleted(true);
+    journal_.deleted(_eh);
 
     // mark corresponding halfedges as deleted
     // As the deleted edge is boundary,
@@ -535,6 +537,7 @@ void PolyConnectivity::delete_face(FaceHandle _fh, bool _delete_isolated_vertice
 
   // mark face deleted
   status(_fh).set_deleted(true);
+  journal_.deleted(_fh);
 
 
   // this vector will hold all boundary edges of face _fh
@@ -596,6 +599,7 @@ void PolyConnectivity::delete_face(FaceHandle _fh, bool _delete_isolated_vertice
       // mark edge deleted if the mesh has a edge status
       if ( has_edge_status() )
     	 status(*del_it).set_deleted(true);
+      journal_.deleted(*del_it);
 
 
       // mark corresponding halfedges as deleted
@@ -613,7 +617,10 @@ void PolyConnectivity::delete_face(FaceHandle _fh, bool _delete_isolated_vertice
         if (next0 == h1)
         {
           if (_delete_isolated_vertices)
+          {
             status(v0).set_deleted(true);
+            journal_.deleted(v0);
+          }
           set_isolated(v0);
         }
         else set_halfedge_handle(v0, next0);
@@ -626,7 +633,10 @@ void PolyConnectivity::delete_face(FaceHandle _fh, bool _delete_isolated_vertice
         if (next1 == h0)
         {
           if (_delete_isolated_vertices)
+          {
             status(v1).set_deleted(true);
+            journal_.deleted(v1);
+          }
           set_isolated(v1);
         }
         else  set_halfedge_handle(v1, next1);
@@ -702,6 +712,8 @@ void PolyConnectivity::collapse_edge(HalfedgeHandle _hh)
   // delete stuff
   status(edge_handle(h)).set_deleted(true);
   status(vo).set_deleted(true);
+  journal_.deleted(edge_handle(h));
+  journal_.deleted(vo);
   if (has_halfedge_status())
   {
     status(h).set_deleted(true);
@@ -755,8 +767,10 @@ void PolyConnectivity::collapse_loop(HalfedgeHandle _hh)
   {
     set_halfedge_handle(fh, InvalidHalfedgeHandle);
     status(fh).set_deleted(true);
+    journal_.deleted(fh);
   }
   status(edge_handle(h0)).set_deleted(true);
+  journal_.deleted(edge_handle(h0));
   if (has_halfedge_status())
   {
     status(h0).set_deleted(true);
@@ -862,6 +876,8 @@ PolyConnectivity::remove_edge(EdgeHandle _eh)
   
   status(_eh).set_deleted(true);  
   status(del_fh).set_deleted(true);  
+  journal_.deleted(_eh);
+  journal_.deleted(del_fh);
   return rem_fh;//returns the remaining face handle
 }
 
@@ -873,6 +889,7 @@ void PolyConnectivity::reinsert_edge(EdgeHandle _eh)
   //shoudl be deleted  
   assert(status(_eh).deleted());
   status(_eh).set_deleted(false);  
+  journal_.created(_eh);
   
   HalfedgeHandle heh0 = halfedge_handle(_eh, 0);
   HalfedgeHandle heh1 = halfedge_handle(_eh, 1);
@@ -883,6 +900,7 @@ void PolyConnectivity::reinsert_edge(EdgeHandle _eh)
   }
   assert(status(del_fh).deleted());
   status(del_fh).set_deleted(false); 
+  journal_.created(del_fh);
   
   //restore halfedge relations
   HalfedgeHandle prev_heh0 = prev_halfedge_handle(heh0);
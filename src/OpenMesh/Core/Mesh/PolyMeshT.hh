@@ -274,6 +274,23 @@ public:
    */
   void update_normals();
 
+  /** \brief Compute normals of the primitives changed since a journal position
+   *
+   * Like update_normals(), but only recomputes the normals of the faces,
+   * vertices and halfedges affected by the changes recorded in the
+   * journal since \c _since, so the cost is proportional to the edit.
+   * If the position is no longer valid (e.g. after a garbage collection)
+   * or no journal is requested, all normals are recomputed.
+   *
+   * Unlike update_normals(), vertex normals are also updated if the mesh
+   * has no face normals; they are then computed from the geometry with
+   * calc_vertex_normal_correct(). Halfedge normals require face normals.
+   *
+   * \return a new journal position for the next call
+   * \sa ArrayKernel::request_journal(), TopologyJournal
+   */
+  TopologyJournal::Position update_normals(TopologyJournal::Position _since);
+
   /// Update normal for face _fh
   void update_normal(FaceHandle _fh)
   { this->set_normal(_fh, calc_face_normal(_fh)); }
@@ -57,9 +57,11 @@
 #include <OpenMesh/Core/Mesh/PolyMeshT.hh>
 #include <OpenMesh/Core/Geometry/LoopSchemeMaskT.hh>
 #include <OpenMesh/Core/Utils/GenProg.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
 #include <OpenMesh/Core/Utils/vector_cast.hh>
 #include <OpenMesh/Core/Utils/vector_traits.hh>
 #include <OpenMesh/Core/System/omstream.hh>
+#include <algorithm>
 #include <vector>
 
 
@@ -107,29 +109,27 @@ template <class Kernel>
 typename PolyMeshT<Kernel>::Normal
 PolyMeshT<Kernel>::calc_face_normal_impl(FaceHandle _fh, PointIs3DTag) const
 {
-  assert(this->halfedge_handle(_fh).is_valid());
-  ConstFaceVertexIter fv_it(this->cfv_iter(_fh));
+  const HalfedgeHandle heh0 = this->halfedge_handle(_fh);
+  assert(heh0.is_valid());
 
-  // Safeguard for 1-gons
-  if (!(++fv_it).is_valid()) return Normal(0, 0, 0);
+  // Safeguard for 1-gons and 2-gons
+  if (this->next_halfedge_handle(this->next_halfedge_handle(heh0)) == heh0)
+    return Normal(0, 0, 0);
 
-  // Safeguard for 2-gons
-  if (!(++fv_it).is_valid()) return Normal(0, 0, 0);
-
-  // use Newell's Method to compute the surface normal
+  // use Newell's Method to compute the surface normal. Walk the halfedges
+  // directly so that every point is fetched only once.
   Normal n(0,0,0);
-  for(fv_it = this->cfv_iter(_fh); fv_it.is_valid(); ++fv_it)
+  HalfedgeHandle heh = heh0;
+  const Point* p = &this->point(this->to_vertex_handle(heh));
+  do
   {
     // next vertex
-    ConstFaceVertexIter fv_itn = fv_it;
-    ++fv_itn;
-
-    if (!fv_itn.is_valid())
-      fv_itn = this->cfv_iter(_fh);
+    heh = this->next_halfedge_handle(heh);
+    const Point& pn = this->point(this->to_vertex_handle(heh));
 
     // http://www.opengl.org/wiki/Calculating_a_Surface_Normal
-    const Point a = this->point(*fv_it) - this->point(*fv_itn);
-    const Point b = this->point(*fv_it) + this->point(*fv_itn);
+    const Point a = *p - pn;
+    const Point b = *p + pn;
 
 
     // Due to traits, the value types of normals and points can be different.
@@ -137,7 +137,9 @@ PolyMeshT<Kernel>::calc_face_normal_impl(FaceHandle _fh, PointIs3DTag) const
     n[0] += static_cast<typename vector_traits<Normal>::value_type>(a[1] * b[2]);
     n[1] += static_cast<typename vector_traits<Normal>::value_type>(a[2] * b[0]);
     n[2] += static_cast<typename vector_traits<Normal>::value_type>(a[0] * b[1]);
-  }
+
+    p = &pn;
+  } while (heh != heh0);
 
   const typename vector_traits<Normal>::value_type length = norm(n);
 
@@ -251,10 +253,14 @@ calc_face_centroid(FaceHandle _fh) const
   Point _pt;
   vectorize(_pt, Scalar(0));
   Scalar valence = 0.0;
-  for (ConstFaceVertexIter cfv_it = this->cfv_iter(_fh); cfv_it.is_valid(); ++cfv_it, valence += 1.0)
+  const HalfedgeHandle heh0 = this->halfedge_handle(_fh);
+  HalfedgeHandle heh = heh0;
+  do
   {
-    _pt += this->point(*cfv_it);
-  }
+    _pt += this->point(this->to_vertex_handle(heh));
+    valence += 1.0;
+    heh = this->next_halfedge_handle(heh);
+  } while (heh != heh0);
   _pt /= valence;
   return _pt;
 }
@@ -329,15 +335,129 @@ update_normals()
 //-----------------------------------------------------------------------------
 
 
+template <class Kernel>
+TopologyJournal::Position
+PolyMeshT<Kernel>::
+update_normals(TopologyJournal::Position _since)
+{
+  TopologyJournal& journal = this->journal();
+  if (!journal.valid(_since))
+  {
+    update_normals();
+    if (!Kernel::has_face_normals() && Kernel::has_vertex_normals())
+      for (VertexHandle vh : this->vertices())
+        this->set_normal(vh, calc_normal(vh));
+    return journal.checkpoint();
+  }
+
+  const PolyMeshT& mesh = *this;
+  auto alive_vertex = [&mesh](VertexHandle _vh) {
+    return mesh.is_valid_handle(_vh) && !(mesh.has_vertex_status() && mesh.status(_vh).deleted());
+  };
+  auto alive_face = [&mesh](FaceHandle _fh) {
+    return mesh.is_valid_handle(_fh) && !(mesh.has_face_status() && mesh.status(_fh).deleted());
+  };
+
+  // faces whose normal may have changed, vertices whose neighborhood changed
+  std::vector<FaceHandle>   faces;
+  std::vector<VertexHandle> vertices;
+  journal.for_each(_since, [&](const TopologyJournal::Entry& _e) {
+    switch (_e.kind)
+    {
+      case TopologyJournal::VERTEX:
+      {
+        const VertexHandle vh(_e.idx);
+        if (!alive_vertex(vh))
+          break;
+        vertices.push_back(vh);
+        for (HalfedgeHandle heh : mesh.voh_range(vh))
+          if (!mesh.is_boundary(heh))
+            faces.push_back(mesh.face_handle(heh));
+        break;
+      }
+      case TopologyJournal::EDGE:
+      {
+        const EdgeHandle eh(_e.idx);
+        if (!mesh.is_valid_handle(eh))
+          break;
+        for (int i = 0; i < 2; ++i)
+        {
+          const HalfedgeHandle heh = mesh.halfedge_handle(eh, i);
+          const VertexHandle vh = mesh.to_vertex_handle(heh);
+          if (alive_vertex(vh))
+            vertices.push_back(vh);
+          if (!mesh.is_boundary(heh) && alive_face(mesh.face_handle(heh)))
+            faces.push_back(mesh.face_handle(heh));
+        }
+        break;
+      }
+      case TopologyJournal::FACE:
+      {
+        const FaceHandle fh(_e.idx);
+        if (alive_face(fh))
+          faces.push_back(fh);
+        break;
+      }
+    }
+  });
+
+  std::sort(faces.begin(), faces.end());
+  faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
+
+  const bool face_normals = Kernel::has_face_normals();
+  for (FaceHandle fh : faces)
+  {
+    if (face_normals)
+      this->set_normal(fh, calc_face_normal(fh));
+    for (VertexHandle vh : mesh.fv_range(fh))
+      vertices.push_back(vh);
+  }
+
+  std::sort(vertices.begin(), vertices.end());
+  vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+
+  // without face normals compute the vertex normals from the geometry
+  if (Kernel::has_vertex_normals())
+    for (VertexHandle vh : vertices)
+      this->set_normal(vh, face_normals ? calc_vertex_normal(vh) : calc_normal(vh));
+
+  // halfedge normals depend on the faces around their target vertex
+  if (face_normals && Kernel::has_halfedge_normals())
+    for (VertexHandle vh : vertices)
+      for (HalfedgeHandle heh : mesh.vih_range(vh))
+        this->set_normal(heh, calc_halfedge_normal(heh));
+
+  return journal.checkpoint();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
 template <class Kernel>
 void
 PolyMeshT<Kernel>::
 update_face_normals()
 {
-  FaceIter f_it(Kernel::faces_sbegin()), f_end(Kernel::faces_end());
+  if (this->n_faces() == 0)
+    return;
 
-  for (; f_it != f_end; ++f_it)
-    this->set_normal(*f_it, calc_face_normal(*f_it));
+  // faces are independent, process them in parallel. Skip deleted and
+  // hidden faces as faces_sbegin() does. The threads write through the
+  // raw normal array (taken once, which also detaches copy-on-write
+  // storage), reads go through the const mesh.
+  Normal* normals = this->property(this->face_normals_pph()).data_vector().data();
+  const PolyMeshT& mesh = *this;
+  const bool skip = Kernel::has_face_status();
+  parallel_for(this->n_faces(), 4096, [normals, &mesh, skip](size_t _first, size_t _last) {
+    for (size_t i = _first; i < _last; ++i)
+    {
+      const FaceHandle fh = FaceHandle(int(i));
+      if (skip && (mesh.status(fh).deleted() || mesh.status(fh).hidden()))
+        continue;
+      normals[i] = mesh.calc_face_normal(fh);
+    }
+  });
 }
 
 
@@ -349,10 +469,15 @@ void
 PolyMeshT<Kernel>::
 update_halfedge_normals(const double _feature_angle)
 {
-  HalfedgeIter h_it(Kernel::halfedges_begin()), h_end(Kernel::halfedges_end());
+  if (this->n_halfedges() == 0)
+    return;
 
-  for (; h_it != h_end; ++h_it)
-    this->set_normal(*h_it, calc_halfedge_normal(*h_it, _feature_angle));
+  Normal* normals = this->property(this->halfedge_normals_pph()).data_vector().data();
+  const PolyMeshT& mesh = *this;
+  parallel_for(this->n_halfedges(), 4096, [normals, &mesh, _feature_angle](size_t _first, size_t _last) {
+    for (size_t i = _first; i < _last; ++i)
+      normals[i] = mesh.calc_halfedge_normal(HalfedgeHandle(int(i)), _feature_angle);
+  });
 }
 
 
@@ -571,10 +696,15 @@ void
 PolyMeshT<Kernel>::
 update_vertex_normals()
 {
-  VertexIter  v_it(Kernel::vertices_begin()), v_end(Kernel::vertices_end());
+  if (this->n_vertices() == 0)
+    return;
 
-  for (; v_it!=v_end; ++v_it)
-    this->set_normal(*v_it, calc_vertex_normal(*v_it));
+  Normal* normals = this->property(this->vertex_normals_pph()).data_vector().data();
+  const PolyMeshT& mesh = *this;
+  parallel_for(this->n_vertices(), 4096, [normals, &mesh](size_t _first, size_t _last) {
+    for (size_t i = _first; i < _last; ++i)
+      normals[i] = mesh.calc_vertex_normal(VertexHandle(int(i)));
+  });
 }
 
 //=============================================================================
@@ -46,6 +46,13 @@
 #include <array>
 #include <vector>
 #include <set>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <memory>
+
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
 
 //== NAMESPACES ===============================================================
 
@@ -63,11 +70,20 @@ struct Identity
   T operator()(const T& _t) const { return _t; }
 };
 
+struct AlwaysTrue
+{
+  template <typename T>
+  bool operator()(const T&) const { return true; }
+};
+
 }
 
 template <typename RangeT, typename HandleT, typename Functor>
 struct FilteredSmartRangeT;
 
+template <typename RangeT, typename HandleT, typename Filter = AlwaysTrue>
+struct ParallelSmartRangeT;
+
 /// Base class for all smart range types
 template <typename RangeT, typename HandleT>
 struct SmartRangeT
@@ -433,6 +449,28 @@ struct SmartRangeT
     auto range = static_cast<const RangeT*>(this);
     return FilteredSmartRangeT<SmartRange, Handle, Functor>(std::forward<Functor>(f), (*range).begin(), (*range).end());
   }
+
+  /** @brief Parallel version of the range
+   *
+   * Returns a range with the same operations which splits the elements into blocks of \p grain
+   * elements and processes them on the global ThreadPool using at most \p threads threads
+   * (0: no limit, see also ThreadLimit). Reductions
+   * combine the block results in block order, so their result only depends on \p grain and
+   * not on the number of threads or the scheduling. Functors are called concurrently and
+   * must not modify shared state without synchronization.
+   *
+   * \code
+   * auto area = mesh.faces().par().sum([&](OpenMesh::FaceHandle fh) { return mesh.calc_face_area(fh); });
+   * \endcode
+   *
+   * @param threads Maximal number of threads, 0 for no limit
+   * @param grain   Number of elements per block
+   */
+  auto par(unsigned int threads = 0, size_t grain = 4096) -> ParallelSmartRangeT<RangeT, HandleT>
+  {
+    auto range = static_cast<const RangeT*>(this);
+    return ParallelSmartRangeT<RangeT, HandleT>((*range).begin(), (*range).end(), threads, grain, AlwaysTrue());
+  }
 };
 
 
@@ -488,6 +526,294 @@ struct FilteredSmartRangeT : public SmartRangeT<FilteredSmartRangeT<RangeT, Hand
 };
 
 
+/** Parallel version of a smart range, see SmartRangeT::par()
+ *
+ * The range is split into blocks at construction. Ranges over all mesh elements (vertices(),
+ * faces(), ...) are split by index without walking them, all other ranges are walked once.
+ */
+template <typename RangeT, typename HandleT, typename Filter>
+struct ParallelSmartRangeT
+{
+  using Iterator = decltype((std::declval<const RangeT&>().begin()));
+  using Block    = std::pair<Iterator, Iterator>;
+
+  ParallelSmartRangeT(Iterator begin, Iterator end, unsigned int threads, size_t grain, Filter filter) :
+    threads_(threads),
+    filter_(std::move(filter))
+  {
+    split(begin, end, std::max(grain, size_t(1)), 0);
+  }
+
+  ParallelSmartRangeT(std::vector<Block> blocks, unsigned int threads, Filter filter) :
+    blocks_(std::move(blocks)), threads_(threads), filter_(std::move(filter))
+  {
+  }
+
+  /// Parallel version of SmartRangeT::sum()
+  template <typename Functor>
+  auto sum(Functor&& f) -> typename std::decay<decltype (f(std::declval<HandleT>()))>::type
+  {
+    using Result = typename std::decay<decltype (f(std::declval<HandleT>()))>::type;
+    std::vector<std::unique_ptr<Result>> partial(blocks_.size());
+    run([&](size_t b) {
+      for (Iterator it = blocks_[b].first; it != blocks_[b].second; ++it)
+        if (filter_(*it))
+        {
+          if (partial[b])
+            *partial[b] += f(*it);
+          else
+            partial[b].reset(new Result(f(*it)));
+        }
+    });
+    return combine(partial, [](Result& res, const Result& val) { res += val; });
+  }
+
+  /// Parallel version of SmartRangeT::avg()
+  template <typename Functor>
+  auto avg(Functor&& f) -> typename std::decay<decltype (f(std::declval<HandleT>()))>::type
+  {
+    const int n_elements = count_if(AlwaysTrue());
+    return (1.0 / n_elements) * sum(f);
+  }
+
+  /// Parallel version of SmartRangeT::any_of(), stops all threads at the first match
+  template <typename Functor>
+  auto any_of(Functor&& f) -> bool
+  {
+    std::atomic<bool> found(false);
+    run([&](size_t b) {
+      for (Iterator it = blocks_[b].first; it != blocks_[b].second && !found; ++it)
+        if (filter_(*it) && f(*it))
+          found = true;
+    });
+    return found;
+  }
+
+  /// Parallel version of SmartRangeT::all_of(), stops all threads at the first mismatch
+  template <typename Functor>
+  auto all_of(Functor&& f) -> bool
+  {
+    return !any_of([&](const HandleT& h) { return !f(h); });
+  }
+
+  /// Parallel version of SmartRangeT::to_vector(), the order is the same as for the serial range
+  template <typename Functor = Identity>
+  auto to_vector(Functor&& f = {}) -> std::vector<typename std::decay<decltype (f(std::declval<HandleT>()))>::type>
+  {
+    using Result = typename std::decay<decltype (f(std::declval<HandleT>()))>::type;
+    std::vector<std::vector<Result>> partial(blocks_.size());
+    run([&](size_t b) {
+      for (Iterator it = blocks_[b].first; it != blocks_[b].second; ++it)
+        if (filter_(*it))
+          partial[b].push_back(f(*it));
+    });
+    std::vector<Result> res;
+    size_t n = 0;
+    for (const auto& p : partial)
+      n += p.size();
+    res.reserve(n);
+    for (const auto& p : partial)
+      res.insert(res.end(), p.begin(), p.end());
+    return res;
+  }
+
+  /// Parallel version of SmartRangeT::min()
+  template <typename Functor>
+  auto min(Functor&& f) -> typename std::decay<decltype (f(std::declval<HandleT>()))>::type
+  {
+    using std::min;
+    using Result = typename std::decay<decltype (f(std::declval<HandleT>()))>::type;
+    std::vector<std::unique_ptr<Result>> partial(blocks_.size());
+    run([&](size_t b) {
+      for (Iterator it = blocks_[b].first; it != blocks_[b].second; ++it)
+        if (filter_(*it))
+        {
+          if (partial[b])
+            *partial[b] = min(*partial[b], f(*it));
+          else
+            partial[b].reset(new Result(f(*it)));
+        }
+    });
+    return combine(partial, [](Result& res, const Result& val) { res = min(res, val); });
+  }
+
+  /// Parallel version of SmartRangeT::max()
+  template <typename Functor>
+  auto max(Functor&& f) -> typename std::decay<decltype (f(std::declval<HandleT>()))>::type
+  {
+    using std::max;
+    using Result = typename std::decay<decltype (f(std::declval<HandleT>()))>::type;
+    std::vector<std::unique_ptr<Result>> partial(blocks_.size());
+    run([&](size_t b) {
+      for (Iterator it = blocks_[b].first; it != blocks_[b].second; ++it)
+        if (filter_(*it))
+        {
+          if (partial[b])
+            *partial[b] = max(*partial[b], f(*it));
+          else
+            partial[b].reset(new Result(f(*it)));
+        }
+    });
+    return combine(partial, [](Result& res, const Result& val) { res = max(res, val); });
+  }
+
+  /// Parallel version of SmartRangeT::minmax()
+  template <typename Functor>
+  auto minmax(Functor&& f) -> std::pair<typename std::decay<decltype (f(std::declval<HandleT>()))>::type,
+                                        typename std::decay<decltype (f(std::declval<HandleT>()))>::type>
+  {
+    return std::make_pair(this->min(f), this->max(f));
+  }
+
+  /// Parallel version of SmartRangeT::argmin(), returns the first minimal element as the serial version
+  template <typename Functor>
+  auto argmin(Functor&& f) -> HandleT
+  {
+    return arg_best(f, [](const decltype(f(std::declval<HandleT>()))& a,
+                          const decltype(f(std::declval<HandleT>()))& b) { return a < b; });
+  }
+
+  /// Parallel version of SmartRangeT::argmax(), returns the first maximal element as the serial version
+  template <typename Functor>
+  auto argmax(Functor&& f) -> HandleT
+  {
+    return arg_best(f, [](const decltype(f(std::declval<HandleT>()))& a,
+                          const decltype(f(std::declval<HandleT>()))& b) { return a > b; });
+  }
+
+  /// Parallel version of SmartRangeT::count_if()
+  template <typename Functor>
+  auto count_if(Functor&& f) -> int
+  {
+    std::vector<int> partial(blocks_.size(), 0);
+    run([&](size_t b) {
+      int count = 0;
+      for (Iterator it = blocks_[b].first; it != blocks_[b].second; ++it)
+        if (filter_(*it) && f(*it))
+          ++count;
+      partial[b] = count;
+    });
+    int count = 0;
+    for (int c : partial)
+      count += c;
+    return count;
+  }
+
+  /// Parallel version of SmartRangeT::for_each(), \p f is called concurrently
+  template <typename Functor>
+  auto for_each(Functor&& f) -> void
+  {
+    run([&](size_t b) {
+      for (Iterator it = blocks_[b].first; it != blocks_[b].second; ++it)
+        if (filter_(*it))
+          f(*it);
+    });
+  }
+
+  /** @brief Only process a subset of elements
+   *
+   * Returns a parallel range which skips all elements that do not satisfy functor \p f, e.g.
+   * one of the predicates from Predicates.hh or a combination of them.
+   */
+  template <typename Functor>
+  auto filtered(Functor&& f) -> ParallelSmartRangeT<RangeT, HandleT, std::function<bool(const HandleT&)>>
+  {
+    Filter filter = filter_;
+    typename std::decay<Functor>::type pred = std::forward<Functor>(f);
+    return ParallelSmartRangeT<RangeT, HandleT, std::function<bool(const HandleT&)>>(
+          blocks_, threads_, [filter, pred](const HandleT& h) { return filter(h) && pred(h); });
+  }
+
+  /// Number of blocks the range has been split into
+  size_t n_blocks() const { return blocks_.size(); }
+
+private:
+
+  // Ranges over mesh elements: compute the block boundaries from the handle indices
+  template <typename It>
+  auto split(It begin, It end, size_t grain, int) ->
+    decltype(It(*(*begin).mesh(), typename It::value_handle(0), begin.skipping_enabled()), void())
+  {
+    const size_t first = size_t(std::max((*begin).idx(), 0));
+    const size_t last  = size_t(std::max((*end).idx(), 0));
+    for (size_t b = first; b < last; b += grain)
+    {
+      It block_begin = (b == first) ? begin : It(*(*begin).mesh(), typename It::value_handle(int(b)), begin.skipping_enabled());
+      It block_end   = (b + grain >= last) ? end : It(*(*begin).mesh(), typename It::value_handle(int(b + grain)), begin.skipping_enabled());
+      blocks_.push_back(Block(block_begin, block_end));
+    }
+  }
+
+  // All other ranges: walk the range once
+  template <typename It>
+  void split(It begin, It end, size_t grain, long)
+  {
+    size_t n = 0;
+    It block_begin = begin;
+    for (It it = begin; it != end; ++it)
+      if (++n == grain)
+      {
+        It block_end = it;
+        ++block_end;
+        blocks_.push_back(Block(block_begin, block_end));
+        block_begin = block_end;
+        n = 0;
+      }
+    if (n > 0)
+      blocks_.push_back(Block(block_begin, end));
+  }
+
+  // Process all blocks on the thread pool, rethrows the first exception
+  template <typename BlockFunctor>
+  void run(BlockFunctor&& f)
+  {
+    parallel_for(blocks_.size(), 1, [&](size_t first, size_t last) {
+      for (size_t b = first; b < last; ++b)
+        f(b);
+    }, threads_);
+  }
+
+  // Combine the block results in block order
+  template <typename Result, typename Combine>
+  static Result combine(const std::vector<std::unique_ptr<Result>>& partial, Combine&& c)
+  {
+    auto it = std::find_if(partial.begin(), partial.end(), [](const std::unique_ptr<Result>& p) { return bool(p); });
+    assert(it != partial.end());
+    Result res = **it;
+    for (++it; it != partial.end(); ++it)
+      if (*it)
+        c(res, **it);
+    return res;
+  }
+
+  template <typename Functor, typename Better>
+  HandleT arg_best(Functor&& f, Better&& better)
+  {
+    using Result = typename std::decay<decltype (f(std::declval<HandleT>()))>::type;
+    std::vector<std::unique_ptr<std::pair<Result, HandleT>>> partial(blocks_.size());
+    run([&](size_t b) {
+      for (Iterator it = blocks_[b].first; it != blocks_[b].second; ++it)
+        if (filter_(*it))
+        {
+          auto val = f(*it);
+          if (!partial[b])
+            partial[b].reset(new std::pair<Result, HandleT>(val, *it));
+          else if (better(val, partial[b]->first))
+            *partial[b] = std::pair<Result, HandleT>(val, *it);
+        }
+    });
+    return combine(partial, [&](std::pair<Result, HandleT>& res, const std::pair<Result, HandleT>& val) {
+      if (better(val.first, res.first))
+        res = val;
+    }).second;
+  }
+
+  std::vector<Block> blocks_;
+  unsigned int threads_;
+  Filter filter_;
+};
+
+
 
 //=============================================================================
 } // namespace OpenMesh
@@ -0,0 +1,179 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  CLASS TopologyJournal - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/Mesh/TopologyJournal.hh>
+#include <algorithm>
+#include <limits>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+TopologyJournal::TopologyJournal()
+  : enabled_(false), base_(0), section_(0), max_size_(size_t(1) << 22), epoch_(0)
+{
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void TopologyJournal::enable(bool _yn)
+{
+  if (enabled_ && !_yn)
+  {
+    reset();
+    for (int k = 0; k < 3; ++k)
+      std::vector<uint32_t>().swap(slots_[k]);
+    std::vector<Entry>().swap(log_);
+  }
+  enabled_ = _yn;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void TopologyJournal::reset()
+{
+  // skip one position, so that positions at the end become invalid as
+  // well. The slots need no reset, they all point before the new section.
+  base_ += log_.size() + 1;
+  section_ = base_;
+  log_.clear();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+TopologyJournal::Position TopologyJournal::checkpoint()
+{
+  section_ = end();
+  return section_;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void TopologyJournal::truncate(Position _pos)
+{
+  if (_pos <= base_)
+    return;
+
+  _pos = std::min(_pos, end());
+  log_.erase(log_.begin(), log_.begin() + (_pos - base_));
+  base_ = _pos;
+  section_ = std::max(section_, base_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void TopologyJournal::record(Kind _kind, int _idx, unsigned char _flags)
+{
+  if (_idx < 0)
+    return;
+
+  std::vector<uint32_t>& slots = slots_[_kind];
+  if (size_t(_idx) >= slots.size())
+    slots.resize(size_t(_idx) + 1, 0);
+
+  // already recorded in this section
+  const Position slot = epoch_ + slots[_idx];
+  if (slot > section_)
+  {
+    log_[slot - 1 - base_].flags |= _flags;
+    return;
+  }
+
+  if (log_.size() >= max_size_)
+    reset();
+
+  if (end() + 1 - epoch_ > std::numeric_limits<uint32_t>::max())
+    rebase();
+
+  Entry e;
+  e.idx   = _idx;
+  e.kind  = static_cast<unsigned char>(_kind);
+  e.flags = _flags;
+  log_.push_back(e);
+  slots_[_kind][_idx] = static_cast<uint32_t>(end() - epoch_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void TopologyJournal::rebase()
+{
+  reset();
+  for (int k = 0; k < 3; ++k)
+    std::fill(slots_[k].begin(), slots_[k].end(), 0u);
+  epoch_ = base_;
+}
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
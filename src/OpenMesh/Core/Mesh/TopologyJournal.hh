@@ -0,0 +1,216 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  CLASS TopologyJournal
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_TOPOLOGYJOURNAL_HH
+#define OPENMESH_TOPOLOGYJOURNAL_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Mesh/Handles.hh>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Journal of the vertices, edges and faces touched by topology changes.
+ *
+ *  The ArrayKernel records every change of the connectivity (setters of
+ *  the halfedge structure, new and deleted elements) and every
+ *  set_point() in the journal if it is requested, see
+ *  ArrayKernel::request_journal(). Halfedge changes are recorded for
+ *  their edge. Geometry written through the non-const point() reference
+ *  or the points() array is not recorded, use touch() for that.
+ *
+ *  Consumers remember a position returned by checkpoint() and later
+ *  visit all entries since that position with for_each(). An element
+ *  appears at most once between two checkpoints, its flags tell whether
+ *  it was touched, created and/or deleted. Several consumers may use
+ *  the same journal, each with its own position.
+ *
+ *  Operations which invalidate handles (garbage collection, permute,
+ *  clear, resize) reset the journal: positions before the reset are no
+ *  longer valid() and consumers have to recompute everything. The same
+ *  happens if the journal grows beyond max_size().
+ *
+ *  \code
+ *  mesh.request_journal();
+ *  TopologyJournal::Position pos = mesh.journal().checkpoint();
+ *  mesh.collapse(heh);
+ *  pos = mesh.update_normals(pos);    // only around the collapsed edge
+ *  \endcode
+ */
+class OPENMESHDLLEXPORT TopologyJournal
+{
+public:
+
+  /// Absolute position in the journal
+  typedef size_t Position;
+
+  /// Element type of an entry
+  enum Kind { VERTEX = 0, EDGE = 1, FACE = 2 };
+
+  /// Change flags of an entry
+  enum Flags { TOUCHED = 1, CREATED = 2, DELETED = 4 };
+
+  struct Entry
+  {
+    int           idx;
+    unsigned char kind;
+    unsigned char flags;
+  };
+
+public:
+
+  TopologyJournal();
+
+  /// Start or stop recording. Stopping resets the journal.
+  void enable(bool _yn);
+
+  /// Is the journal recording?
+  bool enabled() const { return enabled_; }
+
+  //--- recording -------------------------------------------------------------
+
+  void touch(VertexHandle _vh) { if (enabled_) record(VERTEX, _vh.idx(), TOUCHED); }
+  void touch(EdgeHandle _eh)   { if (enabled_) record(EDGE,   _eh.idx(), TOUCHED); }
+  void touch(HalfedgeHandle _heh) { if (enabled_) record(EDGE, _heh.idx() >> 1, TOUCHED); }
+  void touch(FaceHandle _fh)   { if (enabled_) record(FACE,   _fh.idx(), TOUCHED); }
+
+  template <class HandleT>
+  void created(HandleT _h) { if (enabled_) record(kind(_h), index(_h), CREATED); }
+
+  template <class HandleT>
+  void deleted(HandleT _h) { if (enabled_) record(kind(_h), index(_h), DELETED); }
+
+  /// Invalidate all positions, e.g. after handles changed
+  void reset();
+
+  //--- consuming -------------------------------------------------------------
+
+  /** Start a new section of the journal and return its position. Elements
+   *  changed afterwards are recorded again even if they were recorded
+   *  before. */
+  Position checkpoint();
+
+  /// Position behind the last entry
+  Position end() const { return base_ + log_.size(); }
+
+  /// Are all changes since _pos still recorded?
+  bool valid(Position _pos) const { return enabled_ && _pos >= base_ && _pos <= end(); }
+
+  /// Number of entries since _pos, which must be valid()
+  size_t size(Position _pos) const { return end() - _pos; }
+
+  /// Call _f(const Entry&) for all entries since _pos, which must be valid()
+  template <class Functor>
+  void for_each(Position _pos, Functor _f) const
+  {
+    for (size_t i = _pos - base_; i < log_.size(); ++i)
+      _f(log_[i]);
+  }
+
+  /// Drop the entries before _pos, positions before it become invalid
+  void truncate(Position _pos);
+
+  /// Maximal number of entries kept before the journal is reset
+  size_t max_size() const { return max_size_; }
+  void set_max_size(size_t _n) { max_size_ = _n; }
+
+private:
+
+  static Kind kind(VertexHandle)   { return VERTEX; }
+  static Kind kind(EdgeHandle)     { return EDGE; }
+  static Kind kind(HalfedgeHandle) { return EDGE; }
+  static Kind kind(FaceHandle)     { return FACE; }
+
+  static int index(VertexHandle _h)   { return _h.idx(); }
+  static int index(EdgeHandle _h)     { return _h.idx(); }
+  static int index(HalfedgeHandle _h) { return _h.idx() >> 1; }
+  static int index(FaceHandle _h)     { return _h.idx(); }
+
+  void record(Kind _kind, int _idx, unsigned char _flags);
+
+  /// Reset and restart the 32 bit slots at the current position
+  void rebase();
+
+private:
+
+  bool                enabled_;
+  std::vector<Entry>  log_;
+  Position            base_;        // position of log_[0]
+  Position            section_;     // position of the last checkpoint
+  size_t              max_size_;
+  Position            epoch_;       // origin of the slots
+
+  // per element position+1 of its last entry relative to epoch_, the entry
+  // is reused if it is in the current section
+  std::vector<uint32_t> slots_[3];
+};
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_TOPOLOGYJOURNAL_HH defined
+//=============================================================================
@@ -64,6 +64,8 @@
 #include <OpenMesh/Core/Geometry/VectorT.hh>
 #include <OpenMesh/Core/Mesh/Attributes.hh>
 #include <OpenMesh/Core/Mesh/Handles.hh>
+#include <OpenMesh/Core/Utils/MemoryResource.hh>
+#include <memory>
 
 
 //== NAMESPACES ===============================================================
@@ -150,6 +152,15 @@ struct DefaultTraits
   HalfedgeAttributes(Attributes::PrevHalfedge);
   EdgeAttributes(0);
   FaceAttributes(0);
+
+  /** Allocator of the property arrays, either std::allocator<char> or
+      ResourceAllocatorT<char>. The latter places the properties of a mesh
+      in a MemoryResource, e.g. a NUMA-local, huge-page or arena resource,
+      together with the connectivity arrays and the status flags. Bool
+      properties always use std::allocator.
+      \see BaseKernel::set_memory_resource(), BaseKernel::set_copy_on_write(), PropertyTypeT
+  */
+  typedef std::allocator<char> PropertyAllocator;
 };
 
 /** \class DefaultTraitsDouble Traits.hh <OpenMesh/Mesh/Traits.hh>
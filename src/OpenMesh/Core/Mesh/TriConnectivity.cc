@@ -45,6 +45,8 @@
 //  CLASS TriMeshT - IMPLEMENTATION
 
 #include <OpenMesh/Core/Mesh/TriConnectivity.hh>
+#include <algorithm>
+#include <vector>
 
 namespace OpenMesh
 {
@@ -108,7 +110,7 @@ SmartFaceHandle TriConnectivity::add_face(VertexHandle _vh0, VertexHandle _vh1,
 
 //-----------------------------------------------------------------------------
 
-bool TriConnectivity::is_collapse_ok(HalfedgeHandle v0v1)
+bool TriConnectivity::is_collapse_ok(HalfedgeHandle v0v1) const
 {
   // is the edge already deleted?
   if ( status(edge_handle(v0v1)).deleted() )
@@ -159,18 +161,39 @@ bool TriConnectivity::is_collapse_ok(HalfedgeHandle v0v1)
   // if vl and vr are equal or both invalid -> fail
   if (vl == vr) return false;
 
-  VertexVertexIter  vv_it;
+  // test intersection of the one-rings of v0 and v1. The one-ring of v1 is
+  // copied instead of tagged, so the test does not write to the mesh. Large
+  // rings are sorted to keep the test linear.
+  const size_t    n_small = 32;
+  VertexHandle    small_ring[n_small];
+  std::vector<VertexHandle> large_ring;
+  size_t          n_ring = 0;
 
-  // test intersection of the one-rings of v0 and v1
-  for (vv_it = vv_iter(v0); vv_it.is_valid(); ++vv_it)
-    status(*vv_it).set_tagged(false);
+  for (ConstVertexVertexIter vv_it = cvv_iter(v1); vv_it.is_valid(); ++vv_it, ++n_ring)
+  {
+    if (n_ring < n_small)
+      small_ring[n_ring] = *vv_it;
+    else
+    {
+      if (n_ring == n_small)
+        large_ring.assign(small_ring, small_ring + n_small);
+      large_ring.push_back(*vv_it);
+    }
+  }
+  if (n_ring > n_small)
+    std::sort(large_ring.begin(), large_ring.end());
 
-  for (vv_it = vv_iter(v1); vv_it.is_valid(); ++vv_it)
-    status(*vv_it).set_tagged(true);
+  for (ConstVertexVertexIter vv_it = cvv_iter(v0); vv_it.is_valid(); ++vv_it)
+  {
+    if (*vv_it == vl || *vv_it == vr)
+      continue;
 
-  for (vv_it = vv_iter(v0); vv_it.is_valid(); ++vv_it)
-    if (status(*vv_it).tagged() && *vv_it != vl && *vv_it != vr)
+    const bool common = (n_ring > n_small)
+      ? std::binary_search(large_ring.begin(), large_ring.end(), *vv_it)
+      : std::find(small_ring, small_ring + n_ring, *vv_it) != small_ring + n_ring;
+    if (common)
       return false;
+  }
 
 
   // edge between two boundary vertices should be a boundary edge
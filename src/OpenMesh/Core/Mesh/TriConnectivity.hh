@@ -143,9 +143,10 @@ public:
 
   /** Returns whether collapsing halfedge _heh is ok or would lead to
       topological inconsistencies.
-      \attention This method need the Attributes::Status attribute and
-      changes the \em tagged bit.  */
-  bool is_collapse_ok(HalfedgeHandle _heh);
+      \attention This method needs the Attributes::Status attribute. It
+      is const and does not modify the mesh, so different collapses may be
+      tested concurrently as long as no thread modifies the mesh. */
+  bool is_collapse_ok(HalfedgeHandle _heh) const;
 
   /// Vertex Split: inverse operation to collapse().
   HalfedgeHandle vertex_split(VertexHandle v0, VertexHandle v1,
@@ -73,12 +73,12 @@ typename TriMeshT<Kernel>::Normal
 TriMeshT<Kernel>::
 calc_face_normal(FaceHandle _fh) const
 {
-  assert(this->halfedge_handle(_fh).is_valid());
-  ConstFaceVertexIter fv_it(this->cfv_iter(_fh));
+  HalfedgeHandle heh = this->halfedge_handle(_fh);
+  assert(heh.is_valid());
 
-  const Point& p0(this->point(*fv_it));  ++fv_it;
-  const Point& p1(this->point(*fv_it));  ++fv_it;
-  const Point& p2(this->point(*fv_it));
+  const Point& p0(this->point(this->to_vertex_handle(heh)));  heh = this->next_halfedge_handle(heh);
+  const Point& p1(this->point(this->to_vertex_handle(heh)));  heh = this->next_halfedge_handle(heh);
+  const Point& p2(this->point(this->to_vertex_handle(heh)));
 
   return PolyMesh::calc_face_normal(p0, p1, p2);
 }
@@ -47,6 +47,7 @@
 #include <string>
 #include <OpenMesh/Core/IO/StoreRestore.hh>
 #include <OpenMesh/Core/System/omstream.hh>
+#include <OpenMesh/Core/Utils/MemoryResource.hh>
 
 namespace OpenMesh {
 
@@ -82,12 +83,14 @@ public:
   /// \param _internal_type_name Internal type name which will be used when storing the data in OM format
   ///
   BaseProperty(const std::string& _name = "<unknown>", const std::string& _internal_type_name = "<unknown>" )
-  : name_(_name), internal_type_name_(_internal_type_name), persistent_(false)
+  : name_(_name), internal_type_name_(_internal_type_name), persistent_(false),
+    resource_allocation_(false)
   {}
 
   /// \brief Copy constructor
   BaseProperty(const BaseProperty & _rhs)
-      : name_( _rhs.name_ ), internal_type_name_(_rhs.internal_type_name_), persistent_( _rhs.persistent_ ) {}
+      : name_( _rhs.name_ ), internal_type_name_(_rhs.internal_type_name_), persistent_( _rhs.persistent_ ),
+        resource_allocation_( _rhs.resource_allocation_ ) {}
 
   /// Destructor.
   virtual ~BaseProperty() {}
@@ -112,9 +115,37 @@ public: // synchronized array interface
   /// Copy one element to another
   virtual void copy(size_t _io, size_t _i1) = 0;
   
-  /// Return a deep copy of self.
+  /// Return a deep copy of self. If copy-on-write is enabled, the copy
+  /// shares the element storage with self until either of them is modified.
   virtual BaseProperty* clone () const = 0;
 
+  /// Exchange all elements with \p _other. Returns false and leaves both
+  /// untouched if \p _other is not of the same class.
+  virtual bool swap_elements( BaseProperty& /* _other */ ) { return false; }
+
+public: // copy-on-write support
+
+  /// Enable or disable sharing of the element storage with copies of self.
+  /// Properties without copy-on-write support ignore this setting.
+  virtual void set_copy_on_write( bool /* _yn */ ) {}
+
+  /// Returns true if copies of self share the element storage.
+  virtual bool copy_on_write() const { return false; }
+
+public: // memory resource
+
+  /// Move the element storage into memory obtained from \p _resource.
+  /// Properties with their own storage management ignore this request.
+  virtual void set_memory_resource( MemoryResource* /* _resource */ ) {}
+
+  /// Returns the resource providing the element storage or nullptr if the
+  /// property does not use one.
+  virtual MemoryResource* memory_resource() const { return nullptr; }
+
+  /// Returns true if the element vector uses ResourceAllocatorT, see
+  /// PropertyTypeT. Checked by PropertyContainer::property().
+  bool resource_allocation() const { return resource_allocation_; }
+
 public: // named property interface
 
   /// Return the name of the property
@@ -177,11 +208,15 @@ protected:
     persistent_ = IO::is_streamable<T>() && _yn;
   }
 
+  /// Called by the constructor of PropertyT.
+  void set_resource_allocation( bool _yn ) { resource_allocation_ = _yn; }
+
 private:
 
   std::string name_;
   std::string internal_type_name_;
   bool        persistent_;
+  bool        resource_allocation_;
 };
 
 }//namespace OpenMesh
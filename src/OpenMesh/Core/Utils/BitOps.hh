@@ -0,0 +1,142 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  Helpers for word-parallel bit manipulation
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_BITOPS_HH
+#define OPENMESH_BITOPS_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#  include <intrin.h>
+#endif
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+
+//== FUNCTIONS ================================================================
+
+
+/// Number of set bits in \c _w.
+inline unsigned int popcount(uint64_t _w)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned int>(__builtin_popcountll(_w));
+#else
+  return static_cast<unsigned int>(std::bitset<64>(_w).count());
+#endif
+}
+
+
+/// Index of the lowest set bit of \c _w. \c _w must not be zero.
+inline unsigned int count_trailing_zeros(uint64_t _w)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned int>(__builtin_ctzll(_w));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+  unsigned long idx;
+  _BitScanForward64(&idx, _w);
+  return static_cast<unsigned int>(idx);
+#else
+  unsigned int idx = 0;
+  while (!(_w & 1)) { _w >>= 1; ++idx; }
+  return idx;
+#endif
+}
+
+
+/// Number of set bits in the first \c _n words of \c _words.
+inline size_t popcount(const uint64_t* _words, size_t _n)
+{
+  size_t count = 0;
+  for (size_t i = 0; i < _n; ++i)
+    count += popcount(_words[i]);
+  return count;
+}
+
+
+/** Call \c _f(idx) for the index of every set bit in the first \c _n words
+    of \c _words, in ascending order. Bit \c b of word \c w has the index
+    <tt>64*w+b</tt>. Zero words are skipped at once.
+*/
+template <class Functor>
+inline void for_each_set_bit(const uint64_t* _words, size_t _n, Functor _f)
+{
+  for (size_t i = 0; i < _n; ++i)
+  {
+    uint64_t w = _words[i];
+    while (w)
+    {
+      _f(64 * i + count_trailing_zeros(w));
+      w &= w - 1;
+    }
+  }
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_BITOPS_HH
+//=============================================================================
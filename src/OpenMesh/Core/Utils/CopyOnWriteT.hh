@@ -0,0 +1,257 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+//=============================================================================
+//
+//  CLASS CopyOnWriteT
+//
+//=============================================================================
+
+#ifndef OPENMESH_COPYONWRITE_HH
+#define OPENMESH_COPYONWRITE_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+#include <atomic>
+#include <memory>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+/** \class CopyOnWriteT CopyOnWriteT.hh <OpenMesh/Core/Utils/CopyOnWriteT.hh>
+
+    Storage wrapper around a container (usually a std::vector) which can
+    share its buffer with copies of itself.
+
+    By default the wrapper behaves like the plain container: copying it
+    copies all elements. If copy-on-write is enabled via enable(), copies
+    made from this object share the buffer with it and only take a private
+    copy on the first non-const access through write(). Copying a wrapper
+    with copy-on-write enabled is therefore O(1).
+
+    Reads go through read(), writes through write(). References obtained
+    from read() are invalidated by a subsequent write() on the same object,
+    in the same way as a reallocation of a std::vector invalidates them.
+
+    While copy-on-write is enabled the buffer is held in shared storage, so
+    copying an object only copies a reference and never modifies the
+    source. write() takes the buffer over without a copy if no other object
+    references it anymore. Private copies use the allocator of the object
+    taking them, which is kept while the buffer is shared, see
+    set_allocator().
+
+    \note Any number of threads may read or copy the same object
+    concurrently. write() and enable() must not run while another thread
+    accesses the same object, parallel code has to read through const
+    access (read(), const mesh accessors) or call write() once before the
+    parallel section. Different objects sharing a buffer may be used from
+    different threads, a shared buffer is never modified.
+
+    As long as copy-on-write is disabled, write() only tests one pointer
+    before returning the container.
+**/
+template <class Container>
+class CopyOnWriteT
+{
+public:
+
+  typedef Container                              container_type;
+  typedef typename Container::allocator_type     allocator_type;
+
+public:
+
+  /// Default constructor, copy-on-write is disabled.
+  CopyOnWriteT() : enabled_(false) {}
+
+  /// Copy constructor. Shares the buffer of \p _rhs if copy-on-write is
+  /// enabled there, otherwise the elements are copied. The copy uses the
+  /// allocator a copy of the container would get, if that one differs
+  /// from the allocator of the shared buffer the elements are copied as
+  /// well.
+  CopyOnWriteT(const CopyOnWriteT& _rhs)
+    : data_(_rhs.shared_ ? Container(std::allocator_traits<allocator_type>::
+                select_on_container_copy_construction(_rhs.data_.get_allocator()))
+            : _rhs.data_),
+      shared_(_rhs.shared_),
+      enabled_(_rhs.enabled_)
+  {
+    adopt_allocator();
+  }
+
+  /// Assignment operator, see the copy constructor. Keeps the allocator of
+  /// self.
+  CopyOnWriteT& operator=(const CopyOnWriteT& _rhs)
+  {
+    if (this != &_rhs)
+    {
+      enabled_ = _rhs.enabled_;
+      shared_  = _rhs.shared_;
+      if (shared_)
+      {
+        Container(data_.get_allocator()).swap(data_);
+        adopt_allocator();
+      }
+      else
+        data_ = _rhs.data_;
+    }
+    return *this;
+  }
+
+public:
+
+  /// Enable or disable sharing of the buffer with copies made from self.
+  void enable(bool _yn)
+  {
+    if (_yn == enabled_)
+      return;
+
+    if (_yn)
+    {
+      shared_ = std::make_shared<Container>(data_.get_allocator());
+      shared_->swap(data_);
+    }
+    else
+    {
+      data_.swap(write());
+      shared_.reset();
+    }
+    enabled_ = _yn;
+  }
+
+  /// Returns true if copies made from self share the buffer.
+  bool enabled() const { return enabled_; }
+
+  /// Returns true if the buffer is currently referenced by another object.
+  bool shared() const { return shared_ && shared_.use_count() > 1; }
+
+  /// Const access to the container.
+  const Container& read() const { return shared_ ? *shared_ : data_; }
+
+  /// Non-const access to the container. Takes a private copy of the buffer
+  /// if it is shared with another object.
+  Container& write()
+  {
+    return shared_ ? write_shared() : data_;
+  }
+
+  /// Returns the allocator used for the buffer and for private copies.
+  allocator_type get_allocator() const { return data_.get_allocator(); }
+
+  /// Move the buffer into storage obtained from \p _alloc. Private copies
+  /// taken by write() later on use \p _alloc as well. A shared buffer is
+  /// copied, the other objects keep referencing the old one.
+  void set_allocator(const allocator_type& _alloc)
+  {
+    if (shared_)
+    {
+      std::shared_ptr<Container> moved;
+      if (shared_.use_count() > 1)
+        moved = std::make_shared<Container>(*shared_, _alloc);
+      else
+      {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        moved = std::make_shared<Container>(std::move(*shared_), _alloc);
+      }
+      shared_.swap(moved);
+      data_ = Container(_alloc);
+    }
+    else
+      data_ = Container(std::move(data_), _alloc);
+  }
+
+  /// Drop the buffer (shared or not) and release its memory. The
+  /// allocator of the container is kept.
+  void release()
+  {
+    Container empty(data_.get_allocator());
+    if (shared_)
+      shared_ = std::make_shared<Container>(std::move(empty));
+    else
+      empty.swap(data_);
+  }
+
+private:
+
+  /// Take a private copy of a shared buffer living in another allocator,
+  /// e.g. an arena the copy must not point into.
+  void adopt_allocator()
+  {
+    if (shared_ && shared_->get_allocator() != data_.get_allocator())
+      shared_ = std::make_shared<Container>(*shared_, data_.get_allocator());
+  }
+
+  /// write() on shared storage, kept out of write() so that the path of
+  /// objects without copy-on-write stays small enough to be inlined
+  Container& write_shared()
+  {
+    if (shared_.use_count() > 1 || shared_->get_allocator() != data_.get_allocator())
+    {
+      std::shared_ptr<Container> copy = std::make_shared<Container>(*shared_, data_.get_allocator());
+      shared_.swap(copy);
+    }
+    else // the last other owner may just have released it
+      std::atomic_thread_fence(std::memory_order_acquire);
+    return *shared_;
+  }
+
+private:
+
+  Container                  data_;
+  std::shared_ptr<Container> shared_;
+  bool                       enabled_;
+};
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_COPYONWRITE_HH
+//=============================================================================
@@ -0,0 +1,200 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  Memory resources and the allocator used for mesh storage
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/Utils/MemoryResource.hh>
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+namespace {
+
+class NewDeleteResource : public MemoryResource
+{
+protected:
+
+  void* do_allocate(size_t _bytes, size_t _align) override
+  {
+#ifdef __cpp_aligned_new
+    if (_align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+      return ::operator new(_bytes, std::align_val_t(_align));
+#else
+    if (_align > alignof(std::max_align_t))
+    {
+      // over-allocate and keep the original pointer in front of the block
+      char* raw = static_cast<char*>(::operator new(_bytes + _align + sizeof(void*)));
+      std::uintptr_t p = reinterpret_cast<std::uintptr_t>(raw + sizeof(void*));
+      char* aligned = reinterpret_cast<char*>((p + _align - 1) & ~(std::uintptr_t(_align) - 1));
+      reinterpret_cast<void**>(aligned)[-1] = raw;
+      return aligned;
+    }
+#endif
+    return ::operator new(_bytes);
+  }
+
+  void do_deallocate(void* _p, size_t /* _bytes */, size_t _align) override
+  {
+#ifdef __cpp_aligned_new
+    if (_align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+      ::operator delete(_p, std::align_val_t(_align));
+      return;
+    }
+#else
+    if (_align > alignof(std::max_align_t))
+    {
+      ::operator delete(reinterpret_cast<void**>(_p)[-1]);
+      return;
+    }
+#endif
+    ::operator delete(_p);
+  }
+
+  bool do_is_equal(const MemoryResource& _other) const override
+  { return dynamic_cast<const NewDeleteResource*>(&_other) != nullptr; }
+};
+
+} // anonymous namespace
+
+
+//-----------------------------------------------------------------------------
+
+
+MemoryResource* MemoryResource::default_resource()
+{
+  static NewDeleteResource resource;
+  return &resource;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+ArenaMemoryResource::ArenaMemoryResource(size_t _block_size, MemoryResource* _upstream)
+  : upstream_(_upstream ? _upstream : MemoryResource::default_resource()),
+    block_size_(std::max<size_t>(_block_size, 64)),
+    current_(nullptr), end_(nullptr),
+    bytes_allocated_(0), bytes_reserved_(0)
+{
+}
+
+
+ArenaMemoryResource::~ArenaMemoryResource()
+{
+  release();
+}
+
+
+void ArenaMemoryResource::release()
+{
+  for (const Block& b : blocks_)
+    upstream_->deallocate(b.begin, b.size);
+  blocks_.clear();
+  current_ = end_ = nullptr;
+  bytes_allocated_ = bytes_reserved_ = 0;
+}
+
+
+void* ArenaMemoryResource::do_allocate(size_t _bytes, size_t _align)
+{
+  _bytes = std::max<size_t>(_bytes, 1);
+
+  std::uintptr_t p = reinterpret_cast<std::uintptr_t>(current_);
+  std::uintptr_t aligned = (p + _align - 1) & ~(std::uintptr_t(_align) - 1);
+
+  if (current_ == nullptr || aligned + _bytes > reinterpret_cast<std::uintptr_t>(end_))
+  {
+    Block b;
+    b.size  = std::max(block_size_, _bytes + _align);
+    b.begin = static_cast<char*>(upstream_->allocate(b.size));
+    blocks_.push_back(b);
+    bytes_reserved_ += b.size;
+
+    current_ = b.begin;
+    end_     = b.begin + b.size;
+    p        = reinterpret_cast<std::uintptr_t>(current_);
+    aligned  = (p + _align - 1) & ~(std::uintptr_t(_align) - 1);
+  }
+
+  current_ = reinterpret_cast<char*>(aligned) + _bytes;
+  bytes_allocated_ += _bytes;
+  return reinterpret_cast<char*>(aligned);
+}
+
+
+void ArenaMemoryResource::do_deallocate(void* /* _p */, size_t /* _bytes */, size_t /* _align */)
+{
+  // Memory is only returned by release()
+}
+
+
+bool ArenaMemoryResource::do_is_equal(const MemoryResource& _other) const
+{
+  return this == &_other;
+}
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,288 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  Memory resources and the allocator used for mesh storage
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_MEMORYRESOURCE_HH
+#define OPENMESH_MEMORYRESOURCE_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Utils/CopyOnWriteT.hh>
+#include <OpenMesh/Core/Utils/Noncopyable.hh>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \class MemoryResource MemoryResource.hh <OpenMesh/Core/Utils/MemoryResource.hh>
+
+    Abstract source of raw memory for the property storage of meshes whose
+    traits select ResourceAllocatorT. It mirrors std::pmr::memory_resource
+    so that custom strategies (NUMA-local pools, huge pages, arenas) can be
+    plugged in per mesh.
+
+    A resource must outlive every mesh and property using it.
+
+    \see ArenaMemoryResource, ResourceAllocatorT, BaseKernel::set_memory_resource()
+*/
+class OPENMESHDLLEXPORT MemoryResource
+{
+public:
+
+  virtual ~MemoryResource() {}
+
+  /// Allocate \c _bytes bytes aligned to \c _align.
+  void* allocate(size_t _bytes, size_t _align = alignof(std::max_align_t))
+  { return do_allocate(_bytes, _align); }
+
+  /// Return memory obtained by allocate() with the same size and alignment.
+  void deallocate(void* _p, size_t _bytes, size_t _align = alignof(std::max_align_t))
+  { do_deallocate(_p, _bytes, _align); }
+
+  /// Memory allocated by one resource can be released by the other.
+  bool is_equal(const MemoryResource& _other) const
+  { return this == &_other || do_is_equal(_other); }
+
+  /// The global new/delete resource, used when nothing else is set.
+  static MemoryResource* default_resource();
+
+protected:
+
+  virtual void* do_allocate(size_t _bytes, size_t _align) = 0;
+  virtual void  do_deallocate(void* _p, size_t _bytes, size_t _align) = 0;
+  virtual bool  do_is_equal(const MemoryResource& _other) const = 0;
+};
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \class ArenaMemoryResource MemoryResource.hh <OpenMesh/Core/Utils/MemoryResource.hh>
+
+    Monotonic arena. Memory is carved from large blocks obtained from an
+    upstream resource and is only returned when release() is called or the
+    arena is destroyed, deallocate() does nothing. Growing arrays therefore
+    leave their old buffers behind; reserve the final size up front where
+    it is known.
+
+    Typical use is one arena per temporary mesh:
+    \code
+    OpenMesh::ArenaMemoryResource arena;
+    {
+      ArenaMesh piece;   // traits with PropertyAllocator = ResourceAllocatorT<char>
+      piece.set_memory_resource(&arena);
+      // ... build, process, write ...
+    }
+    arena.release();   // hand back all blocks at once
+    \endcode
+
+    The arena is not thread-safe.
+*/
+class OPENMESHDLLEXPORT ArenaMemoryResource : public MemoryResource,
+                                              private Utils::Noncopyable
+{
+public:
+
+  /// \param _block_size Minimum size of the blocks requested from upstream.
+  /// \param _upstream   Resource providing the blocks (default new/delete).
+  explicit ArenaMemoryResource(size_t _block_size = 1 << 20,
+                               MemoryResource* _upstream = nullptr);
+
+  ~ArenaMemoryResource();
+
+  /// Return all blocks to the upstream resource.
+  void release();
+
+  /// Number of bytes currently handed out by the arena.
+  size_t bytes_allocated() const { return bytes_allocated_; }
+
+  /// Number of bytes held in blocks from the upstream resource.
+  size_t bytes_reserved() const { return bytes_reserved_; }
+
+protected:
+
+  void* do_allocate(size_t _bytes, size_t _align) override;
+  void  do_deallocate(void* _p, size_t _bytes, size_t _align) override;
+  bool  do_is_equal(const MemoryResource& _other) const override;
+
+private:
+
+  struct Block
+  {
+    char*  begin;
+    size_t size;
+  };
+
+  MemoryResource*    upstream_;
+  size_t             block_size_;
+  std::vector<Block> blocks_;
+  char*              current_;
+  char*              end_;
+  size_t             bytes_allocated_;
+  size_t             bytes_reserved_;
+};
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \class ResourceAllocatorT MemoryResource.hh <OpenMesh/Core/Utils/MemoryResource.hh>
+
+    Standard allocator forwarding to a MemoryResource. Mesh traits select it
+    for the property arrays, see DefaultTraits::PropertyAllocator.
+
+    Copies follow std::pmr::polymorphic_allocator: a copy constructed
+    container uses the default resource and a copy assigned container keeps
+    its own, so copying data out of an arena never leaves the copy pointing
+    into it. Moves and swaps exchange the buffers and take their resource
+    along.
+*/
+template <class T>
+class ResourceAllocatorT
+{
+public:
+
+  typedef T value_type;
+
+  typedef std::false_type propagate_on_container_copy_assignment;
+  typedef std::true_type  propagate_on_container_move_assignment;
+  typedef std::true_type  propagate_on_container_swap;
+
+  ResourceAllocatorT() : resource_(MemoryResource::default_resource()) {}
+
+  ResourceAllocatorT(MemoryResource* _resource)
+    : resource_(_resource ? _resource : MemoryResource::default_resource()) {}
+
+  template <class U>
+  ResourceAllocatorT(const ResourceAllocatorT<U>& _other)
+    : resource_(_other.resource()) {}
+
+  T* allocate(size_t _n)
+  { return static_cast<T*>(resource_->allocate(_n * sizeof(T), alignof(T))); }
+
+  void deallocate(T* _p, size_t _n)
+  { resource_->deallocate(_p, _n * sizeof(T), alignof(T)); }
+
+  MemoryResource* resource() const { return resource_; }
+
+  /// Copies of a container start on the default resource.
+  ResourceAllocatorT select_on_container_copy_construction() const
+  { return ResourceAllocatorT(); }
+
+private:
+
+  MemoryResource* resource_;
+};
+
+template <class T, class U>
+inline bool operator==(const ResourceAllocatorT<T>& _a, const ResourceAllocatorT<U>& _b)
+{ return _a.resource()->is_equal(*_b.resource()); }
+
+template <class T, class U>
+inline bool operator!=(const ResourceAllocatorT<T>& _a, const ResourceAllocatorT<U>& _b)
+{ return !(_a == _b); }
+
+
+//-----------------------------------------------------------------------------
+
+
+/// Returns the resource providing the storage of \c _v, nullptr for
+/// allocators not using a MemoryResource.
+template <class T, class A>
+MemoryResource* resource_of(const std::vector<T, A>& /* _v */)
+{ return nullptr; }
+
+template <class T>
+MemoryResource* resource_of(const std::vector<T, ResourceAllocatorT<T> >& _v)
+{ return _v.get_allocator().resource(); }
+
+/// Returns true if \c _v would not change by rehome(_v, _resource).
+template <class T, class A>
+bool same_resource(const std::vector<T, A>& /* _v */, MemoryResource* /* _resource */)
+{ return true; }
+
+template <class T>
+bool same_resource(const std::vector<T, ResourceAllocatorT<T> >& _v, MemoryResource* _resource)
+{ return _v.get_allocator() == ResourceAllocatorT<T>(_resource); }
+
+/// Move the buffer of \c _v into memory obtained from \c _resource, private
+/// copies taken by CopyOnWriteT::write() later on are placed there as well.
+/// Vectors with other allocators are left alone.
+template <class T, class A>
+void rehome(CopyOnWriteT<std::vector<T, A> >& /* _v */, MemoryResource* /* _resource */)
+{}
+
+template <class T>
+void rehome(CopyOnWriteT<std::vector<T, ResourceAllocatorT<T> > >& _v, MemoryResource* _resource)
+{
+  if (!same_resource(_v.read(), _resource) || _v.get_allocator() != ResourceAllocatorT<T>(_resource))
+    _v.set_allocator(ResourceAllocatorT<T>(_resource));
+}
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_MEMORYRESOURCE_HH
+//=============================================================================
@@ -50,9 +50,13 @@
 
 #include <OpenMesh/Core/System/config.h>
 #include <OpenMesh/Core/Mesh/Handles.hh>
+#include <OpenMesh/Core/Mesh/Status.hh>
 #include <OpenMesh/Core/Utils/BaseProperty.hh>
+#include <OpenMesh/Core/Utils/CopyOnWriteT.hh>
+#include <OpenMesh/Core/Utils/MemoryResource.hh>
 #include <vector>
 #include <string>
+#include <type_traits>
 #include <algorithm>
 
 #include <OpenMesh/Core/IO/SR_store.hh>
@@ -81,6 +85,11 @@ namespace OpenMesh {
  *
  *  Persistency of non-fundamental types is supported if and only if a
  *  specialization of struct IO::binary<> exists for the wanted type.
+ *
+ *  \p Alloc is the allocator of the element vector. Only meshes whose
+ *  traits select ResourceAllocatorT use another one than std::allocator,
+ *  see DefaultTraits::PropertyAllocator. The element vector is held in
+ *  CopyOnWriteT, see set_copy_on_write().
  */
 
 // TODO: it might be possible to define Property using kind of a runtime info
@@ -88,13 +97,14 @@ namespace OpenMesh {
 // in pure malloc() style w/o virtual overhead. Template member function proved per
 // element access to the properties, asserting dynamic_casts in debug
 
-template <class T>
+template <class T, class Alloc = std::allocator<T> >
 class PropertyT : public BaseProperty
 {
 public:
 
   typedef T                                       Value;
-  typedef std::vector<T>                          vector_type;
+  typedef std::vector<T, Alloc>                   vector_type;
+  typedef Alloc                                   allocator_type;
   typedef T                                       value_type;
   typedef typename vector_type::reference         reference;
   typedef typename vector_type::const_reference   const_reference;
@@ -106,7 +116,7 @@ public:
             const std::string& _name = "<unknown>",
             const std::string& _internal_type_name = "<unknown>")
   : BaseProperty(_name, _internal_type_name)
-  {}
+  { set_resource_allocation(std::is_same<Alloc, ResourceAllocatorT<T> >::value); }
 
   /// Copy constructor
   PropertyT(const PropertyT & _rhs)
@@ -114,21 +124,37 @@ public:
 
 public: // inherited from BaseProperty
 
-  virtual void reserve(size_t _n) override { data_.reserve(_n);    }
-  virtual void resize(size_t _n) override  { data_.resize(_n);     }
-  virtual void clear() override  { data_.clear(); vector_type().swap(data_);    }
-  virtual void push_back() override        { data_.emplace_back(); }
+  virtual void reserve(size_t _n) override { data_.write().reserve(_n);    }
+  virtual void resize(size_t _n) override  { data_.write().resize(_n);     }
+  virtual void clear() override  { data_.release();    }
+  virtual void push_back() override        { data_.write().emplace_back(); }
   virtual void swap(size_t _i0, size_t _i1) override
-  { std::swap(data_[_i0], data_[_i1]); }
+  { vector_type& v = data_.write(); std::swap(v[_i0], v[_i1]); }
   virtual void copy(size_t _i0, size_t _i1) override
-  { data_[_i1] = data_[_i0]; }
+  { vector_type& v = data_.write(); v[_i1] = v[_i0]; }
+  virtual bool swap_elements(BaseProperty& _other) override
+  {
+    PropertyT<T, Alloc>* other = dynamic_cast<PropertyT<T, Alloc>*>(&_other);
+    if (other == nullptr)
+      return false;
+    data_.write().swap(other->data_.write());
+    return true;
+  }
 
 public:
 
   virtual void set_persistent( bool _yn ) override
   { check_and_set_persistent<T>( _yn ); }
 
-  virtual size_t       n_elements()   const override { return data_.size(); }
+  virtual void set_copy_on_write( bool _yn ) override { data_.enable(_yn); }
+  virtual bool copy_on_write() const override        { return data_.enabled(); }
+
+  virtual void set_memory_resource( MemoryResource* _resource ) override
+  { rehome(data_, _resource); }
+  virtual MemoryResource* memory_resource() const override
+  { return resource_of(data_.read()); }
+
+  virtual size_t       n_elements()   const override { return data_.read().size(); }
   virtual size_t       element_size() const override { return IO::size_of<T>(); }
 
 #ifndef DOXY_IGNORE_THIS
@@ -142,7 +168,7 @@ public:
   {
     if (element_size() != IO::UnknownSize)
       return this->BaseProperty::size_of(n_elements());
-    return std::accumulate(data_.begin(), data_.end(), size_t(0), plus());
+    return std::accumulate(data_.read().begin(), data_.read().end(), size_t(0), plus());
   }
 
   virtual size_t size_of(size_t _n_elem) const override
@@ -151,22 +177,23 @@ public:
   virtual size_t store( std::ostream& _ostr, bool _swap ) const override
   {
     if (IO::is_streamable<vector_type>() && element_size() != IO::UnknownSize)
-      return IO::store(_ostr, data_, _swap, false);   //does not need to store its length
+      return IO::store(_ostr, data_.read(), _swap, false);   //does not need to store its length
 
     size_t bytes = 0;
     for (size_t i=0; i<n_elements(); ++i)
-      bytes += IO::store( _ostr, data_[i], _swap);
+      bytes += IO::store( _ostr, data_.read()[i], _swap);
     return bytes;
   }
 
   virtual size_t restore( std::istream& _istr, bool _swap ) override
   {
     if ( IO::is_streamable<vector_type>() && element_size() != IO::UnknownSize)
-      return IO::restore(_istr, data_, _swap, false);  //does not need to restore its length
+      return IO::restore(_istr, data_.write(), _swap, false);  //does not need to restore its length
 
+    vector_type& v = data_.write();
     size_t bytes = 0;
     for (size_t i=0; i<n_elements(); ++i)
-      bytes += IO::restore( _istr, data_[i], _swap);
+      bytes += IO::restore( _istr, v[i], _swap);
     return bytes;
   }
 
@@ -175,40 +202,40 @@ public: // data access interface
   /// Get pointer to array (does not work for T==bool)
   const T* data() const {
 
-    if( data_.empty() )
+    if( data_.read().empty() )
       return 0;
 
-    return &data_[0];
+    return &data_.read()[0];
   }
 
   /// Get reference to property vector (be careful, improper usage, e.g. resizing, may crash OpenMesh!!!)
   vector_type& data_vector() {
-    return data_;
+    return data_.write();
   }
 
   /// Const access to property vector
   const vector_type& data_vector() const {
-    return data_;
+    return data_.read();
   }
 
   /// Access the i'th element. No range check is performed!
   reference operator[](int _idx)
   {
-    assert( size_t(_idx) < data_.size() );
-    return data_[_idx];
+    assert( size_t(_idx) < data_.read().size() );
+    return data_.write()[_idx];
   }
 
   /// Const access to the i'th element. No range check is performed!
   const_reference operator[](int _idx) const
   {
-    assert( size_t(_idx) < data_.size());
-    return data_[_idx];
+    assert( size_t(_idx) < data_.read().size());
+    return data_.read()[_idx];
   }
 
   /// Make a copy of self.
-  PropertyT<T>* clone() const override
+  PropertyT<T, Alloc>* clone() const override
   {
-    PropertyT<T>* p = new PropertyT<T>( *this );
+    PropertyT<T, Alloc>* p = new PropertyT<T, Alloc>( *this );
     return p;
   }
 
@@ -219,7 +246,7 @@ public: // data access interface
 
 private:
 
-  vector_type data_;
+  CopyOnWriteT<vector_type> data_;
 };
 
 //-----------------------------------------------------------------------------
@@ -229,32 +256,41 @@ private:
 
   The data will be stored as a bitset.
  */
-template <>
-class PropertyT<bool> : public BaseProperty
+template <class Alloc>
+class PropertyT<bool, Alloc> : public BaseProperty
 {
 public:
 
-  typedef std::vector<bool>                       vector_type;
+  typedef std::vector<bool, Alloc>                vector_type;
+  typedef Alloc                                   allocator_type;
   typedef bool                                    value_type;
-  typedef vector_type::reference                  reference;
-  typedef vector_type::const_reference            const_reference;
+  typedef typename vector_type::reference         reference;
+  typedef typename vector_type::const_reference   const_reference;
 
 public:
 
   explicit PropertyT(const std::string& _name = "<unknown>", const std::string& _internal_type_name="" )
     : BaseProperty(_name, _internal_type_name)
-  { }
+  { set_resource_allocation(std::is_same<Alloc, ResourceAllocatorT<bool> >::value); }
 
 public: // inherited from BaseProperty
 
-  virtual void reserve(size_t _n) override { data_.reserve(_n);    }
-  virtual void resize(size_t _n) override  { data_.resize(_n);     }
-  virtual void clear() override  { data_.clear(); vector_type().swap(data_);    }
-  virtual void push_back() override        { data_.push_back(bool()); }
+  virtual void reserve(size_t _n) override { data_.write().reserve(_n);    }
+  virtual void resize(size_t _n) override  { data_.write().resize(_n);     }
+  virtual void clear() override  { data_.release();    }
+  virtual void push_back() override        { data_.write().push_back(bool()); }
   virtual void swap(size_t _i0, size_t _i1) override
-  { bool t(data_[_i0]); data_[_i0]=data_[_i1]; data_[_i1]=t; }
+  { vector_type& v = data_.write(); bool t(v[_i0]); v[_i0]=v[_i1]; v[_i1]=t; }
   virtual void copy(size_t _i0, size_t _i1) override
-  { data_[_i1] = data_[_i0]; }
+  { vector_type& v = data_.write(); v[_i1] = v[_i0]; }
+  virtual bool swap_elements(BaseProperty& _other) override
+  {
+    PropertyT<bool, Alloc>* other = dynamic_cast<PropertyT<bool, Alloc>*>(&_other);
+    if (other == nullptr)
+      return false;
+    data_.write().swap(other->data_.write());
+    return true;
+  }
 
 public:
 
@@ -263,7 +299,15 @@ public:
     check_and_set_persistent<bool>( _yn );
   }
 
-  virtual size_t       n_elements()   const override { return data_.size();  }
+  virtual void set_copy_on_write( bool _yn ) override { data_.enable(_yn); }
+  virtual bool copy_on_write() const override        { return data_.enabled(); }
+
+  virtual void set_memory_resource( MemoryResource* _resource ) override
+  { rehome(data_, _resource); }
+  virtual MemoryResource* memory_resource() const override
+  { return resource_of(data_.read()); }
+
+  virtual size_t       n_elements()   const override { return data_.read().size();  }
   virtual size_t       element_size() const override { return UnknownSize;    }
   virtual size_t       size_of() const override      { return size_of( n_elements() ); }
   virtual size_t       size_of(size_t _n_elem) const override
@@ -273,10 +317,11 @@ public:
 
   size_t store( std::ostream& _ostr, bool /* _swap */ ) const override
   {
+    const vector_type& bits_v = data_.read();
     size_t bytes = 0;
 
-    size_t N = data_.size() / 8;
-    size_t R = data_.size() % 8;
+    size_t N = bits_v.size() / 8;
+    size_t R = bits_v.size() % 8;
 
     size_t        idx;  // element index
     size_t        bidx;
@@ -284,14 +329,14 @@ public:
 
     for (bidx=idx=0; idx < N; ++idx, bidx+=8)
     {
-      bits = static_cast<unsigned char>(data_[bidx])
-        | (static_cast<unsigned char>(data_[bidx+1]) << 1)
-        | (static_cast<unsigned char>(data_[bidx+2]) << 2)
-        | (static_cast<unsigned char>(data_[bidx+3]) << 3)
-        | (static_cast<unsigned char>(data_[bidx+4]) << 4)
-        | (static_cast<unsigned char>(data_[bidx+5]) << 5)
-        | (static_cast<unsigned char>(data_[bidx+6]) << 6)
-        | (static_cast<unsigned char>(data_[bidx+7]) << 7);
+      bits = static_cast<unsigned char>(bits_v[bidx])
+        | (static_cast<unsigned char>(bits_v[bidx+1]) << 1)
+        | (static_cast<unsigned char>(bits_v[bidx+2]) << 2)
+        | (static_cast<unsigned char>(bits_v[bidx+3]) << 3)
+        | (static_cast<unsigned char>(bits_v[bidx+4]) << 4)
+        | (static_cast<unsigned char>(bits_v[bidx+5]) << 5)
+        | (static_cast<unsigned char>(bits_v[bidx+6]) << 6)
+        | (static_cast<unsigned char>(bits_v[bidx+7]) << 7);
       _ostr << bits;
     }
     bytes = N;
@@ -300,7 +345,7 @@ public:
     {
       bits = 0;
       for (idx=0; idx < R; ++idx)
-        bits |= static_cast<unsigned char>(data_[bidx+idx]) << idx;
+        bits |= static_cast<unsigned char>(bits_v[bidx+idx]) << idx;
       _ostr << bits;
       ++bytes;
     }
@@ -312,10 +357,11 @@ public:
 
   size_t restore( std::istream& _istr, bool /* _swap */ ) override
   {
+    vector_type& bits_v = data_.write();
     size_t bytes = 0;
 
-    size_t N = data_.size() / 8;
-    size_t R = data_.size() % 8;
+    size_t N = bits_v.size() / 8;
+    size_t R = bits_v.size() % 8;
 
     size_t        idx;  // element index
     size_t        bidx; //
@@ -324,14 +370,14 @@ public:
     for (bidx=idx=0; idx < N; ++idx, bidx+=8)
     {
       _istr >> bits;
-      data_[bidx+0] = (bits & 0x01) != 0;
-      data_[bidx+1] = (bits & 0x02) != 0;
-      data_[bidx+2] = (bits & 0x04) != 0;
-      data_[bidx+3] = (bits & 0x08) != 0;
-      data_[bidx+4] = (bits & 0x10) != 0;
-      data_[bidx+5] = (bits & 0x20) != 0;
-      data_[bidx+6] = (bits & 0x40) != 0;
-      data_[bidx+7] = (bits & 0x80) != 0;
+      bits_v[bidx+0] = (bits & 0x01) != 0;
+      bits_v[bidx+1] = (bits & 0x02) != 0;
+      bits_v[bidx+2] = (bits & 0x04) != 0;
+      bits_v[bidx+3] = (bits & 0x08) != 0;
+      bits_v[bidx+4] = (bits & 0x10) != 0;
+      bits_v[bidx+5] = (bits & 0x20) != 0;
+      bits_v[bidx+6] = (bits & 0x40) != 0;
+      bits_v[bidx+7] = (bits & 0x80) != 0;
     }
     bytes = N;
 
@@ -339,7 +385,7 @@ public:
     {
       _istr >> bits;
       for (idx=0; idx < R; ++idx)
-        data_[bidx+idx] = (bits & (1<<idx)) != 0;
+        bits_v[bidx+idx] = (bits & (1<<idx)) != 0;
       ++bytes;
     }
 
@@ -351,32 +397,32 @@ public:
 
   /// Get reference to property vector (be careful, improper usage, e.g. resizing, may crash OpenMesh!!!)
   vector_type& data_vector() {
-    return data_;
+    return data_.write();
   }
 
   /// Const access to property vector
   const vector_type& data_vector() const {
-    return data_;
+    return data_.read();
   }
 
   /// Access the i'th element. No range check is performed!
   reference operator[](int _idx)
   {
-    assert( size_t(_idx) < data_.size() );
-    return data_[_idx];
+    assert( size_t(_idx) < data_.read().size() );
+    return data_.write()[_idx];
   }
 
   /// Const access to the i'th element. No range check is performed!
   const_reference operator[](int _idx) const
   {
-    assert( size_t(_idx) < data_.size());
-    return data_[_idx];
+    assert( size_t(_idx) < data_.read().size());
+    return data_.read()[_idx];
   }
 
   /// Make a copy of self.
-  PropertyT<bool>* clone() const override
+  PropertyT<bool, Alloc>* clone() const override
   {
-    PropertyT<bool>* p = new PropertyT<bool>( *this );
+    PropertyT<bool, Alloc>* p = new PropertyT<bool, Alloc>( *this );
     return p;
   }
 
@@ -388,13 +434,50 @@ public:
 
 private:
 
-  vector_type data_;
+  CopyOnWriteT<vector_type> data_;
 };
 
 
 //-----------------------------------------------------------------------------
 
 
+/** \brief PropertyT class a mesh creates for values of type \p T.
+ *
+ *  \p Resource tells whether the mesh traits select ResourceAllocatorT as
+ *  PropertyAllocator.
+ *
+ *  Bool properties always use std::allocator: the reference proxy of
+ *  std::vector<bool> depends on the allocator, with a single class the
+ *  element accessors of BaseKernel return the same type for all meshes.
+ *  Status flags always use ResourceAllocatorT, like the connectivity arrays
+ *  of the ArrayKernel which accesses them without knowing the traits. On
+ *  meshes with std::allocator properties they stay on the default
+ *  new/delete resource.
+ */
+template <class T, bool Resource>
+struct PropertyTypeT
+{ typedef PropertyT<T> type; };
+
+template <class T>
+struct PropertyTypeT<T, true>
+{ typedef PropertyT<T, ResourceAllocatorT<T> > type; };
+
+template <>
+struct PropertyTypeT<bool, true>
+{ typedef PropertyT<bool> type; };
+
+template <>
+struct PropertyTypeT<Attributes::StatusInfo, false>
+{ typedef PropertyT<Attributes::StatusInfo, ResourceAllocatorT<Attributes::StatusInfo> > type; };
+
+template <>
+struct PropertyTypeT<Attributes::StatusInfo, true>
+{ typedef PropertyT<Attributes::StatusInfo, ResourceAllocatorT<Attributes::StatusInfo> > type; };
+
+
+//-----------------------------------------------------------------------------
+
+
 /// Base property handle.
 template <class T>
 struct BasePropHandleT : public BaseHandle
@@ -46,6 +46,8 @@
 
 #include <OpenMesh/Core/Utils/Property.hh>
 #include <OpenMesh/Core/Utils/typename.hh>
+#include <stdexcept>
+#include <type_traits>
 
 //-----------------------------------------------------------------------------
 namespace OpenMesh
@@ -61,7 +63,8 @@ public:
 
   //-------------------------------------------------- constructor / destructor
 
-  PropertyContainer() {}
+  PropertyContainer()
+    : copy_on_write_(false), resource_allocation_(false), memory_resource_(nullptr) {}
   virtual ~PropertyContainer() { std::for_each(properties_.begin(), properties_.end(), Delete()); }
 
 
@@ -75,17 +78,24 @@ public:
 
   //--------------------------------------------------------- copy / assignment
 
-  PropertyContainer(const PropertyContainer& _rhs) { operator=(_rhs); }
+  PropertyContainer(const PropertyContainer& _rhs)
+    : copy_on_write_(false), resource_allocation_(_rhs.resource_allocation_),
+      memory_resource_(nullptr) { operator=(_rhs); }
 
   PropertyContainer& operator=(const PropertyContainer& _rhs)
   {
     // The assignment below relies on all previous BaseProperty* elements having been deleted
     std::for_each(properties_.begin(), properties_.end(), Delete());
+    copy_on_write_ = _rhs.copy_on_write_;
     properties_ = _rhs.properties_;
     Properties::iterator p_it=properties_.begin(), p_end=properties_.end();
     for (; p_it!=p_end; ++p_it)
       if (*p_it)
+      {
         *p_it = (*p_it)->clone();
+        // copies live in the memory resource of this container, not in the one of _rhs
+        (*p_it)->set_memory_resource(memory_resource_);
+      }
     return *this;
   }
 
@@ -100,7 +110,13 @@ public:
     int idx=0;
     for ( ; p_it!=p_end && *p_it!=nullptr; ++p_it, ++idx ) {};
     if (p_it==p_end) properties_.push_back(nullptr);
-    properties_[idx] = new PropertyT<T>(_name, get_type_name<T>() );        // create a new property with requested name and given (system dependent) internal typename
+    // create a new property with requested name and given (system dependent) internal typename
+    if (resource_allocation_)
+      properties_[idx] = new typename PropertyTypeT<T, true>::type(_name, get_type_name<T>() );
+    else
+      properties_[idx] = new typename PropertyTypeT<T, false>::type(_name, get_type_name<T>() );
+    properties_[idx]->set_copy_on_write(copy_on_write_);
+    properties_[idx]->set_memory_resource(memory_resource_);
     return BasePropHandleT<T>(idx);
   }
 
@@ -135,28 +151,64 @@ public:
     return nullptr;
   }
 
-  template <class T> PropertyT<T>& property(BasePropHandleT<T> _h)
+  /** Returns the property \p _h as PropertyT<T, Alloc>. The default for
+   *  \p Alloc is the class created by add() for meshes with std::allocator
+   *  properties, see PropertyTypeT. Throws std::logic_error if the property
+   *  uses another allocator.
+   */
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  PropertyT<T, Alloc>& property(BasePropHandleT<T> _h)
   {
     assert(_h.idx() >= 0 && _h.idx() < (int)properties_.size());
     assert(properties_[_h.idx()] != nullptr);
     assert( properties_[_h.idx()]->internal_type_name() == get_type_name<T>() );
-    PropertyT<T> *p = static_cast< PropertyT<T>* > (properties_[_h.idx()]);
+    check_allocator<T, Alloc>(*properties_[_h.idx()]);
+    PropertyT<T, Alloc> *p = static_cast< PropertyT<T, Alloc>* > (properties_[_h.idx()]);
     assert(p != nullptr);
     return *p;
   }
 
 
-  template <class T> const PropertyT<T>& property(BasePropHandleT<T> _h) const
+  template <class T, class Alloc = typename PropertyTypeT<T, false>::type::allocator_type>
+  const PropertyT<T, Alloc>& property(BasePropHandleT<T> _h) const
   {
     assert(_h.idx() >= 0 && _h.idx() < (int)properties_.size());
     assert(properties_[_h.idx()] != nullptr);
     assert( properties_[_h.idx()]->internal_type_name() == get_type_name<T>() );
-    PropertyT<T> *p = static_cast< PropertyT<T>* > (properties_[_h.idx()]);
+    check_allocator<T, Alloc>(*properties_[_h.idx()]);
+    PropertyT<T, Alloc> *p = static_cast< PropertyT<T, Alloc>* > (properties_[_h.idx()]);
     assert(p != nullptr);
     return *p;
   }
 
 
+  /// Element \p _i of the property \p _h, whichever PropertyTypeT class
+  /// it has.
+  template <class T>
+  typename BasePropHandleT<T>::reference element(BasePropHandleT<T> _h, size_t _i)
+  {
+    typedef typename PropertyTypeT<T, false>::type::allocator_type DefaultAlloc;
+    typedef typename PropertyTypeT<T, true>::type::allocator_type  ResourceAlloc;
+    assert(_h.idx() >= 0 && _h.idx() < (int)properties_.size());
+    assert(properties_[_h.idx()] != nullptr);
+    if (properties_[_h.idx()]->resource_allocation())
+      return property<T, ResourceAlloc>(_h)[int(_i)];
+    return property<T, DefaultAlloc>(_h)[int(_i)];
+  }
+
+  template <class T>
+  typename BasePropHandleT<T>::const_reference element(BasePropHandleT<T> _h, size_t _i) const
+  {
+    typedef typename PropertyTypeT<T, false>::type::allocator_type DefaultAlloc;
+    typedef typename PropertyTypeT<T, true>::type::allocator_type  ResourceAlloc;
+    assert(_h.idx() >= 0 && _h.idx() < (int)properties_.size());
+    assert(properties_[_h.idx()] != nullptr);
+    if (properties_[_h.idx()]->resource_allocation())
+      return property<T, ResourceAlloc>(_h)[int(_i)];
+    return property<T, DefaultAlloc>(_h)[int(_i)];
+  }
+
+
   template <class T> void remove(BasePropHandleT<T> _h)
   {
     assert(_h.idx() >= 0 && _h.idx() < (int)properties_.size());
@@ -165,6 +217,51 @@ public:
   }
 
 
+  //---------------------------------------------------------- copy-on-write
+
+  /** Enable or disable copy-on-write for all contained properties and all
+   *  properties added later on. With copy-on-write enabled, copying the
+   *  container only shares the property buffers, each property takes a
+   *  private copy on its first non-const access.
+   */
+  void set_copy_on_write(bool _yn)
+  {
+    copy_on_write_ = _yn;
+    std::for_each(properties_.begin(), properties_.end(),
+            [_yn](BaseProperty* p) { if (p) p->set_copy_on_write(_yn); });
+  }
+
+  /// Returns true if copy-on-write is enabled, see set_copy_on_write().
+  bool copy_on_write() const { return copy_on_write_; }
+
+
+  //-------------------------------------------------------- memory resources
+
+  /** Select the PropertyT class of properties added later on by add():
+   *  with \p _yn set they use ResourceAllocatorT, see PropertyTypeT. Set
+   *  by the mesh according to its traits, existing properties keep their
+   *  class. The setting is inherited by copy constructed containers.
+   */
+  void set_resource_allocation(bool _yn) { resource_allocation_ = _yn; }
+
+  /// Returns true if add() creates properties using ResourceAllocatorT.
+  bool resource_allocation() const { return resource_allocation_; }
+
+  /// Move the storage of all properties into \p _resource. Properties added
+  /// later on and copies assigned to this container are allocated there as
+  /// well. nullptr selects the default new/delete resource. Only properties
+  /// using ResourceAllocatorT are affected.
+  void set_memory_resource(MemoryResource* _resource)
+  {
+    memory_resource_ = _resource;
+    std::for_each(properties_.begin(), properties_.end(),
+            [_resource](BaseProperty* p) { if (p) p->set_memory_resource(_resource); });
+  }
+
+  /// Returns the resource set by set_memory_resource() or nullptr.
+  MemoryResource* memory_resource() const { return memory_resource_; }
+
+
   void clear()
   {
 	// Clear properties vector:
@@ -271,6 +368,8 @@ protected: // generic add/get
     for (; p_it!=p_end && *p_it!=nullptr; ++p_it, ++idx) {};
     if (p_it==p_end) properties_.push_back(nullptr);
     properties_[idx] = _bp;
+    if (_bp) _bp->set_copy_on_write(copy_on_write_);
+    if (_bp) _bp->set_memory_resource(memory_resource_);
     return idx;
   }
 
@@ -304,6 +403,21 @@ protected: // generic add/get
 
 private:
 
+  /// Throws unless \p _p was created with allocator \p Alloc.
+  template <class T, class Alloc>
+  static void check_allocator(const BaseProperty& _p)
+  {
+    if (_p.resource_allocation() != std::is_same<Alloc, ResourceAllocatorT<T> >::value)
+      allocator_mismatch(_p);
+  }
+
+  static void allocator_mismatch(const BaseProperty& _p)
+  {
+    throw std::logic_error("PropertyContainer: property \"" + _p.name() +
+                           "\" is accessed with another allocator than it uses, "
+                           "see PropertyTypeT");
+  }
+
   //-------------------------------------------------- synchronization functors
 
 #ifndef DOXY_IGNORE_THIS
@@ -348,7 +462,10 @@ private:
   };
 #endif
 
-  Properties   properties_;
+  Properties      properties_;
+  bool            copy_on_write_;
+  bool            resource_allocation_;
+  MemoryResource* memory_resource_;
 };
 
 }//namespace OpenMesh
@@ -48,6 +48,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace OpenMesh {
 
@@ -120,10 +121,24 @@ class PropertyManager {
             from.copy_to(from.mesh_.template all_elements<Handle>(), to, to.mesh_.template all_elements<Handle>());
           }
           static void swap(PropertyManager& lhs, PropertyManager2& rhs) {
-            std::swap(lhs.mesh().property(lhs.prop_).data_vector(), rhs.mesh().property(rhs.prop_).data_vector());
+            const size_t n_lhs = lhs.mesh().template n_elements<Handle>();
+            const size_t n_rhs = rhs.mesh().template n_elements<Handle>();
+            BaseProperty& lhs_prop = lhs.mesh()._property(lhs.prop_);
+            BaseProperty& rhs_prop = rhs.mesh()._property(rhs.prop_);
+            if (!lhs_prop.swap_elements(rhs_prop)) {
+              // the meshes use different allocators (see PropertyTypeT), swap the values
+              std::vector<Value> values;
+              values.reserve(n_lhs);
+              for (size_t i = 0; i < n_lhs; ++i)
+                values.push_back(lhs[Handle(int(i))]);
+              for (size_t i = 0; i < n_lhs; ++i)
+                lhs[Handle(int(i))] = i < n_rhs ? Value(rhs[Handle(int(i))]) : Value();
+              for (size_t i = 0; i < n_rhs; ++i)
+                rhs[Handle(int(i))] = i < n_lhs ? Value(values[i]) : Value();
+            }
             // resize the property to the correct size
-            lhs.mesh().property(lhs.prop_).resize(lhs.mesh().template n_elements<Handle>());
-            rhs.mesh().property(rhs.prop_).resize(rhs.mesh().template n_elements<Handle>());
+            lhs_prop.resize(n_lhs);
+            rhs_prop.resize(n_rhs);
           }
           static ConstReference access_property_const(PolyConnectivity& mesh, const PROPTYPE& prop_handle, const Handle& handle) {
             return mesh.property(prop_handle, handle);
@@ -426,7 +441,7 @@ class PropertyManager {
          * @note This method is only used for mesh properties.
          */
         typename PROPTYPE::reference& operator*() {
-            return mesh().mproperty(prop_)[0];
+            return mesh().property(prop_);
         }
 
         /**
@@ -442,7 +457,7 @@ class PropertyManager {
          * @note This method is only used for mesh properties.
          */
         typename PROPTYPE::const_reference& operator*() const {
-            return mesh().mproperty(prop_)[0];
+            return mesh().property(prop_);
         }
 
         /**
@@ -601,7 +616,7 @@ class PropertyManager {
          */
         void set_persistent(bool _persistence = true)
         {
-          mesh().property(getRawProperty()).set_persistent(_persistence);
+          mesh()._property(getRawProperty()).set_persistent(_persistence);
         }
 
     private:
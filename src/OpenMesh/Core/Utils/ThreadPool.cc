@@ -0,0 +1,335 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  CLASS ThreadPool - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+namespace {
+
+// limit set by ThreadLimit, 0: none
+thread_local unsigned int thread_limit = 0;
+
+// true while the thread processes blocks of a parallel_for
+thread_local bool in_parallel_for = false;
+
+unsigned int hardware_threads()
+{
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+// size of the global pool: OPENMESH_NUM_THREADS, serial if unset
+unsigned int global_default_threads()
+{
+  if (const char* env = std::getenv("OPENMESH_NUM_THREADS"))
+  {
+    const unsigned long n = std::strtoul(env, nullptr, 10);
+    if (n > 0)
+      return static_cast<unsigned int>(n);
+  }
+  return 1;
+}
+
+// written under global_mutex, read without lock by global()
+std::mutex               global_mutex;
+std::atomic<ThreadPool*> global_pool(nullptr);
+
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+struct ThreadPool::Job
+{
+  Job(size_t _n, size_t _grain, const RangeFunction& _f, unsigned int _max_threads)
+    : n(_n), grain(_grain), n_blocks((_n + _grain - 1) / _grain), f(_f),
+      max_threads(_max_threads), n_threads(1), next(0)
+  {
+  }
+
+  const size_t         n;
+  const size_t         grain;
+  const size_t         n_blocks;
+  const RangeFunction& f;
+
+  const unsigned int   max_threads;
+  unsigned int         n_threads;   // threads working on the job, guarded by the pool mutex
+  std::atomic<size_t>  next;        // next block to process
+
+  std::mutex           error_mutex;
+  std::exception_ptr   error;
+};
+
+
+//-----------------------------------------------------------------------------
+
+
+ThreadPool::ThreadPool(unsigned int _n_threads)
+  : n_threads_(_n_threads ? _n_threads : hardware_threads()),
+    stop_(false)
+{
+  for (unsigned int i = 1; i < n_threads_; ++i)
+    workers_.push_back(std::thread(&ThreadPool::worker, this));
+}
+
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  work_cv_.notify_all();
+
+  for (size_t i = 0; i < workers_.size(); ++i)
+    workers_[i].join();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+unsigned int ThreadPool::max_threads(unsigned int _max_threads) const
+{
+  if (in_parallel_for)
+    return 1;
+
+  unsigned int n = n_threads_;
+  if (_max_threads)
+    n = std::min(n, _max_threads);
+  if (thread_limit)
+    n = std::min(n, thread_limit);
+  return n;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void ThreadPool::parallel_for(size_t _n, size_t _grain, const RangeFunction& _f,
+                              unsigned int _max_threads)
+{
+  if (_n == 0)
+    return;
+
+  const size_t grain    = std::max(_grain, size_t(1));
+  const size_t n_blocks = (_n + grain - 1) / grain;
+  Job job(_n, grain, _f, static_cast<unsigned int>(std::min<size_t>(max_threads(_max_threads), n_blocks)));
+
+  if (job.max_threads < 2)
+  {
+    // same blocks as in the parallel case
+    for (size_t first = 0; first < _n; first += grain)
+      _f(first, std::min(first + grain, _n));
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(&job);
+  }
+  work_cv_.notify_all();
+
+  run(job);
+
+  // no new workers may join, wait for the ones still busy
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    jobs_.erase(std::find(jobs_.begin(), jobs_.end(), &job));
+    --job.n_threads;
+    done_cv_.wait(lock, [&job]() { return job.n_threads == 0; });
+  }
+
+  if (job.error)
+    std::rethrow_exception(job.error);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void ThreadPool::run(Job& _job)
+{
+  const bool was_in_parallel_for = in_parallel_for;
+  in_parallel_for = true;
+
+  for (size_t b = _job.next++; b < _job.n_blocks; b = _job.next++)
+  {
+    const size_t first = b * _job.grain;
+    try
+    {
+      _job.f(first, std::min(first + _job.grain, _job.n));
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(_job.error_mutex);
+      if (!_job.error)
+        _job.error = std::current_exception();
+      _job.next = _job.n_blocks;
+    }
+  }
+
+  in_parallel_for = was_in_parallel_for;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void ThreadPool::worker()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  for (;;)
+  {
+    // a job with unprocessed blocks which may use another thread
+    Job* job = nullptr;
+    work_cv_.wait(lock, [this, &job]() {
+      for (size_t i = 0; i < jobs_.size(); ++i)
+        if (jobs_[i]->n_threads < jobs_[i]->max_threads && jobs_[i]->next < jobs_[i]->n_blocks)
+        {
+          job = jobs_[i];
+          return true;
+        }
+      return stop_;
+    });
+
+    if (!job)
+      return;
+
+    ++job->n_threads;
+    lock.unlock();
+
+    run(*job);
+
+    lock.lock();
+    if (--job->n_threads == 0)
+      done_cv_.notify_all();
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+ThreadPool& ThreadPool::global()
+{
+  ThreadPool* pool = global_pool.load(std::memory_order_acquire);
+  if (pool)
+    return *pool;
+
+  std::lock_guard<std::mutex> lock(global_mutex);
+
+  // never destroyed: joining the workers during static destruction may
+  // dead-lock, e.g. when unloading a DLL
+  pool = global_pool.load(std::memory_order_relaxed);
+  if (!pool)
+  {
+    pool = new ThreadPool(global_default_threads());
+    global_pool.store(pool, std::memory_order_release);
+  }
+
+  return *pool;
+}
+
+
+void ThreadPool::set_global_threads(unsigned int _n_threads)
+{
+  std::lock_guard<std::mutex> lock(global_mutex);
+
+  ThreadPool* pool = new ThreadPool(_n_threads ? _n_threads : global_default_threads());
+  delete global_pool.exchange(pool, std::memory_order_acq_rel);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+ThreadLimit::ThreadLimit(unsigned int _max_threads)
+  : previous_(thread_limit)
+{
+  if (_max_threads && (!thread_limit || _max_threads < thread_limit))
+    thread_limit = _max_threads;
+}
+
+
+ThreadLimit::~ThreadLimit()
+{
+  thread_limit = previous_;
+}
+
+
+unsigned int ThreadLimit::current()
+{
+  return thread_limit;
+}
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,206 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  CLASS ThreadPool
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_THREADPOOL_HH
+#define OPENMESH_THREADPOOL_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Utils/Noncopyable.hh>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Pool of worker threads for the parallel algorithms of OpenMesh.
+ *
+ *  All parallel features (writers, CSRAdjacency, SmartRangeT::par(),
+ *  normal updates, ...) run their loops on the global pool instead of
+ *  spawning their own threads. Its size is taken from the environment
+ *  variable \c OPENMESH_NUM_THREADS and defaults to a single thread, i.e.
+ *  OpenMesh runs serially and starts no threads unless the application
+ *  opts in by setting the variable or calling set_global_threads().
+ *
+ *  parallel_for() splits an index range into blocks of a fixed size. The
+ *  calling thread works on the blocks as well and the call returns when all
+ *  blocks are done. A parallel_for() issued from inside a block runs
+ *  serially on the calling thread, so nesting cannot dead-lock.
+ *
+ *  \code
+ *  OpenMesh::parallel_for(mesh.n_vertices(), 4096, [&](size_t first, size_t last) {
+ *    for (size_t i = first; i < last; ++i)
+ *      ...
+ *  });
+ *  \endcode
+ *
+ *  \see ThreadLimit to limit the threads of a job.
+ */
+class OPENMESHDLLEXPORT ThreadPool : private Utils::Noncopyable
+{
+public:
+
+  /// Loop body, called with the half-open index range [first, last)
+  typedef std::function<void(size_t, size_t)> RangeFunction;
+
+public:
+
+  /** Construct a pool of \c _n_threads threads including the calling thread,
+   *  i.e. with _n_threads-1 workers (0: hardware concurrency). */
+  explicit ThreadPool(unsigned int _n_threads = 0);
+
+  /// Waits for all workers to finish.
+  ~ThreadPool();
+
+  /// Number of threads including the calling thread
+  unsigned int n_threads() const { return n_threads_; }
+
+  /** Call \c _f for the blocks [i*_grain, min((i+1)*_grain, _n)) of [0, _n)
+   *  on up to \c _max_threads threads (0: all threads of the pool), see also
+   *  ThreadLimit. The block bounds do not depend on the number of threads.
+   *  Returns after all blocks are processed. If \c _f throws, the remaining
+   *  blocks are skipped and the first exception is rethrown. */
+  void parallel_for(size_t _n, size_t _grain, const RangeFunction& _f,
+                    unsigned int _max_threads = 0);
+
+  /// Maximal number of threads a parallel_for() called from this thread would use
+  unsigned int max_threads(unsigned int _max_threads = 0) const;
+
+  /// The pool shared by all parallel algorithms of OpenMesh
+  static ThreadPool& global();
+
+  /** Replace the global pool by one with \c _n_threads threads
+   *  (0: the default, see above). Must not be called while the global pool
+   *  is in use. */
+  static void set_global_threads(unsigned int _n_threads);
+
+private:
+
+  struct Job;
+
+  void worker();
+  static void run(Job& _job);
+
+private:
+
+  unsigned int             n_threads_;
+  std::vector<std::thread> workers_;
+
+  std::mutex               mutex_;
+  std::condition_variable  work_cv_;
+  std::condition_variable  done_cv_;
+  std::deque<Job*>         jobs_;
+  bool                     stop_;
+};
+
+
+//-----------------------------------------------------------------------------
+
+
+/** Limit the number of threads parallel algorithms called from the current
+ *  thread may use, for the lifetime of the object. Limits nest, the
+ *  smallest one wins.
+ *
+ *  \code
+ *  {
+ *    OpenMesh::ThreadLimit limit(2);
+ *    mesh.update_normals();    // uses at most two threads
+ *  }
+ *  \endcode
+ */
+class OPENMESHDLLEXPORT ThreadLimit : private Utils::Noncopyable
+{
+public:
+
+  explicit ThreadLimit(unsigned int _max_threads);
+  ~ThreadLimit();
+
+  /// Current limit of this thread (0: none)
+  static unsigned int current();
+
+private:
+
+  unsigned int previous_;
+};
+
+
+//-----------------------------------------------------------------------------
+
+
+/// ThreadPool::parallel_for() on the global pool
+inline void parallel_for(size_t _n, size_t _grain, const ThreadPool::RangeFunction& _f,
+                         unsigned int _max_threads = 0)
+{
+  ThreadPool::global().parallel_for(_n, _grain, _f, _max_threads);
+}
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_THREADPOOL_HH defined
+//=============================================================================
@@ -62,6 +62,7 @@
 #include <OpenMesh/Tools/Decimater/ModBaseT.hh>
 #include <OpenMesh/Core/Utils/Noncopyable.hh>
 #include <OpenMesh/Tools/Decimater/Observer.hh>
+#include <OpenMesh/Tools/Decimater/DecimaterStatistics.hh>
 
 
 
@@ -134,6 +135,25 @@ public: //--------------------------------------------------- module management
       return observer_;
   }
 
+  /** \brief Set statistics
+   *
+   * The decimater counts candidates, rejections and collapses, times the
+   * modules and records the collapse errors in \c _s, see
+   * DecimaterStatistics. The statistics are owned by the caller,
+   * nullptr switches them off.
+   */
+  void set_statistics(DecimaterStatistics* _s)
+  {
+      statistics_ = _s;
+      init_statistics();
+  }
+
+  /// Get current statistics of a decimater
+  DecimaterStatistics* statistics()
+  {
+      return statistics_;
+  }
+
   /// access mesh. used in modules.
   Mesh& mesh() { return mesh_; }
 
@@ -198,6 +218,13 @@ protected:
     return true;
   }
 
+  /// Update the largest heap size of the statistics
+  void notify_heap_size(size_t _size)
+  {
+    if (statistics_)
+      statistics_->add_heap_size(_size);
+  }
+
   /// Reset the initialized flag, and clear the bmodules_ and cmodule_
   void set_uninitialized() {
     initialized_ = false;
@@ -218,15 +245,28 @@ protected: //---------------------------------------------------- private method
 
   /// Is an edge collapse legal?  Performs topological test only.
   /// The method evaluates the status bit Locked, Deleted, and Feature.
-  /// \attention The method temporarily sets the bit Tagged. After usage
-  ///            the bit will be disabled!
+  /// It reads the mesh through const accessors only; on triangle meshes,
+  /// whose is_collapse_ok() is const, it may be called concurrently as
+  /// long as no thread modifies the mesh. PolyConnectivity::is_collapse_ok()
+  /// writes the tagged bits, so on polygonal meshes it may not.
   bool is_collapse_legal(const CollapseInfo& _ci);
 
-  /// Calculate priority of an halfedge collapse (using the modules)
+  /// Can collapse_priority() be called concurrently, i.e. do all modules
+  /// support it? \see ModBaseT::is_concurrent()
+  bool is_concurrent() const;
+
+  /// Let the modules choose the position of the remaining vertex
+  void place_vertex(CollapseInfo& _ci);
+
+  /// Calculate priority of an halfedge collapse (using the modules).
+  /// The modules evaluate a copy of \c _ci placed by place_vertex(),
+  /// preprocess_collapse() places the vertex again.
   float collapse_priority(const CollapseInfo& _ci);
 
-  /// Pre-process a collapse
-  void preprocess_collapse(CollapseInfo& _ci);
+  /// Pre-process a collapse. Calls place_vertex() and moves the
+  /// remaining vertex to _ci.p1. \c _priority is recorded in the
+  /// statistics (negative: unknown).
+  void preprocess_collapse(CollapseInfo& _ci, float _priority = -1.0f);
 
   /// Post-process a collapse
   void postprocess_collapse(CollapseInfo& _ci);
@@ -248,6 +288,18 @@ protected: //---------------------------------------------------- private method
   void reset(){ initialized_ = false; };
 
 
+private: //---------------------------------------------------- private methods
+
+  /// Topology tests of is_collapse_legal()
+  bool is_collapse_legal_topology(const CollapseInfo& _ci) const;
+
+  /// collapse_priority() counting and timing the modules
+  float collapse_priority_statistics(CollapseInfo& _ci);
+
+  /// Register the modules in the statistics
+  void init_statistics();
+
+
 private: //------------------------------------------------------- private data
 
 
@@ -269,6 +321,9 @@ private: //------------------------------------------------------- private data
   /// observer
   Observer* observer_;
 
+  /// statistics
+  DecimaterStatistics* statistics_;
+
 };
 
 //=============================================================================
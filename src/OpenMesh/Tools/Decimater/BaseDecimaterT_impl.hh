@@ -51,6 +51,7 @@
 
 //== INCLUDES =================================================================
 
+#include <chrono>
 #include <vector>
 #if defined(OM_CC_MIPS)
 #  include <float.h>
@@ -67,7 +68,8 @@ namespace Decimater {
 
 template<class Mesh>
 BaseDecimaterT<Mesh>::BaseDecimaterT(Mesh& _mesh) :
-    mesh_(_mesh), cmodule_(nullptr), initialized_(false), observer_(nullptr) {
+    mesh_(_mesh), cmodule_(nullptr), initialized_(false), observer_(nullptr),
+    statistics_(nullptr) {
   // default properties
   mesh_.request_vertex_status();
   mesh_.request_edge_status();
@@ -98,10 +100,25 @@ BaseDecimaterT<Mesh>::~BaseDecimaterT() {
 
 template<class Mesh>
 bool BaseDecimaterT<Mesh>::is_collapse_legal(const CollapseInfo& _ci) {
+  if (is_collapse_legal_topology(_ci))
+    return true;
+
+  if (statistics_)
+    statistics_->add_illegal();
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+bool BaseDecimaterT<Mesh>::is_collapse_legal_topology(const CollapseInfo& _ci) const {
   //   std::clog << "McDecimaterT<>::is_collapse_legal()\n";
 
+  // read only, the decimaters test candidates concurrently
+  const Mesh& mesh = mesh_;
+
   // locked ?
-  if (mesh_.status(_ci.v0).locked())
+  if (mesh.status(_ci.v0).locked())
     return false;
 
   // this test checks:
@@ -113,25 +130,26 @@ bool BaseDecimaterT<Mesh>::is_collapse_legal(const CollapseInfo& _ci) {
   // are vl and vr equal or both invalid?
   // one ring intersection test
   // edge between two boundary vertices should be a boundary edge
+  // (const for triangle meshes, the polygonal version writes tagged bits)
   if (!mesh_.is_collapse_ok(_ci.v0v1))
     return false;
 
   if (_ci.vl.is_valid() && _ci.vr.is_valid()
-      && mesh_.find_halfedge(_ci.vl, _ci.vr).is_valid()
-      && mesh_.valence(_ci.vl) == 3 && mesh_.valence(_ci.vr) == 3) {
+      && mesh.find_halfedge(_ci.vl, _ci.vr).is_valid()
+      && mesh.valence(_ci.vl) == 3 && mesh.valence(_ci.vr) == 3) {
     return false;
   }
   //--- feature test ---
 
-  if (mesh_.status(_ci.v0).feature()
-      && !mesh_.status(mesh_.edge_handle(_ci.v0v1)).feature())
+  if (mesh.status(_ci.v0).feature()
+      && !mesh.status(mesh.edge_handle(_ci.v0v1)).feature())
     return false;
 
   //--- test boundary cases ---
-  if (mesh_.is_boundary(_ci.v0)) {
+  if (mesh.is_boundary(_ci.v0)) {
 
     // don't collapse a boundary vertex to an inner one
-    if (!mesh_.is_boundary(_ci.v1))
+    if (!mesh.is_boundary(_ci.v1))
       return false;
 
     // only one one ring intersection
@@ -140,8 +158,8 @@ bool BaseDecimaterT<Mesh>::is_collapse_legal(const CollapseInfo& _ci) {
   }
 
   // there have to be at least 2 incident faces at v0
-  if (mesh_.cw_rotated_halfedge_handle(
-      mesh_.cw_rotated_halfedge_handle(_ci.v0v1)) == _ci.v0v1)
+  if (mesh.cw_rotated_halfedge_handle(
+      mesh.cw_rotated_halfedge_handle(_ci.v0v1)) == _ci.v0v1)
     return false;
 
   // collapse passed all tests -> ok
@@ -150,15 +168,89 @@ bool BaseDecimaterT<Mesh>::is_collapse_legal(const CollapseInfo& _ci) {
 
 //-----------------------------------------------------------------------------
 
+template<class Mesh>
+void BaseDecimaterT<Mesh>::place_vertex(CollapseInfo& _ci) {
+  typename ModuleList::iterator m_it, m_end = bmodules_.end();
+
+  for (m_it = bmodules_.begin(); m_it != m_end; ++m_it)
+    (*m_it)->place_vertex(_ci);
+
+  cmodule_->place_vertex(_ci);
+}
+
+//-----------------------------------------------------------------------------
+
 template<class Mesh>
 float BaseDecimaterT<Mesh>::collapse_priority(const CollapseInfo& _ci) {
+  CollapseInfo ci(_ci);
+
+  if (statistics_)
+    return collapse_priority_statistics(ci);
+
+  place_vertex(ci);
+
   typename ModuleList::iterator m_it, m_end = bmodules_.end();
 
   for (m_it = bmodules_.begin(); m_it != m_end; ++m_it) {
-    if ((*m_it)->collapse_priority(_ci) < 0.0)
+    if ((*m_it)->collapse_priority(ci) < 0.0)
+      return ModBaseT< Mesh >::ILLEGAL_COLLAPSE;
+  }
+  return cmodule_->collapse_priority(ci);
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+float BaseDecimaterT<Mesh>::collapse_priority_statistics(CollapseInfo& _ci) {
+  typedef std::chrono::steady_clock Clock;
+
+  // modules are numbered like in init_statistics(), cmodule_ last
+  const size_t n_bmodules = bmodules_.size();
+  const bool   timed      = statistics_->begin_candidate();
+
+  Clock::time_point start;
+  auto stop = [&](size_t _module, bool _evaluation) {
+    if (timed)
+      statistics_->add_time(_module,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count(),
+          _evaluation);
+  };
+
+  for (size_t i = 0; i < n_bmodules; ++i) {
+    if (timed) start = Clock::now();
+    bmodules_[i]->place_vertex(_ci);
+    stop(i, false);
+  }
+  if (timed) start = Clock::now();
+  cmodule_->place_vertex(_ci);
+  stop(n_bmodules, false);
+
+  for (size_t i = 0; i < n_bmodules; ++i) {
+    if (timed) start = Clock::now();
+    const bool rejected = bmodules_[i]->collapse_priority(_ci) < 0.0;
+    stop(i, true);
+
+    statistics_->add_evaluation(i, rejected);
+    if (rejected)
       return ModBaseT< Mesh >::ILLEGAL_COLLAPSE;
   }
-  return cmodule_->collapse_priority(_ci);
+
+  if (timed) start = Clock::now();
+  const float priority = cmodule_->collapse_priority(_ci);
+  stop(n_bmodules, true);
+
+  statistics_->add_evaluation(n_bmodules, priority < 0.0);
+  return priority;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+bool BaseDecimaterT<Mesh>::is_concurrent() const {
+  for (const Module* m : bmodules_)
+    if (!m->is_concurrent())
+      return false;
+  return cmodule_ && cmodule_->is_concurrent();
 }
 
 //-----------------------------------------------------------------------------
@@ -176,13 +268,22 @@ void BaseDecimaterT<Mesh>::postprocess_collapse(CollapseInfo& _ci) {
 //-----------------------------------------------------------------------------
 
 template<class Mesh>
-void BaseDecimaterT<Mesh>::preprocess_collapse(CollapseInfo& _ci) {
+void BaseDecimaterT<Mesh>::preprocess_collapse(CollapseInfo& _ci, float _priority) {
+  if (statistics_)
+    statistics_->add_collapse(_priority);
+
+  place_vertex(_ci);
+
   typename ModuleList::iterator m_it, m_end = bmodules_.end();
 
   for (m_it = bmodules_.begin(); m_it != m_end; ++m_it)
     (*m_it)->preprocess_collapse(_ci);
 
   cmodule_->preprocess_collapse(_ci);
+
+  // the collapse keeps v1, move it to its new position
+  if (_ci.p1 != mesh_.point(_ci.v1))
+    mesh_.set_point(_ci.v1, _ci.p1);
 }
 
 //-----------------------------------------------------------------------------
@@ -291,7 +392,25 @@ bool BaseDecimaterT<Mesh>::initialize() {
     }
   }
 
-  return initialized_ = true;
+  initialized_ = true;
+  init_statistics();
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+void BaseDecimaterT<Mesh>::init_statistics() {
+  if (!statistics_ || !initialized_)
+    return;
+
+  std::vector<std::string> names;
+  for (const Module* m : bmodules_)
+    names.push_back(m->name());
+  names.push_back(cmodule_->name());
+
+  statistics_->set_modules(names, bmodules_.size());
 }
 
 
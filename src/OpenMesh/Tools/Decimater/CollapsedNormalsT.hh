@@ -0,0 +1,210 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/** \file CollapsedNormalsT.hh
+ */
+
+//=============================================================================
+//
+//  CLASS CollapsedNormalsT
+//
+//=============================================================================
+
+#ifndef OPENMESH_DECIMATER_COLLAPSEDNORMALST_HH
+#define OPENMESH_DECIMATER_COLLAPSEDNORMALST_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/Geometry/VectorBatchT.hh>
+#include <OpenMesh/Core/Utils/vector_cast.hh>
+#include <OpenMesh/Core/Utils/vector_traits.hh>
+#include <OpenMesh/Tools/Decimater/CollapseInfoT.hh>
+
+
+//== NAMESPACE ================================================================
+
+namespace OpenMesh  {
+namespace Decimater {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \brief Face normals of the one-ring after a simulated collapse
+
+    Collects the faces of \c _ci.v0 (and of \c _ci.v1, if the collapse
+    moves it to \c _ci.p1) except \c _ci.fl and \c _ci.fr and computes
+    their normals after the collapse. The faces are processed in chunks of
+    at most chunk_size, the cross products of a chunk are computed with
+    the batch operations of VectorBatchT.hh, so modules can compare the
+    normals with dot_n() and stop at the first chunk that violates their
+    criterion. The normals equal those of PolyMeshT::calc_face_normal() on
+    the moved face vertices.
+
+    \code
+    CollapsedNormalsT<Mesh> normals(mesh, ci);
+    while (size_t n = normals.next())
+      for (size_t i = 0; i < n; ++i)
+        test(normals.face(i), normals.normal(i));
+    \endcode
+
+    Only triangle meshes are supported, the class does not modify the mesh
+    and can be used concurrently.
+*/
+template <class MeshT>
+class CollapsedNormalsT
+{
+public:
+
+  typedef MeshT                                            Mesh;
+  typedef typename Mesh::Normal                            Normal;
+  typedef typename Mesh::FaceHandle                        FaceHandle;
+  typedef typename Mesh::HalfedgeHandle                    HalfedgeHandle;
+  typedef typename Mesh::VertexHandle                      VertexHandle;
+  typedef typename vector_traits<Normal>::value_type       Scalar;
+
+  /// Maximal number of faces returned by next()
+  static const size_t chunk_size = 16;
+
+  /// Constructor
+  CollapsedNormalsT(const Mesh& _mesh, const CollapseInfoT<Mesh>& _ci)
+  : mesh_(_mesh), ci_(_ci), p1_(vector_cast<Normal>(_ci.p1)),
+    vertex_(0), n_vertices_(_ci.p1 != _mesh.point(_ci.v1) ? 2 : 1),
+    start_(_mesh.halfedge_handle(_ci.v0)), heh_(start_), n_(0)
+  {
+  }
+
+  /** Collect the next chunk of faces and compute their normals. Returns the
+      number of faces in the chunk, 0 if all faces have been processed. */
+  size_t next()
+  {
+    Normal e0[chunk_size];
+
+    n_ = 0;
+    while (n_ < chunk_size && vertex_ < n_vertices_)
+    {
+      if (!heh_.is_valid()) {
+        next_vertex();
+        continue;
+      }
+
+      // heh_ is an outgoing halfedge of the current vertex
+      const FaceHandle fh = mesh_.face_handle(heh_);
+      if (fh.is_valid() && fh != ci_.fl && fh != ci_.fr)
+      {
+        // same vertex order and operands as PolyMeshT::calc_face_normal()
+        // on the face vertices, so the normals match it exactly
+        HalfedgeHandle h = mesh_.halfedge_handle(fh);
+        const Normal p0 = position(mesh_.to_vertex_handle(h));
+        h = mesh_.next_halfedge_handle(h);
+        const Normal p1 = position(mesh_.to_vertex_handle(h));
+        h = mesh_.next_halfedge_handle(h);
+        const Normal p2 = position(mesh_.to_vertex_handle(h));
+
+        faces_[n_]   = fh;
+        e0[n_]       = p2 - p1;
+        normals_[n_] = p0 - p1;
+        ++n_;
+      }
+
+      heh_ = mesh_.next_halfedge_handle(mesh_.opposite_halfedge_handle(heh_));
+      if (heh_ == start_)
+        next_vertex();
+    }
+
+    cross_n(e0, normals_, normals_, n_);
+
+    // scaled by the inverse length like calc_face_normal(), normalize_n()
+    // divides and may differ in the last bit
+    for (size_t i = 0; i < n_; ++i)
+    {
+      const Scalar length = norm(normals_[i]);
+      if (length != Scalar(0))
+        normals_[i] *= Scalar(1) / length;
+    }
+    return n_;
+  }
+
+  /// Face \c _i of the current chunk
+  FaceHandle face(size_t _i) const { return faces_[_i]; }
+
+  /// Normal of face \c _i of the current chunk after the collapse
+  const Normal& normal(size_t _i) const { return normals_[_i]; }
+
+  /// Normals of the current chunk
+  const Normal* normals() const { return normals_; }
+
+private:
+
+  /// Position of _vh after the collapse
+  Normal position(VertexHandle _vh) const
+  {
+    return (_vh == ci_.v0 || _vh == ci_.v1) ? p1_ : vector_cast<Normal>(mesh_.point(_vh));
+  }
+
+  void next_vertex()
+  {
+    if (++vertex_ < n_vertices_)
+      start_ = heh_ = mesh_.halfedge_handle(ci_.v1);
+  }
+
+private:
+
+  const Mesh&                 mesh_;
+  const CollapseInfoT<Mesh>&  ci_;
+  const Normal                p1_;
+
+  int                         vertex_, n_vertices_;
+  HalfedgeHandle              start_, heh_;
+
+  size_t                      n_;
+  FaceHandle                  faces_[chunk_size];
+  Normal                      normals_[chunk_size];
+};
+
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+#endif // OPENMESH_DECIMATER_COLLAPSEDNORMALST_HH defined
+//=============================================================================
@@ -0,0 +1,318 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+/** \file DecimaterStatistics.cc
+ */
+
+//=============================================================================
+//
+//  CLASS DecimaterStatistics - IMPLEMENTATION
+//
+//=============================================================================
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Tools/Decimater/DecimaterStatistics.hh>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include <sstream>
+
+//== NAMESPACE ===============================================================
+
+namespace OpenMesh {
+namespace Decimater {
+
+//== IMPLEMENTATION ==========================================================
+
+namespace {
+
+/// Write a JSON number, non-finite values become null
+void write_number(std::ostream& _os, double _value)
+{
+  if (std::isfinite(_value))
+    _os << _value;
+  else
+    _os << "null";
+}
+
+/// Write a JSON string
+void write_string(std::ostream& _os, const std::string& _s)
+{
+  _os << '"';
+  for (const char c : _s)
+  {
+    switch (c)
+    {
+      case '"':  _os << "\\\""; break;
+      case '\\': _os << "\\\\"; break;
+      case '\n': _os << "\\n";  break;
+      case '\t': _os << "\\t";  break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          const char* hex = "0123456789abcdef";
+          _os << "\\u00" << hex[(c >> 4) & 0xf] << hex[c & 0xf];
+        }
+        else
+          _os << c;
+    }
+  }
+  _os << '"';
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+
+DecimaterStatistics::Histogram::Histogram()
+  : counts_((max_exponent - min_exponent) * bins_per_decade + 2)
+{
+  clear();
+}
+
+void DecimaterStatistics::Histogram::clear()
+{
+  std::fill(counts_.begin(), counts_.end(), 0);
+  n_   = 0;
+  min_ = std::numeric_limits<double>::max();
+  max_ = 0.0;
+  sum_ = 0.0;
+}
+
+void DecimaterStatistics::Histogram::add(double _value)
+{
+  if (!(_value >= 0.0))
+    return;
+
+  size_t bin = 0;
+  if (_value >= lower_bound(1))
+  {
+    const double x = (std::log10(_value) - min_exponent) * bins_per_decade;
+    bin = std::min(static_cast<size_t>(x) + 1, counts_.size() - 1);
+  }
+
+  ++counts_[bin];
+  ++n_;
+  min_  = std::min(min_, _value);
+  max_  = std::max(max_, _value);
+  sum_ += _value;
+}
+
+double DecimaterStatistics::Histogram::lower_bound(size_t _i) const
+{
+  if (_i == 0)
+    return 0.0;
+  return std::pow(10.0, min_exponent + double(_i - 1) / bins_per_decade);
+}
+
+double DecimaterStatistics::Histogram::upper_bound(size_t _i) const
+{
+  if (_i + 1 >= counts_.size())
+    return std::numeric_limits<double>::infinity();
+  return lower_bound(_i + 1);
+}
+
+double DecimaterStatistics::Histogram::quantile(double _q) const
+{
+  if (n_ == 0)
+    return 0.0;
+
+  const double rank = std::min(std::max(_q, 0.0), 1.0) * double(n_);
+  size_t sum = 0;
+  for (size_t i = 0; i < counts_.size(); ++i)
+  {
+    if (counts_[i] == 0 || double(sum + counts_[i]) < rank)
+    {
+      sum += counts_[i];
+      continue;
+    }
+
+    // interpolate within the bin, clamped to the observed range
+    const double lo = std::max(lower_bound(i), min_);
+    const double hi = std::min(upper_bound(i), max_);
+    const double t  = (rank - double(sum)) / double(counts_[i]);
+    if (lo <= 0.0 || hi <= lo)
+      return lo + t * (hi - lo);
+    return lo * std::pow(hi / lo, t);
+  }
+  return max_;
+}
+
+//-----------------------------------------------------------------------------
+
+DecimaterStatistics::ModuleCounters::ModuleCounters(const std::string& _name, bool _priority)
+  : name(_name), priority(_priority),
+    n_evaluations(0), n_rejected(0), n_timed(0), nanoseconds(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+DecimaterStatistics::DecimaterStatistics(unsigned int _timing_interval)
+  : timing_interval_(_timing_interval),
+    n_candidates_(0),
+    n_illegal_(0),
+    n_collapses_(0),
+    max_heap_size_(0)
+{
+}
+
+DecimaterStatistics::~DecimaterStatistics()
+{
+}
+
+void DecimaterStatistics::reset()
+{
+  n_candidates_  = 0;
+  n_illegal_     = 0;
+  n_collapses_   = 0;
+  max_heap_size_ = 0;
+  errors_.clear();
+
+  for (ModuleCounters& m : modules_)
+  {
+    m.n_evaluations = 0;
+    m.n_rejected    = 0;
+    m.n_timed       = 0;
+    m.nanoseconds   = 0;
+  }
+}
+
+void DecimaterStatistics::set_modules(const std::vector<std::string>& _names, size_t _priority_module)
+{
+  modules_.clear();
+  for (size_t i = 0; i < _names.size(); ++i)
+    modules_.emplace_back(_names[i], i == _priority_module);
+}
+
+std::vector<DecimaterStatistics::ModuleStatistics> DecimaterStatistics::modules() const
+{
+  std::vector<ModuleStatistics> result;
+  for (const ModuleCounters& m : modules_)
+  {
+    ModuleStatistics s;
+    s.name          = m.name;
+    s.priority      = m.priority;
+    s.n_evaluations = m.n_evaluations.load(std::memory_order_relaxed);
+    s.n_rejected    = m.n_rejected.load(std::memory_order_relaxed);
+
+    // extrapolate the sampled time to all evaluations
+    const size_t n_timed = m.n_timed.load(std::memory_order_relaxed);
+    const double seconds = double(m.nanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+    s.seconds = n_timed ? seconds * double(s.n_evaluations) / double(n_timed) : 0.0;
+
+    result.push_back(s);
+  }
+  return result;
+}
+
+void DecimaterStatistics::write_json(std::ostream& _os) const
+{
+  const std::streamsize precision = _os.precision(9);
+
+  _os << "{\n";
+  _os << "  \"candidates\": "    << n_candidates()  << ",\n";
+  _os << "  \"illegal\": "       << n_illegal()     << ",\n";
+  _os << "  \"collapses\": "     << n_collapses()   << ",\n";
+  _os << "  \"max_heap_size\": " << max_heap_size() << ",\n";
+
+  _os << "  \"modules\": [";
+  const std::vector<ModuleStatistics> mods = modules();
+  for (size_t i = 0; i < mods.size(); ++i)
+  {
+    _os << (i ? ",\n" : "\n") << "    {\"name\": ";
+    write_string(_os, mods[i].name);
+    _os << ", \"priority\": "    << (mods[i].priority ? "true" : "false")
+        << ", \"evaluations\": " << mods[i].n_evaluations
+        << ", \"rejected\": "    << mods[i].n_rejected
+        << ", \"seconds\": ";
+    write_number(_os, mods[i].seconds);
+    _os << "}";
+  }
+  _os << (mods.empty() ? "],\n" : "\n  ],\n");
+
+  _os << "  \"errors\": {\"count\": " << errors_.n() << ", \"min\": ";
+  write_number(_os, errors_.min());
+  _os << ", \"max\": ";
+  write_number(_os, errors_.max());
+  _os << ", \"mean\": ";
+  write_number(_os, errors_.mean());
+  _os << ", \"p50\": ";
+  write_number(_os, errors_.quantile(0.5));
+  _os << ", \"p90\": ";
+  write_number(_os, errors_.quantile(0.9));
+  _os << ", \"p99\": ";
+  write_number(_os, errors_.quantile(0.99));
+
+  // only the occupied bins
+  _os << ",\n    \"bins\": [";
+  bool first = true;
+  for (size_t i = 0; i < errors_.n_bins(); ++i)
+  {
+    if (errors_.count(i) == 0)
+      continue;
+    _os << (first ? "\n" : ",\n") << "      {\"lower\": ";
+    write_number(_os, errors_.lower_bound(i));
+    _os << ", \"upper\": ";
+    write_number(_os, errors_.upper_bound(i));
+    _os << ", \"count\": " << errors_.count(i) << "}";
+    first = false;
+  }
+  _os << (first ? "]}\n" : "\n    ]}\n");
+  _os << "}\n";
+
+  _os.precision(precision);
+}
+
+std::string DecimaterStatistics::json() const
+{
+  std::ostringstream os;
+  write_json(os);
+  return os.str();
+}
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
@@ -0,0 +1,280 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/** \file DecimaterStatistics.hh
+ *
+ * This file contains a class collecting counters, module timings and
+ * collapse errors of a decimater.
+ *
+ */
+
+//=============================================================================
+//
+//  CLASS DecimaterStatistics
+//
+//=============================================================================
+
+#pragma once
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+//== NAMESPACE ================================================================
+
+namespace OpenMesh  {
+namespace Decimater {
+
+
+//== CLASS DEFINITION =========================================================
+
+/** \brief Statistics of a decimation
+ *
+ * Set with BaseDecimaterT::set_statistics(), the decimater then counts the
+ * evaluated candidates, the candidates rejected by the topology tests and
+ * by each module, the performed collapses and the heap size, measures the
+ * time spent in each module and collects the priorities of the performed
+ * collapses in a logarithmic histogram.
+ *
+ * Counting costs a few atomic increments per candidate. Timing is sampled:
+ * only every timing_interval()-th candidate is timed and the module times
+ * are extrapolated, so the statistics can stay enabled in production. Use
+ * an interval of 1 for exact times.
+ *
+ * \code
+ * OpenMesh::Decimater::DecimaterStatistics statistics;
+ * decimater.set_statistics(&statistics);
+ * decimater.initialize();
+ * decimater.decimate_to(1000);
+ * statistics.write_json(std::cout);
+ * \endcode
+ *
+ * The statistics accumulate over several decimate() calls until reset().
+ * The counters may be updated concurrently (McDecimaterT evaluates batches
+ * in parallel), collapses are always recorded sequentially.
+ */
+class OPENMESHDLLEXPORT DecimaterStatistics
+{
+public:
+
+  /// Counters of one module
+  struct ModuleStatistics
+  {
+    std::string name;           ///< ModBaseT::name()
+    bool        priority;       ///< Priority module (otherwise binary)
+    size_t      n_evaluations;  ///< Calls of collapse_priority()
+    size_t      n_rejected;     ///< Evaluations returning ILLEGAL_COLLAPSE
+    double      seconds;        ///< Estimated time in place_vertex() and collapse_priority()
+  };
+
+  /** \brief Logarithmic histogram
+   *
+   * bins_per_decade bins per power of ten from 10^min_exponent to
+   * 10^max_exponent, one bin below and one above.
+   */
+  class OPENMESHDLLEXPORT Histogram
+  {
+  public:
+
+    static const int bins_per_decade = 4;
+    static const int min_exponent    = -12;
+    static const int max_exponent    = 6;
+
+    Histogram();
+
+    /// Remove all values
+    void clear();
+
+    /// Add a value, negative values are ignored
+    void add(double _value);
+
+    /// Number of bins
+    size_t n_bins() const { return counts_.size(); }
+
+    /// Number of values in bin \c _i
+    size_t count(size_t _i) const { return counts_[_i]; }
+
+    /// Lower bound of bin \c _i (0 for the first bin)
+    double lower_bound(size_t _i) const;
+
+    /// Upper bound of bin \c _i (infinity for the last bin)
+    double upper_bound(size_t _i) const;
+
+    /// Number of values
+    size_t n() const { return n_; }
+
+    /// Smallest, largest and mean value (0 if empty)
+    double min() const  { return n_ ? min_ : 0.0; }
+    double max() const  { return n_ ? max_ : 0.0; }
+    double mean() const { return n_ ? sum_ / double(n_) : 0.0; }
+
+    /// Approximate \c _q quantile, interpolated geometrically within its bin
+    double quantile(double _q) const;
+
+  private:
+
+    std::vector<size_t> counts_;
+    size_t n_;
+    double min_, max_, sum_;
+  };
+
+public:
+
+  /// Constructor, every \c _timing_interval-th candidate is timed (0: no timing)
+  explicit DecimaterStatistics(unsigned int _timing_interval = 16);
+
+  /// Destructor
+  ~DecimaterStatistics();
+
+  /// Clear all counters, the modules stay registered
+  void reset();
+
+  /// Interval of timed candidates (0: no timing, 1: every candidate)
+  unsigned int timing_interval() const { return timing_interval_; }
+  void set_timing_interval(unsigned int _interval) { timing_interval_ = _interval; }
+
+  /// Number of evaluated candidates (calls of collapse_priority())
+  size_t n_candidates() const { return n_candidates_.load(std::memory_order_relaxed); }
+
+  /// Number of candidates rejected by the topology tests (is_collapse_legal())
+  size_t n_illegal() const { return n_illegal_.load(std::memory_order_relaxed); }
+
+  /// Number of performed collapses
+  size_t n_collapses() const { return n_collapses_; }
+
+  /// Largest heap size (DecimaterT only)
+  size_t max_heap_size() const { return max_heap_size_; }
+
+  /// Statistics of the modules, binary modules first and the priority module last
+  std::vector<ModuleStatistics> modules() const;
+
+  /// Histogram of the priorities (errors) of the performed collapses
+  const Histogram& errors() const { return errors_; }
+
+  /// Write all statistics as a JSON object
+  void write_json(std::ostream& _os) const;
+
+  /// All statistics as a JSON string
+  std::string json() const;
+
+public: //------------------------------------- interface used by the decimater
+
+  /// Register the modules (called on initialization), resets the module counters
+  void set_modules(const std::vector<std::string>& _names, size_t _priority_module);
+
+  /// Start the evaluation of a candidate, returns whether it should be timed
+  bool begin_candidate()
+  {
+    const size_t i = n_candidates_.fetch_add(1, std::memory_order_relaxed);
+    return timing_interval_ && i % timing_interval_ == 0;
+  }
+
+  /// Count an evaluation of module \c _module
+  void add_evaluation(size_t _module, bool _rejected)
+  {
+    ModuleCounters& m = modules_[_module];
+    m.n_evaluations.fetch_add(1, std::memory_order_relaxed);
+    if (_rejected)
+      m.n_rejected.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Add the time of a sampled call of module \c _module, \c _evaluation
+  /// marks the collapse_priority() call which is counted for the extrapolation
+  void add_time(size_t _module, int64_t _nanoseconds, bool _evaluation)
+  {
+    ModuleCounters& m = modules_[_module];
+    m.nanoseconds.fetch_add(_nanoseconds, std::memory_order_relaxed);
+    if (_evaluation)
+      m.n_timed.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Count a candidate rejected by the topology tests
+  void add_illegal() { n_illegal_.fetch_add(1, std::memory_order_relaxed); }
+
+  /// Count a collapse with priority \c _priority (negative: unknown)
+  void add_collapse(double _priority)
+  {
+    ++n_collapses_;
+    errors_.add(_priority);
+  }
+
+  /// Update the largest heap size
+  void add_heap_size(size_t _size)
+  {
+    if (_size > max_heap_size_)
+      max_heap_size_ = _size;
+  }
+
+private:
+
+  struct ModuleCounters
+  {
+    ModuleCounters(const std::string& _name, bool _priority);
+
+    std::string          name;
+    bool                 priority;
+    std::atomic<size_t>  n_evaluations;
+    std::atomic<size_t>  n_rejected;
+    std::atomic<size_t>  n_timed;
+    std::atomic<int64_t> nanoseconds;
+  };
+
+  unsigned int               timing_interval_;
+  std::atomic<size_t>        n_candidates_;
+  std::atomic<size_t>        n_illegal_;
+  size_t                     n_collapses_;
+  size_t                     max_heap_size_;
+  std::deque<ModuleCounters> modules_;
+  Histogram                  errors_;
+};
+
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+
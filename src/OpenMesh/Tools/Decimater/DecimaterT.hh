@@ -186,6 +186,9 @@ private: //---------------------------------------------------- private methods
   /// Insert vertex in heap
   void heap_vertex(VertexHandle _vh);
 
+  /// Insert all (selected) vertices which are not deleted in heap
+  void fill_heap(bool _only_selected);
+
 private: //------------------------------------------------------- private data
 
 
@@ -145,6 +145,25 @@ void DecimaterT<Mesh>::heap_vertex(VertexHandle _vh) {
   }
 }
 
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+void DecimaterT<Mesh>::fill_heap(bool _only_selected) {
+
+  if (_only_selected) {
+    // skip unselected vertices 64 at a time
+    mesh_.for_each_status_bits(VertexHandle(), Attributes::SELECTED, [this](VertexHandle _vh) {
+      if (!mesh_.status(_vh).deleted())
+        heap_vertex(_vh);
+    });
+  }
+  else {
+    for ( auto v_it : mesh_.vertices() )
+      if (!mesh_.status(v_it).deleted())
+        heap_vertex(v_it);
+  }
+}
+
 //-----------------------------------------------------------------------------
 template<class Mesh>
 size_t DecimaterT<Mesh>::decimate(size_t _n_collapses, bool _only_selected) {
@@ -180,16 +199,10 @@ size_t DecimaterT<Mesh>::decimate(size_t _n_collapses, bool _only_selected) {
 
   heap_->reserve(mesh_.n_vertices());
 
-  for ( auto v_it : mesh_.vertices() ) {
+  for ( auto v_it : mesh_.vertices() )
     heap_->reset_heap_position(v_it);
 
-    if (!mesh_.status(v_it).deleted()) {
-      if (!_only_selected  || mesh_.status(v_it).selected() ) {
-        heap_vertex(v_it);
-      }
-    }
-
-  }
+  fill_heap(_only_selected);
 
   const bool update_normals = mesh_.has_face_normals();
 
@@ -198,6 +211,8 @@ size_t DecimaterT<Mesh>::decimate(size_t _n_collapses, bool _only_selected) {
     // get 1st heap entry
     vp = heap_->front();
     v0v1 = mesh_.property(collapse_target_, vp);
+    const float prio = mesh_.property(priority_, vp);
+    this->notify_heap_size(heap_->size());
     heap_->pop_front();
 
     // setup collapse info
@@ -214,12 +229,21 @@ size_t DecimaterT<Mesh>::decimate(size_t _n_collapses, bool _only_selected) {
       support.push_back(*vv_it);
 
     // pre-processing
-    this->preprocess_collapse(ci);
+    const typename Mesh::Point p1 = ci.p1;
+    this->preprocess_collapse(ci, prio);
 
     // perform collapse
     mesh_.collapse(v0v1);
     ++n_collapses;
 
+    // a moved v1 changes the faces of its one-ring, too
+    if (ci.p1 != p1) {
+      support.clear();
+      support.push_back(ci.v1);
+      for (vv_it = mesh_.vv_iter(ci.v1); vv_it.is_valid(); ++vv_it)
+        support.push_back(*vv_it);
+    }
+
     if (update_normals)
     {
       // update triangle normals
@@ -287,14 +311,10 @@ size_t DecimaterT<Mesh>::decimate_to_faces(size_t _nv, size_t _nf, bool _only_se
   #endif
   heap_->reserve(mesh_.n_vertices());
 
-  for ( auto v_it : mesh_.vertices() ) {
+  for ( auto v_it : mesh_.vertices() )
     heap_->reset_heap_position(v_it);
-    if (!mesh_.status(v_it).deleted()) {
-      if (!_only_selected  || mesh_.status(v_it).selected() ) {
-        heap_vertex(v_it);
-      }
-    }
-  }
+
+  fill_heap(_only_selected);
 
   const bool update_normals = mesh_.has_face_normals();
 
@@ -303,6 +323,8 @@ size_t DecimaterT<Mesh>::decimate_to_faces(size_t _nv, size_t _nf, bool _only_se
     // get 1st heap entry
     vp = heap_->front();
     v0v1 = mesh_.property(collapse_target_, vp);
+    const float prio = mesh_.property(priority_, vp);
+    this->notify_heap_size(heap_->size());
     heap_->pop_front();
 
     // setup collapse info
@@ -327,11 +349,20 @@ size_t DecimaterT<Mesh>::decimate_to_faces(size_t _nv, size_t _nf, bool _only_se
       nf -= 2;
 
     // pre-processing
-    this->preprocess_collapse(ci);
+    const typename Mesh::Point p1 = ci.p1;
+    this->preprocess_collapse(ci, prio);
 
     // perform collapse
     mesh_.collapse(v0v1);
 
+    // a moved v1 changes the faces of its one-ring, too
+    if (ci.p1 != p1) {
+      support.clear();
+      support.push_back(ci.v1);
+      for (vv_it = mesh_.vv_iter(ci.v1); vv_it.is_valid(); ++vv_it)
+        support.push_back(*vv_it);
+    }
+
     // update triangle normals
     if (update_normals)
     {
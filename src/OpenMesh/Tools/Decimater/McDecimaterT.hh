@@ -56,6 +56,7 @@
 
 //== INCLUDES =================================================================
 
+#include <algorithm>
 #include <memory>
 #include <OpenMesh/Tools/Decimater/BaseDecimaterT.hh>
 
@@ -149,6 +150,35 @@ public:
   size_t samples(){return randomSamples_;}
   void set_samples(const size_t _value){randomSamples_ = _value;}
 
+  /** Let decimate() draw _batch_size independent sets of samples() halfedges
+   *  per round instead of one. The sets are evaluated on up to _max_threads
+   *  threads (0: all threads of the global ThreadPool) and the best collapses
+   *  of all sets whose one-rings do not overlap are performed together.
+   *  The sets are drawn on the calling thread, so the result does not depend
+   *  on the number of threads. A batch size of 1 (default) is the classic
+   *  one collapse per step scheme.
+   *
+   *  Evaluation falls back to a single thread if one of the modules is not
+   *  ModBaseT::is_concurrent(). Arrays the mesh shares with copies of it
+   *  (see BaseKernel::set_copy_on_write()) are detached before the first
+   *  round, since the modules read the mesh through non-const accessors.
+   *
+   *  Only decimate() is batched, decimate_to_faces() and
+   *  decimate_constraints_only() always perform one collapse per step.
+   */
+  void set_batch_size(size_t _batch_size, unsigned int _max_threads = 0)
+  {
+    batch_size_  = std::max<size_t>(_batch_size, 1);
+    max_threads_ = _max_threads;
+  }
+
+  size_t batch_size() const { return batch_size_; }
+
+private: //----------------------------------------------------- private methods
+
+  /// decimate() for batch_size() > 1
+  size_t decimate_batched( size_t _n_collapses, bool _only_selected );
+
 private: //------------------------------------------------------- private data
 
 
@@ -157,6 +187,10 @@ private: //------------------------------------------------------- private data
 
   size_t randomSamples_;
 
+  // number of sample sets per round and threads evaluating them
+  size_t       batch_size_;
+  unsigned int max_threads_;
+
 };
 
 //=============================================================================
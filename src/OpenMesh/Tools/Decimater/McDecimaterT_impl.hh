@@ -53,7 +53,9 @@
 //== INCLUDES =================================================================
 
 #include <OpenMesh/Tools/Decimater/McDecimaterT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
 
+#include <algorithm>
 #include <vector>
 #if defined(OM_CC_MIPS)
 #  include <float.h>
@@ -75,7 +77,7 @@ namespace Decimater {
 template<class Mesh>
 McDecimaterT<Mesh>::McDecimaterT(Mesh& _mesh) :
   BaseDecimaterT<Mesh>(_mesh),
-    mesh_(_mesh), randomSamples_(10) {
+    mesh_(_mesh), randomSamples_(10), batch_size_(1), max_threads_(0) {
 
   // default properties
   mesh_.request_vertex_status();
@@ -104,6 +106,9 @@ size_t McDecimaterT<Mesh>::decimate(size_t _n_collapses, bool _only_selected) {
   if (!this->is_initialized())
     return 0;
 
+  if (batch_size_ > 1)
+    return decimate_batched(_n_collapses, _only_selected);
+
   unsigned int n_collapses(0);
 
   bool collapsesUnchanged = false;
@@ -176,7 +181,7 @@ size_t McDecimaterT<Mesh>::decimate(size_t _n_collapses, bool _only_selected) {
         continue;
 
       // pre-processing
-      this->preprocess_collapse(ci);
+      this->preprocess_collapse(ci, bestEnergy);
 
       // perform collapse
       mesh_.collapse(bestHandle);
@@ -222,6 +227,161 @@ size_t McDecimaterT<Mesh>::decimate(size_t _n_collapses, bool _only_selected) {
 
 //-----------------------------------------------------------------------------
 
+template<class Mesh>
+size_t McDecimaterT<Mesh>::decimate_batched(size_t _n_collapses, bool _only_selected) {
+
+  typedef typename Mesh::HalfedgeHandle HalfedgeHandle;
+  typedef typename Mesh::VertexHandle   VertexHandle;
+
+  // best sample of one set
+  struct Candidate {
+    double         energy;
+    HalfedgeHandle heh;
+    bool operator<(const Candidate& _other) const {
+      return (energy < _other.energy) ||
+             (energy == _other.energy && heh.idx() < _other.heh.idx());
+    }
+  };
+
+  size_t n_collapses(0);
+
+  // number of rounds where no collapses were performed in a row
+  unsigned int noCollapses = 0;
+
+#ifdef WIN32
+  RandomNumberGenerator randGen(mesh_.n_halfedges());
+#endif
+
+  const bool update_normals = mesh_.has_face_normals();
+  const unsigned int max_threads = this->is_concurrent() ? max_threads_ : 1;
+
+  std::vector<HalfedgeHandle> samples;
+  std::vector<Candidate>      candidates;
+
+  // round in which a vertex was last touched by a collapse
+  std::vector<unsigned int> stamp(mesh_.n_vertices(), 0);
+  unsigned int round = 0;
+
+  // The first non-const access to a copy-on-write property replaces it,
+  // which must not happen in the workers. reserve() writes to all
+  // properties and so takes the private copies up front.
+  mesh_.reserve(mesh_.n_vertices(), mesh_.n_edges(), mesh_.n_faces());
+  const Mesh& mesh = mesh_;
+
+  while ( n_collapses < _n_collapses ) {
+
+    if (noCollapses > 20) {
+      omlog() << "[McDecimater] : no collapses performed in over 20 iterations in a row\n";
+      break;
+    }
+
+    ++round;
+
+    // Draw all sets up front to keep the random sequence independent of the threads
+    const size_t n_sets = std::min(batch_size_, _n_collapses - n_collapses);
+    samples.resize(n_sets * randomSamples_);
+    for (size_t i = 0; i < samples.size(); ++i) {
+#ifdef WIN32
+      samples[i] = HalfedgeHandle(int(randGen.getRand() * double(mesh_.n_halfedges() - 1.0)) );
+#else
+      samples[i] = HalfedgeHandle( (double(rand()) / double(RAND_MAX) ) * double(mesh_.n_halfedges()-1) );
+#endif
+    }
+
+    // Evaluate the sets, each one keeps its best legal collapse
+    candidates.assign(n_sets, Candidate{ FLT_MAX, HalfedgeHandle() });
+    parallel_for(n_sets, 1, [&](size_t _first, size_t _last) {
+      for (size_t s = _first; s < _last; ++s) {
+        Candidate& best = candidates[s];
+        for (size_t i = s * randomSamples_; i < (s + 1) * randomSamples_; ++i) {
+          const HalfedgeHandle heh = samples[i];
+
+          if ( mesh.status(heh).deleted() || (_only_selected && !mesh.status(heh).selected()) )
+            continue;
+
+          CollapseInfo ci(mesh_, heh);
+          if (!this->is_collapse_legal(ci))
+            continue;
+
+          const double energy = this->collapse_priority(ci);
+          if (energy != ModBaseT<Mesh>::ILLEGAL_COLLAPSE && energy < best.energy)
+            best = Candidate{ energy, heh };
+        }
+      }
+    }, max_threads);
+
+    std::sort(candidates.begin(), candidates.end());
+
+    // Commit the best candidates whose one-rings were not touched in this round
+    size_t n_round = 0;
+    for (const Candidate& c : candidates) {
+
+      if (c.energy == FLT_MAX || n_collapses >= _n_collapses)
+        break;
+
+      // the same halfedge may win several sets and is deleted then
+      if (mesh_.status(c.heh).deleted())
+        continue;
+
+      const VertexHandle v0 = mesh_.from_vertex_handle(c.heh);
+      const VertexHandle v1 = mesh_.to_vertex_handle(c.heh);
+
+      bool locked = false;
+      for (VertexHandle v : { v0, v1 }) {
+        if (stamp[v.idx()] == round)
+          locked = true;
+        for (auto vv_it = mesh_.cvv_iter(v); !locked && vv_it.is_valid(); ++vv_it)
+          locked = (stamp[vv_it->idx()] == round);
+      }
+      if (locked)
+        continue;
+
+      // setup collapse info
+      CollapseInfo ci(mesh_, c.heh);
+
+      // check topological correctness AGAIN !
+      if (!this->is_collapse_legal(ci))
+        continue;
+
+      // pre-processing
+      this->preprocess_collapse(ci, c.energy);
+
+      // perform collapse
+      mesh_.collapse(c.heh);
+      ++n_collapses;
+      ++n_round;
+
+      // lock the one-ring of v1 for the rest of this round
+      stamp[v1.idx()] = round;
+      for (auto vv_it = mesh_.cvv_iter(v1); vv_it.is_valid(); ++vv_it)
+        stamp[vv_it->idx()] = round;
+
+      // update triangle normals
+      if (update_normals)
+      {
+        typename Mesh::VertexFaceIter vf_it = mesh_.vf_iter(ci.v1);
+        for (; vf_it.is_valid(); ++vf_it)
+          if (!mesh_.status(*vf_it).deleted())
+            mesh_.set_normal(*vf_it, mesh_.calc_face_normal(*vf_it));
+      }
+
+      // post-process collapse
+      this->postprocess_collapse(ci);
+
+      // notify observer and stop if the observer requests it
+      if (!this->notify_observer(n_collapses))
+          return n_collapses;
+    }
+
+    noCollapses = n_round ? 0 : noCollapses + 1;
+  }
+
+  // DON'T do garbage collection here! It's up to the application.
+  return n_collapses;
+}
+
+//-----------------------------------------------------------------------------
+
 template<class Mesh>
 size_t McDecimaterT<Mesh>::decimate_to_faces(size_t _nv, size_t _nf, bool _only_selected) {
 
@@ -319,7 +479,7 @@ size_t McDecimaterT<Mesh>::decimate_to_faces(size_t _nv, size_t _nf, bool _only_
         nf -= 2;
 
       // pre-processing
-      this->preprocess_collapse(ci);
+      this->preprocess_collapse(ci, bestEnergy);
 
       // perform collapse
       mesh_.collapse(bestHandle);
@@ -480,7 +640,7 @@ size_t McDecimaterT<Mesh>::decimate_constraints_only(float _factor, bool _only_s
         nf -= 2;
 
       // pre-processing
-      this->preprocess_collapse(ci);
+      this->preprocess_collapse(ci, bestEnergy);
 
       // perform collapse
       mesh_.collapse(bestHandle);
@@ -116,6 +116,9 @@ class ModAspectRatioT: public ModBaseT<MeshT> {
     /// Returns the collapse priority
     float collapse_priority(const CollapseInfo& _ci) override;
 
+    /// The priority only reads the mesh and the stored aspect ratios
+    bool is_concurrent() const override { return true; }
+
     /// update aspect ratio of one-ring
     void preprocess_collapse(const CollapseInfo& _ci) override;
 
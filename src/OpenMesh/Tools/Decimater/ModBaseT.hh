@@ -222,12 +222,31 @@ public:
   /// Set whether module is binary or not.
   void set_binary(bool _b)   { is_binary_ = _b; }
 
+  /** Returns true if place_vertex() and collapse_priority() may be called for different
+   *  collapses from several threads at the same time, i.e. it only reads the
+   *  mesh and the module. The multiple choice decimater evaluates candidate
+   *  collapses concurrently only if all modules return true.
+   */
+  virtual bool is_concurrent() const { return false; }
+
 
 public: // common interface
 
    /// Initialize module-internal stuff
    virtual void initialize() { }
 
+   /** Choose the position \c _ci.p1 of the remaining vertex.
+    *
+    *  Called for every module before the collapse priorities are
+    *  evaluated and again before the collapse is performed, which then
+    *  moves \c _ci.v1 to \c _ci.p1. The default keeps the position of
+    *  \c _ci.v1, i.e. a plain halfedge collapse.
+    *
+    *  \see ModQuadricT::set_optimal_placement()
+    */
+   virtual void place_vertex(CollapseInfo& /* _ci */)
+   {}
+
    /** Return collapse priority.
     *
     *  In the binary mode collapse_priority() checks a constraint and
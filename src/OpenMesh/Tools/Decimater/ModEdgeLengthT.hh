@@ -100,6 +100,9 @@ class ModEdgeLengthT: public ModBaseT<MeshT> {
      */
     float collapse_priority(const CollapseInfo& _ci) override;
 
+    /// The priority only reads the collapse info
+    bool is_concurrent() const override { return true; }
+
     /// set the percentage of edge length
     void set_error_tolerance_factor(double _factor) override;
 
@@ -74,6 +74,13 @@ namespace Decimater {
  *  - The distance after the collapse is lower than the given tolerance
  *
  * No continuous mode
+ *
+ * The distances are computed by brute force against the faces around the
+ * collapsed vertex, which are only a handful. Utils::BVHT does not help
+ * here: the tested faces are those after the simulated collapse, and a
+ * hierarchy over the whole mesh would have to be refit for every
+ * candidate. Use BVHT::max_distance() to measure the distance of the
+ * decimated mesh to the original one afterwards.
  */
 template<class MeshT>
 class ModHausdorffT: public ModBaseT<MeshT> {
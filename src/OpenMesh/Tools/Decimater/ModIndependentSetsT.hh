@@ -76,6 +76,9 @@ class ModIndependentSetsT: public ModBaseT<MeshT> {
         Base(_mesh, true) {
     }
 
+    /// The module has no priority
+    bool is_concurrent() const override { return true; }
+
     /// override
     void postprocess_collapse(const CollapseInfo& _ci) override {
       typename Mesh::VertexVertexIter vv_it;
@@ -57,6 +57,7 @@
 //== INCLUDES =================================================================
 
 #include <OpenMesh/Tools/Decimater/ModBaseT.hh>
+#include <OpenMesh/Tools/Decimater/CollapsedNormalsT.hh>
 #include <OpenMesh/Core/Utils/Property.hh>
 #include <OpenMesh/Core/Geometry/NormalConeT.hh>
 
@@ -98,6 +99,8 @@ public:
   typedef typename Mesh::FaceHandle                 FaceHandle;
   typedef typename Mesh::EdgeHandle                 EdgeHandle;
   typedef NormalConeT<Normal>                       NormalCone;
+  typedef CollapsedNormalsT<MeshT>                  CollapsedNormals;
+  typedef typename CollapsedNormals::Scalar         NormalScalar;
 
 
 
@@ -162,46 +165,72 @@ public:
    * the cone to a value greater than the given value
    * the collapse will be illegal.
    *
+   * In binary mode the merged cone sizes are compared with the bound
+   * through their cosines, acos() is only needed for the continuous
+   * priority.
+   *
    * @param _ci Collapse info data
-   * @return Half of the normal cones size (radius in radians)
+   * @return Half of the normal cones size (radius in radians), in binary
+   *         mode LEGAL_COLLAPSE or ILLEGAL_COLLAPSE
    */
   float collapse_priority(const CollapseInfo& _ci) override {
-    // simulate collapse
-    mesh_.set_point(_ci.v0, _ci.p1);
-
-
-    typename Mesh::Scalar               max_angle(0.0);
-    typename Mesh::ConstVertexFaceIter  vf_it(mesh_, _ci.v0);
+    // the collapse is simulated by using p1 for v0 (and v1, if the
+    // collapse moves it)
+    const Mesh&                         mesh = mesh_;
+    const bool                          binary = this->is_binary();
+    const Scalar                        max_half_angle = Scalar(0.5) * normal_deviation_;
+    const Scalar                        cos_max_angle = std::cos(normal_deviation_);
+    Scalar                              max_angle(0.0);
     typename Mesh::FaceHandle           fh, fhl, fhr;
 
-    if (_ci.v0vl.is_valid())  fhl = mesh_.face_handle(_ci.v0vl);
-    if (_ci.vrv0.is_valid())  fhr = mesh_.face_handle(_ci.vrv0);
-
-    for (; vf_it.is_valid(); ++vf_it) {
-      fh = *vf_it;
-      if (fh != _ci.fl && fh != _ci.fr) {
-        NormalCone nc = mesh_.property(normal_cones_, fh);
-
-        nc.merge(NormalCone(mesh_.calc_face_normal(fh)));
-        if (fh == fhl) nc.merge(mesh_.property(normal_cones_, _ci.fl));
-        if (fh == fhr) nc.merge(mesh_.property(normal_cones_, _ci.fr));
+    if (_ci.v0vl.is_valid())  fhl = mesh.face_handle(_ci.v0vl);
+    if (_ci.vrv0.is_valid())  fhr = mesh.face_handle(_ci.vrv0);
+
+    CollapsedNormals normals(mesh, _ci);
+    Normal           centers[CollapsedNormals::chunk_size];
+    NormalScalar     dots[CollapsedNormals::chunk_size];
+
+    while (size_t n = normals.next()) {
+      for (size_t i = 0; i < n; ++i)
+        centers[i] = mesh.property(normal_cones_, normals.face(i)).center_normal();
+      dot_n(centers, normals.normals(), dots, n);
+
+      for (size_t i = 0; i < n; ++i) {
+        fh = normals.face(i);
+        const NormalCone& cone = mesh.property(normal_cones_, fh);
+        Scalar angle;
+
+        if (fh == fhl || fh == fhr) {
+          NormalCone nc = cone;
+          nc.merge(NormalCone(normals.normal(i)));
+          if (fh == fhl) nc.merge(mesh.property(normal_cones_, _ci.fl));
+          if (fh == fhr) nc.merge(mesh.property(normal_cones_, _ci.fr));
+          angle = nc.angle();
+        }
+        else if (binary) {
+          if (merged_angle_reaches(cone, dots[i], max_half_angle, cos_max_angle))
+            return float( Base::ILLEGAL_COLLAPSE );
+          continue;
+        }
+        else
+          angle = cone.merged_angle(dots[i]);
 
-        if (nc.angle() > max_angle) {
-          max_angle = nc.angle();
-          if (max_angle > 0.5 * normal_deviation_)
-            break;
+        if (angle > max_angle) {
+          max_angle = angle;
+          if (max_angle > max_half_angle)
+            return float( Base::ILLEGAL_COLLAPSE );
         }
       }
     }
 
-
-    // undo simulation changes
-    mesh_.set_point(_ci.v0, _ci.p0);
-
-
-    return (max_angle < 0.5 * normal_deviation_ ? max_angle : float( Base::ILLEGAL_COLLAPSE ));
+    if (max_angle >= max_half_angle)
+      return float( Base::ILLEGAL_COLLAPSE );
+    return binary ? float( Base::LEGAL_COLLAPSE ) : float( max_angle );
   }
 
+  /// The priority only reads the mesh and the normal cones
+  bool is_concurrent() const override { return true; }
+
   /// set the percentage of normal deviation
   void set_error_tolerance_factor(double _factor) override {
     if (_factor >= 0.0 && _factor <= 1.0) {
@@ -244,6 +273,31 @@ public:
 
 
 
+private:
+
+  /** Is _cone.merged_angle(_dotp) >= _max_half_angle? (a + acos(_dotp)) / 2
+   *  reaches the bound if _dotp <= cos(2 * _max_half_angle - a), the cosine
+   *  of fresh cones (a = 0) is passed in as _cos_max_angle. */
+  static bool merged_angle_reaches(const NormalCone& _cone, NormalScalar _dotp,
+                                   Scalar _max_half_angle, Scalar _cos_max_angle)
+  {
+    const Scalar a = _cone.angle();
+    if (a >= _max_half_angle)
+      return true;
+
+    // same cases as NormalConeT::merged_angle()
+    if (!(std::fabs(_dotp) < 0.99999f))
+      return _dotp < 0.0f;
+
+    // acos() never exceeds pi, cos() is only monotone up to there
+    const Scalar bound = Scalar(2) * _max_half_angle - a;
+    if (bound >= Scalar(M_PI))
+      return false;
+
+    const Scalar cos_bound = (a == Scalar(0)) ? _cos_max_angle : Scalar(std::cos(bound));
+    return Scalar(_dotp) <= cos_bound;
+  }
+
 private:
 
   Mesh&                               mesh_;
@@ -59,6 +59,7 @@
 //== INCLUDES =================================================================
 
 #include <OpenMesh/Tools/Decimater/ModBaseT.hh>
+#include <OpenMesh/Tools/Decimater/CollapsedNormalsT.hh>
 
 //== NAMESPACES ===============================================================
 
@@ -112,7 +113,9 @@ public:
    *  before and after a collapse.
    *
    *  -# Compute for each adjacent face of \c _ci.v0 the face
-   *  normal if the collpase would be executed.
+   *  normal if the collpase would be executed. If the collapse moves
+   *  \c _ci.v1 to a new position \c _ci.p1, the faces of \c _ci.v1 are
+   *  checked, too.
    *
    *  -# Prevent the collapse, if the cosine of the angle between the
    *     original and the new normal is below a given threshold.
@@ -124,35 +127,33 @@ public:
    */
   float collapse_priority(const CollapseInfo& _ci) override
   {
-    // simulate collapse
-    Base::mesh().set_point(_ci.v0, _ci.p1);
+    // check for flipping normals, simulating the collapse by using p1 for v0
+    // (and v1, if the collapse moves it)
+    typedef CollapsedNormalsT<MeshT>          CollapsedNormals;
+    typedef typename CollapsedNormals::Scalar Scalar;
 
-    // check for flipping normals
-    typename Mesh::ConstVertexFaceIter vf_it(Base::mesh(), _ci.v0);
-    typename Mesh::FaceHandle          fh;
-    typename Mesh::Scalar              c(1.0);
+    const Mesh&           mesh = Base::mesh();
+    CollapsedNormals      normals(mesh, _ci);
+    typename Mesh::Normal old_normals[CollapsedNormals::chunk_size];
+    Scalar                c[CollapsedNormals::chunk_size];
 
-    for (; vf_it.is_valid(); ++vf_it)
+    while (size_t n = normals.next())
     {
-      fh = *vf_it;
-      if (fh != _ci.fl && fh != _ci.fr)
-      {
-        typename Mesh::Normal n1 = Base::mesh().normal(fh);
-        typename Mesh::Normal n2 = Base::mesh().calc_face_normal(fh);
+      for (size_t i = 0; i < n; ++i)
+        old_normals[i] = mesh.normal(normals.face(i));
+      dot_n(old_normals, normals.normals(), c, n);
 
-        c = dot(n1, n2);
-
-        if (c < min_cos_)
-          break;
-      }
+      for (size_t i = 0; i < n; ++i)
+        if (c[i] < min_cos_)
+          return float( Base::ILLEGAL_COLLAPSE );
     }
 
-    // undo simulation changes
-    Base::mesh().set_point(_ci.v0, _ci.p0);
-
-    return float( (c < min_cos_) ? Base::ILLEGAL_COLLAPSE : Base::LEGAL_COLLAPSE );
+    return float( Base::LEGAL_COLLAPSE );
   }
 
+  /// The priority only reads the mesh
+  bool is_concurrent() const override { return true; }
+
   /// set the percentage of maximum normal deviation
   void set_error_tolerance_factor(double _factor) override {
     if (_factor >= 0.0 && _factor <= 1.0) {
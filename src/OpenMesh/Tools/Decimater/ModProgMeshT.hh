@@ -138,6 +138,9 @@ public: // inherited
 
   bool is_binary(void) const { return true; }
 
+  /// The module has no priority
+  bool is_concurrent() const override { return true; }
+
 
 public: // specific methods
 
@@ -166,9 +169,33 @@ public: // specific methods
    *  \return \c true on success of the operation, else \c false.
    */
   bool write( const std::string& _ofname );
+
+  /** Write progressive mesh data in the compact .pm format.
+   *
+   *  Positions are quantized to _bits bits per coordinate and stored
+   *  relative to the split vertex, the indices take only as many bits as
+   *  they need. Records are grouped into blocks of _block_size records, so
+   *  the file can be truncated after any block. Typically four to eight
+   *  times smaller than write(). The format is described at
+   *  Utils::ProgressiveMeshWriter and read by Utils::ProgressiveMesh.
+   *
+   *  \remark Write file before calling the garbage collection of the mesh.
+   *  \param _ofname     Name of the file, where to write the progressive mesh
+   *  \param _bits       Quantization bits per coordinate
+   *  \param _block_size Number of detail records per block
+   *  \return \c true on success of the operation, else \c false.
+   */
+  bool write_compact( const std::string& _ofname, unsigned int _bits = 16,
+                      unsigned int _block_size = 256 );
   /// Reference to collected information
   const InfoList& infolist() const { return pmi_; }
 
+private:
+
+  /// Number the remaining vertices first, then the removed ones in
+  /// refinement order. Returns the number of remaining vertices.
+  size_t index_vertices( std::vector<typename Mesh::VertexHandle>& _vhandles );
+
 private:
 
   InfoList          pmi_;
@@ -62,6 +62,7 @@
 #include <OpenMesh/Core/Utils/vector_cast.hh>
 #include <OpenMesh/Core/IO/BinaryHelper.hh>
 #include <OpenMesh/Core/Utils/Endian.hh>
+#include <OpenMesh/Tools/Utils/ProgressiveMeshWriter.hh>
 // --------------------
 #include <OpenMesh/Tools/Decimater/ModProgMeshT.hh>
 
@@ -77,13 +78,13 @@ namespace Decimater {
 
 
 template <class MeshT>
-bool 
+size_t
 ModProgMeshT<MeshT>::
-write( const std::string& _ofname )
+index_vertices( std::vector<typename Mesh::VertexHandle>& _vhandles )
 {
   // sort vertices
-  size_t i=0, N=Base::mesh().n_vertices(), n_base_vertices(0), n_base_faces(0);
-  std::vector<typename Mesh::VertexHandle>  vhandles(N);
+  size_t i=0, N=Base::mesh().n_vertices(), n_base_vertices(0);
+  _vhandles.resize(N);
 
 
   // base vertices
@@ -94,7 +95,7 @@ write( const std::string& _ofname )
   for (; v_it != v_end; ++v_it)  
     if (!Base::mesh().status(*v_it).deleted())
     {
-      vhandles[i] = *v_it;
+      _vhandles[i] = *v_it;
       Base::mesh().property( idx_, *v_it ) = i;
       ++i;
     }
@@ -107,11 +108,30 @@ write( const std::string& _ofname )
 
   for (; r_it!=r_end; ++r_it)  
   { 
-    vhandles[i] = r_it->v0;  
+    _vhandles[i] = r_it->v0;  
     Base::mesh().property( idx_, r_it->v0) = i;  
     ++i; 
   }
 
+  return n_base_vertices;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class MeshT>
+bool 
+ModProgMeshT<MeshT>::
+write( const std::string& _ofname )
+{
+  size_t i=0, n_base_vertices(0), n_base_faces(0);
+  std::vector<typename Mesh::VertexHandle>  vhandles;
+  n_base_vertices = index_vertices(vhandles);
+
+  typename InfoList::reverse_iterator
+    r_it=pmi_.rbegin(), r_end=pmi_.rend();
+
 
   // base faces
   typename Mesh::ConstFaceIter f_it  = Base::mesh().faces_begin(), 
@@ -178,6 +198,53 @@ write( const std::string& _ofname )
 }
 
 
+//-----------------------------------------------------------------------------
+
+
+template <class MeshT>
+bool 
+ModProgMeshT<MeshT>::
+write_compact( const std::string& _ofname, unsigned int _bits, unsigned int _block_size )
+{
+  std::vector<typename Mesh::VertexHandle>  vhandles;
+  const size_t n_base_vertices = index_vertices(vhandles);
+
+  Utils::ProgressiveMeshWriter writer(_bits, _block_size);
+  const unsigned int invalid = Utils::ProgressiveMeshWriter::invalid;
+
+  // base vertices
+  for (size_t i=0; i<n_base_vertices; ++i)
+    writer.add_vertex( vector_cast<Vec3f>( Base::mesh().point(vhandles[i]) ) );
+
+  // base faces
+  typename Mesh::ConstFaceIter f_it  = Base::mesh().faces_begin(), 
+                               f_end = Base::mesh().faces_end();
+  for (; f_it != f_end; ++f_it)  
+  {
+    if (!Base::mesh().status(*f_it).deleted())
+    {
+      typename Mesh::ConstFaceVertexIter fv_it(Base::mesh(), *f_it);
+      const unsigned int i0 = static_cast<unsigned int>(Base::mesh().property( idx_,   *fv_it ));
+      const unsigned int i1 = static_cast<unsigned int>(Base::mesh().property( idx_, *(++fv_it) ));
+      const unsigned int i2 = static_cast<unsigned int>(Base::mesh().property( idx_, *(++fv_it) ));
+      writer.add_face( i0, i1, i2 );
+    }
+  }
+
+  // detail info
+  typename InfoList::reverse_iterator r_it, r_end=pmi_.rend();
+  for (r_it=pmi_.rbegin(); r_it!=r_end; ++r_it)  
+  { 
+    writer.add_detail( vector_cast<Vec3f>(Base::mesh().point(r_it->v0)),
+        static_cast<unsigned int>(Base::mesh().property(idx_, r_it->v1)),
+        r_it->vl.is_valid() ? static_cast<unsigned int>(Base::mesh().property(idx_, r_it->vl)) : invalid,
+        r_it->vr.is_valid() ? static_cast<unsigned int>(Base::mesh().property(idx_, r_it->vr)) : invalid );
+  }
+
+  return writer.write( _ofname );
+}
+
+
 
 //=============================================================================
 } // END_NS_DECIMATER
@@ -52,9 +52,17 @@
 //== INCLUDES =================================================================
 
 #include <float.h>
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <OpenMesh/Core/System/omstream.hh>
 #include <OpenMesh/Tools/Decimater/ModBaseT.hh>
 #include <OpenMesh/Core/Utils/Property.hh>
 #include <OpenMesh/Core/Utils/vector_cast.hh>
+#include <OpenMesh/Core/Utils/vector_traits.hh>
 #include <OpenMesh/Core/Geometry/QuadricT.hh>
 
 
@@ -70,6 +78,17 @@ namespace Decimater {
 /** \brief Mesh decimation module computing collapse priority based on error quadrics.
  *
  *  This module can be used as a binary and non-binary module.
+ *
+ *  By default a collapse keeps the position of the remaining vertex. With
+ *  set_optimal_placement() the vertex is moved to the position minimizing
+ *  the quadric error instead, which needs considerably fewer triangles for
+ *  the same error.
+ *
+ *  add_attribute() extends the quadrics by vertex properties like normals,
+ *  texture coordinates or colors (generalized quadrics, Garland and
+ *  Heckbert 1998). The error is then measured in the space of positions
+ *  and weighted attributes and the attributes of the remaining vertex are
+ *  set to the values minimizing it.
  */
 template <class MeshT>
 class ModQuadricT : public ModBaseT<MeshT>
@@ -86,7 +105,7 @@ public:
    *  \internal
    */
   explicit ModQuadricT( MeshT &_mesh )
-    : Base(_mesh, false)
+    : Base(_mesh, false), optimal_placement_(false), dim_(3), stride_(0)
   {
     unset_max_err();
     Base::mesh().add_property( quadrics_ );
@@ -116,10 +135,16 @@ public: // inherited
 
     typedef Geometry::QuadricT<double> Q;
 
-    Q q = Base::mesh().property(quadrics_, _ci.v0);
-    q += Base::mesh().property(quadrics_, _ci.v1);
+    double err;
+    if (attributes_.empty())
+    {
+      Q q = Base::mesh().property(quadrics_, _ci.v0);
+      q += Base::mesh().property(quadrics_, _ci.v1);
 
-    double err = q(_ci.p1);
+      err = q(_ci.p1);
+    }
+    else
+      err = attribute_error(_ci, vector_cast<Vec3d>(_ci.p1), nullptr);
 
     //min_ = std::min(err, min_);
     //max_ = std::max(err, max_);
@@ -129,12 +154,35 @@ public: // inherited
     return float( (err < max_err_) ? err : float( Base::ILLEGAL_COLLAPSE ) );
   }
 
+  /// The priority and the placement only read the quadrics
+  bool is_concurrent() const override { return true; }
+
+  /** Move the remaining vertex to the position minimizing the quadric
+   *  error, if set_optimal_placement() is enabled.
+   *
+   *  Falls back to the best of the end points and the edge midpoint if the
+   *  quadric is singular or its minimum is farther away from the midpoint
+   *  than the edge is long. Boundary, locked and feature vertices keep
+   *  their position.
+   */
+  void place_vertex(CollapseInfo& _ci) override;
+
+  /// Pre-process halfedge collapse (set the attributes of the remaining vertex)
+  virtual void preprocess_collapse(const CollapseInfo& _ci) override;
 
   /// Post-process halfedge collapse (accumulate quadrics)
   virtual void postprocess_collapse(const CollapseInfo& _ci) override
   {
     Base::mesh().property(quadrics_, _ci.v1) +=
       Base::mesh().property(quadrics_, _ci.v0);
+
+    if (!attributes_.empty())
+    {
+      double*       q1 = gquadric(_ci.v1);
+      const double* q0 = gquadric(_ci.v0);
+      for (size_t i = 0; i < stride_; ++i)
+        q1[i] += q0[i];
+    }
   }
 
   /// set the percentage of maximum quadric error
@@ -167,12 +215,154 @@ public: // specific methods
   /// Return value of max. allowed error.
   double max_err() const { return max_err_; }
 
+  /** Move the remaining vertex of a collapse to the position minimizing
+   *  the quadric error instead of keeping its position.
+   *  \note A progressive mesh written by ModProgMeshT then restores the
+   *  connectivity exactly, but not the original positions of the
+   *  vertices kept by collapses.
+   */
+  void set_optimal_placement(bool _b) { optimal_placement_ = _b; }
+
+  /// Is optimal placement enabled? \see set_optimal_placement()
+  bool optimal_placement() const { return optimal_placement_; }
+
+  /** Add the vertex property \c _ph to the error quadrics.
+   *
+   *  The values are scaled by \c _weight, which relates the attribute
+   *  error to the squared geometric distance, e.g. with a weight of 1 a
+   *  texture coordinate difference of 0.1 counts like a distance of 0.1.
+   *  \c T has to be a vector type, integral components (colors) are
+   *  rounded and clamped when written. Attributes stored in the vertex
+   *  normals of the mesh are normalized.
+   *
+   *  Attributes have to be added before the decimater is initialized. All
+   *  attributes together may have at most MAX_ATTRIBUTE_DIM components,
+   *  further attributes are ignored.
+   */
+  template <class T>
+  void add_attribute(VPropHandleT<T> _ph, double _weight = 1.0)
+  {
+    typedef vector_traits<T> Traits;
+    typedef typename Traits::value_type Scalar;
+
+    assert(_weight > 0.0);
+
+    size_t dim = Traits::size_;
+    for (const Attribute& a : attributes_)
+      dim += a.dim;
+    if (dim > MAX_ATTRIBUTE_DIM)
+    {
+      omerr() << "[ModQuadric] : attribute ignored, more than "
+              << int(MAX_ATTRIBUTE_DIM) << " attribute components" << std::endl;
+      return;
+    }
+
+    Mesh& mesh = Base::mesh();
+    const bool normalize = mesh.has_vertex_normals() &&
+                           _ph.idx() == mesh.vertex_normals_pph().idx();
+
+    Attribute a;
+    a.dim = Traits::size_;
+    a.get = [&mesh, _ph, _weight](typename Mesh::VertexHandle _vh, double* _x)
+    {
+      const T& v = mesh.property(_ph, _vh);
+      for (size_t i = 0; i < Traits::size_; ++i)
+        _x[i] = _weight * double(v[i]);
+    };
+    a.set = [&mesh, _ph, _weight, normalize](typename Mesh::VertexHandle _vh, const double* _x)
+    {
+      double y[Traits::size_];
+      double l = 0.0;
+      for (size_t i = 0; i < Traits::size_; ++i)
+      {
+        y[i] = _x[i] / _weight;
+        l += y[i] * y[i];
+      }
+      if (normalize && l > 0.0)
+        for (size_t i = 0; i < Traits::size_; ++i)
+          y[i] /= std::sqrt(l);
+
+      T& v = mesh.property(_ph, _vh);
+      for (size_t i = 0; i < Traits::size_; ++i)
+      {
+        if (std::is_integral<Scalar>::value)
+        {
+          y[i] = std::round(y[i]);
+          y[i] = std::max(y[i], double(std::numeric_limits<Scalar>::lowest()));
+          y[i] = std::min(y[i], double(std::numeric_limits<Scalar>::max()));
+        }
+        v[i] = static_cast<Scalar>(y[i]);
+      }
+    };
+    attributes_.push_back(a);
+  }
+
+  /// Remove all attributes added by add_attribute()
+  void clear_attributes() { attributes_.clear(); }
+
+  /// Number of attributes added by add_attribute()
+  size_t n_attributes() const { return attributes_.size(); }
+
+  /// Maximal number of components of all attributes together
+  enum { MAX_ATTRIBUTE_DIM = 13 };
+
+
+private:
+
+  // The generalized quadrics are evaluated in buffers on the stack, sized
+  // for the maximal dimension (position and attributes) and coefficients.
+  enum {
+    MAX_DIM    = 3 + MAX_ATTRIBUTE_DIM,
+    MAX_STRIDE = MAX_DIM * (MAX_DIM + 1) / 2 + MAX_DIM + 1
+  };
+
+  /// Read and write the weighted values of an attribute
+  struct Attribute
+  {
+    size_t dim;
+    std::function<void(typename Mesh::VertexHandle, double*)>       get;
+    std::function<void(typename Mesh::VertexHandle, const double*)> set;
+  };
+
+  /// Generalized quadric of v0 and v1 (packed, see initialize())
+  void sum_quadrics(const CollapseInfo& _ci, double* _q);
+
+  /// Generalized quadric of _vh (packed, see initialize())
+  double* gquadric(typename Mesh::VertexHandle _vh)
+  { return gquadrics_.data() + _vh.idx() * stride_; }
+
+  /// Weighted attribute values of _vh
+  void get_attributes(typename Mesh::VertexHandle _vh, double* _x) const;
+
+  /** Error of placing the remaining vertex at _p, with the attributes
+   *  chosen to minimize it. Stores the attributes in _attributes if not null.
+   */
+  double attribute_error(const CollapseInfo& _ci, const Vec3d& _p, double* _attributes);
+
+  /// Error of placing the remaining vertex at _p
+  double placement_error(const CollapseInfo& _ci, const Vec3d& _p);
+
+  /// Solve the _n x _n system _m x = _rhs in place. Returns false if it is (nearly) singular.
+  static bool solve(size_t _n, double* _m, double* _rhs);
 
 private:
 
   // maximum quadric error
   double max_err_;
 
+  // move the remaining vertex
+  bool optimal_placement_;
+
+  // attributes, dimension of the generalized quadrics and the number of
+  // their coefficients
+  std::vector<Attribute> attributes_;
+  size_t                 dim_;
+  size_t                 stride_;
+
+  // generalized quadric of each vertex while attributes are set, stride_
+  // coefficients per vertex in one array
+  std::vector<double>                         gquadrics_;
+
   // this vertex property stores a quadric for each vertex
   VPropHandleT< Geometry::QuadricT<double> >  quadrics_;
 };
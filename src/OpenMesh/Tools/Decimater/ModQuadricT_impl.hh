@@ -56,6 +56,7 @@
 //== INCLUDES =================================================================
 
 #include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
+#include <algorithm>
 
 
 //== NAMESPACE ===============================================================
@@ -128,6 +129,317 @@ initialize()
     Base::mesh().property(quadrics_, vh1) += q;
     Base::mesh().property(quadrics_, vh2) += q;
   }
+
+  // generalized quadrics
+  dim_ = 3;
+  for (const Attribute& a : attributes_)
+    dim_ += a.dim;
+  stride_ = 0;
+
+  if (attributes_.empty())
+  {
+    std::vector<double>().swap(gquadrics_);
+    return;
+  }
+
+  // Per vertex: the upper triangle of A row by row, b and c with the
+  // error x^T A x + 2 b^T x + c of x = (position, weighted attributes).
+  const size_t n = dim_;
+  stride_ = n * (n + 1) / 2 + n + 1;
+  gquadrics_.assign(Base::mesh().n_vertices() * stride_, 0.0);
+
+  std::vector<double> x[3], e1(n), e2(n), q(stride_);
+  for (auto& xi : x)
+    xi.resize(n);
+
+  for (auto fh : Base::mesh().faces())
+  {
+    typename Mesh::VertexHandle vh[3];
+    int i = 0;
+    for (auto fv : Base::mesh().fv_range(fh))
+      vh[i++] = fv;
+
+    for (int k = 0; k < 3; ++k)
+    {
+      const Vec3d p = vector_cast<Vec3d>(Base::mesh().point(vh[k]));
+      std::copy(p.data(), p.data() + 3, x[k].begin());
+      get_attributes(vh[k], x[k].data() + 3);
+    }
+
+    // orthonormal basis e1, e2 of the triangle in R^n
+    double l1 = 0.0, l2 = 0.0, d = 0.0;
+    for (size_t j = 0; j < n; ++j)
+    {
+      e1[j] = x[1][j] - x[0][j];
+      l1 += e1[j] * e1[j];
+    }
+    if (l1 <= DBL_MIN)
+      continue;
+    for (size_t j = 0; j < n; ++j)
+    {
+      e1[j] /= std::sqrt(l1);
+      e2[j] = x[2][j] - x[0][j];
+      d += e1[j] * e2[j];
+    }
+    for (size_t j = 0; j < n; ++j)
+    {
+      e2[j] -= d * e1[j];
+      l2 += e2[j] * e2[j];
+    }
+    if (l2 <= DBL_MIN)
+      continue;
+    for (size_t j = 0; j < n; ++j)
+      e2[j] /= std::sqrt(l2);
+
+    // area weighted, like the geometric quadrics
+    const Vec3d p0 = vector_cast<Vec3d>(Base::mesh().point(vh[0]));
+    const double area = 0.5 * ((vector_cast<Vec3d>(Base::mesh().point(vh[1])) - p0) %
+                               (vector_cast<Vec3d>(Base::mesh().point(vh[2])) - p0)).norm();
+
+    // A = I - e1 e1^T - e2 e2^T, b = (p.e1) e1 + (p.e2) e2 - p,
+    // c = p.p - (p.e1)^2 - (p.e2)^2
+    double pe1 = 0.0, pe2 = 0.0, pp = 0.0;
+    for (size_t j = 0; j < n; ++j)
+    {
+      pe1 += x[0][j] * e1[j];
+      pe2 += x[0][j] * e2[j];
+      pp  += x[0][j] * x[0][j];
+    }
+
+    double* qa = q.data();
+    for (size_t r = 0; r < n; ++r)
+      for (size_t c = r; c < n; ++c)
+        *qa++ = area * ((r == c ? 1.0 : 0.0) - e1[r] * e1[c] - e2[r] * e2[c]);
+    for (size_t r = 0; r < n; ++r)
+      *qa++ = area * (pe1 * e1[r] + pe2 * e2[r] - x[0][r]);
+    *qa = area * (pp - pe1 * pe1 - pe2 * pe2);
+
+    for (int k = 0; k < 3; ++k)
+    {
+      double* qv = gquadric(vh[k]);
+      for (size_t j = 0; j < stride_; ++j)
+        qv[j] += q[j];
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+template<class MeshT>
+void ModQuadricT<MeshT>::place_vertex(CollapseInfo& _ci)
+{
+  if (!optimal_placement_)
+    return;
+
+  Mesh& mesh = Base::mesh();
+  if (mesh.is_boundary(_ci.v1) ||
+      mesh.status(_ci.v1).locked() || mesh.status(_ci.v1).feature() ||
+      mesh.status(_ci.v0).feature())
+    return;
+
+  const size_t n = dim_;
+  double m[MAX_DIM * MAX_DIM], rhs[MAX_DIM];
+
+  // A x = -b
+  if (attributes_.empty())
+  {
+    Geometry::QuadricT<double> q = mesh.property(quadrics_, _ci.v0);
+    q += mesh.property(quadrics_, _ci.v1);
+
+    m[0] = q.a(); m[1] = q.b(); m[2] = q.c();
+    m[3] = q.b(); m[4] = q.e(); m[5] = q.f();
+    m[6] = q.c(); m[7] = q.f(); m[8] = q.h();
+    rhs[0] = -q.d(); rhs[1] = -q.g(); rhs[2] = -q.i();
+  }
+  else
+  {
+    double q[MAX_STRIDE];
+    sum_quadrics(_ci, q);
+
+    const double* qa = q;
+    for (size_t r = 0; r < n; ++r)
+      for (size_t c = r; c < n; ++c, ++qa)
+        m[r * n + c] = m[c * n + r] = *qa;
+    for (size_t r = 0; r < n; ++r)
+      rhs[r] = -*qa++;
+  }
+
+  const Vec3d p0 = vector_cast<Vec3d>(_ci.p0);
+  const Vec3d p1 = vector_cast<Vec3d>(_ci.p1);
+  const Vec3d mid = (p0 + p1) * 0.5;
+
+  const bool ok = solve(n, m, rhs);
+  Vec3d p(rhs[0], rhs[1], rhs[2]);
+
+  if (!ok || (p - mid).sqrnorm() > (p1 - p0).sqrnorm())
+  {
+    // choose the best of the end points and the midpoint
+    p = p1;
+    double err = placement_error(_ci, p1);
+    for (const Vec3d& c : { mid, p0 })
+    {
+      const double e = placement_error(_ci, c);
+      if (e < err)
+      {
+        err = e;
+        p = c;
+      }
+    }
+  }
+
+  _ci.p1 = vector_cast<typename Mesh::Point>(p);
+}
+
+//-----------------------------------------------------------------------------
+
+template<class MeshT>
+void ModQuadricT<MeshT>::preprocess_collapse(const CollapseInfo& _ci)
+{
+  if (attributes_.empty())
+    return;
+
+  double a[MAX_ATTRIBUTE_DIM];
+  attribute_error(_ci, vector_cast<Vec3d>(_ci.p1), a);
+
+  const double* x = a;
+  for (const Attribute& attr : attributes_)
+  {
+    attr.set(_ci.v1, x);
+    x += attr.dim;
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+template<class MeshT>
+void ModQuadricT<MeshT>::sum_quadrics(const CollapseInfo& _ci, double* _q)
+{
+  const double* q0 = gquadric(_ci.v0);
+  const double* q1 = gquadric(_ci.v1);
+  for (size_t i = 0; i < stride_; ++i)
+    _q[i] = q0[i] + q1[i];
+}
+
+//-----------------------------------------------------------------------------
+
+template<class MeshT>
+void ModQuadricT<MeshT>::get_attributes(typename Mesh::VertexHandle _vh, double* _x) const
+{
+  for (const Attribute& a : attributes_)
+  {
+    a.get(_vh, _x);
+    _x += a.dim;
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+template<class MeshT>
+double ModQuadricT<MeshT>::attribute_error(const CollapseInfo& _ci, const Vec3d& _p,
+                                           double* _attributes)
+{
+  const size_t n = dim_;
+  const size_t m = n - 3;
+
+  double q[MAX_STRIDE], x[MAX_DIM], ma[MAX_ATTRIBUTE_DIM * MAX_ATTRIBUTE_DIM], rhs[MAX_ATTRIBUTE_DIM];
+  sum_quadrics(_ci, q);
+  std::fill(rhs, rhs + m, 0.0);
+
+  // split A into the position rows 0..2 and the attribute rows 3..n-1 and
+  // minimize over the attributes: A_aa a = -(b_a + A_ap p)
+  const double* qa = q;
+  for (size_t r = 0; r < n; ++r)
+    for (size_t c = r; c < n; ++c, ++qa)
+    {
+      if (r >= 3)
+        ma[(r - 3) * m + (c - 3)] = ma[(c - 3) * m + (r - 3)] = *qa;
+      else if (c >= 3)
+        rhs[c - 3] -= *qa * _p[r];
+    }
+  const double* b = qa;
+  for (size_t r = 3; r < n; ++r)
+    rhs[r - 3] -= b[r];
+
+  std::copy(_p.data(), _p.data() + 3, x);
+  if (solve(m, ma, rhs))
+    std::copy(rhs, rhs + m, x + 3);
+  else
+    get_attributes(_ci.v1, x + 3);
+
+  if (_attributes)
+    std::copy(x + 3, x + n, _attributes);
+
+  // x^T A x + 2 b^T x + c
+  double err = 0.0;
+  qa = q;
+  for (size_t r = 0; r < n; ++r)
+    for (size_t c = r; c < n; ++c, ++qa)
+      err += (r == c ? 1.0 : 2.0) * *qa * x[r] * x[c];
+  for (size_t r = 0; r < n; ++r)
+    err += 2.0 * b[r] * x[r];
+  err += b[n];
+
+  return std::max(err, 0.0);
+}
+
+//-----------------------------------------------------------------------------
+
+template<class MeshT>
+double ModQuadricT<MeshT>::placement_error(const CollapseInfo& _ci, const Vec3d& _p)
+{
+  if (!attributes_.empty())
+    return attribute_error(_ci, _p, nullptr);
+
+  Geometry::QuadricT<double> q = Base::mesh().property(quadrics_, _ci.v0);
+  q += Base::mesh().property(quadrics_, _ci.v1);
+  return q(_p);
+}
+
+//-----------------------------------------------------------------------------
+
+template<class MeshT>
+bool ModQuadricT<MeshT>::solve(size_t _n, double* _m, double* _rhs)
+{
+  // Gaussian elimination with partial pivoting
+  double scale = 0.0;
+  for (size_t i = 0; i < _n * _n; ++i)
+    scale = std::max(scale, std::abs(_m[i]));
+  if (scale == 0.0)
+    return false;
+
+  for (size_t k = 0; k < _n; ++k)
+  {
+    size_t pivot = k;
+    for (size_t r = k + 1; r < _n; ++r)
+      if (std::abs(_m[r * _n + k]) > std::abs(_m[pivot * _n + k]))
+        pivot = r;
+
+    if (std::abs(_m[pivot * _n + k]) <= 1e-10 * scale)
+      return false;
+
+    if (pivot != k)
+    {
+      std::swap_ranges(_m + k * _n, _m + (k + 1) * _n, _m + pivot * _n);
+      std::swap(_rhs[k], _rhs[pivot]);
+    }
+
+    for (size_t r = k + 1; r < _n; ++r)
+    {
+      const double f = _m[r * _n + k] / _m[k * _n + k];
+      for (size_t c = k; c < _n; ++c)
+        _m[r * _n + c] -= f * _m[k * _n + c];
+      _rhs[r] -= f * _rhs[k];
+    }
+  }
+
+  for (size_t k = _n; k-- > 0;)
+  {
+    for (size_t c = k + 1; c < _n; ++c)
+      _rhs[k] -= _m[k * _n + c] * _rhs[c];
+    _rhs[k] /= _m[k * _n + k];
+  }
+
+  return true;
 }
 
 //-----------------------------------------------------------------------------
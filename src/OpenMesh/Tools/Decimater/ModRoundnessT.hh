@@ -173,6 +173,9 @@ class ModRoundnessT : public ModBaseT<MeshT>
     return (float) priority;
   }
 
+  /// The priority only reads the mesh
+  bool is_concurrent() const override { return true; }
+
   /// set the percentage of minimum roundness
   void set_error_tolerance_factor(double _factor) override {
     if (this->is_binary()) {
@@ -0,0 +1,1035 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+//=============================================================================
+//
+//  CLASS OutOfCoreDecimater - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Tools/Decimater/OutOfCoreDecimater.hh>
+#include <OpenMesh/Tools/Decimater/DecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/ModNormalFlippingT.hh>
+#include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
+#include <OpenMesh/Core/IO/MeshIO.hh>
+#include <OpenMesh/Core/IO/exporter/BaseExporter.hh>
+#include <OpenMesh/Core/IO/importer/BaseImporter.hh>
+#include <OpenMesh/Core/Mesh/TriMesh_ArrayKernelT.hh>
+#include <OpenMesh/Core/System/omstream.hh>
+#include <OpenMesh/Core/Utils/BitOps.hh>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+
+//== NAMESPACE ================================================================
+
+namespace OpenMesh  {
+namespace Decimater {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+namespace {
+
+typedef TriMesh_ArrayKernelT<> Mesh;
+
+/// Triangle record of the temporary files, vertices are identified by the
+/// index they have in the input file
+struct Triangle
+{
+  int   id[3];
+  Vec3f p[3];
+};
+
+//-----------------------------------------------------------------------------
+
+/// Temporary file of triangles, removed on destruction
+class TriangleFile
+{
+public:
+
+  explicit TriangleFile(const std::string& _name)
+    : name_(_name)
+  {
+    clear();
+  }
+
+  ~TriangleFile()
+  {
+    file_.close();
+    std::remove(name_.c_str());
+  }
+
+  bool good() const { return file_.good(); }
+
+  /// Number of triangles
+  size_t size() const { return size_; }
+
+  /// Bounding box and largest vertex id of the appended triangles
+  const Vec3f& bbox_min() const { return bbox_min_; }
+  const Vec3f& bbox_max() const { return bbox_max_; }
+  int max_id() const { return max_id_; }
+
+  /// Remove all triangles
+  void clear()
+  {
+    file_.close();
+    file_.clear();
+    file_.open(name_.c_str(), std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    buffer_.clear();
+    size_ = 0;
+    bbox_min_ = Vec3f(FLT_MAX, FLT_MAX, FLT_MAX);
+    bbox_max_ = Vec3f(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    max_id_ = -1;
+  }
+
+  /// Append a triangle, call flush() before reading
+  void append(const Triangle& _t)
+  {
+    for (int k = 0; k < 3; ++k)
+    {
+      bbox_min_.minimize(_t.p[k]);
+      bbox_max_.maximize(_t.p[k]);
+      max_id_ = std::max(max_id_, _t.id[k]);
+    }
+    buffer_.push_back(_t);
+    ++size_;
+    if (buffer_.size() >= 4096)
+      flush();
+  }
+
+  /// Write the appended triangles
+  bool flush()
+  {
+    if (!buffer_.empty())
+    {
+      write(size_ - buffer_.size(), buffer_.data(), buffer_.size());
+      buffer_.clear();
+    }
+    return good();
+  }
+
+  /// Write _n triangles at position _pos, does not update the statistics
+  void write(size_t _pos, const Triangle* _t, size_t _n)
+  {
+    file_.seekp(std::streamoff(_pos) * std::streamoff(sizeof(Triangle)));
+    file_.write(reinterpret_cast<const char*>(_t), std::streamsize(_n * sizeof(Triangle)));
+  }
+
+  /// Read _n triangles starting at position _pos
+  bool read(size_t _pos, size_t _n, std::vector<Triangle>& _t)
+  {
+    _t.resize(_n);
+    file_.seekg(std::streamoff(_pos) * std::streamoff(sizeof(Triangle)));
+    file_.read(reinterpret_cast<char*>(_t.data()), std::streamsize(_n * sizeof(Triangle)));
+    return good();
+  }
+
+  /// Set the number of triangles written with write()
+  void set_size(size_t _n) { size_ = _n; }
+
+private:
+
+  std::string           name_;
+  std::fstream          file_;
+  std::vector<Triangle> buffer_;
+  size_t                size_;
+  Vec3f                 bbox_min_, bbox_max_;
+  int                   max_id_;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Temporary file of vertex positions, only a few pages of positions are
+/// held in memory. Readers usually refer to vertices close to each other,
+/// so the pages are replaced rarely.
+class PointFile
+{
+public:
+
+  explicit PointFile(const std::string& _name)
+    : name_(_name),
+      file_(_name.c_str(), std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc),
+      size_(0),
+      n_stored_(0),
+      time_(0),
+      pages_(N_PAGES)
+  {
+  }
+
+  ~PointFile()
+  {
+    file_.close();
+    std::remove(name_.c_str());
+  }
+
+  bool good() const { return file_.good(); }
+
+  /// Number of positions
+  size_t size() const { return size_; }
+
+  /// Append a position
+  void push_back(const Vec3f& _p)
+  {
+    ++size_;
+    set(size_ - 1, _p);
+  }
+
+  /// Set the number of positions, new positions have to be set() before
+  /// they are read
+  void resize(size_t _n) { size_ = _n; }
+
+  /// Read and write the position _i
+  const Vec3f& get(size_t _i) { return page(_i / PAGE_SIZE).data[_i % PAGE_SIZE]; }
+  void set(size_t _i, const Vec3f& _p)
+  {
+    Page& p = page(_i / PAGE_SIZE);
+    p.data[_i % PAGE_SIZE] = _p;
+    p.dirty = true;
+  }
+
+private:
+
+  enum { PAGE_SIZE = 1 << 16, N_PAGES = 16 };
+
+  struct Page
+  {
+    Page() : index(size_t(-1)), dirty(false), last_use(0) {}
+
+    size_t             index;
+    std::vector<Vec3f> data;
+    bool               dirty;
+    size_t             last_use;
+  };
+
+  /// Page _index, the least recently used page is written back and replaced
+  Page& page(size_t _index)
+  {
+    Page* p = &pages_[0];
+    for (Page& q : pages_)
+    {
+      if (q.index == _index)
+      {
+        q.last_use = ++time_;
+        return q;
+      }
+      if (q.last_use < p->last_use)
+        p = &q;
+    }
+
+    if (p->dirty)
+    {
+      const size_t n = std::min<size_t>(PAGE_SIZE, size_ - p->index * PAGE_SIZE);
+      file_.seekp(std::streamoff(p->index) * std::streamoff(PAGE_SIZE * sizeof(Vec3f)));
+      file_.write(reinterpret_cast<const char*>(p->data.data()), std::streamsize(n * sizeof(Vec3f)));
+      n_stored_ = std::max(n_stored_, p->index * PAGE_SIZE + n);
+    }
+
+    p->index    = _index;
+    p->dirty    = false;
+    p->last_use = ++time_;
+    p->data.resize(PAGE_SIZE);
+
+    const size_t first = _index * PAGE_SIZE;
+    if (first < n_stored_)
+    {
+      const size_t n = std::min<size_t>(PAGE_SIZE, n_stored_ - first);
+      file_.seekg(std::streamoff(first) * std::streamoff(sizeof(Vec3f)));
+      file_.read(reinterpret_cast<char*>(p->data.data()), std::streamsize(n * sizeof(Vec3f)));
+    }
+    return *p;
+  }
+
+private:
+
+  std::string       name_;
+  std::fstream      file_;
+  size_t            size_;
+  size_t            n_stored_;
+  size_t            time_;
+  std::vector<Page> pages_;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Importer storing the vertex positions in a PointFile and writing the
+/// (triangulated) faces to a TriangleFile instead of building a mesh
+class TriangleImporter : public IO::BaseImporter
+{
+public:
+
+  TriangleImporter(PointFile& _points, TriangleFile& _file) : points_(_points), file_(_file) {}
+
+  VertexHandle add_vertex(const Vec3f& _point) override
+  {
+    points_.push_back(_point);
+    return VertexHandle(static_cast<int>(points_.size() - 1));
+  }
+
+  VertexHandle add_vertex() override { return add_vertex(Vec3f(0, 0, 0)); }
+
+  FaceHandle add_face(const VHandles& _indices) override
+  {
+    for (const VertexHandle& vh : _indices)
+      if (vh.idx() < 0 || size_t(vh.idx()) >= points_.size())
+        return FaceHandle();
+
+    // fan triangulation, degenerated triangles are skipped
+    for (size_t i = 1; i + 1 < _indices.size(); ++i)
+    {
+      const VertexHandle vh[3] = { _indices[0], _indices[i], _indices[i + 1] };
+      if (vh[0] == vh[1] || vh[1] == vh[2] || vh[2] == vh[0])
+        continue;
+
+      Triangle t;
+      for (int k = 0; k < 3; ++k)
+      {
+        t.id[k] = vh[k].idx();
+        t.p[k]  = points_.get(vh[k].idx());
+      }
+      file_.append(t);
+    }
+    return FaceHandle(static_cast<int>(file_.size()) - 1);
+  }
+
+  void set_point(VertexHandle _vh, const Vec3f& _point) override { points_.set(_vh.idx(), _point); }
+
+  size_t n_vertices() const override { return points_.size(); }
+  size_t n_faces()    const override { return file_.size(); }
+  size_t n_edges()    const override { return 0; }
+
+  bool is_triangle_mesh() const override { return true; }
+
+  // connectivity and attributes are not streamed
+  HalfedgeHandle add_edge(VertexHandle, VertexHandle) override { return HalfedgeHandle(); }
+  FaceHandle add_face(HalfedgeHandle) override { return FaceHandle(); }
+  void add_face_texcoords(FaceHandle, VertexHandle, const std::vector<Vec2f>&) override {}
+  void add_face_texcoords(FaceHandle, VertexHandle, const std::vector<Vec3f>&) override {}
+  void set_face_texindex(FaceHandle, int) override {}
+  void set_halfedge(VertexHandle, HalfedgeHandle) override {}
+  void set_normal(VertexHandle, const Vec3f&) override {}
+  void set_normal(VertexHandle, const Vec3d&) override {}
+  void set_color(VertexHandle, const Vec3uc&) override {}
+  void set_color(VertexHandle, const Vec4uc&) override {}
+  void set_color(VertexHandle, const Vec3f&) override {}
+  void set_color(VertexHandle, const Vec4f&) override {}
+  void set_texcoord(VertexHandle, const Vec2f&) override {}
+  void set_status(VertexHandle, const Attributes::StatusInfo&) override {}
+  void set_next(HalfedgeHandle, HalfedgeHandle) override {}
+  void set_face(HalfedgeHandle, FaceHandle) override {}
+  void request_face_texcoords2D() override {}
+  void set_texcoord(HalfedgeHandle, const Vec2f&) override {}
+  void set_texcoord(VertexHandle, const Vec3f&) override {}
+  void set_texcoord(HalfedgeHandle, const Vec3f&) override {}
+  void set_status(HalfedgeHandle, const Attributes::StatusInfo&) override {}
+  void set_color(EdgeHandle, const Vec3uc&) override {}
+  void set_color(EdgeHandle, const Vec4uc&) override {}
+  void set_color(EdgeHandle, const Vec3f&) override {}
+  void set_color(EdgeHandle, const Vec4f&) override {}
+  void set_status(EdgeHandle, const Attributes::StatusInfo&) override {}
+  void set_normal(FaceHandle, const Vec3f&) override {}
+  void set_normal(FaceHandle, const Vec3d&) override {}
+  void set_color(FaceHandle, const Vec3uc&) override {}
+  void set_color(FaceHandle, const Vec4uc&) override {}
+  void set_color(FaceHandle, const Vec3f&) override {}
+  void set_color(FaceHandle, const Vec4f&) override {}
+  void set_status(FaceHandle, const Attributes::StatusInfo&) override {}
+  void add_texture_information(int, std::string) override {}
+
+private:
+
+  PointFile&    points_;
+  TriangleFile& file_;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Set of input vertex ids stored with one bit per id. After
+/// update_ranks(), rank() numbers the vertices of the set consecutively.
+class VertexSet
+{
+public:
+
+  explicit VertexSet(size_t _n) : words_((_n + 63) / 64, 0) {}
+
+  void insert(int _id) { words_[size_t(_id) / 64] |= uint64_t(1) << (_id % 64); }
+
+  /// Number of vertices
+  size_t size() const { return Utils::popcount(words_.data(), words_.size()); }
+
+  /// Count the vertices before every block of words
+  void update_ranks()
+  {
+    ranks_.resize(words_.size() / WORDS_PER_RANK + 1);
+    size_t n = 0;
+    for (size_t i = 0; i < words_.size(); ++i)
+    {
+      if (i % WORDS_PER_RANK == 0)
+        ranks_[i / WORDS_PER_RANK] = n;
+      n += Utils::popcount(words_[i]);
+    }
+  }
+
+  /// Number of vertices in the set with a smaller id than _id
+  int rank(int _id) const
+  {
+    const size_t word = size_t(_id) / 64;
+    size_t n = ranks_[word / WORDS_PER_RANK];
+    for (size_t i = word - word % WORDS_PER_RANK; i < word; ++i)
+      n += Utils::popcount(words_[i]);
+    return int(n + Utils::popcount(words_[word] & ((uint64_t(1) << (_id % 64)) - 1)));
+  }
+
+private:
+
+  enum { WORDS_PER_RANK = 8 };
+
+  std::vector<uint64_t> words_;
+  std::vector<size_t>   ranks_;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Exporter passing the triangles of a TriangleFile to the writers without
+/// building a mesh. The vertices are numbered by VertexSet::rank(), their
+/// positions are read from a PointFile. Only positions and faces are
+/// exported.
+class TriangleExporter : public IO::BaseExporter
+{
+public:
+
+  TriangleExporter(PointFile& _points, TriangleFile& _file, const VertexSet& _vertices)
+    : points_(_points), file_(_file), vertices_(_vertices),
+      n_vertices_(_vertices.size()), first_(0)
+  {}
+
+  Vec3f point(VertexHandle _vh)  const override { return points_.get(_vh.idx()); }
+  Vec3d pointd(VertexHandle _vh) const override { return vector_cast<Vec3d>(point(_vh)); }
+  bool  is_point_double()        const override { return false; }
+
+  unsigned int get_vhandles(FaceHandle _fh, std::vector<VertexHandle>& _vhandles) const override
+  {
+    const Triangle& t = triangle(_fh.idx());
+    _vhandles.resize(3);
+    for (int k = 0; k < 3; ++k)
+      _vhandles[k] = VertexHandle(vertices_.rank(t.id[k]));
+    return 3;
+  }
+
+  bool triangle_indices(size_t _first, size_t _n, int* _out) const override
+  {
+    for (size_t i = 0; i < _n; ++i, _out += 3)
+    {
+      const Triangle& t = triangle(_first + i);
+      for (int k = 0; k < 3; ++k)
+        _out[k] = vertices_.rank(t.id[k]);
+    }
+    return true;
+  }
+
+  size_t n_vertices() const override { return n_vertices_; }
+  size_t n_faces()    const override { return file_.size(); }
+  size_t n_edges()    const override { return 0; }
+
+  bool is_triangle_mesh() const override { return true; }
+
+  // no attributes
+  Vec3f  normal(VertexHandle)   const override { return Vec3f(0, 0, 0); }
+  Vec3d  normald(VertexHandle)  const override { return Vec3d(0, 0, 0); }
+  bool   is_normal_double()     const override { return false; }
+  Vec3uc color(VertexHandle)    const override { return Vec3uc(0, 0, 0); }
+  Vec4uc colorA(VertexHandle)   const override { return Vec4uc(0, 0, 0, 0); }
+  Vec3ui colori(VertexHandle)   const override { return Vec3ui(0, 0, 0); }
+  Vec4ui colorAi(VertexHandle)  const override { return Vec4ui(0, 0, 0, 0); }
+  Vec3f  colorf(VertexHandle)   const override { return Vec3f(0, 0, 0); }
+  Vec4f  colorAf(VertexHandle)  const override { return Vec4f(0, 0, 0, 0); }
+  Vec2f  texcoord(VertexHandle) const override { return Vec2f(0, 0); }
+  Vec2f  texcoord(HalfedgeHandle) const override { return Vec2f(0, 0); }
+  Attributes::StatusInfo status(VertexHandle) const override { return Attributes::StatusInfo(); }
+
+  HalfedgeHandle getHeh(FaceHandle, VertexHandle) const override { return HalfedgeHandle(); }
+  unsigned int get_face_texcoords(std::vector<Vec2f>& _texcoords) const override { _texcoords.clear(); return 0; }
+  Vec3f  normal(FaceHandle)     const override { return Vec3f(0, 0, 0); }
+  Vec3d  normald(FaceHandle)    const override { return Vec3d(0, 0, 0); }
+  Vec3uc color(FaceHandle)      const override { return Vec3uc(0, 0, 0); }
+  Vec4uc colorA(FaceHandle)     const override { return Vec4uc(0, 0, 0, 0); }
+  Vec3ui colori(FaceHandle)     const override { return Vec3ui(0, 0, 0); }
+  Vec4ui colorAi(FaceHandle)    const override { return Vec4ui(0, 0, 0, 0); }
+  Vec3f  colorf(FaceHandle)     const override { return Vec3f(0, 0, 0); }
+  Vec4f  colorAf(FaceHandle)    const override { return Vec4f(0, 0, 0, 0); }
+  Attributes::StatusInfo status(FaceHandle) const override { return Attributes::StatusInfo(); }
+
+  Vec3uc color(EdgeHandle)      const override { return Vec3uc(0, 0, 0); }
+  Vec4uc colorA(EdgeHandle)     const override { return Vec4uc(0, 0, 0, 0); }
+  Vec3ui colori(EdgeHandle)     const override { return Vec3ui(0, 0, 0); }
+  Vec4ui colorAi(EdgeHandle)    const override { return Vec4ui(0, 0, 0, 0); }
+  Vec3f  colorf(EdgeHandle)     const override { return Vec3f(0, 0, 0); }
+  Vec4f  colorAf(EdgeHandle)    const override { return Vec4f(0, 0, 0, 0); }
+  Attributes::StatusInfo status(EdgeHandle) const override { return Attributes::StatusInfo(); }
+
+  // connectivity is not exported
+  int get_halfedge_id(VertexHandle) override { return -1; }
+  int get_halfedge_id(FaceHandle) override { return -1; }
+  int get_next_halfedge_id(HalfedgeHandle) override { return -1; }
+  int get_to_vertex_id(HalfedgeHandle) override { return -1; }
+  int get_face_id(HalfedgeHandle) override { return -1; }
+  Attributes::StatusInfo status(HalfedgeHandle) const override { return Attributes::StatusInfo(); }
+
+private:
+
+  /// Triangle _i, read in chunks
+  const Triangle& triangle(size_t _i) const
+  {
+    if (_i < first_ || _i >= first_ + chunk_.size())
+    {
+      first_ = _i;
+      file_.read(_i, std::min<size_t>(4096, file_.size() - _i), chunk_);
+    }
+    return chunk_[_i - first_];
+  }
+
+private:
+
+  PointFile&       points_;
+  TriangleFile&    file_;
+  const VertexSet& vertices_;
+  size_t           n_vertices_;
+
+  mutable size_t                first_;
+  mutable std::vector<Triangle> chunk_;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Build a mesh from triangles, _ids receives the id of each vertex.
+/// Corners of faces that cannot be added (complex edges) are duplicated
+/// and locked, like the IO importer does. The status is requested here so
+/// that deleted elements stay marked after the decimater is gone.
+void build_mesh(const std::vector<Triangle>& _triangles, Mesh& _mesh, std::vector<int>& _ids)
+{
+  _mesh.request_vertex_status();
+  _mesh.request_edge_status();
+  _mesh.request_face_status();
+  _ids.clear();
+
+  std::unordered_map<int, Mesh::VertexHandle> vertex;
+  std::vector<Mesh::VertexHandle> vh(3);
+
+  for (const Triangle& t : _triangles)
+  {
+    for (int k = 0; k < 3; ++k)
+    {
+      auto it = vertex.find(t.id[k]);
+      if (it == vertex.end())
+      {
+        it = vertex.emplace(t.id[k], _mesh.add_vertex(t.p[k])).first;
+        _ids.push_back(t.id[k]);
+      }
+      vh[k] = it->second;
+    }
+
+    if (!_mesh.add_face(vh).is_valid())
+    {
+      for (int k = 0; k < 3; ++k)
+      {
+        vh[k] = _mesh.add_vertex(t.p[k]);
+        _ids.push_back(t.id[k]);
+        _mesh.status(vh[k]).set_locked(true);
+      }
+      _mesh.add_face(vh);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+/// Decimate _mesh to _n_vertices with DecimaterT and ModQuadricT
+void decimate_mesh(Mesh& _mesh, size_t _n_vertices, const OutOfCoreDecimater& _ooc)
+{
+  if (_n_vertices >= _mesh.n_vertices())
+    return;
+
+  DecimaterT<Mesh> decimater(_mesh);
+
+  ModQuadricT<Mesh>::Handle hModQuadric;
+  decimater.add(hModQuadric);
+  decimater.module(hModQuadric).unset_max_err();
+  decimater.module(hModQuadric).set_optimal_placement(_ooc.optimal_placement());
+
+  ModNormalFlippingT<Mesh>::Handle hModNormalFlipping;
+  if (_ooc.max_normal_deviation() > 0.0)
+  {
+    _mesh.request_face_normals();
+    _mesh.update_face_normals();
+    decimater.add(hModNormalFlipping);
+    decimater.module(hModNormalFlipping).set_max_normal_deviation(_ooc.max_normal_deviation());
+  }
+
+  decimater.initialize();
+  decimater.decimate_to(_n_vertices);
+}
+
+//-----------------------------------------------------------------------------
+
+/// Bits per axis of the Morton codes, a cell of level l contains the codes
+/// that agree in the highest 3 * l bits
+const unsigned int MORTON_BITS = 21;
+
+/// Level of the initial grid of the partition (64 cells per axis)
+const unsigned int GRID_LEVEL = 6;
+
+/// Interleave the bits of the grid coordinates
+uint64_t morton_code(unsigned int _x, unsigned int _y, unsigned int _z)
+{
+  uint64_t code = 0;
+  for (unsigned int b = 0; b < MORTON_BITS; ++b)
+    code |= (uint64_t((_x >> b) & 1u) << (3 * b)) |
+            (uint64_t((_y >> b) & 1u) << (3 * b + 1)) |
+            (uint64_t((_z >> b) & 1u) << (3 * b + 2));
+  return code;
+}
+
+/// Cell of the partition, cells are refined until they contain at most
+/// max_cluster_faces() triangles
+struct Cell
+{
+  uint64_t     first;    ///< smallest Morton code of the cell
+  unsigned int level;
+  size_t       n_faces;
+};
+
+//-----------------------------------------------------------------------------
+
+/** One round of the partitioned decimation: the triangles of _in are
+ *  grouped into clusters of at most max_cluster_faces() faces along an
+ *  octree, which is shifted by half a cell of the initial grid if _shifted.
+ *  The seams are locked and the free vertices of every cluster are
+ *  decimated by _ratio. In the _final pass a cluster aims at _ratio of
+ *  all its vertices instead, which brings the result close to the target
+ *  despite the locked seams. The result is appended to _out, _used
+ *  receives its vertices and _part is used to sort the triangles by
+ *  cluster.
+ */
+bool decimate_clusters(TriangleFile& _in, TriangleFile& _out, TriangleFile& _part,
+                       bool _shifted, double _ratio, bool _final, const OutOfCoreDecimater& _ooc,
+                       VertexSet& _used, size_t& _n_clusters, size_t& _max_faces_in_memory)
+{
+  const size_t max_cluster_faces = _ooc.max_cluster_faces();
+  std::vector<Triangle> triangles;
+
+  // octree over the bounding cube, shifted by half a cell of the initial
+  // grid in odd rounds. The triangles are identified with the Morton code
+  // of their center.
+  const Vec3f  extent = _in.bbox_max() - _in.bbox_min();
+  const float  size   = std::max(extent.max(), FLT_MIN) * (1.0f + 1.0f / (1u << GRID_LEVEL));
+  const Vec3f  origin = _in.bbox_min() - Vec3f(_shifted ? 0.5f * size / (1u << GRID_LEVEL) : 0.0f);
+  const float  scale  = float(1u << MORTON_BITS) / size;
+
+  auto code_of = [&](const Triangle& _t)
+  {
+    const Vec3f c = (_t.p[0] + _t.p[1] + _t.p[2]) / 3.0f;
+    unsigned int i[3];
+    for (int k = 0; k < 3; ++k)
+      i[k] = std::min(unsigned(std::max((c[k] - origin[k]) * scale, 0.0f)), (1u << MORTON_BITS) - 1);
+    return morton_code(i[0], i[1], i[2]);
+  };
+
+  // the cells are sorted by their Morton codes
+  std::vector<Cell> cells;
+  auto cell_of = [&](const Triangle& _t)
+  {
+    const uint64_t code = code_of(_t);
+    auto it = std::upper_bound(cells.begin(), cells.end(), code,
+                               [](uint64_t _code, const Cell& _c) { return _code < _c.first; });
+    return size_t(it - cells.begin()) - 1;
+  };
+
+  // initial grid, cells with too many triangles are split recursively
+  {
+    const unsigned int shift = 3 * (MORTON_BITS - GRID_LEVEL);
+    std::vector<size_t> grid_size(size_t(1) << (3 * GRID_LEVEL), 0);
+    for (size_t first = 0; first < _in.size(); first += max_cluster_faces)
+    {
+      _in.read(first, std::min(max_cluster_faces, _in.size() - first), triangles);
+      for (const Triangle& t : triangles)
+        ++grid_size[code_of(t) >> shift];
+    }
+    for (size_t c = 0; c < grid_size.size(); ++c)
+      if (grid_size[c] > 0)
+      {
+        const Cell cell = { uint64_t(c) << shift, GRID_LEVEL, grid_size[c] };
+        cells.push_back(cell);
+      }
+  }
+
+  for (unsigned int level = GRID_LEVEL; level < MORTON_BITS; ++level)
+  {
+    const bool split = std::any_of(cells.begin(), cells.end(),
+                                   [&](const Cell& _c) { return _c.n_faces > max_cluster_faces; });
+    if (!split)
+      break;
+
+    const unsigned int shift = 3 * (MORTON_BITS - level - 1);
+    std::unordered_map<uint64_t, size_t> children;
+    for (size_t first = 0; first < _in.size(); first += max_cluster_faces)
+    {
+      _in.read(first, std::min(max_cluster_faces, _in.size() - first), triangles);
+      for (const Triangle& t : triangles)
+        if (cells[cell_of(t)].n_faces > max_cluster_faces)
+          ++children[code_of(t) >> shift];
+    }
+
+    std::vector<Cell> refined;
+    for (const Cell& c : cells)
+    {
+      if (c.n_faces <= max_cluster_faces)
+      {
+        refined.push_back(c);
+        continue;
+      }
+      for (uint64_t k = 0; k < 8; ++k)
+      {
+        const uint64_t first = c.first + (k << shift);
+        auto it = children.find(first >> shift);
+        if (it != children.end())
+        {
+          const Cell child = { first, level + 1, it->second };
+          refined.push_back(child);
+        }
+      }
+    }
+    cells.swap(refined);
+  }
+
+  // group the cells to clusters along the Morton order
+  std::vector<unsigned int> cluster_of(cells.size());
+  std::vector<size_t>       cluster_begin(1, 0);
+  size_t                    n = 0;
+  for (size_t c = 0; c < cells.size(); ++c)
+  {
+    if (n > 0 && n + cells[c].n_faces > max_cluster_faces)
+    {
+      cluster_begin.push_back(cluster_begin.back() + n);
+      n = 0;
+    }
+    cluster_of[c] = unsigned(cluster_begin.size() - 1);
+    n += cells[c].n_faces;
+  }
+  cluster_begin.push_back(_in.size());
+  const size_t n_clusters = cluster_begin.size() - 1;
+
+  // sort the triangles by cluster into the partition file
+  {
+    const size_t buffer_size = std::max<size_t>(64, (1u << 20) / n_clusters);
+    std::vector<std::vector<Triangle>> buffer(n_clusters);
+    std::vector<size_t> written(cluster_begin.begin(), cluster_begin.end() - 1);
+
+    _part.clear();
+    for (size_t first = 0; first < _in.size(); first += max_cluster_faces)
+    {
+      _in.read(first, std::min(max_cluster_faces, _in.size() - first), triangles);
+      for (const Triangle& t : triangles)
+      {
+        const unsigned int c = cluster_of[cell_of(t)];
+        buffer[c].push_back(t);
+        if (buffer[c].size() >= buffer_size)
+        {
+          _part.write(written[c], buffer[c].data(), buffer[c].size());
+          written[c] += buffer[c].size();
+          buffer[c].clear();
+        }
+      }
+    }
+    for (size_t c = 0; c < n_clusters; ++c)
+      _part.write(written[c], buffer[c].data(), buffer[c].size());
+    _part.set_size(_in.size());
+
+    if (!_part.good())
+    {
+      omerr() << "[OutOfCoreDecimater] : cannot write temporary file" << std::endl;
+      return false;
+    }
+  }
+
+  // decimate the clusters with locked seams. A cell of the finest level can
+  // still exceed max_cluster_faces() (triangles with the same center), it
+  // is decimated in pieces then.
+  std::vector<int> ids;
+
+  _out.clear();
+  for (size_t c = 0; c < n_clusters; ++c)
+    for (size_t first = cluster_begin[c]; first < cluster_begin[c + 1]; first += max_cluster_faces)
+    {
+      const size_t n_faces = std::min(max_cluster_faces, cluster_begin[c + 1] - first);
+
+      _part.read(first, n_faces, triangles);
+      _max_faces_in_memory = std::max(_max_faces_in_memory, n_faces);
+      ++_n_clusters;
+
+      Mesh mesh;
+      build_mesh(triangles, mesh, ids);
+
+      // lock the seam and its one-ring, otherwise a collapse could connect
+      // two seam vertices that are already connected in the next cluster
+      size_t n_seam = 0;
+      for (auto vh : mesh.vertices())
+        if (mesh.is_boundary(vh))
+        {
+          ++n_seam;
+          mesh.status(vh).set_locked(true);
+          for (auto vv : vh.vertices())
+            mesh.status(vv).set_locked(true);
+        }
+
+      size_t n_locked = 0;
+      for (auto vh : mesh.vertices())
+        if (mesh.status(vh).locked())
+          ++n_locked;
+
+      // a seam vertex belongs to (at least) two clusters, count half of it
+      const size_t n_free = mesh.n_vertices() - n_locked;
+      const double n_own  = double(mesh.n_vertices()) - 0.5 * double(n_seam);
+      if (_final)
+        decimate_mesh(mesh, std::max(n_locked, size_t(std::lround(_ratio * n_own + 0.5 * double(n_seam)))), _ooc);
+      else
+        decimate_mesh(mesh, n_locked + size_t(std::lround(_ratio * double(n_free))), _ooc);
+
+      for (auto fh : mesh.faces())
+      {
+        Triangle t;
+        int k = 0;
+        for (auto fv : fh.vertices())
+        {
+          t.id[k] = ids[fv.idx()];
+          t.p[k]  = mesh.point(fv);
+          _used.insert(t.id[k]);
+          ++k;
+        }
+        _out.append(t);
+      }
+    }
+
+  if (!_out.flush())
+  {
+    omerr() << "[OutOfCoreDecimater] : cannot write temporary file" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+
+OutOfCoreDecimater::OutOfCoreDecimater()
+  : max_cluster_faces_(1000000),
+    max_normal_deviation_(0.0),
+    optimal_placement_(false),
+    max_rounds_(4),
+    n_rounds_(0),
+    n_clusters_(0),
+    max_faces_in_memory_(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+OutOfCoreDecimater::~OutOfCoreDecimater()
+{
+}
+
+//-----------------------------------------------------------------------------
+
+std::string OutOfCoreDecimater::temp_file(const std::string& _output, int _i) const
+{
+  std::string dir = temp_directory_;
+  std::string name = _output;
+
+  const size_t sep = _output.find_last_of("/\\");
+  if (sep != std::string::npos)
+  {
+    if (dir.empty())
+      dir = _output.substr(0, sep);
+    name = _output.substr(sep + 1);
+  }
+
+  if (!dir.empty() && dir.back() != '/' && dir.back() != '\\')
+    dir += '/';
+
+  return dir + name + ".ooc" + std::to_string(_i) + ".tmp";
+}
+
+//-----------------------------------------------------------------------------
+
+bool OutOfCoreDecimater::decimate(const std::string& _input, const std::string& _output,
+                                  size_t _n_vertices)
+{
+  n_rounds_            = 0;
+  n_clusters_          = 0;
+  max_faces_in_memory_ = 0;
+
+  TriangleFile file0(temp_file(_output, 0)), file1(temp_file(_output, 1)), part(temp_file(_output, 2));
+  if (!file0.good() || !file1.good() || !part.good())
+  {
+    omerr() << "[OutOfCoreDecimater] : cannot create temporary files for " << _output << std::endl;
+    return false;
+  }
+
+  // stream the triangles to the first file, the positions are kept in a
+  // temporary file as well
+  {
+    PointFile points(temp_file(_output, 3));
+    TriangleImporter importer(points, file0);
+    IO::Options opt;
+    if (!points.good() || !IO::IOManager().read(_input, importer, opt) ||
+        !points.good() || !file0.flush())
+    {
+      omerr() << "[OutOfCoreDecimater] : cannot read " << _input << std::endl;
+      return false;
+    }
+  }
+
+  // number of vertices used by the triangles
+  size_t n_vertices = 0;
+  std::vector<Triangle> triangles;
+  {
+    VertexSet used(size_t(file0.max_id() + 1));
+    for (size_t first = 0; first < file0.size(); first += max_cluster_faces_)
+    {
+      file0.read(first, std::min(max_cluster_faces_, file0.size() - first), triangles);
+      for (const Triangle& t : triangles)
+        for (int k = 0; k < 3; ++k)
+          used.insert(t.id[k]);
+    }
+    n_vertices = used.size();
+  }
+
+  TriangleFile* in  = &file0;
+  TriangleFile* out = &file1;
+
+  while (in->size() > max_cluster_faces_ && n_vertices > _n_vertices && n_rounds_ < max_rounds_)
+  {
+    VertexSet used(size_t(in->max_id() + 1));
+    if (!decimate_clusters(*in, *out, part, n_rounds_ % 2 != 0,
+                           double(_n_vertices) / double(n_vertices), false, *this,
+                           used, n_clusters_, max_faces_in_memory_))
+      return false;
+
+    ++n_rounds_;
+    std::swap(in, out);
+
+    const size_t n_remaining = used.size();
+    if (n_remaining >= n_vertices)
+      break;
+    n_vertices = n_remaining;
+  }
+
+  // a mesh fitting into one cluster is decimated to the exact target in
+  // memory, without locked seams
+  if (in->size() <= max_cluster_faces_)
+  {
+    in->read(0, in->size(), triangles);
+    max_faces_in_memory_ = std::max(max_faces_in_memory_, in->size());
+
+    Mesh mesh;
+    std::vector<int> ids;
+    build_mesh(triangles, mesh, ids);
+    triangles = std::vector<Triangle>();
+
+    decimate_mesh(mesh, _n_vertices, *this);
+    mesh.garbage_collection();
+
+    if (!IO::write_mesh(mesh, _output))
+    {
+      omerr() << "[OutOfCoreDecimater] : cannot write " << _output << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  // otherwise a final pass over clusters shifted by half a cell against
+  // the last round decimates the seams, its triangles are streamed to the
+  // writer
+  triangles = std::vector<Triangle>();
+  VertexSet used(size_t(in->max_id() + 1));
+  if (!decimate_clusters(*in, *out, part, n_rounds_ % 2 != 0,
+                         double(_n_vertices) / double(n_vertices), true, *this,
+                         used, n_clusters_, max_faces_in_memory_))
+    return false;
+
+  // positions of the remaining vertices, numbered by their rank
+  used.update_ranks();
+  PointFile points(temp_file(_output, 3));
+  points.resize(used.size());
+  for (size_t first = 0; first < out->size(); first += max_cluster_faces_)
+  {
+    out->read(first, std::min(max_cluster_faces_, out->size() - first), triangles);
+    for (const Triangle& t : triangles)
+      for (int k = 0; k < 3; ++k)
+        points.set(size_t(used.rank(t.id[k])), t.p[k]);
+  }
+  triangles = std::vector<Triangle>();
+
+  TriangleExporter exporter(points, *out, used);
+  if (!points.good() || !IO::IOManager().write(_output, exporter, IO::Options()) || !points.good())
+  {
+    omerr() << "[OutOfCoreDecimater] : cannot write " << _output << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
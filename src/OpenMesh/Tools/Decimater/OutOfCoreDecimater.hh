@@ -0,0 +1,186 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/** \file OutOfCoreDecimater.hh
+ */
+
+//=============================================================================
+//
+//  CLASS OutOfCoreDecimater
+//
+//=============================================================================
+
+#ifndef OPENMESH_DECIMATER_OUTOFCOREDECIMATER_HH
+#define OPENMESH_DECIMATER_OUTOFCOREDECIMATER_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Utils/Noncopyable.hh>
+#include <cstddef>
+#include <string>
+
+
+//== NAMESPACE ================================================================
+
+namespace OpenMesh  {
+namespace Decimater {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \brief Decimation of meshes that do not fit into memory.
+ *
+ *  decimate() reads the input file face by face with the regular readers
+ *  and stores the triangles in a temporary file, the vertex positions are
+ *  kept in a temporary file as well. It then decimates the mesh in rounds:
+ *
+ *  -# The triangles are partitioned into the cells of an octree, cells with
+ *     more than max_cluster_faces() faces are split recursively. The cells
+ *     are grouped along the Morton order into clusters of at most
+ *     max_cluster_faces() faces.
+ *  -# Every cluster is loaded into a TriMesh and decimated with DecimaterT
+ *     and ModQuadricT (optionally ModNormalFlippingT) towards the target
+ *     ratio. The boundary vertices of the clusters and their one-rings are
+ *     locked, so the clusters still fit together afterwards.
+ *  -# The next round uses an octree shifted by half a cell, which moves the
+ *     seams of the previous round into the inside of the clusters.
+ *
+ *  As soon as the remaining mesh fits into one cluster, it is decimated in
+ *  memory to the exact target without locked seams and written with
+ *  IO::write_mesh(). Otherwise, when the target or max_rounds() is
+ *  reached, a final pass decimates the seams of the last round in
+ *  clusters shifted by half a cell against it and streams the triangles
+ *  to the writer without building the mesh. Its clusters are decimated
+ *  further inside to make up for the locked seams, so the target is only
+ *  met approximately, and not at all if the seams make up most of the
+ *  clusters (very small max_cluster_faces()). The memory needed is one cluster, one bit per input vertex and the octree
+ *  cells.
+ *
+ *  The temporary files are created in temp_directory() and removed
+ *  afterwards. Input formats have to pass faces as vertex lists to the
+ *  importer (OFF, PLY, STL, OBJ), the OM reader needs a complete mesh. The
+ *  same holds for the output if it does not fit into one cluster.
+ *
+ *  \code
+ *  OpenMesh::Decimater::OutOfCoreDecimater ooc;
+ *  ooc.set_max_cluster_faces(2000000);
+ *  ooc.decimate("scan.ply", "scan_lod.ply", 500000);
+ *  \endcode
+ */
+class OPENMESHDLLEXPORT OutOfCoreDecimater : private Utils::Noncopyable
+{
+public:
+
+  /// constructor
+  OutOfCoreDecimater();
+
+  /// destructor
+  ~OutOfCoreDecimater();
+
+  /** Decimate the mesh in file _input to _n_vertices vertices and write it
+   *  to _output. Returns false if reading, a temporary file or writing
+   *  failed. */
+  bool decimate(const std::string& _input, const std::string& _output, size_t _n_vertices);
+
+public: // parameters
+
+  /// Maximal number of faces decimated in memory at once (default 1000000)
+  void set_max_cluster_faces(size_t _n) { max_cluster_faces_ = _n > 0 ? _n : 1; }
+  size_t max_cluster_faces() const { return max_cluster_faces_; }
+
+  /** Directory of the temporary files. Defaults to the directory of the
+   *  output file. */
+  void set_temp_directory(const std::string& _dir) { temp_directory_ = _dir; }
+  const std::string& temp_directory() const { return temp_directory_; }
+
+  /** Maximal angle between the normals of a face before and after a
+   *  collapse in degrees, 0 disables the test (default). */
+  void set_max_normal_deviation(double _degrees) { max_normal_deviation_ = _degrees; }
+  double max_normal_deviation() const { return max_normal_deviation_; }
+
+  /// \see ModQuadricT::set_optimal_placement()
+  void set_optimal_placement(bool _b) { optimal_placement_ = _b; }
+  bool optimal_placement() const { return optimal_placement_; }
+
+  /** Maximal number of partitioned rounds (default 4). If the remaining
+   *  mesh still exceeds max_cluster_faces() afterwards, the final pass
+   *  over clusters finishes the decimation. */
+  void set_max_rounds(unsigned int _n) { max_rounds_ = _n; }
+  unsigned int max_rounds() const { return max_rounds_; }
+
+public: // statistics of the last decimate()
+
+  /// Number of partitioned rounds, without the final pass
+  unsigned int n_rounds() const { return n_rounds_; }
+
+  /// Number of clusters decimated in all rounds
+  size_t n_clusters() const { return n_clusters_; }
+
+  /// Largest number of faces held in memory at once
+  size_t max_faces_in_memory() const { return max_faces_in_memory_; }
+
+private:
+
+  /// Name of the i-th temporary file for the output file _output
+  std::string temp_file(const std::string& _output, int _i) const;
+
+private:
+
+  size_t       max_cluster_faces_;
+  std::string  temp_directory_;
+  double       max_normal_deviation_;
+  bool         optimal_placement_;
+  unsigned int max_rounds_;
+
+  unsigned int n_rounds_;
+  size_t       n_clusters_;
+  size_t       max_faces_in_memory_;
+};
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+#endif // OPENMESH_DECIMATER_OUTOFCOREDECIMATER_HH defined
+//=============================================================================
@@ -0,0 +1,179 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+/** \file VertexClusteringT.hh
+ */
+
+//=============================================================================
+//
+//  CLASS VertexClusteringT
+//
+//=============================================================================
+
+#ifndef OPENMESH_DECIMATER_VERTEXCLUSTERINGT_HH
+#define OPENMESH_DECIMATER_VERTEXCLUSTERINGT_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/Geometry/QuadricT.hh>
+#include <OpenMesh/Core/Utils/Noncopyable.hh>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+//== NAMESPACE ================================================================
+
+namespace OpenMesh  {
+namespace Decimater {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Fast simplification of triangle meshes by vertex clustering.
+ *
+ *  The bounding box of the mesh is divided into a grid of cubic cells and
+ *  all vertices of a cell are merged into one. The merged vertex is placed
+ *  at the position minimizing the sum of the area weighted face quadrics of
+ *  the cell (the mean position if that is ill-conditioned or leaves the
+ *  cell). Faces with two vertices in the same cell degenerate and are
+ *  removed. There is no priority queue and no collapse: the remaining
+ *  triangles are collected as an index list and the connectivity is rebuilt
+ *  in one go, so the quality is lower than with DecimaterT, but the speed is
+ *  a lot higher. Keys, quadrics, cell positions and triangles are computed
+ *  in parallel on the ThreadPool, use ThreadLimit to restrict the threads.
+ *
+ *  Locked and feature vertices and the vertices of feature edges are kept
+ *  in place and never merged. Edges which would get more than two faces are
+ *  resolved by dropping the extra faces, vertices which would get several
+ *  fans are split (the copies get all properties of the original).
+ *
+ *  Like the decimaters, removed vertices are only marked as deleted, call
+ *  garbage_collection() while the VertexClusteringT still exists. The
+ *  vertex properties of the surviving vertices are kept, edge, halfedge and
+ *  face properties are reset and face normals have to be updated.
+ *
+ *  \code
+ *  OpenMesh::Decimater::VertexClusteringT<MyMesh> clustering(mesh);
+ *  clustering.decimate(64);   // 64 cells along the longest side
+ *  mesh.garbage_collection();
+ *  \endcode
+ */
+template <class MeshT>
+class VertexClusteringT : private Utils::Noncopyable
+{
+public:
+
+  typedef MeshT                           Mesh;
+  typedef typename Mesh::Point            Point;
+  typedef typename Mesh::Scalar           Scalar;
+  typedef typename Mesh::VertexHandle     VertexHandle;
+  typedef typename Mesh::HalfedgeHandle   HalfedgeHandle;
+  typedef Geometry::QuadricT<double>      Quadric;
+
+public:
+
+  /// Constructor, requests the status of vertices, edges and faces
+  explicit VertexClusteringT(Mesh& _mesh);
+
+  /// Destructor, releases the status
+  ~VertexClusteringT();
+
+  /// The mesh
+  Mesh& mesh() { return mesh_; }
+
+  /** Cluster the vertices on a grid with \c _resolution cells along the
+   *  longest side of the bounding box.
+   *
+   *  \return number of removed vertices
+   */
+  size_t decimate(unsigned int _resolution);
+
+  /** Cluster with the finest grid that has at most \c _n_vertices occupied
+   *  cells. The vertex count afterwards is close to but not exactly
+   *  \c _n_vertices, split vertices and empty cells make it differ.
+   *
+   *  \return number of removed vertices
+   */
+  size_t decimate_to(size_t _n_vertices);
+
+  /// Number of clusters (occupied cells and fixed vertices) of a grid with \c _resolution cells
+  size_t n_clusters(unsigned int _resolution);
+
+private:
+
+  typedef std::pair<uint64_t, int> Key;
+
+  /// Sorted cell keys of the vertices, fixed vertices get a key of their own
+  void cluster_keys(unsigned int _resolution, std::vector<Key>& _keys, Scalar& _cell) const;
+
+  /// Sum of the area weighted quadrics of the faces of \c _vh
+  Quadric vertex_quadric(VertexHandle _vh) const;
+
+  /// Replace the faces and edges by the triangles \c _triangles
+  void rebuild(const std::vector<int>& _triangles);
+
+  /// Sort in parallel (sorted blocks, then parallel merges)
+  template <class T>
+  static void sort_parallel(std::vector<T>& _v);
+
+private:
+
+  // reference to mesh
+  Mesh& mesh_;
+};
+
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_DECIMATER_VERTEXCLUSTERINGT_CC)
+#define OPENMESH_DECIMATER_VERTEXCLUSTERINGT_TEMPLATES
+#include "VertexClusteringT_impl.hh"
+#endif
+//=============================================================================
+#endif // OPENMESH_DECIMATER_VERTEXCLUSTERINGT_HH defined
+//=============================================================================
+
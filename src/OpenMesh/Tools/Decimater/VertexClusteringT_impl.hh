@@ -0,0 +1,637 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+/** \file VertexClusteringT_impl.hh
+ */
+
+//=============================================================================
+//
+//  CLASS VertexClusteringT - IMPLEMENTATION
+//
+//=============================================================================
+#define OPENMESH_DECIMATER_VERTEXCLUSTERINGT_CC
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Tools/Decimater/VertexClusteringT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+
+//== NAMESPACE ===============================================================
+
+namespace OpenMesh {
+namespace Decimater {
+
+
+//== IMPLEMENTATION ==========================================================
+
+
+template <class MeshT>
+VertexClusteringT<MeshT>::VertexClusteringT(Mesh& _mesh)
+  : mesh_(_mesh)
+{
+  // default properties
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+}
+
+//-----------------------------------------------------------------------------
+
+template <class MeshT>
+VertexClusteringT<MeshT>::~VertexClusteringT()
+{
+  // default properties
+  mesh_.release_vertex_status();
+  mesh_.release_edge_status();
+  mesh_.release_face_status();
+}
+
+//-----------------------------------------------------------------------------
+
+template <class MeshT>
+size_t VertexClusteringT<MeshT>::n_clusters(unsigned int _resolution)
+{
+  std::vector<Key> keys;
+  Scalar cell;
+  cluster_keys(std::min(std::max(_resolution, 1u), 1u << 20), keys, cell);
+
+  size_t n = 0;
+  for (size_t i = 0; i < keys.size(); ++i)
+    if (i == 0 || keys[i].first != keys[i - 1].first)
+      ++n;
+  return n;
+}
+
+//-----------------------------------------------------------------------------
+
+template <class MeshT>
+size_t VertexClusteringT<MeshT>::decimate_to(size_t _n_vertices)
+{
+  // safeguarded search for the finest resolution with at most _n_vertices
+  // clusters, the number of clusters grows about quadratically on surfaces
+  unsigned int lo = 1, hi = 1u << 20;
+  unsigned int resolution = 16;
+
+  for (int iter = 0; iter < 8 && hi - lo > 1; ++iter)
+  {
+    const size_t n = n_clusters(resolution);
+    if (n <= _n_vertices)
+      lo = resolution;
+    else
+      hi = resolution;
+
+    const double estimate = resolution * std::sqrt(double(_n_vertices) / double(std::max<size_t>(n, 1)));
+    if (estimate > lo && estimate < hi && unsigned(estimate) != resolution && unsigned(estimate) > lo)
+      resolution = unsigned(estimate);
+    else
+      resolution = lo + (hi - lo) / 2;
+  }
+
+  return decimate(lo);
+}
+
+//-----------------------------------------------------------------------------
+
+template <class MeshT>
+size_t VertexClusteringT<MeshT>::decimate(unsigned int _resolution)
+{
+  if (_resolution == 0 || mesh_.n_faces() == 0)
+    return 0;
+
+  // read access in the parallel sections, the non-const accessors of a
+  // copy-on-write mesh are not thread-safe
+  const Mesh& mesh = mesh_;
+
+  std::vector<Key> keys;
+  Scalar cell;
+  cluster_keys(std::min(_resolution, 1u << 20), keys, cell);
+
+  // clusters are ranges of equal keys
+  std::vector<size_t> begin;
+  for (size_t i = 0; i < keys.size(); ++i)
+    if (i == 0 || keys[i].first != keys[i - 1].first)
+      begin.push_back(i);
+  begin.push_back(keys.size());
+
+  const size_t n_clusters = begin.size() - 1;
+  const size_t nv         = mesh_.n_vertices();
+
+  // representatives and their positions
+  std::vector<int>   rep(nv, -1);
+  std::vector<Point> position(n_clusters);
+  parallel_for(n_clusters, 256, [&](size_t _first, size_t _last)
+  {
+    for (size_t c = _first; c < _last; ++c)
+    {
+      const size_t b = begin[c], e = begin[c + 1];
+      const int    v0 = keys[b].second;
+
+      for (size_t i = b; i < e; ++i)
+        rep[keys[i].second] = v0;
+
+      // single and fixed vertices keep their position
+      position[c] = mesh.point(VertexHandle(v0));
+      if (e - b == 1)
+        continue;
+
+      Quadric q;
+      Point   mean(0, 0, 0);
+      for (size_t i = b; i < e; ++i)
+      {
+        const VertexHandle vh(keys[i].second);
+        q    += vertex_quadric(vh);
+        mean += mesh.point(vh);
+      }
+      mean /= static_cast<Scalar>(e - b);
+      position[c] = mean;
+
+      // minimize the quadric, A x = -b with Cramer's rule
+      const double a00 = q.xx(), a01 = q.xy(), a02 = q.xz();
+      const double a11 = q.yy(), a12 = q.yz(), a22 = q.zz();
+      const double b0 = -q.xw(), b1 = -q.yw(), b2 = -q.zw();
+
+      const double c00 = a11 * a22 - a12 * a12;
+      const double c01 = a02 * a12 - a01 * a22;
+      const double c02 = a01 * a12 - a02 * a11;
+      const double det = a00 * c00 + a01 * c01 + a02 * c02;
+
+      const double trace = (a00 + a11 + a22) / 3.0;
+      if (std::fabs(det) <= 1e-6 * trace * trace * trace)
+        continue;
+
+      const double c11 = a00 * a22 - a02 * a02;
+      const double c12 = a01 * a02 - a00 * a12;
+      const double c22 = a00 * a11 - a01 * a01;
+
+      const Point p(static_cast<Scalar>((c00 * b0 + c01 * b1 + c02 * b2) / det),
+                    static_cast<Scalar>((c01 * b0 + c11 * b1 + c12 * b2) / det),
+                    static_cast<Scalar>((c02 * b0 + c12 * b1 + c22 * b2) / det));
+
+      // reject positions far outside the cell
+      if ((p - mean).l8_norm() <= cell)
+        position[c] = p;
+    }
+  });
+
+  for (size_t c = 0; c < n_clusters; ++c)
+    mesh_.set_point(VertexHandle(keys[begin[c]].second), position[c]);
+
+  // triangles of the representatives, degenerated ones are dropped
+  const size_t nf       = mesh_.n_faces();
+  const size_t grain    = 4096;
+  const size_t n_blocks = (nf + grain - 1) / grain;
+
+  auto corners = [&](size_t _f, int _r[3])
+  {
+    const typename Mesh::FaceHandle fh(static_cast<int>(_f));
+    if (mesh.status(fh).deleted())
+      return false;
+
+    const HalfedgeHandle h0 = mesh.halfedge_handle(fh);
+    const HalfedgeHandle h1 = mesh.next_halfedge_handle(h0);
+    const HalfedgeHandle h2 = mesh.next_halfedge_handle(h1);
+    _r[0] = rep[mesh.to_vertex_handle(h0).idx()];
+    _r[1] = rep[mesh.to_vertex_handle(h1).idx()];
+    _r[2] = rep[mesh.to_vertex_handle(h2).idx()];
+    return _r[0] != _r[1] && _r[1] != _r[2] && _r[2] != _r[0];
+  };
+
+  std::vector<size_t> offset(n_blocks + 1, 0);
+  parallel_for(nf, grain, [&](size_t _first, size_t _last)
+  {
+    int r[3];
+    size_t n = 0;
+    for (size_t f = _first; f < _last; ++f)
+      if (corners(f, r))
+        ++n;
+    offset[_first / grain + 1] = n;
+  });
+  std::partial_sum(offset.begin(), offset.end(), offset.begin());
+
+  std::vector<int> triangles(3 * offset.back());
+  parallel_for(nf, grain, [&](size_t _first, size_t _last)
+  {
+    int r[3];
+    int* out = triangles.data() + 3 * offset[_first / grain];
+    for (size_t f = _first; f < _last; ++f)
+      if (corners(f, r))
+      {
+        *out++ = r[0];
+        *out++ = r[1];
+        *out++ = r[2];
+      }
+  });
+
+  // vertices which stay even without faces
+  std::vector<char> keep(nv, 0);
+  for (size_t i = 0; i < nv; ++i)
+  {
+    const VertexHandle vh(static_cast<int>(i));
+    keep[i] = mesh_.is_isolated(vh) || mesh_.status(vh).locked() || mesh_.status(vh).feature();
+  }
+  for (const Key& key : keys)
+    if (key.first >> 63)
+      keep[key.second] = 1;
+
+  rebuild(triangles);
+
+  // remove the merged vertices and the representatives that lost all faces
+  size_t n_removed = 0;
+  for (size_t i = 0; i < nv; ++i)
+  {
+    const VertexHandle vh(static_cast<int>(i));
+    if (mesh_.status(vh).deleted())
+      continue;
+
+    if (rep[i] != static_cast<int>(i) || (mesh_.is_isolated(vh) && !keep[i]))
+    {
+      mesh_.status(vh).set_deleted(true);
+      ++n_removed;
+    }
+  }
+
+  // split vertices are new
+  return n_removed - std::min(n_removed, mesh_.n_vertices() - nv);
+}
+
+//-----------------------------------------------------------------------------
+
+template <class MeshT>
+typename VertexClusteringT<MeshT>::Quadric
+VertexClusteringT<MeshT>::vertex_quadric(VertexHandle _vh) const
+{
+  const Mesh& mesh = mesh_;
+
+  Quadric q;
+
+  const HalfedgeHandle start = mesh.halfedge_handle(_vh);
+  if (!start.is_valid())
+    return q;
+
+  const Point& p0 = mesh.point(_vh);
+  HalfedgeHandle heh = start;
+  do
+  {
+    if (!mesh.is_boundary(heh))
+    {
+      const Point& p1 = mesh.point(mesh.to_vertex_handle(heh));
+      const Point& p2 = mesh.point(mesh.to_vertex_handle(mesh.next_halfedge_handle(heh)));
+
+      Point n = (p1 - p0) % (p2 - p0);
+      const double area2 = n.norm();
+      if (area2 > 0.0)
+      {
+        n /= static_cast<Scalar>(area2);
+        Quadric qf(n[0], n[1], n[2], -(n | p0));
+        qf *= 0.5 * area2;
+        q += qf;
+      }
+    }
+    heh = mesh.cw_rotated_halfedge_handle(heh);
+  }
+  while (heh != start);
+
+  return q;
+}
+
+//-----------------------------------------------------------------------------
+
+template <class MeshT>
+void VertexClusteringT<MeshT>::cluster_keys(unsigned int _resolution, std::vector<Key>& _keys,
+                                            Scalar& _cell) const
+{
+  const Mesh& mesh = mesh_;
+  const size_t nv = mesh.n_vertices();
+
+  Point bb_min( std::numeric_limits<Scalar>::max());
+  Point bb_max(-std::numeric_limits<Scalar>::max());
+  for (size_t i = 0; i < nv; ++i)
+  {
+    const VertexHandle vh(static_cast<int>(i));
+    if (!mesh.status(vh).deleted())
+    {
+      bb_min.minimize(mesh.point(vh));
+      bb_max.maximize(mesh.point(vh));
+    }
+  }
+
+  const Point extent = bb_max - bb_min;
+  _cell   = std::max(extent.max(), std::numeric_limits<Scalar>::min()) / static_cast<Scalar>(_resolution);
+
+  uint64_t dims[3];
+  for (int k = 0; k < 3; ++k)
+    dims[k] = std::min<uint64_t>(static_cast<uint64_t>(extent[k] / _cell), _resolution - 1) + 1;
+
+  // vertices of feature edges are fixed
+  std::vector<char> feature(nv, 0);
+  for (size_t i = 0; i < mesh.n_edges(); ++i)
+  {
+    const typename Mesh::EdgeHandle eh(static_cast<int>(i));
+    if (mesh.status(eh).feature() && !mesh.status(eh).deleted())
+    {
+      const HalfedgeHandle heh = mesh.halfedge_handle(eh, 0);
+      feature[mesh.to_vertex_handle(heh).idx()]   = 1;
+      feature[mesh.from_vertex_handle(heh).idx()] = 1;
+    }
+  }
+
+  // fixed vertices get the top bit and their index, deleted ones are sorted out
+  const uint64_t fixed   = uint64_t(1) << 63;
+  const uint64_t deleted = std::numeric_limits<uint64_t>::max();
+
+  _keys.resize(nv);
+  parallel_for(nv, 4096, [&](size_t _first, size_t _last)
+  {
+    for (size_t i = _first; i < _last; ++i)
+    {
+      const VertexHandle vh(static_cast<int>(i));
+      _keys[i].second = static_cast<int>(i);
+
+      const auto& status = mesh.status(vh);
+      if (status.deleted())
+      {
+        _keys[i].first = deleted;
+        continue;
+      }
+
+      if (status.locked() || status.feature() || feature[i])
+      {
+        _keys[i].first = fixed | i;
+        continue;
+      }
+
+      const Point& p = mesh.point(vh);
+      uint64_t x[3];
+      for (int k = 0; k < 3; ++k)
+        x[k] = std::min(static_cast<uint64_t>(std::max((p[k] - bb_min[k]) / _cell, Scalar(0))), dims[k] - 1);
+      _keys[i].first = (x[2] * dims[1] + x[1]) * dims[0] + x[0];
+    }
+  });
+
+  sort_parallel(_keys);
+  while (!_keys.empty() && _keys.back().first == deleted)
+    _keys.pop_back();
+}
+
+//-----------------------------------------------------------------------------
+
+template <class MeshT>
+void VertexClusteringT<MeshT>::rebuild(const std::vector<int>& _triangles)
+{
+  const size_t n_corners = _triangles.size();
+  const size_t n_faces   = n_corners / 3;
+  const size_t n_old     = mesh_.n_vertices();
+
+  // corner c is the start of the halfedge c -> next(c) of its face
+  auto next    = [](size_t _c) { return _c - _c % 3 + (_c + 1) % 3; };
+  auto forward = [&](size_t _c) { return _triangles[_c] < _triangles[next(_c)]; };
+
+  // halfedges sorted by their edge
+  std::vector<Key> halfedges(n_corners);
+  parallel_for(n_corners, 16384, [&](size_t _first, size_t _last)
+  {
+    for (size_t c = _first; c < _last; ++c)
+    {
+      const uint32_t a = static_cast<uint32_t>(_triangles[c]);
+      const uint32_t b = static_cast<uint32_t>(_triangles[next(c)]);
+      halfedges[c] = Key((uint64_t(std::min(a, b)) << 32) | std::max(a, b), static_cast<int>(c));
+    }
+  });
+  sort_parallel(halfedges);
+
+  // an edge keeps one halfedge and at most one opposite halfedge, the
+  // faces of all others are dropped
+  std::vector<char> valid(n_faces, 1);
+  for (size_t i = 0, j = 0; i < n_corners; i = j)
+  {
+    int first = -1, second = -1;
+    for (j = i; j < n_corners && halfedges[j].first == halfedges[i].first; ++j)
+    {
+      const int c = halfedges[j].second;
+      if (!valid[c / 3])
+        continue;
+      if (first < 0)
+        first = c;
+      else if (second < 0 && forward(c) != forward(first))
+        second = c;
+      else
+        valid[c / 3] = 0;
+    }
+  }
+
+  // the corners of a vertex connected by edges with two faces form a fan
+  std::vector<int> parent(n_corners);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find = [&](int _c)
+  {
+    while (parent[_c] != _c)
+      _c = parent[_c] = parent[parent[_c]];
+    return _c;
+  };
+  auto unite = [&](int _a, int _b) { parent[find(_a)] = find(_b); };
+
+  size_t n_edges = 0;
+  for (size_t i = 0, j = 0; i < n_corners; i = j)
+  {
+    int pair[2], n = 0;
+    for (j = i; j < n_corners && halfedges[j].first == halfedges[i].first; ++j)
+      if (valid[halfedges[j].second / 3])
+        pair[n++] = halfedges[j].second;
+
+    if (n > 0)
+      ++n_edges;
+    if (n == 2)
+    {
+      unite(pair[0], static_cast<int>(next(pair[1])));
+      unite(static_cast<int>(next(pair[0])), pair[1]);
+    }
+  }
+
+  // one vertex per fan, further fans of a vertex get copies
+  std::vector<int>  corner_vertex(n_corners, -1);
+  std::vector<int>  fan_vertex(n_corners, -1);
+  std::vector<char> taken(n_old, 0);
+  std::vector<int>  copies;
+  size_t n_valid = 0;
+
+  for (size_t c = 0; c < n_corners; ++c)
+  {
+    if (!valid[c / 3])
+      continue;
+    if (c % 3 == 0)
+      ++n_valid;
+
+    const int root = find(static_cast<int>(c));
+    if (fan_vertex[root] < 0)
+    {
+      const int v = _triangles[c];
+      if (!taken[v])
+      {
+        taken[v] = 1;
+        fan_vertex[root] = v;
+      }
+      else
+      {
+        fan_vertex[root] = static_cast<int>(n_old + copies.size());
+        copies.push_back(v);
+      }
+    }
+    corner_vertex[c] = fan_vertex[root];
+  }
+
+  // replace edges and faces
+  mesh_.resize(n_old, 0, 0);
+  mesh_.resize(n_old + copies.size(), n_edges, n_valid);
+
+  for (size_t i = 0; i < copies.size(); ++i)
+    mesh_.copy_all_properties(VertexHandle(copies[i]), VertexHandle(static_cast<int>(n_old + i)), true);
+
+  for (size_t i = 0; i < mesh_.n_vertices(); ++i)
+    mesh_.set_isolated(VertexHandle(static_cast<int>(i)));
+
+  // edges, boundary halfedges are linked at their vertices
+  std::vector<int> corner_halfedge(n_corners, -1);
+  std::vector<HalfedgeHandle> in_boundary(mesh_.n_vertices()), out_boundary(mesh_.n_vertices());
+
+  int e = 0;
+  for (size_t i = 0, j = 0; i < n_corners; i = j)
+  {
+    int pair[2], n = 0;
+    for (j = i; j < n_corners && halfedges[j].first == halfedges[i].first; ++j)
+      if (valid[halfedges[j].second / 3])
+        pair[n++] = halfedges[j].second;
+    if (n == 0)
+      continue;
+
+    const HalfedgeHandle h0(2 * e), h1(2 * e + 1);
+    const VertexHandle   from(corner_vertex[pair[0]]), to(corner_vertex[next(pair[0])]);
+    ++e;
+
+    mesh_.set_vertex_handle(h0, to);
+    mesh_.set_vertex_handle(h1, from);
+    corner_halfedge[pair[0]] = h0.idx();
+
+    if (n == 2)
+      corner_halfedge[pair[1]] = h1.idx();
+    else
+    {
+      mesh_.set_boundary(h1);
+      out_boundary[to.idx()]  = h1;
+      in_boundary[from.idx()] = h1;
+    }
+  }
+
+  // faces
+  for (size_t f = 0, fi = 0; f < n_faces; ++f)
+  {
+    if (!valid[f])
+      continue;
+
+    const typename Mesh::FaceHandle fh(static_cast<int>(fi++));
+    for (size_t k = 0; k < 3; ++k)
+    {
+      const HalfedgeHandle h(corner_halfedge[3 * f + k]);
+      mesh_.set_face_handle(h, fh);
+      mesh_.set_next_halfedge_handle(h, HalfedgeHandle(corner_halfedge[3 * f + (k + 1) % 3]));
+      mesh_.set_halfedge_handle(VertexHandle(corner_vertex[3 * f + k]), h);
+    }
+    mesh_.set_halfedge_handle(fh, HalfedgeHandle(corner_halfedge[3 * f]));
+  }
+
+  // boundary vertices start at their outgoing boundary halfedge
+  for (size_t v = 0; v < mesh_.n_vertices(); ++v)
+    if (out_boundary[v].is_valid())
+    {
+      mesh_.set_next_halfedge_handle(in_boundary[v], out_boundary[v]);
+      mesh_.set_halfedge_handle(VertexHandle(static_cast<int>(v)), out_boundary[v]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+template <class MeshT>
+template <class T>
+void VertexClusteringT<MeshT>::sort_parallel(std::vector<T>& _v)
+{
+  const size_t n         = _v.size();
+  const size_t n_threads = ThreadPool::global().max_threads();
+  const size_t grain     = std::max<size_t>(size_t(1) << 15, (n + n_threads - 1) / n_threads);
+
+  if (n <= grain)
+  {
+    std::sort(_v.begin(), _v.end());
+    return;
+  }
+
+  parallel_for(n, grain, [&](size_t _first, size_t _last)
+  {
+    std::sort(_v.begin() + _first, _v.begin() + _last);
+  });
+
+  std::vector<T> buffer(n);
+  for (size_t width = grain; width < n; width *= 2)
+  {
+    parallel_for((n + 2 * width - 1) / (2 * width), 1, [&](size_t _first, size_t _last)
+    {
+      for (size_t p = _first; p < _last; ++p)
+      {
+        const size_t a = p * 2 * width;
+        const size_t m = std::min(a + width, n);
+        const size_t b = std::min(a + 2 * width, n);
+        std::merge(_v.begin() + a, _v.begin() + m, _v.begin() + m, _v.begin() + b, buffer.begin() + a);
+      }
+    });
+    _v.swap(buffer);
+  }
+}
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+
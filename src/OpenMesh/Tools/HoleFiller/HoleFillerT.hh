@@ -63,23 +63,45 @@ public:
 
   /** Identify and fill all holes of the mesh.
    *
+   * The triangulations of all holes are computed in parallel on the global
+   * ThreadPool, afterwards the holes are filled and faired one after the
+   * other. Holes sharing a vertex with a hole filled before are
+   * triangulated again at that point. Stage 3 smooths the vertices
+   * created by the fillings, the rest of the mesh is not touched.
+   *
+   * @param _stages      If not set to 3, the algorithm will abort after the given stage
+   * @param _max_threads Maximal number of threads (0: no limit)
    */
-  void fill_all_holes( int _stages = 3 );
+  void fill_all_holes( int _stages = 3, unsigned int _max_threads = 0 );
 
 
   /** Fill a hole which is identified by one of its boundary edges.
    *
    * @param _eh     Edge Handle of a boundary halfedge at a hole that should be filled
-   * @param _stages If not set to 3, tha algorithm will abort after the given stage
+   * @param _stages If not set to 3, the algorithm will abort after the given stage
    *
    */
   void fill_hole( typename MeshT::EdgeHandle _eh, int _stages = 3 );
 
 private:
 
+    struct Hole;
+
+    // Collect the boundary loop starting at the boundary halfedge _hh
+    void collect_hole( OpenMesh::SmartHalfedgeHandle _hh, Hole& _hole ) const;
+
+    // Compute the minimal triangulation of the hole (read only)
+    void triangulate( Hole& _hole ) const;
+
+    // Add the triangulation to the mesh and fair it
+    bool commit( const Hole& _hole, int _stages );
 
     void fairing( std::vector< OpenMesh::SmartFaceHandle >& _faceHandles );
 
+    // Smooth the given vertices, their one-ring stays fixed
+    void smooth_fillings( const std::vector< typename MeshT::VertexHandle >& _vertices,
+                          unsigned int _iterations );
+
     // Remove degenerated faces from the filling
     void removeDegeneratedFaces( std::vector< typename MeshT::FaceHandle >& _faceHandles );
 
@@ -124,20 +146,23 @@ private:
 			const Point & _c ) const;
 
   // Create the triangulation for polygon (_i,...,_j).
-  bool fill( int _i, int _j );
+  bool fill( const Hole& _hole, int _i, int _j );
 
   // Compute the weight of the triangle (_i,_j,_k).
-  Weight weight( int _i, int _j, int _k );
+  Weight weight( const Hole& _hole, int _i, int _j, int _k ) const;
 
   // Does edge (_u,_v) already exist?
-  bool exists_edge( OpenMesh::SmartVertexHandle _u, typename MeshT::VertexHandle _w );
+  bool exists_edge( OpenMesh::SmartVertexHandle _u, typename MeshT::VertexHandle _w ) const;
 
   // Compute the area of the triangle (_a,_b,_c).
-  Scalar area( typename MeshT::VertexHandle _a, typename MeshT::VertexHandle _b, typename MeshT::VertexHandle _c );
+  Scalar area( typename MeshT::VertexHandle _a, typename MeshT::VertexHandle _b, typename MeshT::VertexHandle _c ) const;
 
   // Compute the dihedral angle (in degrees) between triangle
   // (_u,_v,_a) and triangle (_v,_u,_b).
-  Scalar dihedral_angle( typename MeshT::VertexHandle _u, typename MeshT::VertexHandle _v, typename MeshT::VertexHandle _a, typename MeshT::VertexHandle _b );
+  Scalar dihedral_angle( typename MeshT::VertexHandle _u, typename MeshT::VertexHandle _v, typename MeshT::VertexHandle _a, typename MeshT::VertexHandle _b ) const;
+
+  // Index of the pair (_i,_j), _i < _j, in the triangular tables of a hole
+  static size_t index( int _i, int _j ) { return size_t( _j ) * ( _j - 1 ) / 2 + _i; }
 
 
   // The mesh, with each vertex we associate a scale factor that is
@@ -146,17 +171,20 @@ private:
   MeshT & mesh_;
   OpenMesh::VPropHandleT< Scalar > scale_;
 
+  // Marks the triangles of the hole while fairing, false everywhere else
+  OpenMesh::FPropHandleT< bool > hole_face_;
+
   /*
                  HOLE
   
-          boundary_vertex_
+          Hole::boundary
                  |
                  V
        ==*=======*=======*==  BOUNDARY 
         / \     / \     / \   
        /   \   /   \   /   \  
             \ /     \ /      
-             *       * <- opposite_vertex_
+             *       * <- Hole::opposite
   */
 
 
@@ -169,30 +197,35 @@ private:
   typedef typename std::vector< typename MeshT::FaceHandle >::const_iterator CFHVecIter;
 
 
-  // This vector contains all vertices of the hole (in order)
-  std::vector< OpenMesh::SmartVertexHandle > boundary_vertex_;
+  // A hole, its boundary loop and the two central arrays that are needed
+  // for the dynamic programming approach to hole filling. The arrays are
+  // triangular, see index().
+  //   w[index(i,j)] : stores the minimal weight that can be achieved
+  //                   for a triangulation of the polygon
+  //                   boundary[i],...,boundary[j]
+  //   l[index(i,j)] : stores the third index of the triangle
+  //                   <boundary[i],boundary[l[index(i,j)]],boundary[j]>
+  //                   that is needed for reconstructing the minimal triangulation
+
+  struct Hole {
+    // all vertices of the hole (in order)
+    std::vector< OpenMesh::SmartVertexHandle > boundary;
+
+    // all vertices that are opposite to an edge of the hole
+    VHVec opposite;
 
-  // This vector contains all vertices that are opposite to an edge of the hole
-  VHVec opposite_vertex_;
+    // the boundary halfedges of the hole
+    std::vector< typename MeshT::HalfedgeHandle > halfedges;
+
+    std::vector< Weight > w;
+    std::vector< int    > l;
+  };
 
   // This vector contains all edges of the hole (in order)
   std::vector< OpenMesh::SmartEdgeHandle > hole_edge_;
 
   // This vector stores handles to all triangles of the current hole
   std::vector< OpenMesh::SmartFaceHandle > hole_triangle_;
-
-  // These are the two central arrays that are needed for the dynamic
-  // programming approach to hole filling.
-  //   w_[i][j] : stores the minimal weight that can be achieved
-  //              for a triangulation of the polygon
-  //              boundary_vertex_[i],...,boundary_vertex_[j]
-  //   l_[i][j] : stores the third index of the triangle
-  //                <boundary_vertex_[i],boundary_vertex_[l_[i][j]],
-  //                 boundary_vertex_[j]>
-  //              that is needed for reconstructing the minimal triangulation
-
-  std::vector< std::vector< Weight > > w_;
-  std::vector< std::vector< int    > > l_;
 };
 
 } // namespace HoleFiller
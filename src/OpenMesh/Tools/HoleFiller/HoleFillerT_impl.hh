@@ -43,7 +43,8 @@
 
 //=============================================================================
 #include "HoleFillerT.hh"
-#include <OpenMesh/Tools/Smoother/JacobiLaplaceSmootherT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+#include <algorithm>
 //=============================================================================
 
 //== NAMESPACES ===============================================================
@@ -61,6 +62,8 @@ HoleFillerT< MeshT >::HoleFillerT(MeshT &_mesh )
 
   if (! mesh_.get_property_handle(scale_,"scale") )
     mesh_.add_property( scale_ , "scale" );
+
+  mesh_.add_property( hole_face_ );
 }
 
 
@@ -76,6 +79,8 @@ HoleFillerT< MeshT >::~HoleFillerT()
 
   if ( mesh_.get_property_handle(scale_,"scale") )
     mesh_.remove_property( scale_ );
+
+  mesh_.remove_property( hole_face_ );
 }
 
 
@@ -88,40 +93,185 @@ HoleFillerT< MeshT >::~HoleFillerT()
 
 template< class MeshT >
 void
-HoleFillerT< MeshT >::fill_all_holes( int _stages )
+HoleFillerT< MeshT >::fill_all_holes( int _stages, unsigned int _max_threads )
 {
 
 
-  // Collect all boundary edges  
-  std::vector< typename MeshT::EdgeHandle > bdry_edge;
-  
+  // Collect all holes, each one starting at its first boundary edge
+  std::vector< Hole > holes;
+  std::vector< bool > visited( mesh_.n_halfedges(), false );
+
   for (auto ei : mesh_.edges())
     if ( ei.is_boundary() )
-      bdry_edge.push_back( ei );
-  
+    {
+      OpenMesh::SmartHalfedgeHandle hh = ei.h0();
+      if ( ! hh.is_boundary() )
+        hh = hh.opp();
+
+      if ( visited[hh.idx()] )
+        continue;
+
+      holes.push_back( Hole() );
+      collect_hole( hh, holes.back() );
+      for (auto heh : holes.back().halfedges)
+        visited[heh.idx()] = true;
+    }
+
+
+  // Triangulate the holes in parallel, this only reads the mesh
+  omlog() << "Stage 1 : Computing minimal triangulations of " << holes.size() << " holes ... ";
+
+  OpenMesh::parallel_for( holes.size(), 1, [&]( size_t _first, size_t _last ) {
+    for ( size_t i = _first; i < _last; ++i )
+      triangulate( holes[i] );
+  }, _max_threads );
+
+
+  // Fill holes. A hole sharing a vertex with a hole filled before may have
+  // changed, it is collected and triangulated again.
+  const size_t n_old_vertices = mesh_.n_vertices();
+  std::vector< bool > filled( n_old_vertices, false );
+
+  for ( size_t i = 0; i < holes.size(); ++i )
+  {
+    Hole& hole = holes[i];
+
+    bool shared = false;
+    for (auto vh : hole.boundary)
+      shared = shared || filled[vh.idx()];
 
-  // Fill holes
-  int cnt = 0;
-  for (auto i : bdry_edge)
-    if ( mesh_.is_boundary( i ) )
+    if ( shared )
     {
-      ++cnt;
-      omlog() << "Filling hole " << cnt << "\n";
-      fill_hole( i, _stages );
+      const OpenMesh::SmartHalfedgeHandle hh = make_smart( hole.halfedges.front(), mesh_ );
+      if ( ! hh.is_boundary() )
+        continue;
+
+      hole = Hole();
+      collect_hole( hh, hole );
+      triangulate( hole );
     }
+
+    for (auto vh : hole.boundary)
+      filled[vh.idx()] = true;
+
+    omlog() << "Filling hole " << i + 1 << "\n";
+    if ( ! commit( hole, _stages ) )
+      omerr() << "Could not create triangulation" << std::endl;
+
+    // release the tables early, scans can have thousands of holes
+    std::vector< Weight >().swap( hole.w );
+    std::vector< int >().swap( hole.l );
+  }
   
   // Smooth fillings
   if ( _stages <= 2 )
     return;
 
   omlog() << "Stage 3 : Smoothing the hole fillings ... ";
-  
-  OpenMesh::Smoother::JacobiLaplaceSmootherT< MeshT > smoother( mesh_ );
-  smoother.initialize( OpenMesh::Smoother::SmootherT< MeshT >::
-		       Tangential_and_Normal,
-               OpenMesh::Smoother::SmootherT< MeshT >::C1 );
-  
-  smoother.smooth( 500 );
+
+  std::vector< typename MeshT::VertexHandle > new_vertices;
+  for ( size_t i = n_old_vertices; i < mesh_.n_vertices(); ++i )
+    if ( !mesh_.status( typename MeshT::VertexHandle( int( i ) ) ).deleted() )
+      new_vertices.push_back( typename MeshT::VertexHandle( int( i ) ) );
+
+  smooth_fillings( new_vertices, 500 );
+}
+
+
+//=============================================================================
+//
+// Smooth the vertices of the fillings
+//
+//=============================================================================
+
+
+template< class MeshT >
+void
+HoleFillerT< MeshT >::smooth_fillings( const std::vector< typename MeshT::VertexHandle >& _vertices,
+                                       unsigned int _iterations )
+{
+  // C1 Jacobi Laplace smoothing with uniform weights as done by
+  // JacobiLaplaceSmootherT, but only the filled vertices move and only
+  // they and their one-ring are visited, not the whole mesh.
+  typedef typename MeshT::Normal Normal;
+
+  std::vector< typename MeshT::VertexHandle > region;
+  for (auto vh : _vertices)
+    if ( !mesh_.is_boundary( vh ) )
+      region.push_back( vh );
+
+  const size_t n_active = region.size();
+  if ( n_active == 0 )
+    return;
+
+  std::vector< int > local( mesh_.n_vertices(), -1 );
+  for ( size_t i = 0; i < n_active; ++i )
+    local[region[i].idx()] = int( i );
+  for ( size_t i = 0; i < n_active; ++i )
+    for (auto vv : mesh_.vv_range( region[i] ))
+      if ( local[vv.idx()] < 0 )
+      {
+        local[vv.idx()] = int( region.size() );
+        region.push_back( vv );
+      }
+
+  // one-rings in local indices, vertex weights are one over the valence
+  std::vector< int >    offsets( 1, 0 ), neighbors;
+  std::vector< Scalar > weights( region.size() );
+  for ( size_t i = 0; i < region.size(); ++i )
+  {
+    unsigned int valence = 0;
+    for (auto vv : mesh_.vv_range( region[i] ))
+    {
+      if ( i < n_active )
+        neighbors.push_back( local[vv.idx()] );
+      ++valence;
+    }
+    if ( i < n_active )
+      offsets.push_back( int( neighbors.size() ) );
+    weights[i] = valence ? Scalar( 1.0 ) / Scalar( valence ) : Scalar( 0.0 );
+  }
+
+  std::vector< Normal > umbrellas( region.size() );
+  std::vector< Point >  positions( n_active );
+
+  while ( _iterations-- )
+  {
+    // umbrellas of the filled vertices and their one-ring
+    for ( size_t i = 0; i < region.size(); ++i )
+    {
+      Normal u( 0, 0, 0 );
+      for (auto vv : mesh_.vv_range( region[i] ))
+        u -= vector_cast< Normal >( mesh_.point( vv ) );
+      u *= weights[i];
+      u += vector_cast< Normal >( mesh_.point( region[i] ) );
+      umbrellas[i] = u;
+    }
+
+    // updates of the filled vertices
+    for ( size_t i = 0; i < n_active; ++i )
+    {
+      Normal uu( 0, 0, 0 );
+      Scalar diag = 0.0;
+      for ( int j = offsets[i]; j < offsets[i + 1]; ++j )
+      {
+        uu   -= umbrellas[neighbors[j]];
+        diag += weights[neighbors[j]] + Scalar( 1.0 );
+      }
+      uu   *= weights[i];
+      diag *= weights[i];
+      uu   += umbrellas[i];
+      if ( diag ) uu *= Scalar( 1.0 ) / diag;
+
+      // damping
+      uu *= Scalar( 0.25 );
+
+      positions[i] = mesh_.point( region[i] ) - vector_cast< Point >( uu );
+    }
+
+    for ( size_t i = 0; i < n_active; ++i )
+      mesh_.set_point( region[i], positions[i] );
+  }
 }
 
 
@@ -139,9 +289,6 @@ HoleFillerT< MeshT >::fill_hole(typename MeshT::EdgeHandle _eh, int _stages )
 
   omlog() << "  Stage 1 : Computing a minimal triangulation ... ";
 
-  // remember last vertex for selection of new ones
-  typename MeshT::VertexHandle old_last_handle = *(--mesh_.vertices_end());
-
   // No boundary edge, no hole
   if ( ! mesh_.is_boundary( _eh ) ) {
       omerr() << "fill_hole: Given edge handle is not a boundary edge at a hole!" << std::endl;
@@ -153,16 +300,33 @@ HoleFillerT< MeshT >::fill_hole(typename MeshT::EdgeHandle _eh, int _stages )
 
   if ( ! hh.is_boundary() )
     hh = hh.opp();
-  
-  // Collect boundary vertices
-  boundary_vertex_.clear();
-  opposite_vertex_.clear();
-  
-  OpenMesh::SmartHalfedgeHandle ch = hh;
+
+  Hole hole;
+  collect_hole( hh, hole );
+  triangulate( hole );
+
+  if ( ! commit( hole, _stages ) )
+      omerr() << "Could not create triangulation" << std::endl;
+}
+
+
+//=============================================================================
+//
+// Collect the boundary loop of a hole
+//
+//=============================================================================
+
+
+template< class MeshT >
+void
+HoleFillerT< MeshT >::collect_hole( OpenMesh::SmartHalfedgeHandle _hh, Hole& _hole ) const
+{
+  OpenMesh::SmartHalfedgeHandle ch = _hh;
 
   do {
-    boundary_vertex_.push_back( ch.from() );
-    opposite_vertex_.push_back( ch.opp().next().to() );
+    _hole.halfedges.push_back( ch );
+    _hole.boundary.push_back( ch.from() );
+    _hole.opposite.push_back( ch.opp().next().to() );
     //check number of outgoing boundary HEH's at Vertex
     int c = 0;
     OpenMesh::SmartVertexHandle vh = ch.to();
@@ -179,69 +343,95 @@ HoleFillerT< MeshT >::fill_hole(typename MeshT::EdgeHandle _eh, int _stages )
     }else
       ch = ch.next();
 
-  } while ( ch != hh );
+  } while ( ch != _hh );
+}
+
+
+//=============================================================================
+//
+// Compute the minimal triangulation of a hole
+//
+//=============================================================================
+
+
+template< class MeshT >
+void
+HoleFillerT< MeshT >::triangulate( Hole& _hole ) const
+{
+  const int nv = _hole.boundary.size();
+  if ( nv < 2 )
+    return;
 
-  
-  int nv = boundary_vertex_.size();
-  
   // Compute an initial triangulation 
-  w_.clear();
-  w_.resize( nv, std::vector<Weight>( nv, Weight() ) );
-  
-  l_.clear();
-  l_.resize( nv, std::vector<int>( nv, 0 ) );
-  
+  _hole.w.assign( index( 0, nv ), Weight() );
+  _hole.l.assign( index( 0, nv ), 0 );
 
   for ( int i = 0; i < nv - 1; ++i )
-    w_[i][i+1] = Weight( 0, 0 );
+    _hole.w[index( i, i+1 )] = Weight( 0, 0 );
   
   for ( int j = 2; j < nv; ++j )
   {
-    #pragma omp parallel for shared(j, nv)
-    for(int i = 0; i < nv-j; ++i)
-    {
-      Weight valmin;
-      int   argmin = -1;
-      for ( int m = i + 1; m < i + j; ++m )
+    // the rows of a diagonal are independent, large holes use several threads
+    OpenMesh::parallel_for( nv - j, std::max( 16, 4096 / j ), [&]( size_t _first, size_t _last ) {
+      for ( int i = int( _first ); i < int( _last ); ++i )
       {
-	Weight newval = w_[i][m] + w_[m][i+j] + weight( i, m, i+j );
-	if ( newval < valmin )
-	{
-	  valmin = newval;
-	  argmin = m;
-	}
+        Weight valmin;
+        int   argmin = -1;
+        for ( int m = i + 1; m < i + j; ++m )
+        {
+          Weight newval = _hole.w[index( i, m )] + _hole.w[index( m, i+j )] + weight( _hole, i, m, i+j );
+          if ( newval < valmin )
+          {
+            valmin = newval;
+            argmin = m;
+          }
+        }
+
+        _hole.w[index( i, i+j )] = valmin;
+        _hole.l[index( i, i+j )] = argmin;
       }
-      
-      w_[i][i+j] = valmin;
-      l_[i][i+j] = argmin;
-    }
+    });
   }
+}
+
+
+//=============================================================================
+//
+// Add the triangulation of a hole to the mesh, fair it and select the
+// new vertices
+//
+//=============================================================================
+
+
+template< class MeshT >
+bool
+HoleFillerT< MeshT >::commit( const Hole& _hole, int _stages )
+{
+  // remember the number of vertices for selection of new ones
+  const size_t n_old_vertices = mesh_.n_vertices();
 
   // Actually fill the hole. We collect all triangles and edges of
   // this filling for further processing. 
   hole_edge_.clear();
   hole_triangle_.clear();
-  if ( fill( 0, nv - 1 ) ){
+  if ( _hole.boundary.size() < 3 || ! fill( _hole, 0, _hole.boundary.size() - 1 ) )
+    return false;
 
-    if ( _stages <= 1 )
-      return;
-    
-    omlog() << "  Stage 2 : Fairing the filling ... " << std::endl;
-    
-    std::vector< OpenMesh::SmartFaceHandle > handles = hole_triangle_;
-    
-    fairing(handles);
+  if ( _stages <= 1 )
+    return true;
 
-    //select all new vertices
-    typename MeshT::VertexIter old_end = ++typename MeshT::VertexIter(mesh_,old_last_handle);
-    typename MeshT::VertexIter v_end = mesh_.vertices_end();
+  omlog() << "  Stage 2 : Fairing the filling ... " << std::endl;
 
-    for(; old_end != v_end; ++old_end)
-      if ( !mesh_.status(*old_end).deleted() )
-        mesh_.status(*old_end).set_selected( true );
+  std::vector< OpenMesh::SmartFaceHandle > handles = hole_triangle_;
 
-  }else
-      omerr() << "Could not create triangulation" << std::endl;
+  fairing(handles);
+
+  //select all new vertices
+  for ( size_t i = n_old_vertices; i < mesh_.n_vertices(); ++i )
+    if ( !mesh_.status( typename MeshT::VertexHandle( int( i ) ) ).deleted() )
+      mesh_.status( typename MeshT::VertexHandle( int( i ) ) ).set_selected( true );
+
+  return true;
 }
 
 
@@ -255,63 +445,40 @@ HoleFillerT< MeshT >::fairing( std::vector< OpenMesh::SmartFaceHandle >& _faceHa
 
   hole_triangle_ = _faceHandles;
 
-  OpenMesh::EPropHandleT< bool > edgeProp;
-  OpenMesh::VPropHandleT< bool > vertexProp;
-  OpenMesh::FPropHandleT< bool > faceProp;
-  OpenMesh::FPropHandleT< bool > orderProp;
-
-  if (! mesh_.get_property_handle(edgeProp,"edgeProp") )
-    mesh_.add_property( edgeProp, "edgeProp" );
-  if (! mesh_.get_property_handle(vertexProp,"vertexProp") )
-    mesh_.add_property( vertexProp, "vertexProp" ); 
-  if (! mesh_.get_property_handle(faceProp,"faceProp") )
-    mesh_.add_property( faceProp, "faceProp" ); 
-  if (! mesh_.get_property_handle(orderProp,"orderProp") )
-    mesh_.add_property( orderProp, "orderProp" ); 
-
-  //init properties by setting all of them to false
-  for (auto fIt : mesh_.faces()) {
-    mesh_.property( orderProp, fIt ) = false;
-    mesh_.property( faceProp, fIt ) = false;
-  }
-
-  for (auto eIt : mesh_.edges())
-    mesh_.property( edgeProp, eIt ) = false;
-
-  for (auto vIt : mesh_.vertices()) {
-    mesh_.property( vertexProp, vIt ) = false;
-  }
+  // Only the triangles of the hole and their vertices are touched, the
+  // work is proportional to the size of the hole.
 
   //set face property
   for (uint i = 0; i < hole_triangle_.size(); i++){
-    mesh_.property( faceProp, hole_triangle_[i] ) = true;
+    mesh_.property( hole_face_, hole_triangle_[i] ) = true;
   }
 
   //set properties
+  std::vector< OpenMesh::SmartEdgeHandle > locked_edges;
+  std::vector< OpenMesh::SmartVertexHandle > hole_vertices;
   for (unsigned int i = 0; i < hole_triangle_.size(); i++){
       for (auto fei : hole_triangle_[i].edges()) {
       mesh_.status( fei ).set_locked(true);
-      //set edge property for all edges inside the hole (eg not on the hole boundary)
-      if (mesh_.property( faceProp, fei.h0().face() ) &&
-          mesh_.property( faceProp, fei.h1().face() ) ){
+      locked_edges.push_back( fei );
+      //collect all edges inside the hole (eg not on the hole boundary)
+      if (mesh_.property( hole_face_, fei.h0().face() ) &&
+          mesh_.property( hole_face_, fei.h1().face() ) ){
 
-        mesh_.property( edgeProp, fei ) = true;
         hole_edge_.push_back( fei );
         mesh_.status( fei ).set_locked(false);
       }
     }
 
-    /// @TODO, strange iterator at property!
-    for (auto fvi : hole_triangle_[i].vertices()){
-      //set vertex property for all vertices of the hole
-      for ( auto vfi : fvi.faces() )
-        mesh_.property( vertexProp, fvi ) = true;
-    }
+    //collect all vertices of the hole
+    for (auto fvi : hole_triangle_[i].vertices())
+      hole_vertices.push_back( fvi );
   }
 
+  std::sort( hole_vertices.begin(), hole_vertices.end() );
+  hole_vertices.erase( std::unique( hole_vertices.begin(), hole_vertices.end() ), hole_vertices.end() );
+
   //calculate scaling weights for vertices
-  for (auto vIt : mesh_.vertices())
-    if (mesh_.property(vertexProp, vIt)){
+  for (auto vIt : hole_vertices) {
 
       Scalar cnt   = 0;
       Scalar scale = 0;
@@ -321,8 +488,8 @@ HoleFillerT< MeshT >::fairing( std::vector< OpenMesh::SmartFaceHandle >& _faceHa
 
         if (voh_it.face().is_valid() &&
             voh_it.opp().face().is_valid() &&
-            mesh_.property(faceProp, voh_it.face() ) &&
-            mesh_.property(faceProp, voh_it.opp().face() ))
+            mesh_.property(hole_face_, voh_it.face() ) &&
+            mesh_.property(hole_face_, voh_it.opp().face() ))
           continue;
 
         cnt += 1.0f;
@@ -337,10 +504,9 @@ HoleFillerT< MeshT >::fairing( std::vector< OpenMesh::SmartFaceHandle >& _faceHa
       mesh_.property( scale_, vIt ) = scale;
     }
 
-  mesh_.remove_property(edgeProp);
-  mesh_.remove_property(vertexProp);
-  mesh_.remove_property(faceProp);
-  mesh_.remove_property(orderProp);
+  for (uint i = 0; i < hole_triangle_.size(); i++){
+    mesh_.property( hole_face_, hole_triangle_[i] ) = false;
+  }
 
   // Do the patch fairing
   bool did_refine = true;
@@ -358,8 +524,8 @@ HoleFillerT< MeshT >::fairing( std::vector< OpenMesh::SmartFaceHandle >& _faceHa
         relax_edge( hole_edge_[j] );
   }
 
-  // unlock everything
-  for ( auto ei : mesh_.edges())
+  // unlock the edges of the filling
+  for ( auto ei : locked_edges )
     mesh_.status( ei ).set_locked( false );
 }
 
@@ -550,36 +716,39 @@ HoleFillerT< MeshT >::in_circumsphere( const Point & _x,
 
 template< class MeshT >			
 bool
-HoleFillerT< MeshT >::fill( int _i, int _j )
+HoleFillerT< MeshT >::fill( const Hole& _hole, int _i, int _j )
 {
   // If the two vertices _i and _j are adjacent, there is nothing to do.
 
   if ( _i + 1 == _j )
     return true;
-    
+
+  const int l = _hole.l[index( _i, _j )];
+  if ( l < 0 )
+    return false;
 
   // Create and store the middle triangle, store its edges.
     
-  OpenMesh::SmartFaceHandle fh = mesh_.add_face( boundary_vertex_[_i],
-			  boundary_vertex_[ l_[_i][_j] ],
-			  boundary_vertex_[_j] );
+  OpenMesh::SmartFaceHandle fh = mesh_.add_face( _hole.boundary[_i],
+			  _hole.boundary[ l ],
+			  _hole.boundary[_j] );
   hole_triangle_.push_back( fh );
 
   if (!fh.is_valid())
     return false;
 
   hole_edge_.push_back( mesh_.edge_handle
-			( mesh_.find_halfedge( boundary_vertex_[_i],
-					       boundary_vertex_[ l_[_i][_j] ] ) ) );
+			( mesh_.find_halfedge( _hole.boundary[_i],
+					       _hole.boundary[ l ] ) ) );
   hole_edge_.push_back( mesh_.edge_handle
-			( mesh_.find_halfedge( boundary_vertex_[ l_[_i][_j] ],
-					       boundary_vertex_[_j] ) ) );
+			( mesh_.find_halfedge( _hole.boundary[ l ],
+					       _hole.boundary[_j] ) ) );
   
   
   // Recursively create the left and right side of the
   // triangulation.
     
-  if (!fill( _i, l_[_i][_j] ) || !fill( l_[_i][_j], _j ))
+  if (!fill( _hole, _i, l ) || !fill( _hole, l, _j ))
     return false;
   else 
     return true;
@@ -596,14 +765,14 @@ HoleFillerT< MeshT >::fill( int _i, int _j )
 
 template< class MeshT >			
 typename HoleFillerT< MeshT >::Weight
-HoleFillerT< MeshT >::weight( int _i, int _j, int _k )
+HoleFillerT< MeshT >::weight( const Hole& _hole, int _i, int _j, int _k ) const
 {
   // Return an infinite weight if the insertion of this triangle
   // would create complex edges.
 
-  if ( exists_edge( boundary_vertex_[_i], boundary_vertex_[_j] ) ||
-       exists_edge( boundary_vertex_[_j], boundary_vertex_[_k] ) ||
-       exists_edge( boundary_vertex_[_k], boundary_vertex_[_i] ) )
+  if ( exists_edge( _hole.boundary[_i], _hole.boundary[_j] ) ||
+       exists_edge( _hole.boundary[_j], _hole.boundary[_k] ) ||
+       exists_edge( _hole.boundary[_k], _hole.boundary[_i] ) )
     return Weight();
 
 
@@ -611,8 +780,8 @@ HoleFillerT< MeshT >::weight( int _i, int _j, int _k )
   // could not be created.
 
     
-  if ( l_[_i][_j] == -1 ) return Weight();
-  if ( l_[_j][_k] == -1 ) return Weight();
+  if ( _hole.l[index( _i, _j )] == -1 ) return Weight();
+  if ( _hole.l[index( _j, _k )] == -1 ) return Weight();
 
    
   // Compute the maxmimum dihedral angles to the adjacent triangles
@@ -621,37 +790,37 @@ HoleFillerT< MeshT >::weight( int _i, int _j, int _k )
   Scalar angle = 0.0f;
 
   if ( _i + 1 == _j )
-    angle = std::max( angle, dihedral_angle( boundary_vertex_[_i],
-					     boundary_vertex_[_j],
-					     boundary_vertex_[_k],
-					     opposite_vertex_[_i] ) );
+    angle = std::max( angle, dihedral_angle( _hole.boundary[_i],
+					     _hole.boundary[_j],
+					     _hole.boundary[_k],
+					     _hole.opposite[_i] ) );
   else
-    angle = std::max( angle, dihedral_angle( boundary_vertex_[_i],
-					     boundary_vertex_[_j],
-					     boundary_vertex_[_k],
-					     boundary_vertex_[l_[_i][_j]] ) );
+    angle = std::max( angle, dihedral_angle( _hole.boundary[_i],
+					     _hole.boundary[_j],
+					     _hole.boundary[_k],
+					     _hole.boundary[_hole.l[index( _i, _j )]] ) );
     
   if ( _j + 1 == _k )
-    angle = std::max( angle, dihedral_angle( boundary_vertex_[_j],
-					     boundary_vertex_[_k],
-					     boundary_vertex_[_i],
-					     opposite_vertex_[_j] ) );
+    angle = std::max( angle, dihedral_angle( _hole.boundary[_j],
+					     _hole.boundary[_k],
+					     _hole.boundary[_i],
+					     _hole.opposite[_j] ) );
   else
-    angle = std::max( angle, dihedral_angle( boundary_vertex_[_j],
-					     boundary_vertex_[_k],
-					     boundary_vertex_[_i],
-					     boundary_vertex_[l_[_j][_k]] ) );
+    angle = std::max( angle, dihedral_angle( _hole.boundary[_j],
+					     _hole.boundary[_k],
+					     _hole.boundary[_i],
+					     _hole.boundary[_hole.l[index( _j, _k )]] ) );
     
-  if ( _i == 0 && _k == (int) boundary_vertex_.size() - 1 )
-    angle = std::max( angle, dihedral_angle( boundary_vertex_[_k],
-					     boundary_vertex_[_i],
-					     boundary_vertex_[_j],
-					     opposite_vertex_[_k] ) );
+  if ( _i == 0 && _k == (int) _hole.boundary.size() - 1 )
+    angle = std::max( angle, dihedral_angle( _hole.boundary[_k],
+					     _hole.boundary[_i],
+					     _hole.boundary[_j],
+					     _hole.opposite[_k] ) );
 
 
-  return Weight( angle, area( boundary_vertex_[_i],
-			      boundary_vertex_[_j],
-			      boundary_vertex_[_k] ) );
+  return Weight( angle, area( _hole.boundary[_i],
+			      _hole.boundary[_j],
+			      _hole.boundary[_k] ) );
 }
 
 
@@ -665,7 +834,7 @@ HoleFillerT< MeshT >::weight( int _i, int _j, int _k )
 
 template< class MeshT >			
 bool
-HoleFillerT< MeshT >::exists_edge( OpenMesh::SmartVertexHandle _u, typename MeshT::VertexHandle _w )
+HoleFillerT< MeshT >::exists_edge( OpenMesh::SmartVertexHandle _u, typename MeshT::VertexHandle _w ) const
 {
   for ( auto vohi : _u.outgoing_halfedges() )
     if ( ! vohi.edge().is_boundary() )
@@ -686,11 +855,14 @@ HoleFillerT< MeshT >::exists_edge( OpenMesh::SmartVertexHandle _u, typename Mesh
 
 template< class MeshT >			
 typename MeshT::Scalar
-HoleFillerT< MeshT >::area( typename MeshT::VertexHandle _a, typename MeshT::VertexHandle _b, typename MeshT::VertexHandle _c )
+HoleFillerT< MeshT >::area( typename MeshT::VertexHandle _a, typename MeshT::VertexHandle _b, typename MeshT::VertexHandle _c ) const
 {
-  Point a( mesh_.point( _a ) );
-  Point b( mesh_.point( _b ) );
-  Point c( mesh_.point( _c ) );
+  // read through a const mesh, this is called from several threads
+  const MeshT& mesh = mesh_;
+
+  Point a( mesh.point( _a ) );
+  Point b( mesh.point( _b ) );
+  Point c( mesh.point( _c ) );
 
   Point n( cross(( b - a ) , ( c - b )) );
 
@@ -711,12 +883,15 @@ HoleFillerT< MeshT >::area( typename MeshT::VertexHandle _a, typename MeshT::Ver
 
 template< class MeshT >			
 typename MeshT::Scalar
-HoleFillerT< MeshT >::dihedral_angle( typename MeshT::VertexHandle _u, typename MeshT::VertexHandle _v, typename MeshT::VertexHandle _a, typename MeshT::VertexHandle _b )
+HoleFillerT< MeshT >::dihedral_angle( typename MeshT::VertexHandle _u, typename MeshT::VertexHandle _v, typename MeshT::VertexHandle _a, typename MeshT::VertexHandle _b ) const
 {
-  Point u( mesh_.point( _u ) );
-  Point v( mesh_.point( _v ) );
-  Point a( mesh_.point( _a ) );
-  Point b( mesh_.point( _b ) );
+  // read through a const mesh, this is called from several threads
+  const MeshT& mesh = mesh_;
+
+  Point u( mesh.point( _u ) );
+  Point v( mesh.point( _v ) );
+  Point a( mesh.point( _a ) );
+  Point b( mesh.point( _b ) );
 
   Point n0( cross(( v - u ) , ( a - v )) );
   Point n1( cross(( u - v ) , ( b - u )) );
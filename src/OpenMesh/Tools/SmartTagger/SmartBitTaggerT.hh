@@ -0,0 +1,204 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+#pragma once
+
+
+//== INCLUDES =================================================================
+
+// OpenMesh
+#include <OpenMesh/Core/Utils/BitOps.hh>
+#include <OpenMesh/Core/Mesh/Handles.hh>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \brief Smart Tagger storing one bit per element
+ *
+ * Boolean variant of SmartTaggerT. The tags are packed into 64 bit words
+ * which are owned by the tagger, so no mesh property is added. All bulk
+ * operations (untag_all(), n_tagged(), for_each_tagged(), tag_status())
+ * process 64 elements per step and are bound by memory bandwidth.
+ *
+ * - Bit tagging for vertices:  SmartBitTaggerVT;
+ * - Bit tagging for edges:     SmartBitTaggerET;
+ * - Bit tagging for faces:     SmartBitTaggerFT;
+ * - Bit tagging for halfedges: SmartBitTaggerHT;
+ *
+ * Elements added to the mesh after construction are untagged until they
+ * are tagged with set_tag().
+ *
+ * Usage:
+ *
+ * \code
+ * SmartBitTaggerVT< MeshType > tagger(mesh);
+ *
+ * // Tag all selected vertices
+ * tagger.tag_status(OpenMesh::Attributes::SELECTED);
+ *
+ * // Count and visit them
+ * size_t n = tagger.n_tagged();
+ * tagger.for_each_tagged([&](OpenMesh::VertexHandle _vh) { ... });
+ * \endcode
+ */
+template <class Mesh, class EHandle>
+class SmartBitTaggerT
+{
+public:
+
+  /// Constructor, all elements are untagged
+  explicit SmartBitTaggerT(Mesh& _mesh);
+
+  /** \brief untag all elements
+   *
+   * Also adapts the tagger to the current number of elements.
+   */
+  inline void untag_all();
+
+  /** \brief tag all elements
+   *
+   * Also adapts the tagger to the current number of elements.
+   */
+  inline void tag_all();
+
+  /** \brief set or clear the tag of an element
+   *
+   * @param _eh  Handle of the element
+   * @param _tag New tag value
+   */
+  inline void set_tag( const EHandle _eh, bool _tag = true);
+
+  /** \brief get tag of an element
+   *
+   * @param _eh Handle of the element
+   * @return true if the element is tagged
+   */
+  inline bool is_tagged( const EHandle _eh) const;
+
+  /// Number of tagged elements, O(n/64)
+  inline size_t n_tagged() const;
+
+  /** \brief call \c _f(handle) for each tagged element in ascending order
+   *
+   * Runs of untagged elements are skipped 64 at a time.
+   */
+  template <class Functor>
+  inline void for_each_tagged( Functor _f) const;
+
+  /** \brief tag exactly the elements with one of the status bits \c _bits set
+   *
+   * Replaces all tags. The mesh must provide status for the element type.
+   */
+  inline void tag_status( unsigned int _bits);
+
+  /// The packed tags, bit \c i%64 of word \c i/64 belongs to element \c i
+  const std::vector<uint64_t>& words() const { return words_; }
+
+protected:
+
+  inline size_t n_elements() const;
+
+protected:
+
+  // Reference to Mesh
+  Mesh& mesh_;
+
+  // one bit per element
+  std::vector<uint64_t> words_;
+};
+
+
+//== SPECIALIZATION ===========================================================
+
+// define standard bit taggers
+
+template< class Mesh>
+class SmartBitTaggerVT
+    : public SmartBitTaggerT< Mesh, typename Mesh::VertexHandle >
+{
+public:
+  typedef SmartBitTaggerT< Mesh, typename Mesh::VertexHandle > BaseType;
+  explicit SmartBitTaggerVT(Mesh& _mesh) : BaseType(_mesh) {}
+};
+
+template< class Mesh>
+class SmartBitTaggerET
+    : public SmartBitTaggerT< Mesh, typename Mesh::EdgeHandle >
+{
+public:
+  typedef SmartBitTaggerT< Mesh, typename Mesh::EdgeHandle > BaseType;
+  explicit SmartBitTaggerET(Mesh& _mesh) : BaseType(_mesh) {}
+};
+
+template< class Mesh>
+class SmartBitTaggerFT
+    : public SmartBitTaggerT< Mesh, typename Mesh::FaceHandle >
+{
+public:
+  typedef SmartBitTaggerT< Mesh, typename Mesh::FaceHandle > BaseType;
+  explicit SmartBitTaggerFT(Mesh& _mesh) : BaseType(_mesh) {}
+};
+
+template< class Mesh>
+class SmartBitTaggerHT
+    : public SmartBitTaggerT< Mesh, typename Mesh::HalfedgeHandle >
+{
+public:
+  typedef SmartBitTaggerT< Mesh, typename Mesh::HalfedgeHandle > BaseType;
+  explicit SmartBitTaggerHT(Mesh& _mesh) : BaseType(_mesh) {}
+};
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_SMARTBITTAGGERT_C)
+#define OPENMESH_SMARTBITTAGGERT_TEMPLATES
+#include "SmartBitTaggerT_impl.hh"
+#endif
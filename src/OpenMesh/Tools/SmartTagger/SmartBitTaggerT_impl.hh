@@ -0,0 +1,185 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+#define OPENMESH_SMARTBITTAGGERT_C
+
+//== INCLUDES =================================================================
+
+#include "SmartBitTaggerT.hh"
+
+#include <algorithm>
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+//== IMPLEMENTATION ==========================================================
+
+template <class Mesh, class EHandle>
+SmartBitTaggerT<Mesh, EHandle>::
+SmartBitTaggerT(Mesh& _mesh)
+  : mesh_(_mesh)
+{
+  untag_all();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh, class EHandle>
+void
+SmartBitTaggerT<Mesh, EHandle>::
+untag_all()
+{
+  words_.assign((n_elements() + 63) / 64, 0);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh, class EHandle>
+void
+SmartBitTaggerT<Mesh, EHandle>::
+tag_all()
+{
+  const size_t n = n_elements();
+  words_.assign((n + 63) / 64, ~uint64_t(0));
+
+  // keep the bits beyond the last element clear
+  if (n % 64)
+    words_.back() = (uint64_t(1) << (n % 64)) - 1;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh, class EHandle>
+void
+SmartBitTaggerT<Mesh, EHandle>::
+set_tag( const EHandle _eh, bool _tag)
+{
+  const size_t idx = static_cast<size_t>(_eh.idx());
+
+  // element added after the last reset
+  if (idx / 64 >= words_.size())
+  {
+    if (!_tag)
+      return;
+    words_.resize(std::max(idx / 64 + 1, (n_elements() + 63) / 64), 0);
+  }
+
+  const uint64_t mask = uint64_t(1) << (idx % 64);
+  if (_tag)
+    words_[idx / 64] |= mask;
+  else
+    words_[idx / 64] &= ~mask;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh, class EHandle>
+bool
+SmartBitTaggerT<Mesh, EHandle>::
+is_tagged( const EHandle _eh) const
+{
+  const size_t idx = static_cast<size_t>(_eh.idx());
+  return idx / 64 < words_.size() && ((words_[idx / 64] >> (idx % 64)) & 1);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh, class EHandle>
+size_t
+SmartBitTaggerT<Mesh, EHandle>::
+n_tagged() const
+{
+  return Utils::popcount(words_.data(), words_.size());
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh, class EHandle>
+template <class Functor>
+void
+SmartBitTaggerT<Mesh, EHandle>::
+for_each_tagged( Functor _f) const
+{
+  Utils::for_each_set_bit(words_.data(), words_.size(),
+                          [&_f](size_t _idx) { _f(EHandle(static_cast<int>(_idx))); });
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh, class EHandle>
+void
+SmartBitTaggerT<Mesh, EHandle>::
+tag_status( unsigned int _bits)
+{
+  mesh_.pack_status_bits(EHandle(), _bits, words_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh, class EHandle>
+size_t
+SmartBitTaggerT<Mesh, EHandle>::
+n_elements() const
+{
+  return mesh_.template n_elements<EHandle>();
+}
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
@@ -45,6 +45,7 @@
 
 #include "SmartTaggerT.hh"
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 
@@ -193,11 +194,9 @@ void
 SmartTaggerT<Mesh, EHandle, EPHandle>::
 all_tags_to_zero()
 {
-  // iterate over property vector
-  for(unsigned int i=0; i<mesh_.property(ep_tag_).n_elements(); ++i)
-  {
-    mesh_.property(ep_tag_)[i] = 0;
-  }
+  // clear the whole property vector at once
+  auto& tags = mesh_.property(ep_tag_).data_vector();
+  std::fill(tags.begin(), tags.end(), 0u);
 }
 
 //=============================================================================
@@ -155,10 +155,8 @@ set_active_vertices()
 
 
   // is something selected?
-  bool nothing_selected(true);
-  for (v_it=mesh_.vertices_begin(); v_it!=v_end; ++v_it)
-    if (mesh_.status(*v_it).selected())
-    { nothing_selected = false; break; }
+  bool nothing_selected = !mesh_.any_status_bits(typename Mesh::VertexHandle(),
+                                                 Attributes::SELECTED);
 
 
   // tagg all active vertices
@@ -0,0 +1,249 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+#ifndef OPENMESH_BVH_HH
+#define OPENMESH_BVH_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Mesh/TopologyJournal.hh>
+#include <limits>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Bounding volume hierarchy over the faces of a mesh.
+ *
+ *  Polygons are split into a triangle fan, every triangle is one primitive.
+ *  The hierarchy is built top-down with binned SAH splits. The primitive
+ *  bounds and the subtrees below the top levels are built on the global
+ *  ThreadPool, the result does not depend on the number of threads.
+ *
+ *  Queries:
+ *  - closest_point(): closest point on the surface,
+ *  - k_nearest_vertices(): nearest vertices incident to faces,
+ *  - intersect(): first hit along a ray,
+ *  - faces_in_box(): faces whose triangles' bounds overlap a box,
+ *  - max_distance(): one-sided Hausdorff distance from the vertices of
+ *    another mesh, e.g. for mesh to mesh comparisons after decimation.
+ *
+ *  After moving vertices, refit() updates the bounds without changing
+ *  the tree, refit(vertices) only updates the leaves around the given
+ *  vertices and their ancestors. Topology changes need a new build(),
+ *  update() picks the cheapest option using the topology journal.
+ *  Deleted faces are skipped.
+ *
+ *  The queries are const and may be called from several threads.
+ *
+ *  \code
+ *  OpenMesh::Utils::BVHT<MyMesh> bvh(mesh);
+ *  bvh.build();
+ *  auto cp = bvh.closest_point(p);
+ *  if (cp.face.is_valid()) ... cp.point, std::sqrt(cp.sqr_distance) ...
+ *  \endcode
+ */
+template <class Mesh>
+class BVHT
+{
+public:
+
+  typedef typename Mesh::Point           Point;
+  typedef typename Mesh::Scalar          Scalar;
+  typedef typename Mesh::VertexHandle    VertexHandle;
+  typedef typename Mesh::HalfedgeHandle  HalfedgeHandle;
+  typedef typename Mesh::FaceHandle      FaceHandle;
+
+  /// Result of closest_point(), \c face is invalid if nothing was found
+  struct ClosestPoint
+  {
+    FaceHandle face;
+    Point      point;
+    Scalar     sqr_distance;
+  };
+
+  /// Result of intersect(), \c face is invalid if the ray misses
+  struct RayHit
+  {
+    FaceHandle face;
+    Point      point;
+    Scalar     t;
+  };
+
+public:
+
+  /** constructor, call build() before querying. The mesh is only read,
+   *  it is non-const because building and refitting take a checkpoint of
+   *  its topology journal. */
+  explicit BVHT(Mesh& _mesh);
+
+  /// destructor
+  ~BVHT() {}
+
+  /// (Re)build the hierarchy using at most _max_threads threads (0: no limit)
+  void build(unsigned int _max_threads = 0);
+
+  /// Update all bounds after vertices moved
+  void refit();
+
+  /// Update the bounds around the moved vertices _vhs only
+  void refit(const std::vector<VertexHandle>& _vhs);
+
+  /** Bring the hierarchy up to date with the changes recorded in the
+   *  topology journal of the mesh, see ArrayKernel::request_journal().
+   *  Moved vertices are refit, topology changes cause a rebuild. Returns
+   *  true if the hierarchy was rebuilt. */
+  bool update();
+
+  /// Number of nodes, 0 if not built
+  size_t n_nodes() const { return nodes_.size(); }
+
+  /// Number of triangles
+  size_t n_triangles() const { return triangles_.size(); }
+
+  //--- queries ---------------------------------------------------------------
+
+  /// Closest point on the surface within _max_distance of _p
+  ClosestPoint closest_point(const Point& _p,
+                             Scalar _max_distance = std::numeric_limits<Scalar>::max()) const;
+
+  /// The (at most) _k vertices closest to _p, sorted by distance
+  std::vector<VertexHandle> k_nearest_vertices(const Point& _p, size_t _k) const;
+
+  /// First intersection of the ray _origin + t * _direction, 0 <= t <= _t_max
+  RayHit intersect(const Point& _origin, const Point& _direction,
+                   Scalar _t_max = std::numeric_limits<Scalar>::max()) const;
+
+  /// Faces with a triangle whose bounds overlap the box [_min, _max]
+  std::vector<FaceHandle> faces_in_box(const Point& _min, const Point& _max) const;
+
+  /** Maximal distance of the vertices of _other to the surface, computed
+   *  in parallel. _other may be of a different mesh type. */
+  template <class OtherMesh>
+  Scalar max_distance(const OtherMesh& _other) const;
+
+private:
+
+  struct Node
+  {
+    Point bmin, bmax;
+    int   first;  // leaf: first triangle, inner: left child (right child is first+1)
+    int   count;  // leaf: number of triangles, inner: 0
+  };
+
+  struct Triangle
+  {
+    int        v[3];
+    FaceHandle face;
+  };
+
+  struct Task
+  {
+    int node, first, last;
+  };
+
+  void compute_triangle_bounds(unsigned int _max_threads);
+
+  void build_node(std::vector<Node>& _nodes, int _node, int _first, int _last,
+                  std::vector<Task>* _tasks, int _task_size);
+
+  void refit_node(int _node);
+  void compute_parents();
+
+  const Point& point(int _v) const { return mesh_.point(VertexHandle(_v)); }
+
+  static Scalar sqr_distance(const Point& _p, const Point& _bmin, const Point& _bmax);
+
+  static Point closest_point_triangle(const Point& _p, const Point& _a,
+                                      const Point& _b, const Point& _c);
+
+  static bool ray_box(const Point& _origin, const Point& _inv_direction,
+                      const Node& _node, Scalar _t_max, Scalar& _t_near);
+
+private:
+
+  const Mesh&      mesh_;
+  TopologyJournal& journal_;
+
+  std::vector<Node>     nodes_;
+  std::vector<Triangle> triangles_;
+  std::vector<Point>    tri_min_, tri_max_, tri_center_;
+
+  // triangle order while building, leaves refer to ranges of it
+  std::vector<int> order_;
+
+  // for refit(vertices): leaf of each triangle, parent of each node and
+  // the triangles of each face (CSR)
+  std::vector<int> leaf_;
+  std::vector<int> parent_;
+  std::vector<int> face_offsets_;
+  std::vector<int> face_triangles_;
+
+  // journal position of the last build or refit
+  TopologyJournal::Position position_;
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_BVH_C)
+#define OPENMESH_BVH_TEMPLATES
+#include "BVHT_impl.hh"
+#endif
+//=============================================================================
+#endif // OPENMESH_BVH_HH defined
+//=============================================================================
@@ -0,0 +1,926 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+#define OPENMESH_BVH_C
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Tools/Utils/BVHT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+#include <OpenMesh/Core/Utils/vector_cast.hh>
+#include <algorithm>
+#include <cmath>
+
+
+//== NAMESPACES ==============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== IMPLEMENTATION ==========================================================
+
+
+namespace BVH {
+
+// binned SAH parameters
+static const int n_bins        = 16;
+static const int max_leaf_size = 4;
+
+template <class Point>
+inline typename Point::value_type half_area(const Point& _bmin, const Point& _bmax)
+{
+  const Point d = _bmax - _bmin;
+  return d[0]*d[1] + d[1]*d[2] + d[2]*d[0];
+}
+
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+BVHT<Mesh>::
+BVHT(Mesh& _mesh)
+  : mesh_(_mesh), journal_(_mesh.journal()), position_(0)
+{
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BVHT<Mesh>::
+build(unsigned int _max_threads)
+{
+  nodes_.clear();
+  triangles_.clear();
+
+  // split faces into triangle fans
+  const bool face_status = mesh_.has_face_status();
+  for (size_t i = 0; i < mesh_.n_faces(); ++i)
+  {
+    const FaceHandle fh(static_cast<int>(i));
+    if (face_status && mesh_.status(fh).deleted())
+      continue;
+
+    const HalfedgeHandle h0 = mesh_.halfedge_handle(fh);
+    Triangle t;
+    t.v[0] = mesh_.to_vertex_handle(h0).idx();
+    t.face = fh;
+    for (HalfedgeHandle h = mesh_.next_halfedge_handle(h0);
+         mesh_.next_halfedge_handle(h) != h0;
+         h = mesh_.next_halfedge_handle(h))
+    {
+      t.v[1] = mesh_.to_vertex_handle(h).idx();
+      t.v[2] = mesh_.to_vertex_handle(mesh_.next_halfedge_handle(h)).idx();
+      triangles_.push_back(t);
+    }
+  }
+
+  compute_triangle_bounds(_max_threads);
+
+  const int n = int(triangles_.size());
+  if (n > 0)
+  {
+    order_.resize(n);
+    for (int i = 0; i < n; ++i)
+      order_[i] = i;
+
+    // build the top levels serially, collecting the subtrees as tasks
+    std::vector<Task> tasks;
+    nodes_.reserve(2 * n);
+    nodes_.resize(1);
+    build_node(nodes_, 0, 0, n, &tasks, std::max(n / 64, 1024));
+
+    // build the subtrees in parallel
+    std::vector< std::vector<Node> > subtrees(tasks.size());
+    parallel_for(tasks.size(), 1, [&](size_t _first, size_t _last) {
+      for (size_t i = _first; i < _last; ++i)
+      {
+        subtrees[i].reserve(2 * (tasks[i].last - tasks[i].first));
+        subtrees[i].resize(1);
+        build_node(subtrees[i], 0, tasks[i].first, tasks[i].last, nullptr, 0);
+      }
+    }, _max_threads);
+
+    // stitch them into the tree, the subtree root replaces the task node,
+    // the other nodes are appended
+    for (size_t i = 0; i < tasks.size(); ++i)
+    {
+      const int base = int(nodes_.size()) - 1;
+      for (size_t j = 0; j < subtrees[i].size(); ++j)
+      {
+        Node node = subtrees[i][j];
+        if (node.count == 0)
+          node.first += base;
+        if (j == 0)
+          nodes_[tasks[i].node] = node;
+        else
+          nodes_.push_back(node);
+      }
+    }
+
+    // bring the triangles into leaf order
+    std::vector<Triangle> triangles(n);
+    std::vector<Point>    tri_min(n), tri_max(n), tri_center(n);
+    for (int i = 0; i < n; ++i)
+    {
+      triangles[i]  = triangles_[order_[i]];
+      tri_min[i]    = tri_min_[order_[i]];
+      tri_max[i]    = tri_max_[order_[i]];
+      tri_center[i] = tri_center_[order_[i]];
+    }
+    triangles_.swap(triangles);
+    tri_min_.swap(tri_min);
+    tri_max_.swap(tri_max);
+    tri_center_.swap(tri_center);
+    std::vector<int>().swap(order_);
+  }
+
+  compute_parents();
+
+  // triangles of each face
+  face_offsets_.assign(mesh_.n_faces() + 1, 0);
+  for (size_t i = 0; i < triangles_.size(); ++i)
+    ++face_offsets_[triangles_[i].face.idx() + 1];
+  for (size_t i = 1; i < face_offsets_.size(); ++i)
+    face_offsets_[i] += face_offsets_[i - 1];
+  face_triangles_.resize(triangles_.size());
+  std::vector<int> cursor(face_offsets_.begin(), face_offsets_.end() - 1);
+  for (size_t i = 0; i < triangles_.size(); ++i)
+    face_triangles_[cursor[triangles_[i].face.idx()]++] = int(i);
+
+  position_ = journal_.checkpoint();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BVHT<Mesh>::
+compute_triangle_bounds(unsigned int _max_threads)
+{
+  const size_t n = triangles_.size();
+  tri_min_.resize(n);
+  tri_max_.resize(n);
+  tri_center_.resize(n);
+
+  parallel_for(n, 4096, [&](size_t _first, size_t _last) {
+    for (size_t i = _first; i < _last; ++i)
+    {
+      const Triangle& t = triangles_[i];
+      tri_min_[i] = tri_max_[i] = point(t.v[0]);
+      for (int j = 1; j < 3; ++j)
+      {
+        tri_min_[i].minimize(point(t.v[j]));
+        tri_max_[i].maximize(point(t.v[j]));
+      }
+      tri_center_[i] = (tri_min_[i] + tri_max_[i]) * Scalar(0.5);
+    }
+  }, _max_threads);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BVHT<Mesh>::
+build_node(std::vector<Node>& _nodes, int _node, int _first, int _last,
+           std::vector<Task>* _tasks, int _task_size)
+{
+  // bounds of the triangles and of their centers
+  Point bmin = tri_min_[order_[_first]], bmax = tri_max_[order_[_first]];
+  Point cmin = tri_center_[order_[_first]], cmax = cmin;
+  for (int i = _first + 1; i < _last; ++i)
+  {
+    const int t = order_[i];
+    bmin.minimize(tri_min_[t]);
+    bmax.maximize(tri_max_[t]);
+    cmin.minimize(tri_center_[t]);
+    cmax.maximize(tri_center_[t]);
+  }
+  _nodes[_node].bmin  = bmin;
+  _nodes[_node].bmax  = bmax;
+  _nodes[_node].first = _first;
+  _nodes[_node].count = _last - _first;
+
+  const int count = _last - _first;
+  if (_tasks && count <= _task_size)
+  {
+    Task task = { _node, _first, _last };
+    _tasks->push_back(task);
+    return;
+  }
+  if (count <= 2)
+    return;
+
+  // split axis: largest extent of the centers
+  const Point extent = cmax - cmin;
+  int axis = 0;
+  if (extent[1] > extent[axis]) axis = 1;
+  if (extent[2] > extent[axis]) axis = 2;
+  if (!(extent[axis] > Scalar(0)) && count <= BVH::max_leaf_size)
+    return;
+
+  int mid = _first;
+  if (extent[axis] > Scalar(0))
+  {
+    // binned SAH
+    const Scalar scale = Scalar(BVH::n_bins) / extent[axis] * Scalar(0.999999);
+    int  bin_count[BVH::n_bins] = {};
+    Point bin_min[BVH::n_bins], bin_max[BVH::n_bins];
+    for (int i = _first; i < _last; ++i)
+    {
+      const int t = order_[i];
+      const int b = std::min(BVH::n_bins - 1, int((tri_center_[t][axis] - cmin[axis]) * scale));
+      if (bin_count[b]++ == 0)
+      {
+        bin_min[b] = tri_min_[t];
+        bin_max[b] = tri_max_[t];
+      }
+      else
+      {
+        bin_min[b].minimize(tri_min_[t]);
+        bin_max[b].maximize(tri_max_[t]);
+      }
+    }
+
+    // cost of the split in front of bin b, sweeping from the right
+    Scalar right_cost[BVH::n_bins];
+    {
+      Point rmin, rmax;
+      int   rcount = 0;
+      for (int b = BVH::n_bins - 1; b > 0; --b)
+      {
+        if (bin_count[b])
+        {
+          if (rcount == 0) { rmin = bin_min[b]; rmax = bin_max[b]; }
+          else             { rmin.minimize(bin_min[b]); rmax.maximize(bin_max[b]); }
+          rcount += bin_count[b];
+        }
+        right_cost[b] = rcount ? Scalar(rcount) * BVH::half_area(rmin, rmax) : Scalar(0);
+      }
+    }
+
+    Scalar best_cost = std::numeric_limits<Scalar>::max();
+    int    best_bin  = -1;
+    {
+      Point lmin, lmax;
+      int   lcount = 0;
+      for (int b = 1; b < BVH::n_bins; ++b)
+      {
+        if (bin_count[b - 1])
+        {
+          if (lcount == 0) { lmin = bin_min[b - 1]; lmax = bin_max[b - 1]; }
+          else             { lmin.minimize(bin_min[b - 1]); lmax.maximize(bin_max[b - 1]); }
+          lcount += bin_count[b - 1];
+        }
+        if (lcount == 0 || lcount == count)
+          continue;
+        const Scalar cost = Scalar(lcount) * BVH::half_area(lmin, lmax) + right_cost[b];
+        if (cost < best_cost)
+        {
+          best_cost = cost;
+          best_bin  = b;
+        }
+      }
+    }
+
+    // small nodes stay leaves unless splitting pays off
+    if (count <= BVH::max_leaf_size &&
+        !(best_cost < Scalar(count) * BVH::half_area(bmin, bmax)))
+      return;
+
+    if (best_bin > 0)
+    {
+      mid = int(std::partition(order_.begin() + _first, order_.begin() + _last,
+                               [&](int _t) {
+        return std::min(BVH::n_bins - 1, int((tri_center_[_t][axis] - cmin[axis]) * scale)) < best_bin;
+      }) - order_.begin());
+    }
+  }
+
+  // no useful SAH split: median split
+  if (mid <= _first || mid >= _last)
+  {
+    mid = (_first + _last) / 2;
+    std::nth_element(order_.begin() + _first, order_.begin() + mid, order_.begin() + _last,
+                     [&](int _a, int _b) { return tri_center_[_a][axis] < tri_center_[_b][axis]; });
+  }
+
+  const int left = int(_nodes.size());
+  _nodes.resize(_nodes.size() + 2);
+  _nodes[_node].first = left;
+  _nodes[_node].count = 0;
+
+  build_node(_nodes, left,     _first, mid,   _tasks, _task_size);
+  build_node(_nodes, left + 1, mid,    _last, _tasks, _task_size);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BVHT<Mesh>::
+compute_parents()
+{
+  parent_.assign(nodes_.size(), -1);
+  leaf_.assign(triangles_.size(), -1);
+  for (size_t i = 0; i < nodes_.size(); ++i)
+  {
+    const Node& node = nodes_[i];
+    if (node.count == 0)
+    {
+      parent_[node.first]     = int(i);
+      parent_[node.first + 1] = int(i);
+    }
+    else
+    {
+      for (int t = node.first; t < node.first + node.count; ++t)
+        leaf_[t] = int(i);
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BVHT<Mesh>::
+refit_node(int _node)
+{
+  Node& node = nodes_[_node];
+  if (node.count == 0)
+  {
+    const Node& left  = nodes_[node.first];
+    const Node& right = nodes_[node.first + 1];
+    node.bmin = left.bmin;
+    node.bmax = left.bmax;
+    node.bmin.minimize(right.bmin);
+    node.bmax.maximize(right.bmax);
+  }
+  else
+  {
+    node.bmin = tri_min_[node.first];
+    node.bmax = tri_max_[node.first];
+    for (int t = node.first + 1; t < node.first + node.count; ++t)
+    {
+      node.bmin.minimize(tri_min_[t]);
+      node.bmax.maximize(tri_max_[t]);
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BVHT<Mesh>::
+refit()
+{
+  compute_triangle_bounds(0);
+
+  // children are always stored behind their parent
+  for (size_t i = nodes_.size(); i-- > 0; )
+    refit_node(int(i));
+
+  position_ = journal_.checkpoint();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+BVHT<Mesh>::
+refit(const std::vector<VertexHandle>& _vhs)
+{
+  const int n_faces = int(face_offsets_.size()) - 1;
+  std::vector<int> nodes;
+
+  for (size_t i = 0; i < _vhs.size(); ++i)
+  {
+    if (!mesh_.is_valid_handle(_vhs[i]))
+      continue;
+
+    for (typename Mesh::ConstVertexFaceIter vf_it = mesh_.cvf_iter(_vhs[i]); vf_it.is_valid(); ++vf_it)
+    {
+      const int f = vf_it->idx();
+      if (f >= n_faces)
+        continue;
+
+      for (int j = face_offsets_[f]; j < face_offsets_[f + 1]; ++j)
+      {
+        const int t = face_triangles_[j];
+        const Triangle& tri = triangles_[t];
+        tri_min_[t] = tri_max_[t] = point(tri.v[0]);
+        for (int k = 1; k < 3; ++k)
+        {
+          tri_min_[t].minimize(point(tri.v[k]));
+          tri_max_[t].maximize(point(tri.v[k]));
+        }
+        tri_center_[t] = (tri_min_[t] + tri_max_[t]) * Scalar(0.5);
+        nodes.push_back(leaf_[t]);
+      }
+    }
+  }
+
+  // collect the ancestors, refit bottom-up
+  for (size_t i = 0; i < nodes.size(); ++i)
+    if (parent_[nodes[i]] >= 0)
+      nodes.push_back(parent_[nodes[i]]);
+  std::sort(nodes.begin(), nodes.end());
+  nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+  for (size_t i = nodes.size(); i-- > 0; )
+    refit_node(nodes[i]);
+
+  position_ = journal_.checkpoint();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+BVHT<Mesh>::
+update()
+{
+  const TopologyJournal& journal = journal_;
+  if (!journal.valid(position_))
+  {
+    build();
+    return true;
+  }
+
+  // only vertex entries: the vertices moved, everything else is topology
+  bool topology = false;
+  std::vector<VertexHandle> moved;
+  journal.for_each(position_, [&](const TopologyJournal::Entry& _entry) {
+    if (_entry.kind == TopologyJournal::VERTEX)
+      moved.push_back(VertexHandle(_entry.idx));
+    else
+      topology = true;
+  });
+
+  if (topology)
+  {
+    build();
+    return true;
+  }
+
+  refit(moved);
+  return false;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename BVHT<Mesh>::Scalar
+BVHT<Mesh>::
+sqr_distance(const Point& _p, const Point& _bmin, const Point& _bmax)
+{
+  Scalar d = Scalar(0);
+  for (int i = 0; i < 3; ++i)
+  {
+    const Scalar e = std::max(std::max(_bmin[i] - _p[i], _p[i] - _bmax[i]), Scalar(0));
+    d += e * e;
+  }
+  return d;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename BVHT<Mesh>::Point
+BVHT<Mesh>::
+closest_point_triangle(const Point& _p, const Point& _a, const Point& _b, const Point& _c)
+{
+  // Ericson, Real-Time Collision Detection, 5.1.5
+  const Point ab = _b - _a, ac = _c - _a, ap = _p - _a;
+  const Scalar d1 = (ab | ap), d2 = (ac | ap);
+  if (d1 <= Scalar(0) && d2 <= Scalar(0))
+    return _a;
+
+  const Point bp = _p - _b;
+  const Scalar d3 = (ab | bp), d4 = (ac | bp);
+  if (d3 >= Scalar(0) && d4 <= d3)
+    return _b;
+
+  const Scalar vc = d1 * d4 - d3 * d2;
+  if (vc <= Scalar(0) && d1 >= Scalar(0) && d3 <= Scalar(0))
+    return _a + ab * (d1 / (d1 - d3));
+
+  const Point cp = _p - _c;
+  const Scalar d5 = (ab | cp), d6 = (ac | cp);
+  if (d6 >= Scalar(0) && d5 <= d6)
+    return _c;
+
+  const Scalar vb = d5 * d2 - d1 * d6;
+  if (vb <= Scalar(0) && d2 >= Scalar(0) && d6 <= Scalar(0))
+    return _a + ac * (d2 / (d2 - d6));
+
+  const Scalar va = d3 * d6 - d5 * d4;
+  if (va <= Scalar(0) && (d4 - d3) >= Scalar(0) && (d5 - d6) >= Scalar(0))
+    return _b + (_c - _b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+  const Scalar denom = va + vb + vc;
+  if (!(denom > Scalar(0)))
+    return _a; // degenerate triangle
+  return _a + ab * (vb / denom) + ac * (vc / denom);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename BVHT<Mesh>::ClosestPoint
+BVHT<Mesh>::
+closest_point(const Point& _p, Scalar _max_distance) const
+{
+  ClosestPoint result;
+  result.face = FaceHandle();
+  result.sqr_distance = std::numeric_limits<Scalar>::max();
+
+  Scalar best = (_max_distance < std::sqrt(std::numeric_limits<Scalar>::max()))
+              ? _max_distance * _max_distance : std::numeric_limits<Scalar>::max();
+
+  if (nodes_.empty() || sqr_distance(_p, nodes_[0].bmin, nodes_[0].bmax) > best)
+    return result;
+
+  std::vector<int> stack;
+  stack.reserve(64);
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const Node& node = nodes_[stack.back()];
+    stack.pop_back();
+    if (sqr_distance(_p, node.bmin, node.bmax) > best)
+      continue;
+
+    if (node.count)
+    {
+      for (int t = node.first; t < node.first + node.count; ++t)
+      {
+        const Triangle& tri = triangles_[t];
+        const Point q = closest_point_triangle(_p, point(tri.v[0]), point(tri.v[1]), point(tri.v[2]));
+        const Scalar d = (q - _p).sqrnorm();
+        if (d < best || (d == best && !result.face.is_valid()))
+        {
+          best = d;
+          result.face  = tri.face;
+          result.point = q;
+        }
+      }
+    }
+    else
+    {
+      // visit the nearer child first
+      const Scalar dl = sqr_distance(_p, nodes_[node.first].bmin,     nodes_[node.first].bmax);
+      const Scalar dr = sqr_distance(_p, nodes_[node.first + 1].bmin, nodes_[node.first + 1].bmax);
+      const int near_child = (dl <= dr) ? node.first : node.first + 1;
+      const int far_child  = (dl <= dr) ? node.first + 1 : node.first;
+      if (std::max(dl, dr) <= best) stack.push_back(far_child);
+      if (std::min(dl, dr) <= best) stack.push_back(near_child);
+    }
+  }
+
+  if (result.face.is_valid())
+    result.sqr_distance = best;
+  return result;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+std::vector<typename BVHT<Mesh>::VertexHandle>
+BVHT<Mesh>::
+k_nearest_vertices(const Point& _p, size_t _k) const
+{
+  // max-heap of the best candidates, the farthest on top
+  typedef std::pair<Scalar, int> Candidate;
+  std::vector<Candidate> heap;
+
+  if (_k > 0 && !nodes_.empty())
+  {
+    heap.reserve(_k + 1);
+    std::vector<int> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    while (!stack.empty())
+    {
+      const Node& node = nodes_[stack.back()];
+      stack.pop_back();
+      const Scalar bound = (heap.size() < _k) ? std::numeric_limits<Scalar>::max() : heap.front().first;
+      if (sqr_distance(_p, node.bmin, node.bmax) > bound)
+        continue;
+
+      if (node.count)
+      {
+        for (int t = node.first; t < node.first + node.count; ++t)
+        {
+          for (int j = 0; j < 3; ++j)
+          {
+            const int v = triangles_[t].v[j];
+            const Scalar d = (point(v) - _p).sqrnorm();
+            if (heap.size() == _k && !(d < heap.front().first))
+              continue;
+
+            bool known = false;
+            for (size_t h = 0; h < heap.size() && !known; ++h)
+              known = (heap[h].second == v);
+            if (known)
+              continue;
+
+            heap.push_back(Candidate(d, v));
+            std::push_heap(heap.begin(), heap.end());
+            if (heap.size() > _k)
+            {
+              std::pop_heap(heap.begin(), heap.end());
+              heap.pop_back();
+            }
+          }
+        }
+      }
+      else
+      {
+        const Scalar dl = sqr_distance(_p, nodes_[node.first].bmin,     nodes_[node.first].bmax);
+        const Scalar dr = sqr_distance(_p, nodes_[node.first + 1].bmin, nodes_[node.first + 1].bmax);
+        if (dl <= dr) { stack.push_back(node.first + 1); stack.push_back(node.first); }
+        else          { stack.push_back(node.first);     stack.push_back(node.first + 1); }
+      }
+    }
+  }
+
+  std::sort_heap(heap.begin(), heap.end());
+  std::vector<VertexHandle> result;
+  result.reserve(heap.size());
+  for (size_t i = 0; i < heap.size(); ++i)
+    result.push_back(VertexHandle(heap[i].second));
+  return result;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+BVHT<Mesh>::
+ray_box(const Point& _origin, const Point& _inv_direction, const Node& _node,
+        Scalar _t_max, Scalar& _t_near)
+{
+  Scalar t0 = Scalar(0), t1 = _t_max;
+  for (int i = 0; i < 3; ++i)
+  {
+    Scalar a = (_node.bmin[i] - _origin[i]) * _inv_direction[i];
+    Scalar b = (_node.bmax[i] - _origin[i]) * _inv_direction[i];
+    if (a > b) std::swap(a, b);
+    // NaN (origin on a slab plane of an axis parallel ray) does not cut
+    if (a > t0) t0 = a;
+    if (b < t1) t1 = b;
+    if (t0 > t1)
+      return false;
+  }
+  _t_near = t0;
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename BVHT<Mesh>::RayHit
+BVHT<Mesh>::
+intersect(const Point& _origin, const Point& _direction, Scalar _t_max) const
+{
+  RayHit hit;
+  hit.face = FaceHandle();
+  hit.t    = _t_max;
+
+  Point inv_direction;
+  for (int i = 0; i < 3; ++i)
+    inv_direction[i] = Scalar(1) / _direction[i];
+
+  Scalar t_near;
+  if (nodes_.empty() || !ray_box(_origin, inv_direction, nodes_[0], hit.t, t_near))
+    return hit;
+
+  std::vector<int> stack;
+  stack.reserve(64);
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const Node& node = nodes_[stack.back()];
+    stack.pop_back();
+    if (!ray_box(_origin, inv_direction, node, hit.t, t_near))
+      continue;
+
+    if (node.count)
+    {
+      // Moeller-Trumbore
+      for (int t = node.first; t < node.first + node.count; ++t)
+      {
+        const Triangle& tri = triangles_[t];
+        const Point& a = point(tri.v[0]);
+        const Point e1 = point(tri.v[1]) - a;
+        const Point e2 = point(tri.v[2]) - a;
+        const Point pvec = _direction % e2;
+        const Scalar det = (e1 | pvec);
+        if (det == Scalar(0))
+          continue;
+        const Scalar inv_det = Scalar(1) / det;
+        const Point tvec = _origin - a;
+        const Scalar u = (tvec | pvec) * inv_det;
+        if (u < Scalar(0) || u > Scalar(1))
+          continue;
+        const Point qvec = tvec % e1;
+        const Scalar v = (_direction | qvec) * inv_det;
+        if (v < Scalar(0) || u + v > Scalar(1))
+          continue;
+        const Scalar s = (e2 | qvec) * inv_det;
+        if (s >= Scalar(0) && s <= hit.t && (s < hit.t || !hit.face.is_valid()))
+        {
+          hit.t    = s;
+          hit.face = tri.face;
+        }
+      }
+    }
+    else
+    {
+      // visit the child entered first first
+      Scalar tl, tr;
+      const bool l = ray_box(_origin, inv_direction, nodes_[node.first],     hit.t, tl);
+      const bool r = ray_box(_origin, inv_direction, nodes_[node.first + 1], hit.t, tr);
+      if (l && r)
+      {
+        if (tl <= tr) { stack.push_back(node.first + 1); stack.push_back(node.first); }
+        else          { stack.push_back(node.first);     stack.push_back(node.first + 1); }
+      }
+      else if (l) stack.push_back(node.first);
+      else if (r) stack.push_back(node.first + 1);
+    }
+  }
+
+  if (hit.face.is_valid())
+    hit.point = _origin + _direction * hit.t;
+  return hit;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+std::vector<typename BVHT<Mesh>::FaceHandle>
+BVHT<Mesh>::
+faces_in_box(const Point& _min, const Point& _max) const
+{
+  std::vector<FaceHandle> result;
+  if (nodes_.empty())
+    return result;
+
+  std::vector<int> stack;
+  stack.reserve(64);
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const Node& node = nodes_[stack.back()];
+    stack.pop_back();
+
+    bool overlap = true;
+    for (int i = 0; i < 3 && overlap; ++i)
+      overlap = !(node.bmax[i] < _min[i] || node.bmin[i] > _max[i]);
+    if (!overlap)
+      continue;
+
+    if (node.count)
+    {
+      for (int t = node.first; t < node.first + node.count; ++t)
+      {
+        bool inside = true;
+        for (int i = 0; i < 3 && inside; ++i)
+          inside = !(tri_max_[t][i] < _min[i] || tri_min_[t][i] > _max[i]);
+        if (inside)
+          result.push_back(triangles_[t].face);
+      }
+    }
+    else
+    {
+      stack.push_back(node.first + 1);
+      stack.push_back(node.first);
+    }
+  }
+
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+template <class OtherMesh>
+typename BVHT<Mesh>::Scalar
+BVHT<Mesh>::
+max_distance(const OtherMesh& _other) const
+{
+  const size_t n     = _other.n_vertices();
+  const size_t grain = 1024;
+  std::vector<Scalar> block_max((n + grain - 1) / grain, Scalar(0));
+  const bool vertex_status = _other.has_vertex_status();
+
+  parallel_for(n, grain, [&](size_t _first, size_t _last) {
+    Scalar d = Scalar(0);
+    for (size_t i = _first; i < _last; ++i)
+    {
+      const typename OtherMesh::VertexHandle vh(static_cast<int>(i));
+      if (vertex_status && _other.status(vh).deleted())
+        continue;
+      const ClosestPoint cp = closest_point(vector_cast<Point>(_other.point(vh)));
+      if (cp.face.is_valid())
+        d = std::max(d, cp.sqr_distance);
+    }
+    block_max[_first / grain] = d;
+  });
+
+  Scalar d = Scalar(0);
+  for (size_t i = 0; i < block_max.size(); ++i)
+    d = std::max(d, block_max[i]);
+  return std::sqrt(d);
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
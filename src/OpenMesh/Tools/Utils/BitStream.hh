@@ -0,0 +1,233 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+/** \file Tools/Utils/BitStream.hh
+    Bit granular writer and reader used by the compact progressive mesh
+    format.
+ */
+
+//=============================================================================
+//
+//  CLASS BitWriter, BitReader
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_UTILS_BITSTREAM_HH
+#define OPENMESH_UTILS_BITSTREAM_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+
+//== FUNCTIONS ================================================================
+
+
+/// Number of bits needed to store the values 0 .. _n-1
+inline unsigned int bit_width(uint64_t _n)
+{
+  unsigned int bits = 0;
+  while (bits < 64 && (uint64_t(1) << bits) < _n)
+    ++bits;
+  return bits;
+}
+
+/// Map signed to unsigned values, small magnitudes stay small
+inline uint64_t zigzag_encode(int64_t _v)
+{
+  return (uint64_t(_v) << 1) ^ uint64_t(_v >> 63);
+}
+
+/// Inverse of zigzag_encode()
+inline int64_t zigzag_decode(uint64_t _v)
+{
+  return int64_t(_v >> 1) ^ -int64_t(_v & 1);
+}
+
+/// Number of bits of the exponential Golomb code of order _k for _v
+inline unsigned int exp_golomb_size(uint64_t _v, unsigned int _k)
+{
+  return 2 * bit_width((_v >> _k) + 2) - 1 + _k;
+}
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Appends values of arbitrary bit width to a byte buffer, least
+ *  significant bit first. The byte order of the result does not depend on
+ *  the platform.
+ */
+class BitWriter
+{
+public:
+
+  explicit BitWriter(std::vector<unsigned char>& _buffer)
+    : buffer_(_buffer), bits_(0), n_bits_(0)
+  {}
+
+  /// Append the lowest _n bits of _v, _n <= 32
+  void put(uint64_t _v, unsigned int _n)
+  {
+    bits_ |= (_v & ((uint64_t(1) << _n) - 1)) << n_bits_;
+    n_bits_ += _n;
+    while (n_bits_ >= 8)
+    {
+      buffer_.push_back(static_cast<unsigned char>(bits_));
+      bits_ >>= 8;
+      n_bits_ -= 8;
+    }
+  }
+
+  /// Append _v as exponential Golomb code of order _k, _v < 2^62
+  void put_exp_golomb(uint64_t _v, unsigned int _k)
+  {
+    const uint64_t q = (_v >> _k) + 1;
+    const unsigned int n = bit_width(q + 1) - 1;
+    for (unsigned int i = 0; i < n; i += 32)
+      put(0, n - i < 32 ? n - i : 32);
+    // q in n+1 bits, most significant bit first
+    for (unsigned int i = n + 1; i-- > 0; )
+      put(q >> i, 1);
+    for (unsigned int i = 0; i < _k; i += 32)
+      put(_v >> i, _k - i < 32 ? _k - i : 32);
+  }
+
+  /// Pad the last byte with zeros
+  void flush()
+  {
+    if (n_bits_ > 0)
+      put(0, 8 - n_bits_);
+  }
+
+private:
+
+  std::vector<unsigned char>& buffer_;
+  uint64_t                    bits_;
+  unsigned int                n_bits_;
+};
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Reads values written by BitWriter. Reading past the end yields zeros and
+ *  sets the failure flag.
+ */
+class BitReader
+{
+public:
+
+  BitReader(const unsigned char* _data, size_t _size)
+    : data_(_data), size_(_size), pos_(0), bits_(0), n_bits_(0), fail_(false)
+  {}
+
+  /// Read _n bits, _n <= 32
+  uint64_t get(unsigned int _n)
+  {
+    while (n_bits_ < _n)
+    {
+      if (pos_ < size_)
+        bits_ |= uint64_t(data_[pos_++]) << n_bits_;
+      else
+        fail_ = true;
+      n_bits_ += 8;
+    }
+    const uint64_t v = bits_ & ((uint64_t(1) << _n) - 1);
+    bits_ >>= _n;
+    n_bits_ -= _n;
+    return v;
+  }
+
+  /// Read an exponential Golomb code of order _k
+  uint64_t get_exp_golomb(unsigned int _k)
+  {
+    unsigned int n = 0;
+    while (get(1) == 0)
+      if (++n > 62 || fail_)
+      {
+        fail_ = true;
+        return 0;
+      }
+    uint64_t q = 1;
+    for (unsigned int i = 0; i < n; ++i)
+      q = (q << 1) | get(1);
+    uint64_t v = (q - 1) << _k;
+    for (unsigned int i = 0; i < _k; i += 32)
+      v |= get(_k - i < 32 ? _k - i : 32) << i;
+    return v;
+  }
+
+  /// Has a read run past the end of the data?
+  bool fail() const { return fail_; }
+
+private:
+
+  const unsigned char* data_;
+  size_t               size_;
+  size_t               pos_;
+  uint64_t             bits_;
+  unsigned int         n_bits_;
+  bool                 fail_;
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_UTILS_BITSTREAM_HH defined
+//=============================================================================
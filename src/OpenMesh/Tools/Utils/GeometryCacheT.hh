@@ -0,0 +1,207 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+#ifndef OPENMESH_GEOMETRYCACHE_HH
+#define OPENMESH_GEOMETRYCACHE_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Mesh/TopologyJournal.hh>
+#include <OpenMesh/Core/Utils/Noncopyable.hh>
+#include <OpenMesh/Core/Utils/Property.hh>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Lazily evaluated face normals, areas, centroids and vertex normals.
+ *
+ *  The cache requests the topology journal of the mesh (see
+ *  ArrayKernel::request_journal()) and marks the faces and vertices
+ *  affected by set_point() and by connectivity changes as dirty. The
+ *  accessors recompute a dirty value on demand, refresh() recomputes all
+ *  dirty values in parallel. Moving a few vertices thus costs time
+ *  proportional to their neighborhood instead of a full update_normals().
+ *
+ *  Positions written through the non-const point() reference or the
+ *  points() array are not recorded by the journal, call invalidate() for
+ *  these vertices.
+ *
+ *  If the mesh has face or vertex normals, recomputed normals are written
+ *  to them as well.
+ *
+ *  \code
+ *  OpenMesh::Utils::GeometryCacheT<MyMesh> cache(mesh);
+ *  for (step ...) {
+ *    for (auto vh : moved) mesh.set_point(vh, ...);
+ *    cache.refresh();           // or just call cache.normal(vh) when needed
+ *  }
+ *  \endcode
+ *
+ *  \note The accessors update the cache and are not thread-safe.
+ */
+template <class Mesh>
+class GeometryCacheT : private Noncopyable
+{
+public:
+
+  typedef typename Mesh::Point           Point;
+  typedef typename Mesh::Normal          Normal;
+  typedef typename Mesh::Scalar          Scalar;
+  typedef typename Mesh::VertexHandle    VertexHandle;
+  typedef typename Mesh::HalfedgeHandle  HalfedgeHandle;
+  typedef typename Mesh::EdgeHandle      EdgeHandle;
+  typedef typename Mesh::FaceHandle      FaceHandle;
+
+public:
+
+  /// constructor, all values are dirty
+  explicit GeometryCacheT(Mesh& _mesh);
+
+  /// destructor
+  ~GeometryCacheT();
+
+  /// Normal of face _fh
+  const Normal& normal(FaceHandle _fh)
+  { sync(); return face_data(_fh).normal; }
+
+  /// Area of face _fh (length of its vector area)
+  Scalar area(FaceHandle _fh)
+  { sync(); return face_data(_fh).area; }
+
+  /// Centroid of face _fh
+  const Point& centroid(FaceHandle _fh)
+  { sync(); return face_data(_fh).centroid; }
+
+  /// Normal of vertex _vh, the normalized sum of its face normals
+  const Normal& normal(VertexHandle _vh)
+  { sync(); return vertex_data(_vh).normal; }
+
+  /// Recompute all dirty values on the global ThreadPool
+  void refresh();
+
+  /// Mark the values depending on the position of _vh dirty
+  void invalidate(VertexHandle _vh);
+
+  /// Mark all values dirty
+  void invalidate_all();
+
+  /// Number of dirty faces and vertices
+  size_t n_dirty_faces();
+  size_t n_dirty_vertices();
+
+private:
+
+  struct FaceData
+  {
+    FaceData() : area(0), dirty(false) {}
+
+    Normal normal;
+    Point  centroid;
+    Scalar area;
+    bool   dirty;
+  };
+
+  struct VertexData
+  {
+    VertexData() : dirty(false) {}
+
+    Normal normal;
+    bool   dirty;
+  };
+
+  /// Mark the changes recorded since the last sync() dirty
+  void sync();
+
+  void mark(FaceHandle _fh);
+  void mark(VertexHandle _vh);
+
+  const FaceData&   face_data(FaceHandle _fh);
+  const VertexData& vertex_data(VertexHandle _vh);
+
+  void compute(FaceHandle _fh, FaceData& _data) const;
+  void compute(VertexHandle _vh, VertexData& _data) const;
+
+  bool alive(VertexHandle _vh) const;
+  bool alive(FaceHandle _fh) const;
+
+private:
+
+  // ref to mesh
+  Mesh& mesh_;
+
+  FPropHandleT<FaceData>    face_data_;
+  VPropHandleT<VertexData>  vertex_data_;
+
+  // position in the journal up to which changes are marked
+  TopologyJournal::Position position_;
+
+  // candidates for refresh(), may contain clean elements
+  std::vector<FaceHandle>   dirty_faces_;
+  std::vector<VertexHandle> dirty_vertices_;
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_GEOMETRYCACHE_C)
+#define OPENMESH_GEOMETRYCACHE_TEMPLATES
+#include "GeometryCacheT_impl.hh"
+#endif
+//=============================================================================
+#endif // OPENMESH_GEOMETRYCACHE_HH defined
+//=============================================================================
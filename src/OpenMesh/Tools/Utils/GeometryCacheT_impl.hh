@@ -0,0 +1,455 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+#define OPENMESH_GEOMETRYCACHE_C
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Tools/Utils/GeometryCacheT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+#include <OpenMesh/Core/Utils/vector_traits.hh>
+#include <algorithm>
+
+
+//== NAMESPACES ==============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== IMPLEMENTATION ==========================================================
+
+
+template <class Mesh>
+GeometryCacheT<Mesh>::
+GeometryCacheT(Mesh& _mesh)
+  : mesh_(_mesh)
+{
+  mesh_.add_property(face_data_);
+  mesh_.add_property(vertex_data_);
+  mesh_.request_journal();
+
+  position_ = mesh_.journal().checkpoint();
+  invalidate_all();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+GeometryCacheT<Mesh>::
+~GeometryCacheT()
+{
+  mesh_.release_journal();
+  mesh_.remove_property(vertex_data_);
+  mesh_.remove_property(face_data_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+GeometryCacheT<Mesh>::
+refresh()
+{
+  sync();
+
+  // dirty faces first, the vertex normals depend on them
+  std::vector<FaceHandle> faces;
+  faces.reserve(dirty_faces_.size());
+  for (FaceHandle fh : dirty_faces_)
+    if (alive(fh) && mesh_.property(face_data_, fh).dirty)
+      faces.push_back(fh);
+  std::sort(faces.begin(), faces.end());
+  faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
+  dirty_faces_.clear();
+
+  // the threads write through raw arrays, taken once before the loop
+  // (which also takes private copies of copy-on-write storage)
+  FaceData* face_data = mesh_.property(face_data_).data_vector().data();
+  Normal* face_normals = nullptr;
+  if (mesh_.has_face_normals() && !faces.empty())
+    face_normals = mesh_.property(mesh_.face_normals_pph()).data_vector().data();
+
+  parallel_for(faces.size(), 1024, [&](size_t _first, size_t _last) {
+    for (size_t i = _first; i < _last; ++i)
+    {
+      FaceData& data = face_data[faces[i].idx()];
+      compute(faces[i], data);
+      data.dirty = false;
+      if (face_normals)
+        face_normals[faces[i].idx()] = data.normal;
+    }
+  });
+
+  std::vector<VertexHandle> vertices;
+  vertices.reserve(dirty_vertices_.size());
+  for (VertexHandle vh : dirty_vertices_)
+    if (alive(vh) && mesh_.property(vertex_data_, vh).dirty)
+      vertices.push_back(vh);
+  std::sort(vertices.begin(), vertices.end());
+  vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+  dirty_vertices_.clear();
+
+  VertexData* vertex_data = mesh_.property(vertex_data_).data_vector().data();
+  Normal* vertex_normals = nullptr;
+  if (mesh_.has_vertex_normals() && !vertices.empty())
+    vertex_normals = mesh_.property(mesh_.vertex_normals_pph()).data_vector().data();
+
+  parallel_for(vertices.size(), 1024, [&](size_t _first, size_t _last) {
+    for (size_t i = _first; i < _last; ++i)
+    {
+      VertexData& data = vertex_data[vertices[i].idx()];
+      compute(vertices[i], data);
+      data.dirty = false;
+      if (vertex_normals)
+        vertex_normals[vertices[i].idx()] = data.normal;
+    }
+  });
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+GeometryCacheT<Mesh>::
+invalidate(VertexHandle _vh)
+{
+  if (!alive(_vh))
+    return;
+
+  mark(_vh);
+  for (auto vf_it = mesh_.cvf_iter(_vh); vf_it.is_valid(); ++vf_it)
+    mark(*vf_it);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+GeometryCacheT<Mesh>::
+invalidate_all()
+{
+  dirty_faces_.clear();
+  dirty_vertices_.clear();
+
+  for (size_t i = 0; i < mesh_.n_faces(); ++i)
+  {
+    const FaceHandle fh = FaceHandle(int(i));
+    mesh_.property(face_data_, fh).dirty = true;
+    dirty_faces_.push_back(fh);
+  }
+
+  for (size_t i = 0; i < mesh_.n_vertices(); ++i)
+  {
+    const VertexHandle vh = VertexHandle(int(i));
+    mesh_.property(vertex_data_, vh).dirty = true;
+    dirty_vertices_.push_back(vh);
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+size_t
+GeometryCacheT<Mesh>::
+n_dirty_faces()
+{
+  sync();
+
+  std::sort(dirty_faces_.begin(), dirty_faces_.end());
+  dirty_faces_.erase(std::unique(dirty_faces_.begin(), dirty_faces_.end()), dirty_faces_.end());
+
+  size_t n = 0;
+  for (FaceHandle fh : dirty_faces_)
+    if (alive(fh) && mesh_.property(face_data_, fh).dirty)
+      ++n;
+  return n;
+}
+
+
+template <class Mesh>
+size_t
+GeometryCacheT<Mesh>::
+n_dirty_vertices()
+{
+  sync();
+
+  std::sort(dirty_vertices_.begin(), dirty_vertices_.end());
+  dirty_vertices_.erase(std::unique(dirty_vertices_.begin(), dirty_vertices_.end()), dirty_vertices_.end());
+
+  size_t n = 0;
+  for (VertexHandle vh : dirty_vertices_)
+    if (alive(vh) && mesh_.property(vertex_data_, vh).dirty)
+      ++n;
+  return n;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+GeometryCacheT<Mesh>::
+sync()
+{
+  TopologyJournal& journal = mesh_.journal();
+  if (position_ == journal.end())
+    return;
+
+  // handles changed or too many changes, start over
+  if (!journal.valid(position_))
+  {
+    invalidate_all();
+    position_ = journal.checkpoint();
+    return;
+  }
+
+  journal.for_each(position_, [this](const TopologyJournal::Entry& _e) {
+    switch (_e.kind)
+    {
+      case TopologyJournal::VERTEX:
+        invalidate(VertexHandle(_e.idx));
+        break;
+
+      case TopologyJournal::EDGE:
+      {
+        const EdgeHandle eh(_e.idx);
+        if (!mesh_.is_valid_handle(eh))
+          break;
+        for (int i = 0; i < 2; ++i)
+        {
+          const HalfedgeHandle heh = mesh_.halfedge_handle(eh, i);
+          const FaceHandle     fh  = mesh_.face_handle(heh);
+          const VertexHandle   vh  = mesh_.to_vertex_handle(heh);
+          if (fh.is_valid() && alive(fh))
+            mark(fh);
+          if (alive(vh))
+            mark(vh);
+        }
+        break;
+      }
+
+      case TopologyJournal::FACE:
+      {
+        const FaceHandle fh(_e.idx);
+        if (alive(fh))
+          mark(fh);
+        break;
+      }
+    }
+  });
+
+  position_ = journal.checkpoint();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+GeometryCacheT<Mesh>::
+mark(FaceHandle _fh)
+{
+  FaceData& data = mesh_.property(face_data_, _fh);
+  if (!data.dirty)
+  {
+    data.dirty = true;
+    dirty_faces_.push_back(_fh);
+  }
+
+  // the normals of its vertices depend on the face normal
+  for (auto fv_it = mesh_.cfv_iter(_fh); fv_it.is_valid(); ++fv_it)
+    mark(*fv_it);
+}
+
+
+template <class Mesh>
+void
+GeometryCacheT<Mesh>::
+mark(VertexHandle _vh)
+{
+  VertexData& data = mesh_.property(vertex_data_, _vh);
+  if (!data.dirty)
+  {
+    data.dirty = true;
+    dirty_vertices_.push_back(_vh);
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+const typename GeometryCacheT<Mesh>::FaceData&
+GeometryCacheT<Mesh>::
+face_data(FaceHandle _fh)
+{
+  FaceData& data = mesh_.property(face_data_, _fh);
+  if (data.dirty)
+  {
+    compute(_fh, data);
+    data.dirty = false;
+    if (mesh_.has_face_normals())
+      mesh_.set_normal(_fh, data.normal);
+  }
+  return data;
+}
+
+
+template <class Mesh>
+const typename GeometryCacheT<Mesh>::VertexData&
+GeometryCacheT<Mesh>::
+vertex_data(VertexHandle _vh)
+{
+  VertexData& data = mesh_.property(vertex_data_, _vh);
+  if (data.dirty)
+  {
+    for (auto vf_it = mesh_.cvf_iter(_vh); vf_it.is_valid(); ++vf_it)
+      face_data(*vf_it);
+    compute(_vh, data);
+    data.dirty = false;
+    if (mesh_.has_vertex_normals())
+      mesh_.set_normal(_vh, data.normal);
+  }
+  return data;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+GeometryCacheT<Mesh>::
+compute(FaceHandle _fh, FaceData& _data) const
+{
+  const Mesh& mesh = mesh_;
+
+  _data.normal   = mesh.calc_face_normal(_fh);
+  _data.centroid = mesh.calc_face_centroid(_fh);
+
+  // Newell's vector area
+  Normal n;
+  vectorize(n, Scalar(0));
+  const HalfedgeHandle heh0 = mesh.halfedge_handle(_fh);
+  HalfedgeHandle heh = heh0;
+  const Point* p = &mesh.point(mesh.to_vertex_handle(heh));
+  do
+  {
+    heh = mesh.next_halfedge_handle(heh);
+    const Point& pn = mesh.point(mesh.to_vertex_handle(heh));
+    const Point a = *p - pn;
+    const Point b = *p + pn;
+    n[0] += a[1] * b[2];
+    n[1] += a[2] * b[0];
+    n[2] += a[0] * b[1];
+    p = &pn;
+  } while (heh != heh0);
+
+  _data.area = Scalar(0.5) * norm(n);
+}
+
+
+template <class Mesh>
+void
+GeometryCacheT<Mesh>::
+compute(VertexHandle _vh, VertexData& _data) const
+{
+  const Mesh& mesh = mesh_;
+
+  // as PolyMeshT::calc_vertex_normal() with the cached face normals
+  Normal n;
+  vectorize(n, Scalar(0));
+  for (auto vf_it = mesh.cvf_iter(_vh); vf_it.is_valid(); ++vf_it)
+    n += mesh.property(face_data_, *vf_it).normal;
+
+  const Scalar length = norm(n);
+  if (length != 0.0)
+    n *= (Scalar(1.0) / length);
+
+  _data.normal = n;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+GeometryCacheT<Mesh>::
+alive(VertexHandle _vh) const
+{
+  return mesh_.is_valid_handle(_vh) && !(mesh_.has_vertex_status() && mesh_.status(_vh).deleted());
+}
+
+
+template <class Mesh>
+bool
+GeometryCacheT<Mesh>::
+alive(FaceHandle _fh) const
+{
+  return mesh_.is_valid_handle(_fh) && !(mesh_.has_face_status() && mesh_.status(_fh).deleted());
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,206 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/** \file MeshCheckReport.cc
+ */
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Tools/Utils/MeshCheckReport.hh>
+#include <algorithm>
+#include <ostream>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace Utils {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+MeshCheckReport::MeshCheckReport(size_t _max_samples)
+  : max_samples_(_max_samples)
+{
+  clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void MeshCheckReport::clear()
+{
+  complete_ = true;
+  for (int i = 0; i < N_VIOLATIONS; ++i) {
+    counts_[i] = 0;
+    samples_[i].clear();
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+bool MeshCheckReport::ok() const
+{
+  return n_errors() == 0;
+}
+
+//-----------------------------------------------------------------------------
+
+size_t MeshCheckReport::n_errors() const
+{
+  size_t n = 0;
+  for (int i = 0; i < N_VIOLATIONS; ++i)
+    if (i != VERTEX_NON_MANIFOLD)
+      n += counts_[i];
+  return n;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* MeshCheckReport::description(Violation _v)
+{
+  switch (_v) {
+    case VERTEX_HALFEDGE_INVALID:      return "outgoing halfedge out of range or deleted";
+    case VERTEX_HALFEDGE_FROM:         return "outgoing halfedge does not reference vertex";
+    case VERTEX_HALFEDGE_NOT_BOUNDARY: return "outgoing halfedge not on boundary";
+    case VERTEX_ONE_RING:              return "circulator problem, one ring corrupt";
+    case VERTEX_NON_MANIFOLD:          return "non-manifold";
+    case HALFEDGE_INVALID:             return "handle out of range";
+    case HALFEDGE_ISOLATED_VERTEX:     return "to-vertex has no outgoing halfedge, but it is not isolated";
+    case HALFEDGE_DEGENERATE:          return "to-vertex == from-vertex";
+    case HALFEDGE_PREV_NEXT:           return "prev->next != this";
+    case HALFEDGE_NEXT_FROM:           return "to != next->from";
+    case HALFEDGE_PREV_TO:             return "from != prev->to";
+    case HALFEDGE_NEXT_DELETED:        return "next or prev deleted, halfedges do not form a cycle";
+    case HALFEDGE_ORPHANED:            return "orphaned, not in the one ring of its from-vertex";
+    case FACE_HALFEDGE_INVALID:        return "halfedge out of range, deleted or not on a cycle";
+    case FACE_HALFEDGE:                return "its halfedges reference a different face";
+    default:                           return "unknown";
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+MeshCheckReport::Element MeshCheckReport::element(Violation _v)
+{
+  if (_v < HALFEDGE_INVALID)      return VERTEX;
+  if (_v < FACE_HALFEDGE_INVALID) return HALFEDGE;
+  return FACE;
+}
+
+//-----------------------------------------------------------------------------
+
+void MeshCheckReport::merge(const MeshCheckReport& _other)
+{
+  complete_ = complete_ && _other.complete_;
+
+  for (int i = 0; i < N_VIOLATIONS; ++i) {
+    if (!_other.counts_[i])
+      continue;
+
+    counts_[i] += _other.counts_[i];
+
+    std::vector<int>& s = samples_[i];
+    const size_t n = s.size();
+    s.insert(s.end(), _other.samples_[i].begin(), _other.samples_[i].end());
+    std::inplace_merge(s.begin(), s.begin() + n, s.end());
+    if (s.size() > max_samples_)
+      s.resize(max_samples_);
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+void MeshCheckReport::write(std::ostream& _os) const
+{
+  static const char* element_names[] = { "vertex", "halfedge", "face" };
+
+  for (int i = 0; i < N_VIOLATIONS; ++i) {
+    if (!counts_[i])
+      continue;
+
+    const Violation v = Violation(i);
+    _os << "MeshChecker: " << counts_[i] << " x " << element_names[element(v)]
+        << ": " << description(v);
+
+    for (size_t j = 0; j < samples_[i].size(); ++j)
+      _os << (j ? ", " : " (") << samples_[i][j];
+    if (!samples_[i].empty())
+      _os << (samples_[i].size() < counts_[i] ? ", ...)" : ")");
+    _os << "\n";
+  }
+
+  if (!complete_)
+    _os << "MeshChecker: stopped at the first error\n";
+}
+
+//-----------------------------------------------------------------------------
+
+void MeshCheckReport::write_elements(std::ostream& _os) const
+{
+  static const char* element_names[] = { "vertex", "halfedge", "face" };
+
+  struct Line { int element, idx, violation; };
+  std::vector<Line> lines;
+  for (int i = 0; i < N_VIOLATIONS; ++i)
+    if (i != VERTEX_NON_MANIFOLD)
+      for (int idx : samples_[i])
+        lines.push_back(Line{ int(element(Violation(i))), idx, i });
+
+  std::sort(lines.begin(), lines.end(), [](const Line& _a, const Line& _b) {
+    if (_a.element != _b.element) return _a.element < _b.element;
+    if (_a.idx != _b.idx)         return _a.idx < _b.idx;
+    return _a.violation < _b.violation;
+  });
+
+  for (const Line& l : lines)
+    _os << "MeshChecker: " << element_names[l.element] << " " << l.idx
+        << ": " << description(Violation(l.violation)) << "\n";
+
+  if (!complete_)
+    _os << "MeshChecker: stopped at the first error\n";
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
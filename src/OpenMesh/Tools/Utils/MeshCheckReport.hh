@@ -0,0 +1,186 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/** \file MeshCheckReport.hh
+ */
+
+//=============================================================================
+//
+//  CLASS MeshCheckReport
+//
+//=============================================================================
+
+#ifndef OPENMESH_MESHCHECKREPORT_HH
+#define OPENMESH_MESHCHECKREPORT_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace Utils {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \brief Result of MeshCheckerT::check()
+ *
+ *  Counts the violations of each class and keeps the indices of the first
+ *  max_samples() offending elements (vertices, halfedges or faces, see
+ *  element()) in ascending order. The samples do not depend on the number
+ *  of threads used by the checker.
+ *
+ *  Non-manifold vertices are reported, but are no error: OpenMesh supports
+ *  vertices with several fans of faces, ok() ignores them.
+ *
+ *  \code
+ *  OpenMesh::Utils::MeshCheckReport report;
+ *  OpenMesh::Utils::MeshCheckerT<Mesh> checker(mesh);
+ *  if (!checker.check(report))
+ *    report.write(std::cerr);
+ *  \endcode
+ */
+class OPENMESHDLLEXPORT MeshCheckReport
+{
+public:
+
+  /// Classes of violations
+  enum Violation
+  {
+    VERTEX_HALFEDGE_INVALID,      ///< Outgoing halfedge out of range or deleted
+    VERTEX_HALFEDGE_FROM,         ///< Outgoing halfedge does not start at the vertex
+    VERTEX_HALFEDGE_NOT_BOUNDARY, ///< Boundary vertex whose outgoing halfedge is not a boundary halfedge
+    VERTEX_ONE_RING,              ///< Circulating the one-ring does not return to the start
+    VERTEX_NON_MANIFOLD,          ///< More than one boundary in the one-ring (no error)
+    HALFEDGE_INVALID,             ///< Vertex, next, prev or face handle out of range
+    HALFEDGE_ISOLATED_VERTEX,     ///< To-vertex has no outgoing halfedge
+    HALFEDGE_DEGENERATE,          ///< To-vertex == from-vertex
+    HALFEDGE_PREV_NEXT,           ///< prev->next != this
+    HALFEDGE_NEXT_FROM,           ///< to != next->from
+    HALFEDGE_PREV_TO,             ///< from != prev->to
+    HALFEDGE_NEXT_DELETED,        ///< Next or prev halfedge deleted, the halfedges do not form a cycle
+    HALFEDGE_ORPHANED,            ///< Not reached by circulating around its from-vertex
+    FACE_HALFEDGE_INVALID,        ///< Halfedge out of range or deleted, or the halfedges do not form a cycle
+    FACE_HALFEDGE,                ///< A halfedge of the face references a different face
+    N_VIOLATIONS
+  };
+
+  /// Kinds of elements referenced by the samples
+  enum Element { VERTEX, HALFEDGE, FACE };
+
+public:
+
+  /// Constructor, keeps up to \c _max_samples samples per violation class
+  explicit MeshCheckReport(size_t _max_samples = 10);
+
+  /// Remove all violations
+  void clear();
+
+  /// No errors found (non-manifold vertices are no error)
+  bool ok() const;
+
+  /// False if the checker stopped at the first error
+  bool complete() const { return complete_; }
+
+  /// Number of violations of class \c _v
+  size_t count(Violation _v) const { return counts_[_v]; }
+
+  /// Number of errors of all classes (without non-manifold vertices)
+  size_t n_errors() const;
+
+  /// Indices of the first max_samples() elements violating \c _v, ascending
+  const std::vector<int>& samples(Violation _v) const { return samples_[_v]; }
+
+  /// Maximal number of samples per violation class
+  size_t max_samples() const { return max_samples_; }
+
+  /// Short description of \c _v
+  static const char* description(Violation _v);
+
+  /// Kind of the elements stored as samples of \c _v
+  static Element element(Violation _v);
+
+  /// Write a line per violation class found, including the samples
+  void write(std::ostream& _os) const;
+
+  /** Write a line per sampled element and violation, ordered by element
+   *  kind and index. Non-manifold vertices are skipped. This is the
+   *  output of MeshCheckerT::check(_targets, _os). */
+  void write_elements(std::ostream& _os) const;
+
+public: //----------------------------------------- interface used by the checker
+
+  /// Count a violation of \c _v by element \c _idx
+  void add(Violation _v, int _idx)
+  {
+    if (counts_[_v]++ < max_samples_)
+      samples_[_v].push_back(_idx);
+  }
+
+  /// Add the violations of \c _other, keeping the smallest samples
+  void merge(const MeshCheckReport& _other);
+
+  /// Mark the report as incomplete (early exit)
+  void set_complete(bool _b) { complete_ = _b; }
+
+private:
+
+  size_t           max_samples_;
+  bool             complete_;
+  size_t           counts_[N_VIOLATIONS];
+  std::vector<int> samples_[N_VIOLATIONS];
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_MESHCHECKREPORT_HH defined
+//=============================================================================
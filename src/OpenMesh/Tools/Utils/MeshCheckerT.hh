@@ -53,7 +53,11 @@
 #include <OpenMesh/Core/System/omstream.hh>
 #include <OpenMesh/Core/Utils/GenProg.hh>
 #include <OpenMesh/Core/Mesh/Attributes.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckReport.hh>
+#include <atomic>
+#include <cstdint>
 #include <ostream>
+#include <vector>
 
 
 //== NAMESPACES ===============================================================
@@ -68,6 +72,13 @@ namespace Utils {
 /** Check integrity of mesh.
  *
  *  This class provides several functions to check the integrity of a mesh.
+ *  The vertices, halfedges and faces are checked in parallel on the global
+ *  ThreadPool, all tests walk a bounded number of steps, so corrupt
+ *  connectivity cannot make the checker loop forever or read out of range.
+ *  Without the PrevHalfedge attribute the previous halfedge is searched by
+ *  the checker itself, the walk is capped at the number of halfedges.
+ *
+ *  \see MeshCheckReport for the classes of violations
  */
 template <class Mesh>
 class MeshCheckerT
@@ -75,7 +86,7 @@ class MeshCheckerT
 public:
    
   /// constructor
-  explicit MeshCheckerT(const Mesh& _mesh) : mesh_(_mesh) {}
+  explicit MeshCheckerT(const Mesh& _mesh) : mesh_(_mesh), early_exit_(false) {}
  
   /// destructor
   ~MeshCheckerT() {}
@@ -91,25 +102,66 @@ public:
   };
 
   
-  /// check it, return true iff ok
+  /// check it, return true iff ok. On errors a line per offending element is written to \c _os.
   bool check( unsigned int _targets=CHECK_ALL,
 	      std::ostream&  _os= omerr());
 
+  /** Check the mesh and collect the violations in \c _report (which is
+   *  cleared first), return true iff ok. Orphaned halfedges are only
+   *  detected if both CHECK_VERTICES and CHECK_EDGES are set. */
+  bool check( MeshCheckReport& _report, unsigned int _targets=CHECK_ALL );
+
+  /** Stop at the first error instead of checking the whole mesh
+   *  (default: false). The report then contains at least one error and
+   *  MeshCheckReport::complete() is false. */
+  void set_early_exit(bool _b) { early_exit_ = _b; }
+  bool early_exit() const { return early_exit_; }
+
 
 private:
 
-  bool is_deleted(typename Mesh::VertexHandle _vh) 
+  typedef typename Mesh::VertexHandle   VertexHandle;
+  typedef typename Mesh::HalfedgeHandle HalfedgeHandle;
+  typedef typename Mesh::EdgeHandle     EdgeHandle;
+  typedef typename Mesh::FaceHandle     FaceHandle;
+
+  bool is_deleted(VertexHandle _vh) const
   { return (mesh_.has_vertex_status() ? mesh_.status(_vh).deleted() : false); }
 
-  bool is_deleted(typename Mesh::EdgeHandle _eh) 
+  bool is_deleted(EdgeHandle _eh) const
   { return (mesh_.has_edge_status() ? mesh_.status(_eh).deleted() : false); }
 
-  bool is_deleted(typename Mesh::FaceHandle _fh) 
+  bool is_deleted(HalfedgeHandle _hh) const
+  { return is_deleted(mesh_.edge_handle(_hh)); }
+
+  bool is_deleted(FaceHandle _fh) const
   { return (mesh_.has_face_status() ? mesh_.status(_fh).deleted() : false); }
 
+  /// Handle is in range, i.e. it can be passed to the mesh
+  bool in_range(VertexHandle _vh) const
+  { return _vh.is_valid() && _vh.idx() < int(mesh_.n_vertices()); }
+
+  bool in_range(HalfedgeHandle _hh) const
+  { return _hh.is_valid() && _hh.idx() < int(mesh_.n_halfedges()); }
+
+  /// Previous halfedge of _hh or an invalid handle if the search for it
+  /// leaves the mesh or exceeds the number of halfedges
+  HalfedgeHandle prev_halfedge(HalfedgeHandle _hh) const;
+
+  void check_vertex(VertexHandle _vh, MeshCheckReport& _report,
+                    std::vector< std::atomic<uint64_t> >* _visited) const;
+  void check_halfedge(HalfedgeHandle _hh, MeshCheckReport& _report,
+                      const std::vector< std::atomic<uint64_t> >* _visited) const;
+  void check_face(FaceHandle _fh, MeshCheckReport& _report) const;
+
+  /// Run _check on all indices in [0, _n) in parallel and merge the reports
+  template <class CheckFunction>
+  void check_range(size_t _n, const CheckFunction& _check, MeshCheckReport& _report) const;
+
 
   // ref to mesh
   const Mesh&  mesh_;
+  bool         early_exit_;
 };
 
 
@@ -49,6 +49,9 @@
 
 
 #include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+#include <limits>
+#include <mutex>
 
 
 //== NAMESPACES ============================================================== 
@@ -65,172 +68,321 @@ bool
 MeshCheckerT<Mesh>::
 check(unsigned int _targets, std::ostream& _os)
 {
-  bool  ok(true);
+  // a line per offending element as before, so keep all samples
+  MeshCheckReport report(std::numeric_limits<size_t>::max());
+  const bool ok = check(report, _targets);
+  if (!ok)
+    report.write_elements(_os);
+  return ok;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+MeshCheckerT<Mesh>::
+check(MeshCheckReport& _report, unsigned int _targets)
+{
+  _report.clear();
 
+  // one bit per halfedge, set when circulating around its from-vertex
+  const bool orphans = (_targets & CHECK_VERTICES) && (_targets & CHECK_EDGES);
+  std::vector< std::atomic<uint64_t> > visited(orphans ? (mesh_.n_halfedges() + 63) / 64 : 0);
+  std::vector< std::atomic<uint64_t> >* visited_ptr = orphans ? &visited : nullptr;
+
+  auto stopped = [&]() {
+    if (early_exit_ && !_report.ok()) {
+      _report.set_complete(false);
+      return true;
+    }
+    return false;
+  };
 
 
   //--- vertex checks ---
 
   if (_targets & CHECK_VERTICES)
   {
-    unsigned int                   count;
-    const unsigned int             max_valence(10000);
+    check_range(mesh_.n_vertices(), [&](int _idx, MeshCheckReport& _r) {
+      check_vertex(VertexHandle(_idx), _r, visited_ptr);
+    }, _report);
+  }
 
 
-    for (const auto vh: mesh_.vertices())
-    {
-        /* The outgoing halfedge of a boundary vertex has to be a boundary halfedge */
-        auto heh = vh.halfedge();
-        if (heh.is_valid() && !mesh_.is_boundary(heh))
-        {
-          for (typename Mesh::ConstVertexOHalfedgeIter vh_it(mesh_, vh);
-              vh_it.is_valid(); ++vh_it)
-          {
-            if (mesh_.is_boundary(*vh_it))
-            {
-              _os << "MeshChecker: vertex " << vh
-                  << ": outgoing halfedge not on boundary error\n";
-              ok = false;
-            }
-          }
-        }
-        if (heh.is_valid()) {
-          if (heh.idx() < -1 || heh.idx() >= (int)mesh_.n_halfedges()) {
-              _os << "MeshChecker: vertex " << vh
-                  << " has out-of-bounds outgoing HE: " << heh;
-              ok = false;
-            }
-            if (is_deleted(heh.edge())) {
-              _os << "MeshChecker: vertex " << vh
-                  << " has deleted outgoing HE: " << heh;
-              ok = false;
-            }
-        }
-
-
-      
-        // outgoing halfedge has to refer back to vertex
-        if (mesh_.halfedge_handle(vh).is_valid() &&
-            mesh_.from_vertex_handle(mesh_.halfedge_handle(vh)) != vh)
-        {
-          _os << "MeshChecker: vertex " << vh
-              << ": outgoing halfedge does not reference vertex\n";
-          ok = false;
-        }
-
-
-        // check whether circulators are still in order
-        auto vv_it = mesh_.cvv_cwiter(vh);
-        for (count=0; vv_it.is_valid() && (count < max_valence); ++vv_it, ++count) {};
-        if (count == max_valence)
-        {
-          _os << "MeshChecker: vertex " << vh
-              << ": ++circulator problem, one ring corrupt\n";
-          ok = false;
-        }
-        vv_it = mesh_.cvv_cwiter(vh);
-        for (count=0; vv_it.is_valid() && (count < max_valence); --vv_it, ++count) {};
-        if (count == max_valence)
-        {
-          _os << "MeshChecker: vertex " << vh
-              << ": --circulator problem, one ring corrupt\n";
-          ok = false;
-        }
-    }
+  //--- halfedge checks ---
+
+  if ((_targets & CHECK_EDGES) && !stopped())
+  {
+    check_range(mesh_.n_halfedges(), [&](int _idx, MeshCheckReport& _r) {
+      check_halfedge(HalfedgeHandle(_idx), _r, visited_ptr);
+    }, _report);
   }
 
 
+  //--- face checks ---
+
+  if ((_targets & CHECK_FACES) && !stopped())
+  {
+    check_range(mesh_.n_faces(), [&](int _idx, MeshCheckReport& _r) {
+      check_face(FaceHandle(_idx), _r);
+    }, _report);
+  }
+
+
+  return _report.ok();
+}
+
+
+//-----------------------------------------------------------------------------
 
-  //--- halfedge checks ---
 
-  if (_targets & CHECK_EDGES)
+template <class Mesh>
+template <class CheckFunction>
+void
+MeshCheckerT<Mesh>::
+check_range(size_t _n, const CheckFunction& _check, MeshCheckReport& _report) const
+{
+  std::mutex        mutex;
+  std::atomic<bool> stop(false);
+
+  parallel_for(_n, 16384, [&](size_t _first, size_t _last)
   {
-    typename Mesh::HalfedgeHandle     hstart, hhh;
-    size_t                            n_halfedges = 2*mesh_.n_edges();
+    MeshCheckReport report(_report.max_samples());
 
-    for (const auto hh: mesh_.halfedges())
+    for (size_t i = _first; i < _last; ++i)
     {
-      if (!hh.to().halfedge().is_valid()) {
-            _os << "MeshChecker: vertex " << hh.from()
-                << " has no outgoing halfedge, but it is not isolated.\n";
-            ok = false;
-      }
-      // degenerated halfedge ?
-      if (mesh_.from_vertex_handle(hh) == mesh_.to_vertex_handle(hh))
-      {
-        _os << "MeshChecker: halfedge " << hh
-            << ": to-vertex == from-vertex\n";
-        ok = false;
+      if (early_exit_ && stop.load(std::memory_order_relaxed)) {
+        report.set_complete(false);
+        break;
       }
 
+      _check(int(i), report);
 
-      // next <-> prev check
-      if (mesh_.next_halfedge_handle(mesh_.prev_halfedge_handle(hh)) != hh)
-      {
-        _os << "MeshChecker: halfedge " << hh
-            << ": prev->next != this\n";
-        ok = false;
+      if (early_exit_ && !report.ok()) {
+        stop.store(true, std::memory_order_relaxed);
+        if (i + 1 < _last)
+          report.set_complete(false);
+        break;
       }
+    }
 
-      // heh.to == heh.next.from?
-      if (mesh_.to_vertex_handle(hh) != mesh_.from_vertex_handle(
-                  mesh_.next_halfedge_handle(hh)))
-      {
-        _os << "MeshChecker: halfedge " << hh
-            << ".to != he.next.from\n";
-        ok = false;
-      }
-      // heh.from == heh.prev.to?
-      if (mesh_.from_vertex_handle(hh) != mesh_.to_vertex_handle(
-                  mesh_.prev_halfedge_handle(hh)))
-      {
-        _os << "MeshChecker: halfedge " << hh
-            << ".from != he.prev.to\n";
-        ok = false;
-      }
+    std::lock_guard<std::mutex> lock(mutex);
+    _report.merge(report);
+  });
+}
 
 
-      // halfedges should form a cycle
-      size_t count=0; hstart=hhh=hh;
-      do
-      {
-        hhh = mesh_.next_halfedge_handle(hhh);
-        ++count;
-      } while (hhh != hstart && count < n_halfedges);
+//-----------------------------------------------------------------------------
 
-      if (count == n_halfedges)
-      {
-        _os << "MeshChecker: halfedges starting from " << hh
-            << " do not form a cycle\n";
-        ok = false;
-      }
-    }
+
+template <class Mesh>
+void
+MeshCheckerT<Mesh>::
+check_vertex(VertexHandle _vh, MeshCheckReport& _report,
+             std::vector< std::atomic<uint64_t> >* _visited) const
+{
+  const unsigned int max_valence(10000);
+
+  if (is_deleted(_vh))
+    return;
+
+  const HalfedgeHandle heh = mesh_.halfedge_handle(_vh);
+  if (!heh.is_valid())
+    return;
+
+  if (!in_range(heh)) {
+    _report.add(MeshCheckReport::VERTEX_HALFEDGE_INVALID, _vh.idx());
+    return;
   }
 
+  if (is_deleted(heh))
+    _report.add(MeshCheckReport::VERTEX_HALFEDGE_INVALID, _vh.idx());
 
+  // outgoing halfedge has to refer back to vertex
+  if (mesh_.from_vertex_handle(heh) != _vh)
+    _report.add(MeshCheckReport::VERTEX_HALFEDGE_FROM, _vh.idx());
 
-  //--- face checks ---
 
-  if (_targets & CHECK_FACES)
+  // circulate clockwise, count boundaries and mark the outgoing halfedges
+  unsigned int   count(0), n_boundary(0);
+  HalfedgeHandle hh(heh);
+  do
   {
-    typename Mesh::ConstFaceHalfedgeIter  fh_it;
-
-    for(const auto fh: mesh_.faces()) {
-        for(const auto heh: fh.halfedges()) {
-            if (heh.face() != fh) {
-                _os << "MeshChecker: face " << fh
-                    << ": its halfedge " << heh << " references a different face: "
-                    << heh.face()
-                    << ".\n";
-                ok = false;
-            }
-        }
-    }
+    if (mesh_.is_boundary(hh))
+      ++n_boundary;
+
+    if (_visited && mesh_.from_vertex_handle(hh) == _vh)
+      (*_visited)[hh.idx() / 64].fetch_or(uint64_t(1) << (hh.idx() % 64),
+                                          std::memory_order_relaxed);
+
+    hh = mesh_.next_halfedge_handle(mesh_.opposite_halfedge_handle(hh));
+    ++count;
+  } while (in_range(hh) && hh != heh && count < max_valence);
+
+  const bool cw_ok = (hh == heh);
+
+  // circulate counterclockwise
+  count = 0;
+  hh    = heh;
+  do
+  {
+    hh = prev_halfedge(hh);
+    if (!in_range(hh))
+      break;
+    hh = mesh_.opposite_halfedge_handle(hh);
+    ++count;
+  } while (hh != heh && count < max_valence);
+
+  if (!cw_ok || hh != heh)
+  {
+    _report.add(MeshCheckReport::VERTEX_ONE_RING, _vh.idx());
+    return;
   }
 
+  // the outgoing halfedge of a boundary vertex has to be a boundary halfedge
+  if (n_boundary > 0 && !mesh_.is_boundary(heh))
+    _report.add(MeshCheckReport::VERTEX_HALFEDGE_NOT_BOUNDARY, _vh.idx());
 
+  if (n_boundary > 1)
+    _report.add(MeshCheckReport::VERTEX_NON_MANIFOLD, _vh.idx());
+}
 
-  return ok;
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshCheckerT<Mesh>::
+check_halfedge(HalfedgeHandle _hh, MeshCheckReport& _report,
+               const std::vector< std::atomic<uint64_t> >* _visited) const
+{
+  if (is_deleted(_hh))
+    return;
+
+  const VertexHandle   to   = mesh_.to_vertex_handle(_hh);
+  const VertexHandle   from = mesh_.from_vertex_handle(_hh);
+  const HalfedgeHandle next = mesh_.next_halfedge_handle(_hh);
+  const HalfedgeHandle prev = prev_halfedge(_hh);
+  const FaceHandle     fh   = mesh_.face_handle(_hh);
+
+  if (!in_range(to) || !in_range(from) || !in_range(next) || !in_range(prev) ||
+      fh.idx() >= int(mesh_.n_faces()))
+  {
+    _report.add(MeshCheckReport::HALFEDGE_INVALID, _hh.idx());
+    return;
+  }
+
+  if (!mesh_.halfedge_handle(to).is_valid())
+    _report.add(MeshCheckReport::HALFEDGE_ISOLATED_VERTEX, _hh.idx());
+
+  // degenerated halfedge ?
+  if (from == to)
+    _report.add(MeshCheckReport::HALFEDGE_DEGENERATE, _hh.idx());
+
+  // next <-> prev check
+  if (mesh_.next_halfedge_handle(prev) != _hh)
+    _report.add(MeshCheckReport::HALFEDGE_PREV_NEXT, _hh.idx());
+
+  // heh.to == heh.next.from?
+  if (to != mesh_.from_vertex_handle(next))
+    _report.add(MeshCheckReport::HALFEDGE_NEXT_FROM, _hh.idx());
+
+  // heh.from == heh.prev.to?
+  if (from != mesh_.to_vertex_handle(prev))
+    _report.add(MeshCheckReport::HALFEDGE_PREV_TO, _hh.idx());
+
+  // if every halfedge is the next of its (not deleted) prev, next is a
+  // permutation of the halfedges and they form cycles, no need to walk them
+  if (is_deleted(next) || is_deleted(prev))
+    _report.add(MeshCheckReport::HALFEDGE_NEXT_DELETED, _hh.idx());
+
+  if (_visited &&
+      !((*_visited)[_hh.idx() / 64].load(std::memory_order_relaxed) & (uint64_t(1) << (_hh.idx() % 64))))
+    _report.add(MeshCheckReport::HALFEDGE_ORPHANED, _hh.idx());
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshCheckerT<Mesh>::
+check_face(FaceHandle _fh, MeshCheckReport& _report) const
+{
+  if (is_deleted(_fh))
+    return;
+
+  const HalfedgeHandle heh = mesh_.halfedge_handle(_fh);
+  if (!in_range(heh) || is_deleted(heh)) {
+    _report.add(MeshCheckReport::FACE_HALFEDGE_INVALID, _fh.idx());
+    return;
+  }
+
+  // walk around the face, at most once over all halfedges
+  const size_t   n_halfedges = mesh_.n_halfedges();
+  size_t         count(0);
+  HalfedgeHandle hh(heh);
+  do
+  {
+    if (mesh_.face_handle(hh) != _fh) {
+      _report.add(MeshCheckReport::FACE_HALFEDGE, _fh.idx());
+      return;
+    }
+    hh = mesh_.next_halfedge_handle(hh);
+  } while (in_range(hh) && hh != heh && ++count < n_halfedges);
+
+  if (hh != heh)
+    _report.add(MeshCheckReport::FACE_HALFEDGE_INVALID, _fh.idx());
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename MeshCheckerT<Mesh>::HalfedgeHandle
+MeshCheckerT<Mesh>::
+prev_halfedge(HalfedgeHandle _hh) const
+{
+  if (Mesh::HasPrevHalfedge::my_bool)
+    return mesh_.prev_halfedge_handle(_hh);
+
+  // The kernel walks the face or, for boundary halfedges, the vertex
+  // without limit. Do the same with at most one step per halfedge.
+  const size_t n_halfedges = mesh_.n_halfedges();
+
+  if (mesh_.is_boundary(_hh))
+  {
+    HalfedgeHandle curr = mesh_.opposite_halfedge_handle(_hh);
+    for (size_t count = 0; count < n_halfedges; ++count)
+    {
+      const HalfedgeHandle next = mesh_.next_halfedge_handle(curr);
+      if (!in_range(next))
+        break;
+      if (next == _hh)
+        return curr;
+      curr = mesh_.opposite_halfedge_handle(next);
+    }
+  }
+  else
+  {
+    HalfedgeHandle curr = _hh;
+    for (size_t count = 0; count < n_halfedges; ++count)
+    {
+      const HalfedgeHandle next = mesh_.next_halfedge_handle(curr);
+      if (!in_range(next))
+        break;
+      if (next == _hh)
+        return curr;
+      curr = next;
+    }
+  }
+
+  return HalfedgeHandle();
 }
 
 
@@ -0,0 +1,158 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+#ifndef OPENMESH_MESHREORDER_HH
+#define OPENMESH_MESHREORDER_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Mesh/Handles.hh>
+#include <cstdint>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Reorder the elements of a mesh for memory locality.
+ *
+ *  Meshes from scanners or from decimation followed by garbage_collection()
+ *  have an essentially random element order, so circulators jump around in
+ *  memory. MeshReorderT sorts the vertices along a space-filling curve
+ *  through their positions, then orders edges and faces by their lowest new
+ *  vertex index. Neighboring elements thus end up close to each other in
+ *  all arrays.
+ *
+ *  All registered properties (including points, normals and status) are
+ *  permuted together with the elements, see ArrayKernel::permute(). The
+ *  returned Remap maps old handles to new ones, so handles stored outside
+ *  the mesh can be updated.
+ *
+ *  \code
+ *  OpenMesh::Utils::MeshReorderT<MyMesh> reorder(mesh);
+ *  OpenMesh::Utils::MeshReorderT<MyMesh>::Remap remap = reorder.reorder();
+ *  vh = remap.vertices[vh.idx()];
+ *  \endcode
+ */
+template <class Mesh>
+class MeshReorderT
+{
+public:
+
+  typedef typename Mesh::VertexHandle    VertexHandle;
+  typedef typename Mesh::HalfedgeHandle  HalfedgeHandle;
+  typedef typename Mesh::EdgeHandle      EdgeHandle;
+  typedef typename Mesh::FaceHandle      FaceHandle;
+
+  /// Space-filling curves available for the vertex order
+  enum Curve
+  {
+    Morton,  ///< Z-order, cheapest to compute
+    Hilbert  ///< Hilbert curve, better locality
+  };
+
+  /// Old to new handles, indexed by the old index
+  struct Remap
+  {
+    std::vector<VertexHandle>   vertices;
+    std::vector<HalfedgeHandle> halfedges;
+    std::vector<EdgeHandle>     edges;
+    std::vector<FaceHandle>     faces;
+  };
+
+public:
+
+  /// constructor
+  explicit MeshReorderT(Mesh& _mesh) : mesh_(_mesh) {}
+
+  /// destructor
+  ~MeshReorderT() {}
+
+  /// Reorder vertices along \c _curve, edges and faces follow their vertices.
+  Remap reorder(Curve _curve = Hilbert);
+
+  /** Reorder with a given vertex order, \c _vertex_order[i] is the vertex
+   *  which gets index \c i. Edges and faces follow their vertices. */
+  Remap reorder(const std::vector<VertexHandle>& _vertex_order);
+
+  /// Vertices sorted along \c _curve through their positions.
+  std::vector<VertexHandle> curve_order(Curve _curve) const;
+
+private:
+
+  /// Stable counting sort of the elements by \c _key in [0, _n_keys].
+  template <class HandleT>
+  static std::vector<HandleT> order_by_key(const std::vector<int>& _key, size_t _n_keys);
+
+  static uint64_t morton_key(const uint32_t _x[3]);
+  static uint64_t hilbert_key(uint32_t _x[3]);
+
+private:
+
+  // ref to mesh
+  Mesh& mesh_;
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_MESHREORDER_C)
+#define OPENMESH_MESHREORDER_TEMPLATES
+#include "MeshReorderT_impl.hh"
+#endif
+//=============================================================================
+#endif // OPENMESH_MESHREORDER_HH defined
+//=============================================================================
@@ -0,0 +1,314 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+#define OPENMESH_MESHREORDER_C
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Tools/Utils/MeshReorderT.hh>
+#include <OpenMesh/Core/Utils/vector_traits.hh>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+
+//== NAMESPACES ==============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== IMPLEMENTATION ==========================================================
+
+
+template <class Mesh>
+typename MeshReorderT<Mesh>::Remap
+MeshReorderT<Mesh>::
+reorder(Curve _curve)
+{
+  return reorder(curve_order(_curve));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename MeshReorderT<Mesh>::Remap
+MeshReorderT<Mesh>::
+reorder(const std::vector<VertexHandle>& _vertex_order)
+{
+  const size_t n_v = mesh_.n_vertices();
+  assert(_vertex_order.size() == n_v);
+
+  // new index of each vertex
+  std::vector<int> vnew(n_v);
+  for (size_t i = 0; i < n_v; ++i)
+    vnew[_vertex_order[i].idx()] = static_cast<int>(i);
+
+  // edges and faces follow their lowest vertex, deleted ones go last
+  const int last = static_cast<int>(n_v);
+
+  std::vector<int> ekey(mesh_.n_edges());
+  for (auto eh : mesh_.all_edges())
+  {
+    if (mesh_.has_edge_status() && mesh_.status(eh).deleted())
+      ekey[eh.idx()] = last;
+    else
+      ekey[eh.idx()] = std::min(vnew[mesh_.from_vertex_handle(mesh_.halfedge_handle(eh, 0)).idx()],
+                                vnew[mesh_.to_vertex_handle  (mesh_.halfedge_handle(eh, 0)).idx()]);
+  }
+
+  std::vector<int> fkey(mesh_.n_faces());
+  for (auto fh : mesh_.all_faces())
+  {
+    int key = last;
+    if (!mesh_.has_face_status() || !mesh_.status(fh).deleted())
+      for (auto fv : mesh_.fv_range(fh))
+        key = std::min(key, vnew[fv.idx()]);
+    fkey[fh.idx()] = key;
+  }
+
+  const std::vector<EdgeHandle> edge_order = order_by_key<EdgeHandle>(ekey, n_v);
+  const std::vector<FaceHandle> face_order = order_by_key<FaceHandle>(fkey, n_v);
+
+  mesh_.permute(_vertex_order, edge_order, face_order);
+
+  // report old -> new
+  Remap remap;
+
+  remap.vertices.resize(n_v);
+  for (size_t i = 0; i < n_v; ++i)
+    remap.vertices[_vertex_order[i].idx()] = VertexHandle(static_cast<int>(i));
+
+  remap.edges.resize(edge_order.size());
+  remap.halfedges.resize(2 * edge_order.size());
+  for (size_t i = 0; i < edge_order.size(); ++i)
+  {
+    const int e = edge_order[i].idx();
+    remap.edges[e]           = EdgeHandle(static_cast<int>(i));
+    remap.halfedges[2*e]     = HalfedgeHandle(static_cast<int>(2*i));
+    remap.halfedges[2*e + 1] = HalfedgeHandle(static_cast<int>(2*i + 1));
+  }
+
+  remap.faces.resize(face_order.size());
+  for (size_t i = 0; i < face_order.size(); ++i)
+    remap.faces[face_order[i].idx()] = FaceHandle(static_cast<int>(i));
+
+  return remap;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+std::vector<typename MeshReorderT<Mesh>::VertexHandle>
+MeshReorderT<Mesh>::
+curve_order(Curve _curve) const
+{
+  typedef typename Mesh::Point Point;
+  const size_t dim = std::min<size_t>(3, vector_traits<Point>::size());
+  const size_t n_v = mesh_.n_vertices();
+
+  // bounding box of the finite coordinates
+  double bb_min[3] = { 0.0, 0.0, 0.0 };
+  double bb_max[3] = { 0.0, 0.0, 0.0 };
+  for (size_t k = 0; k < dim; ++k)
+  {
+    bb_min[k] =  std::numeric_limits<double>::max();
+    bb_max[k] = -std::numeric_limits<double>::max();
+  }
+  for (auto vh : mesh_.all_vertices())
+  {
+    const Point& p = mesh_.point(vh);
+    for (size_t k = 0; k < dim; ++k)
+    {
+      const double c = double(p[k]);
+      if (std::isfinite(c))
+      {
+        bb_min[k] = std::min(bb_min[k], c);
+        bb_max[k] = std::max(bb_max[k], c);
+      }
+    }
+  }
+
+  // quantize to 21 bits per axis and sort by curve key. The halved
+  // extent stays finite even if the box spans the whole double range.
+  const double range = double((1u << 21) - 1);
+  double scale[3] = { 0.0, 0.0, 0.0 };
+  for (size_t k = 0; k < dim; ++k)
+    if (bb_max[k] > bb_min[k])
+      scale[k] = range / (0.5 * bb_max[k] - 0.5 * bb_min[k]);
+
+  std::vector< std::pair<uint64_t, int> > keys(n_v);
+  for (auto vh : mesh_.all_vertices())
+  {
+    const Point& p = mesh_.point(vh);
+    uint32_t x[3] = { 0, 0, 0 };
+    for (size_t k = 0; k < dim; ++k)
+    {
+      // NaN and infinite coordinates go to the upper end of the axis
+      const double c = double(p[k]);
+      double q = std::isfinite(c) ? (0.5 * c - 0.5 * bb_min[k]) * scale[k] : range;
+      q = std::min(std::max(q, 0.0), range);
+      x[k] = static_cast<uint32_t>(q);
+    }
+
+    keys[vh.idx()] = std::make_pair(_curve == Hilbert ? hilbert_key(x) : morton_key(x), vh.idx());
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<VertexHandle> order(n_v);
+  for (size_t i = 0; i < n_v; ++i)
+    order[i] = VertexHandle(keys[i].second);
+  return order;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+template <class HandleT>
+std::vector<HandleT>
+MeshReorderT<Mesh>::
+order_by_key(const std::vector<int>& _key, size_t _n_keys)
+{
+  // histogram -> bucket offsets -> scatter
+  std::vector<size_t> offset(_n_keys + 2, 0);
+  for (size_t i = 0; i < _key.size(); ++i)
+    ++offset[_key[i] + 1];
+  for (size_t k = 1; k < offset.size(); ++k)
+    offset[k] += offset[k-1];
+
+  std::vector<HandleT> order(_key.size());
+  for (size_t i = 0; i < _key.size(); ++i)
+    order[offset[_key[i]]++] = HandleT(static_cast<int>(i));
+  return order;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+uint64_t
+MeshReorderT<Mesh>::
+morton_key(const uint32_t _x[3])
+{
+  // spread the lower 21 bits so that two zero bits follow each bit
+  auto spread = [](uint64_t _v) -> uint64_t
+  {
+    _v &= 0x1fffff;
+    _v = (_v | (_v << 32)) & 0x1f00000000ffffULL;
+    _v = (_v | (_v << 16)) & 0x1f0000ff0000ffULL;
+    _v = (_v | (_v <<  8)) & 0x100f00f00f00f00fULL;
+    _v = (_v | (_v <<  4)) & 0x10c30c30c30c30c3ULL;
+    _v = (_v | (_v <<  2)) & 0x1249249249249249ULL;
+    return _v;
+  };
+
+  return (spread(_x[0]) << 2) | (spread(_x[1]) << 1) | spread(_x[2]);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+uint64_t
+MeshReorderT<Mesh>::
+hilbert_key(uint32_t _x[3])
+{
+  // J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004
+  const int      bits = 21;
+  const uint32_t M    = 1u << (bits - 1);
+  uint32_t P, Q, t;
+
+  // inverse undo
+  for (Q = M; Q > 1; Q >>= 1)
+  {
+    P = Q - 1;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (_x[i] & Q)
+        _x[0] ^= P;
+      else
+      {
+        t = (_x[0] ^ _x[i]) & P;
+        _x[0] ^= t;
+        _x[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i = 1; i < 3; ++i)
+    _x[i] ^= _x[i-1];
+  t = 0;
+  for (Q = M; Q > 1; Q >>= 1)
+    if (_x[2] & Q)
+      t ^= Q - 1;
+  for (int i = 0; i < 3; ++i)
+    _x[i] ^= t;
+
+  // interleave the transposed index
+  uint64_t key = 0;
+  for (int b = bits - 1; b >= 0; --b)
+    for (int i = 0; i < 3; ++i)
+      key = (key << 1) | ((_x[i] >> b) & 1);
+  return key;
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
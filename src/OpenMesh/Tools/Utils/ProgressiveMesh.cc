@@ -0,0 +1,639 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  CLASS ProgressiveMesh - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Tools/Utils/ProgressiveMesh.hh>
+#include <OpenMesh/Tools/Utils/BitStream.hh>
+#include <OpenMesh/Tools/Utils/ProgressiveMeshWriter.hh>
+#include <OpenMesh/Core/IO/SR_store.hh>
+#include <OpenMesh/Core/Mesh/TriMesh_ArrayKernelT.hh>
+#include <OpenMesh/Core/System/omstream.hh>
+#include <OpenMesh/Core/Utils/Endian.hh>
+#include <algorithm>
+#include <cstring>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+/// Connectivity at the finest level read so far, used to find the corners
+/// moved by the next vertex split
+struct ProgressiveMesh::Replay
+{
+  TriMesh_ArrayKernelT<> mesh;
+
+  // compact format: quantized points, the grid and the current block
+  bool                        compact = false;
+  unsigned int                bits = 0;
+  unsigned int                block_size = 0;
+  Point                       origin = Point(0, 0, 0);
+  float                       step = 0.0f;
+  std::vector<Vec3ui>         q;
+  std::vector<unsigned int>   offsets;
+  std::vector<unsigned char>  buffer;
+  BitReader                   in = BitReader(nullptr, 0);
+  size_t                      block = 0;
+  size_t                      left = 0;
+  unsigned int                mode[3] = { 0, 0, 0 };
+  unsigned int                k[3] = { 0, 0, 0 };
+  std::vector<unsigned int>   ring;
+
+  Point point(const Vec3ui& _q) const
+  {
+    return Point(origin[0] + float(_q[0]) * step,
+                 origin[1] + float(_q[1]) * step,
+                 origin[2] + float(_q[2]) * step);
+  }
+};
+
+
+//-----------------------------------------------------------------------------
+
+
+ProgressiveMesh::ProgressiveMesh()
+  : stream_(nullptr), swap_(false)
+{
+  clear();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+ProgressiveMesh::~ProgressiveMesh()
+{
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void ProgressiveMesh::clear()
+{
+  close();
+
+  n_base_vertices_ = 0;
+  n_details_       = 0;
+  n_vertices_      = 0;
+
+  points_.clear();
+  faces_.clear();
+  v1_.clear();
+  n_faces_.assign(1, 0);
+  corner_offsets_.assign(1, 0);
+  corners_.clear();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMesh::open(const std::string& _filename)
+{
+  clear();
+
+  file_.clear();
+  file_.open(_filename.c_str(), std::ios::binary);
+  if (!file_)
+  {
+    omerr() << "[ProgressiveMesh] : cannot open file " << _filename << std::endl;
+    return false;
+  }
+
+  return read_base(file_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMesh::open(std::istream& _is)
+{
+  clear();
+  return read_base(_is);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void ProgressiveMesh::close()
+{
+  stream_ = nullptr;
+  replay_.reset();
+  if (file_.is_open())
+    file_.close();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMesh::read_base(std::istream& _is)
+{
+  // always little endian, see ModProgMeshT::write()
+  swap_ = Endian::local() != Endian::LSB;
+  replay_.reset(new Replay);
+
+  char magic[8];
+  _is.read(magic, 8);
+
+  bool ok = false;
+  if (_is && std::strncmp(magic, "ProgMesh", 8) == 0)
+    ok = read_raw_base(_is);
+  else if (_is && std::strncmp(magic, "ProgMshQ", 8) == 0)
+    ok = read_compact_base(_is);
+  else
+    omerr() << "[ProgressiveMesh] : wrong file format\n";
+
+  if (!ok)
+  {
+    clear();
+    return false;
+  }
+
+  stream_ = &_is;
+  if (n_details_ == 0)
+    close();
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void ProgressiveMesh::init(size_t _n_base_vertices, size_t _n_base_faces, size_t _n_details)
+{
+  n_base_vertices_ = _n_base_vertices;
+  n_details_       = _n_details;
+  n_vertices_      = _n_base_vertices;
+  n_faces_[0]      = static_cast<unsigned int>(_n_base_faces);
+
+  // a split adds at most two faces
+  points_.reserve(n_base_vertices_ + n_details_);
+  faces_.reserve(3 * (_n_base_faces + 2 * n_details_));
+  v1_.reserve(n_details_);
+  n_faces_.reserve(n_details_ + 1);
+  corner_offsets_.reserve(n_details_ + 1);
+
+  replay_->mesh.reserve(n_base_vertices_ + n_details_, 3 * (n_base_vertices_ + n_details_),
+                        _n_base_faces + 2 * n_details_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMesh::add_base_face(const unsigned int _idx[3])
+{
+  TriMesh_ArrayKernelT<>& mesh = replay_->mesh;
+  const size_t n = n_base_vertices_;
+
+  if (_idx[0] >= n || _idx[1] >= n || _idx[2] >= n ||
+      !mesh.add_face(mesh.vertex_handle(_idx[0]), mesh.vertex_handle(_idx[1]),
+                     mesh.vertex_handle(_idx[2])).is_valid())
+  {
+    omerr() << "[ProgressiveMesh] : invalid base mesh\n";
+    return false;
+  }
+
+  faces_.insert(faces_.end(), _idx, _idx + 3);
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMesh::read_raw_base(std::istream& _is)
+{
+  unsigned int n_base_vertices(0), n_base_faces(0), n_details(0);
+  IO::restore(_is, n_base_vertices, swap_);
+  IO::restore(_is, n_base_faces,    swap_);
+  IO::restore(_is, n_details,       swap_);
+  if (!_is)
+  {
+    omerr() << "[ProgressiveMesh] : cannot read header\n";
+    return false;
+  }
+
+  init(n_base_vertices, n_base_faces, n_details);
+
+  Point p;
+  for (size_t i = 0; i < n_base_vertices_; ++i)
+  {
+    IO::restore(_is, p, swap_);
+    points_.push_back(p);
+    replay_->mesh.add_vertex(vector_cast<TriMesh_ArrayKernelT<>::Point>(p));
+  }
+  if (!_is)
+  {
+    omerr() << "[ProgressiveMesh] : cannot read base vertices\n";
+    return false;
+  }
+
+  unsigned int idx[3];
+  for (size_t i = 0; i < n_base_faces; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+      IO::restore(_is, idx[j], swap_);
+    if (!_is || !add_base_face(idx))
+      return false;
+  }
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMesh::read_compact_base(std::istream& _is)
+{
+  Replay& r = *replay_;
+  r.compact = true;
+
+  unsigned int n_base_vertices(0), n_base_faces(0), n_details(0), base_size(0);
+  IO::restore(_is, n_base_vertices, swap_);
+  IO::restore(_is, n_base_faces,    swap_);
+  IO::restore(_is, n_details,       swap_);
+  IO::restore(_is, r.bits,          swap_);
+  IO::restore(_is, r.block_size,    swap_);
+  IO::restore(_is, r.origin,        swap_);
+  IO::restore(_is, r.step,          swap_);
+  IO::restore(_is, base_size,       swap_);
+  if (!_is || r.bits < 1 || r.bits > 24 || r.block_size == 0)
+  {
+    omerr() << "[ProgressiveMesh] : cannot read header\n";
+    return false;
+  }
+
+  init(n_base_vertices, n_base_faces, n_details);
+
+  r.buffer.resize(base_size);
+  _is.read(reinterpret_cast<char*>(r.buffer.data()), base_size);
+  if (!_is)
+  {
+    omerr() << "[ProgressiveMesh] : cannot read base mesh\n";
+    return false;
+  }
+
+  BitReader in(r.buffer.data(), r.buffer.size());
+  r.q.reserve(n_base_vertices_ + n_details_);
+  for (size_t i = 0; i < n_base_vertices_; ++i)
+  {
+    Vec3ui q;
+    for (int j = 0; j < 3; ++j)
+      q[j] = static_cast<unsigned int>(in.get(r.bits));
+    r.q.push_back(q);
+    points_.push_back(r.point(q));
+    replay_->mesh.add_vertex(vector_cast<TriMesh_ArrayKernelT<>::Point>(points_.back()));
+  }
+
+  const unsigned int index_bits = bit_width(n_base_vertices_);
+  unsigned int idx[3];
+  for (size_t i = 0; i < n_base_faces; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+      idx[j] = static_cast<unsigned int>(in.get(index_bits));
+    if (in.fail())
+    {
+      omerr() << "[ProgressiveMesh] : cannot read base mesh\n";
+      return false;
+    }
+    if (!add_base_face(idx))
+      return false;
+  }
+
+  // block offsets
+  unsigned int n_blocks(0);
+  IO::restore(_is, n_blocks, swap_);
+  if (!_is || n_blocks != (n_details_ + r.block_size - 1) / r.block_size)
+  {
+    omerr() << "[ProgressiveMesh] : invalid block table\n";
+    return false;
+  }
+  r.offsets.resize(n_blocks + 1);
+  for (unsigned int& o : r.offsets)
+    IO::restore(_is, o, swap_);
+  if (!_is || !std::is_sorted(r.offsets.begin(), r.offsets.end()))
+  {
+    omerr() << "[ProgressiveMesh] : invalid block table\n";
+    return false;
+  }
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMesh::read_record()
+{
+  Point p;
+  unsigned int v1(0), vl(0), vr(0);
+
+  const bool ok = replay_->compact ? read_compact_record(p, v1, vl, vr)
+                                   : read_raw_record(p, v1, vl, vr);
+  return ok && split(p, v1, vl, vr);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMesh::read_raw_record(Point& _p, unsigned int& _v1,
+                                      unsigned int& _vl, unsigned int& _vr)
+{
+  IO::restore(*stream_, _p,  swap_);
+  IO::restore(*stream_, _v1, swap_);
+  IO::restore(*stream_, _vl, swap_);
+  IO::restore(*stream_, _vr, swap_);
+  return bool(*stream_);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMesh::read_compact_record(Point& _p, unsigned int& _v1,
+                                          unsigned int& _vl, unsigned int& _vr)
+{
+  Replay& r = *replay_;
+
+  if (r.left == 0)
+  {
+    const size_t size = r.offsets[r.block + 1] - r.offsets[r.block];
+    r.buffer.resize(size);
+    stream_->read(reinterpret_cast<char*>(r.buffer.data()), std::streamsize(size));
+
+    // a file truncated at a block boundary simply has fewer records
+    if (stream_->gcount() == 0 && stream_->eof())
+    {
+      omlog() << "[ProgressiveMesh] : file ends after " << v1_.size() << " of "
+              << n_details_ << " detail records\n";
+      n_details_ = v1_.size();
+      return false;
+    }
+    if (!*stream_)
+      return false;
+
+    r.in = BitReader(r.buffer.data(), size);
+    for (int j = 0; j < 3; ++j)
+    {
+      r.mode[j] = static_cast<unsigned int>(r.in.get(1));
+      r.k[j]    = static_cast<unsigned int>(r.in.get(5));
+    }
+    r.left = std::min(size_t(r.block_size), n_details_ - v1_.size());
+    ++r.block;
+  }
+  --r.left;
+
+  BitReader& in = r.in;
+  const size_t n = r.q.size();
+
+  _v1 = static_cast<unsigned int>(in.get(bit_width(n)));
+  if (_v1 >= n)
+    return false;
+
+  ProgressiveMeshWriter::ring(r.mesh, TriMesh_ArrayKernelT<>::VertexHandle(static_cast<int>(_v1)),
+                              r.ring);
+  const size_t       n_ring = r.ring.size();
+  const unsigned int w      = bit_width(n_ring + 1);
+  const size_t       rl     = size_t(in.get(w));
+  const size_t       rr     = size_t(in.get(w));
+  if (rl > n_ring || rr > n_ring)
+    return false;
+  _vl = (rl == n_ring) ? ProgressiveMeshWriter::invalid : r.ring[rl];
+  _vr = (rr == n_ring) ? ProgressiveMeshWriter::invalid : r.ring[rr];
+
+  // position relative to the prediction from the parent
+  const int64_t n_cells = (int64_t(1) << r.bits) - 1;
+  Vec3ui q;
+  for (int j = 0; j < 3; ++j)
+  {
+    const int64_t c = ProgressiveMeshWriter::predict(r.q, _v1, _vl, _vr, j, r.mode[j] == 1) +
+                      zigzag_decode(in.get_exp_golomb(r.k[j]));
+    if (c < 0 || c > n_cells)
+      return false;
+    q[j] = static_cast<unsigned int>(c);
+  }
+  if (in.fail())
+    return false;
+
+  r.q.push_back(q);
+  _p = r.point(q);
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMesh::split(const Point& _p, unsigned int _v1, unsigned int _vl, unsigned int _vr)
+{
+  // vl and vr are -1 at the boundary
+  TriMesh_ArrayKernelT<>& mesh = replay_->mesh;
+  const unsigned int n = static_cast<unsigned int>(mesh.n_vertices());
+  const unsigned int invalid = static_cast<unsigned int>(-1);
+  if (_v1 >= n || (_vl >= n && _vl != invalid) || (_vr >= n && _vr != invalid))
+    return false;
+
+  const TriMesh_ArrayKernelT<>::VertexHandle vh1(static_cast<int>(_v1)), vhl(static_cast<int>(_vl)),
+                                             vhr(static_cast<int>(_vr));
+  if ((vhl.is_valid() && !mesh.find_halfedge(vh1, vhl).is_valid()) ||
+      (vhr.is_valid() && !mesh.find_halfedge(vhr, vh1).is_valid()))
+    return false;
+
+  const int n_faces = int(mesh.n_faces());
+  const TriMesh_ArrayKernelT<>::VertexHandle vh0 =
+    mesh.add_vertex(vector_cast<TriMesh_ArrayKernelT<>::Point>(_p));
+  mesh.vertex_split(vh0, vh1, vhl, vhr);
+
+  // corners of the old faces which moved from v1 to v0
+  for (auto fh : mesh.vf_range(vh0))
+  {
+    if (fh.idx() >= n_faces)
+      continue;
+    for (int j = 0; j < 3; ++j)
+    {
+      const unsigned int corner = 3 * fh.idx() + j;
+      if (faces_[corner] == _v1)
+      {
+        faces_[corner] = vh0.idx();
+        corners_.push_back(corner);
+        break;
+      }
+    }
+  }
+
+  // new faces
+  for (size_t i = n_faces; i < mesh.n_faces(); ++i)
+    for (auto vh : mesh.fv_range(TriMesh_ArrayKernelT<>::FaceHandle(static_cast<int>(i))))
+      faces_.push_back(vh.idx());
+
+  points_.push_back(_p);
+  v1_.push_back(_v1);
+  n_faces_.push_back(static_cast<unsigned int>(mesh.n_faces()));
+  corner_offsets_.push_back(static_cast<unsigned int>(corners_.size()));
+  ++n_vertices_;
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+size_t ProgressiveMesh::load(size_t _n)
+{
+  if (!stream_)
+    return 0;
+
+  // records are read at the finest level
+  const size_t n_vertices = n_vertices_;
+  apply(n_max_vertices());
+
+  size_t n = 0;
+  for (; n < _n && v1_.size() < n_details_; ++n)
+  {
+    if (!read_record())
+    {
+      if (v1_.size() < n_details_)
+        omerr() << "[ProgressiveMesh] : invalid detail record " << v1_.size() << std::endl;
+      n_details_ = v1_.size();
+      break;
+    }
+  }
+
+  if (v1_.size() == n_details_)
+    close();
+
+  apply(n_vertices);
+  return n;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void ProgressiveMesh::apply(size_t _n)
+{
+  while (n_vertices_ < _n)
+  {
+    const size_t r = n_vertices_ - n_base_vertices_;
+    const unsigned int v0 = static_cast<unsigned int>(n_vertices_);
+    for (unsigned int i = corner_offsets_[r]; i < corner_offsets_[r + 1]; ++i)
+      faces_[corners_[i]] = v0;
+    ++n_vertices_;
+  }
+
+  while (n_vertices_ > _n)
+  {
+    --n_vertices_;
+    const size_t r = n_vertices_ - n_base_vertices_;
+    const unsigned int v1 = v1_[r];
+    for (unsigned int i = corner_offsets_[r]; i < corner_offsets_[r + 1]; ++i)
+      faces_[corners_[i]] = v1;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+size_t ProgressiveMesh::refine(size_t _n)
+{
+  if (_n > n_max_vertices())
+    load(_n - n_max_vertices());
+
+  if (_n > n_vertices_)
+    apply(std::min(_n, n_max_vertices()));
+  return n_vertices_;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+size_t ProgressiveMesh::coarsen(size_t _n)
+{
+  if (_n < n_vertices_)
+    apply(std::max(_n, n_base_vertices_));
+  return n_vertices_;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+size_t ProgressiveMesh::set_n_vertices(size_t _n)
+{
+  return (_n > n_vertices_) ? refine(_n) : coarsen(_n);
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
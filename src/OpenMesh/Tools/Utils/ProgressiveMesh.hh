@@ -0,0 +1,243 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  CLASS ProgressiveMesh
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_PROGRESSIVEMESH_HH
+#define OPENMESH_PROGRESSIVEMESH_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+#include <OpenMesh/Core/Utils/Noncopyable.hh>
+#include <OpenMesh/Core/Utils/vector_cast.hh>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Headless runtime for progressive meshes written by
+ *  Decimater::ModProgMeshT::write() or in the compact format of
+ *  ProgressiveMeshWriter, see Decimater::ModProgMeshT::write_compact().
+ *
+ *  The current level of detail is an indexed triangle list: points() holds
+ *  the base vertices followed by one vertex per detail record, faces() holds
+ *  three vertex indices per face. The faces are ordered such that the mesh
+ *  with n vertices consists of the first n_faces() faces. A vertex split
+ *  appends its faces and moves the corners of the faces around v1 to the
+ *  new vertex, an edge collapse restores them. Both only touch the
+ *  one-ring of the split vertex and never allocate, so set_n_vertices() can
+ *  jump to any level of detail by applying a batch of records.
+ *
+ *  Detail records are streamed: open() reads the header and the base mesh,
+ *  further records are read when a refinement needs them or by load(). The
+ *  corners a record moves are found by replaying the splits on a temporary
+ *  TriMesh, which is released when all records are read or on close().
+ *
+ *  \code
+ *  OpenMesh::Utils::ProgressiveMesh pm;
+ *  if (pm.open("model.pm")) {
+ *    pm.set_n_vertices(10000);
+ *    upload(pm.points(), pm.n_vertices(), pm.faces(), pm.n_faces());
+ *  }
+ *  \endcode
+ */
+class OPENMESHDLLEXPORT ProgressiveMesh : private Utils::Noncopyable
+{
+public:
+
+  typedef Vec3f Point;
+
+public:
+
+  /// constructor
+  ProgressiveMesh();
+
+  /// destructor
+  ~ProgressiveMesh();
+
+  /// Open a progressive mesh file, reads the header and the base mesh
+  bool open(const std::string& _filename);
+
+  /** Open a progressive mesh from a stream, reads the header and the base
+   *  mesh. The stream has to stay valid until all details are read or
+   *  close() is called. A compact file that is cut after any block provides
+   *  the records up to that block. */
+  bool open(std::istream& _is);
+
+  /** Read up to _n further detail records from the stream, returns the
+   *  number of records read. The current level of detail is kept. */
+  size_t load(size_t _n = std::numeric_limits<size_t>::max());
+
+  /// Stop reading detail records, the records read so far stay available
+  void close();
+
+  /// Are there detail records left to read?
+  bool streaming() const { return stream_ != nullptr; }
+
+  //--- level of detail -------------------------------------------------------
+
+  /** Refine or coarsen to _n vertices, clamped to the available range.
+   *  Missing detail records are read from the stream. Returns n_vertices(). */
+  size_t set_n_vertices(size_t _n);
+
+  /// Refine up to _n vertices, returns n_vertices()
+  size_t refine(size_t _n);
+
+  /// Coarsen down to _n vertices, returns n_vertices()
+  size_t coarsen(size_t _n);
+
+  /// Number of vertices of the current level of detail
+  size_t n_vertices() const { return n_vertices_; }
+
+  /// Number of faces of the current level of detail
+  size_t n_faces() const { return n_faces_[n_vertices_ - n_base_vertices_]; }
+
+  /// Points of the current level of detail, n_vertices() are used
+  const Point* points() const { return points_.data(); }
+
+  /// Vertex indices of the current faces, 3 * n_faces() are used
+  const unsigned int* faces() const { return faces_.data(); }
+
+  //--- sizes -----------------------------------------------------------------
+
+  /// Number of vertices of the base mesh
+  size_t n_base_vertices() const { return n_base_vertices_; }
+
+  /// Number of faces of the base mesh
+  size_t n_base_faces() const { return n_faces_[0]; }
+
+  /// Number of detail records in the file
+  size_t n_details() const { return n_details_; }
+
+  /// Number of detail records read so far
+  size_t n_loaded_details() const { return v1_.size(); }
+
+  /// Maximal number of vertices with the records read so far
+  size_t n_max_vertices() const { return n_base_vertices_ + v1_.size(); }
+
+  //--- conversion ------------------------------------------------------------
+
+  /// Copy the current level of detail into _mesh
+  template <class Mesh>
+  void get_mesh(Mesh& _mesh) const
+  {
+    _mesh.clear();
+    _mesh.reserve(n_vertices(), n_vertices() + n_faces(), n_faces());
+    for (size_t i = 0; i < n_vertices(); ++i)
+      _mesh.add_vertex(vector_cast<typename Mesh::Point>(points_[i]));
+    for (size_t i = 0; i < n_faces(); ++i)
+      _mesh.add_face(typename Mesh::VertexHandle(int(faces_[3*i  ])),
+                     typename Mesh::VertexHandle(int(faces_[3*i+1])),
+                     typename Mesh::VertexHandle(int(faces_[3*i+2])));
+  }
+
+private:
+
+  struct Replay;
+
+  void clear();
+  void init(size_t _n_base_vertices, size_t _n_base_faces, size_t _n_details);
+  bool add_base_face(const unsigned int _idx[3]);
+  bool read_base(std::istream& _is);
+  bool read_raw_base(std::istream& _is);
+  bool read_compact_base(std::istream& _is);
+  bool read_record();
+  bool read_raw_record(Point& _p, unsigned int& _v1, unsigned int& _vl, unsigned int& _vr);
+  bool read_compact_record(Point& _p, unsigned int& _v1, unsigned int& _vl, unsigned int& _vr);
+  bool split(const Point& _p, unsigned int _v1, unsigned int _vl, unsigned int _vr);
+  void apply(size_t _n);
+
+private:
+
+  size_t n_base_vertices_;
+  size_t n_details_;
+  size_t n_vertices_;
+
+  std::vector<Point>        points_;
+  std::vector<unsigned int> faces_;
+
+  // per record: the split vertex v1, the number of faces after the split
+  // (n_faces_[0] is the base mesh) and the corners moving to the new vertex
+  std::vector<unsigned int> v1_;
+  std::vector<unsigned int> n_faces_;
+  std::vector<unsigned int> corner_offsets_;
+  std::vector<unsigned int> corners_;
+
+  // streaming state
+  std::ifstream           file_;
+  std::istream*           stream_;
+  bool                    swap_;
+  std::unique_ptr<Replay> replay_;
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_PROGRESSIVEMESH_HH defined
+//=============================================================================
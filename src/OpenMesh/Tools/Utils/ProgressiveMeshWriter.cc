@@ -0,0 +1,382 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  CLASS ProgressiveMeshWriter - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Tools/Utils/ProgressiveMeshWriter.hh>
+#include <OpenMesh/Tools/Utils/BitStream.hh>
+#include <OpenMesh/Core/IO/SR_store.hh>
+#include <OpenMesh/Core/System/omstream.hh>
+#include <OpenMesh/Core/Utils/Endian.hh>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+const unsigned int ProgressiveMeshWriter::invalid;
+
+
+//-----------------------------------------------------------------------------
+
+
+int64_t ProgressiveMeshWriter::predict(const std::vector<Vec3ui>& _q, unsigned int _v1,
+                                       unsigned int _vl, unsigned int _vr, int _j,
+                                       bool _parallelogram)
+{
+  // v0 completes the parallelogram v1, vl, v0, vr
+  if (_parallelogram && _vl != invalid && _vr != invalid)
+    return int64_t(_q[_vl][_j]) + int64_t(_q[_vr][_j]) - int64_t(_q[_v1][_j]);
+  return int64_t(_q[_v1][_j]);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+ProgressiveMeshWriter::ProgressiveMeshWriter(unsigned int _bits, unsigned int _block_size)
+  : bits_(std::min(std::max(_bits, 1u), 24u)),
+    block_size_(std::max(_block_size, 1u))
+{
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void ProgressiveMeshWriter::clear()
+{
+  points_.clear();
+  faces_.clear();
+  details_.clear();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+unsigned int ProgressiveMeshWriter::add_vertex(const Point& _p)
+{
+  points_.push_back(_p);
+  return static_cast<unsigned int>(points_.size() - 1);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void ProgressiveMeshWriter::add_face(unsigned int _v0, unsigned int _v1, unsigned int _v2)
+{
+  faces_.push_back(_v0);
+  faces_.push_back(_v1);
+  faces_.push_back(_v2);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void ProgressiveMeshWriter::add_detail(const Point& _p0, unsigned int _v1,
+                                       unsigned int _vl, unsigned int _vr)
+{
+  Detail d;
+  d.p0 = _p0;
+  d.v1 = _v1;
+  d.vl = _vl;
+  d.vr = _vr;
+  details_.push_back(d);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void ProgressiveMeshWriter::ring(const TriMesh_ArrayKernelT<>& _mesh,
+                                 TriMesh_ArrayKernelT<>::VertexHandle _vh,
+                                 std::vector<unsigned int>& _ring)
+{
+  _ring.clear();
+  for (auto vh : _mesh.vv_range(_vh))
+    _ring.push_back(vh.idx());
+  std::sort(_ring.begin(), _ring.end());
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMeshWriter::write(const std::string& _filename) const
+{
+  std::ofstream out(_filename.c_str(), std::ios::binary);
+  if (!out)
+  {
+    omerr() << "[ProgressiveMeshWriter] : cannot open file " << _filename << std::endl;
+    return false;
+  }
+  return write(out);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool ProgressiveMeshWriter::write(std::ostream& _os) const
+{
+  typedef TriMesh_ArrayKernelT<> Mesh;
+
+  const size_t n_base_vertices = points_.size();
+  const size_t n_base_faces    = faces_.size() / 3;
+  const size_t n_details       = details_.size();
+
+  // grid over the bounding box of all points
+  Point bb_min(FLT_MAX), bb_max(-FLT_MAX);
+  for (const Point& p : points_)
+  {
+    bb_min.minimize(p);
+    bb_max.maximize(p);
+  }
+  for (const Detail& d : details_)
+  {
+    bb_min.minimize(d.p0);
+    bb_max.maximize(d.p0);
+  }
+  if (n_base_vertices == 0)
+  {
+    omerr() << "[ProgressiveMeshWriter] : empty base mesh\n";
+    return false;
+  }
+
+  const uint64_t n_cells = (uint64_t(1) << bits_) - 1;
+  const float    extent  = (bb_max - bb_min).max();
+  const float    step    = (extent > 0.0f) ? extent / float(n_cells) : 1.0f;
+
+  std::vector<Vec3ui> q;
+  q.reserve(n_base_vertices + n_details);
+  auto quantize = [&](const Point& _p)
+  {
+    Vec3ui c;
+    for (int j = 0; j < 3; ++j)
+    {
+      const double x = std::floor((_p[j] - bb_min[j]) / step + 0.5);
+      c[j] = static_cast<unsigned int>(std::min(std::max(x, 0.0), double(n_cells)));
+    }
+    return c;
+  };
+
+  // base mesh, packed
+  std::vector<unsigned char> base;
+  BitWriter base_bits(base);
+  const unsigned int index_bits = bit_width(n_base_vertices);
+
+  Mesh mesh;
+  mesh.reserve(n_base_vertices + n_details, 3 * (n_base_vertices + n_details),
+               n_base_faces + 2 * n_details);
+
+  for (const Point& p : points_)
+  {
+    q.push_back(quantize(p));
+    for (int j = 0; j < 3; ++j)
+      base_bits.put(q.back()[j], bits_);
+    mesh.add_vertex(Mesh::Point(0, 0, 0));
+  }
+  for (size_t i = 0; i < n_base_faces; ++i)
+  {
+    const unsigned int* f = &faces_[3 * i];
+    if (f[0] >= n_base_vertices || f[1] >= n_base_vertices || f[2] >= n_base_vertices ||
+        !mesh.add_face(mesh.vertex_handle(f[0]), mesh.vertex_handle(f[1]),
+                       mesh.vertex_handle(f[2])).is_valid())
+    {
+      omerr() << "[ProgressiveMeshWriter] : invalid base face " << i << std::endl;
+      return false;
+    }
+    for (int j = 0; j < 3; ++j)
+      base_bits.put(f[j], index_bits);
+  }
+  base_bits.flush();
+
+  // code the records while replaying the splits, the ranks of vl and vr
+  // depend on the connectivity before each split
+  struct Code
+  {
+    unsigned int v1, rl, rr, n_ring;
+    uint64_t     d[2][3]; // relative to v1 and to the parallelogram
+  };
+  std::vector<Code> codes(n_details);
+  std::vector<unsigned int> r;
+
+  for (size_t i = 0; i < n_details; ++i)
+  {
+    const Detail& d = details_[i];
+    Code& c = codes[i];
+    const size_t n = n_base_vertices + i;
+
+    const Mesh::VertexHandle vh1(static_cast<int>(d.v1));
+    if (d.v1 >= n)
+    {
+      omerr() << "[ProgressiveMeshWriter] : invalid detail record " << i << std::endl;
+      return false;
+    }
+    ring(mesh, vh1, r);
+
+    c.v1     = d.v1;
+    c.n_ring = static_cast<unsigned int>(r.size());
+    c.rl     = static_cast<unsigned int>(std::lower_bound(r.begin(), r.end(), d.vl) - r.begin());
+    c.rr     = static_cast<unsigned int>(std::lower_bound(r.begin(), r.end(), d.vr) - r.begin());
+
+    const Mesh::VertexHandle vhl(d.vl == invalid ? -1 : static_cast<int>(d.vl));
+    const Mesh::VertexHandle vhr(d.vr == invalid ? -1 : static_cast<int>(d.vr));
+    if ((vhl.is_valid() && (c.rl == c.n_ring || !mesh.find_halfedge(vh1, vhl).is_valid())) ||
+        (vhr.is_valid() && (c.rr == c.n_ring || !mesh.find_halfedge(vhr, vh1).is_valid())) ||
+        (!vhl.is_valid() && !vhr.is_valid()) || d.vl == d.vr)
+    {
+      omerr() << "[ProgressiveMeshWriter] : invalid detail record " << i << std::endl;
+      return false;
+    }
+
+    const Vec3ui q0 = quantize(d.p0);
+    for (int m = 0; m < 2; ++m)
+      for (int j = 0; j < 3; ++j)
+        c.d[m][j] = zigzag_encode(int64_t(q0[j]) - predict(q, d.v1, d.vl, d.vr, j, m == 1));
+    q.push_back(q0);
+
+    mesh.vertex_split(mesh.add_vertex(Mesh::Point(0, 0, 0)), vh1, vhl, vhr);
+  }
+
+  // blocks
+  const size_t n_blocks = (n_details + block_size_ - 1) / block_size_;
+  std::vector<unsigned char> blocks;
+  std::vector<unsigned int>  offsets(1, 0);
+
+  for (size_t b = 0; b < n_blocks; ++b)
+  {
+    const size_t first = b * block_size_;
+    const size_t last  = std::min(first + block_size_, n_details);
+
+    // per coordinate the prediction and Golomb order with the fewest bits
+    unsigned int mode[3] = { 0, 0, 0 }, k[3] = { 0, 0, 0 };
+    for (int j = 0; j < 3; ++j)
+    {
+      uint64_t best = std::numeric_limits<uint64_t>::max();
+      for (unsigned int m = 0; m < 2; ++m)
+        for (unsigned int kk = 0; kk < 32; ++kk)
+        {
+          uint64_t size = 0;
+          for (size_t i = first; i < last; ++i)
+            size += exp_golomb_size(codes[i].d[m][j], kk);
+          if (size < best)
+          {
+            best    = size;
+            mode[j] = m;
+            k[j]    = kk;
+          }
+        }
+    }
+
+    BitWriter bw(blocks);
+    for (int j = 0; j < 3; ++j)
+    {
+      bw.put(mode[j], 1);
+      bw.put(k[j], 5);
+    }
+    for (size_t i = first; i < last; ++i)
+    {
+      const Code& c = codes[i];
+      bw.put(c.v1, bit_width(n_base_vertices + i));
+      bw.put(c.rl, bit_width(c.n_ring + 1));
+      bw.put(c.rr, bit_width(c.n_ring + 1));
+      for (int j = 0; j < 3; ++j)
+        bw.put_exp_golomb(c.d[mode[j]][j], k[j]);
+    }
+    bw.flush();
+    offsets.push_back(static_cast<unsigned int>(blocks.size()));
+  }
+
+  // always little endian
+  const bool swap = Endian::local() != Endian::LSB;
+
+  _os.write("ProgMshQ", 8);
+  IO::store(_os, static_cast<unsigned int>(n_base_vertices), swap);
+  IO::store(_os, static_cast<unsigned int>(n_base_faces),    swap);
+  IO::store(_os, static_cast<unsigned int>(n_details),       swap);
+  IO::store(_os, bits_,       swap);
+  IO::store(_os, block_size_, swap);
+  IO::store(_os, bb_min,      swap);
+  IO::store(_os, step,        swap);
+
+  IO::store(_os, static_cast<unsigned int>(base.size()), swap);
+  _os.write(reinterpret_cast<const char*>(base.data()), std::streamsize(base.size()));
+
+  IO::store(_os, static_cast<unsigned int>(n_blocks), swap);
+  for (unsigned int o : offsets)
+    IO::store(_os, o, swap);
+  _os.write(reinterpret_cast<const char*>(blocks.data()), std::streamsize(blocks.size()));
+
+  return _os.good();
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
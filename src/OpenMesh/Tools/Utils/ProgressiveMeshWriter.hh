@@ -0,0 +1,184 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+
+
+//=============================================================================
+//
+//  CLASS ProgressiveMeshWriter
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_PROGRESSIVEMESHWRITER_HH
+#define OPENMESH_PROGRESSIVEMESHWRITER_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+#include <OpenMesh/Core/Mesh/TriMesh_ArrayKernelT.hh>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Writes progressive meshes in the compact .pm format read by
+ *  ProgressiveMesh.
+ *
+ *  Positions are quantized to a grid of \c bits bits per coordinate over the
+ *  bounding box. The position of a split vertex v0 is stored relative to its
+ *  parent v1, either as the difference to v1 or to vl + vr - v1, which
+ *  completes the parallelogram over the collapsed edge (see predict()). The
+ *  parent is stored with as many bits as the current mesh has vertices, vl
+ *  and vr as their rank among the neighbors of v1 (see ring()), which
+ *  typically takes three bits each.
+ *
+ *  The records are grouped into blocks of \c block_size records. Each block
+ *  chooses the prediction and the exponential Golomb code per coordinate and
+ *  starts at a byte boundary. A table of block offsets follows the base
+ *  mesh, so a client can fetch the prefix of the file up to any block and
+ *  truncated files are read up to their last complete block.
+ *
+ *  Layout, all integers are 32-bit little endian:
+ *
+ *  - The 8 bytes "ProgMshQ".
+ *  - Number of base vertices, base faces and detail records.
+ *  - \c bits and \c block_size.
+ *  - Grid origin (3 floats) and grid spacing (float).
+ *  - Byte size of the base mesh, followed by the base mesh: the quantized
+ *    base vertices and three vertex indices per base face, packed into the
+ *    fewest bits that hold them.
+ *  - Number of blocks \c nb and nb+1 block offsets relative to the first
+ *    block.
+ *  - The blocks: per coordinate one bit for the prediction and 5 bits for
+ *    the Golomb order k, then per record the parent v1, the ranks of vl and
+ *    vr (the neighbor count stands for an invalid vertex) and the zigzag
+ *    coded position differences.
+ *
+ *  Decimater::ModProgMeshT::write_compact() uses this class, other sources
+ *  of vertex splits can feed it directly.
+ */
+class OPENMESHDLLEXPORT ProgressiveMeshWriter
+{
+public:
+
+  typedef Vec3f Point;
+
+  /// Sentinel for a missing vl or vr
+  static const unsigned int invalid = static_cast<unsigned int>(-1);
+
+public:
+
+  /// Constructor, _bits is clamped to [1,24], _block_size to at least 1
+  explicit ProgressiveMeshWriter(unsigned int _bits = 16, unsigned int _block_size = 256);
+
+  /// Remove all vertices, faces and records
+  void clear();
+
+  /// Add a base vertex, returns its index. Split vertices are numbered
+  /// after all base vertices.
+  unsigned int add_vertex(const Point& _p);
+
+  /// Add a base triangle
+  void add_face(unsigned int _v0, unsigned int _v1, unsigned int _v2);
+
+  /** Add a vertex split, in refinement order. The new vertex at _p0 gets
+   *  the next index, _vl and _vr may be \c invalid at the boundary. */
+  void add_detail(const Point& _p0, unsigned int _v1, unsigned int _vl, unsigned int _vr);
+
+  /// Write to a file
+  bool write(const std::string& _filename) const;
+
+  /// Write to a binary stream
+  bool write(std::ostream& _os) const;
+
+  /** Neighbors of _vh in ascending order of their indices. The ranks of vl
+   *  and vr refer to this order on the mesh before the split. */
+  static void ring(const TriMesh_ArrayKernelT<>& _mesh,
+                   TriMesh_ArrayKernelT<>::VertexHandle _vh,
+                   std::vector<unsigned int>& _ring);
+
+  /** Predicted coordinate _j of the quantized position of v0, the stored
+   *  difference refers to it. Either v1 or, if _parallelogram is set and
+   *  vl and vr exist, vl + vr - v1. */
+  static int64_t predict(const std::vector<Vec3ui>& _q, unsigned int _v1,
+                         unsigned int _vl, unsigned int _vr, int _j,
+                         bool _parallelogram);
+
+private:
+
+  struct Detail
+  {
+    Point        p0;
+    unsigned int v1, vl, vr;
+  };
+
+  unsigned int bits_;
+  unsigned int block_size_;
+
+  std::vector<Point>        points_;
+  std::vector<unsigned int> faces_;
+  std::vector<Detail>       details_;
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_PROGRESSIVEMESHWRITER_HH defined
+//=============================================================================
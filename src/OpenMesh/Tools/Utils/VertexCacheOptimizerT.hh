@@ -0,0 +1,183 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+//=============================================================================
+//
+//  CLASS VertexCacheOptimizerT
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_VERTEXCACHEOPTIMIZERT_HH
+#define OPENMESH_VERTEXCACHEOPTIMIZERT_HH
+
+
+//== INCLUDES =================================================================
+
+#include <vector>
+#include <cstddef>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+
+
+/** \class VertexCacheOptimizerT VertexCacheOptimizerT.hh <OpenMesh/Tools/Utils/VertexCacheOptimizerT.hh>
+
+    Computes a triangle index buffer ordered for the post-transform vertex
+    cache of a GPU.
+
+    The triangle order is computed by Tipsify (P. Sander, D. Nehab and
+    J. Barczak, "Fast Triangle Reordering for Vertex Locality and Reduced
+    Overdraw", SIGGRAPH 2007), which runs in linear time. The sequence is
+    split into clusters where the algorithm had to jump to a new region.
+    Optionally, these clusters are sorted so that outward facing clusters
+    are drawn first, which reduces overdraw.
+
+    Polygonal faces are triangulated as fans, deleted faces are skipped.
+    The index buffer refers to the vertex indices of the mesh.
+
+    \code
+    OpenMesh::VertexCacheOptimizerT<MyMesh> optimizer(mesh);
+    optimizer.optimize();
+    std::cout << "ACMR " << optimizer.report().acmr << std::endl;
+    glDrawElements(GL_TRIANGLES, optimizer.indices().size(), GL_UNSIGNED_INT, optimizer.indices().data());
+    \endcode
+*/
+
+template <class Mesh>
+class VertexCacheOptimizerT
+{
+public:
+
+  typedef unsigned int                      Index;
+  typedef std::vector<Index>                Indices;
+  typedef typename Indices::const_iterator  IndexIterator;
+
+  /// Vertex cache statistics of an index buffer
+  struct Report
+  {
+    size_t n_triangles;   ///< number of triangles
+    size_t n_vertices;    ///< number of distinct vertices referenced
+    size_t cache_misses;  ///< number of vertex transforms
+    double acmr;          ///< average cache miss ratio, misses per triangle
+    double atvr;          ///< average transform to vertex ratio, misses per vertex (1.0 is optimal)
+  };
+
+
+  /// Default constructor
+  explicit VertexCacheOptimizerT(Mesh& _mesh);
+
+  /// Destructor
+  ~VertexCacheOptimizerT();
+
+  /** Compute the index buffer, returns the number of triangles
+   *
+   * @param _cache_size Size of the vertex cache the order is optimized for
+   * @param _overdraw   Sort the clusters to reduce overdraw
+   */
+  size_t optimize(unsigned int _cache_size = 16, bool _overdraw = true);
+
+  /// Index buffer in the original face order (fan triangulated), returns the number of triangles
+  size_t unoptimized();
+
+  /// delete the index buffer
+  void clear() { Indices().swap(indices_); }
+
+  /// are indices computed?
+  bool is_valid() const { return !indices_.empty(); }
+
+  /// Access index buffer, three indices per triangle
+  const Indices& indices() const { return indices_; }
+  /// Access index buffer
+  IndexIterator begin() const { return indices_.begin(); }
+  /// Access index buffer
+  IndexIterator end()   const { return indices_.end(); }
+
+  /// First triangle of each cluster, the last entry is the number of triangles
+  const std::vector<size_t>& clusters() const { return clusters_; }
+
+  /// Statistics of the current index buffer for a FIFO cache of \c _cache_size entries
+  Report report(unsigned int _cache_size = 16) const { return analyze(indices_, _cache_size); }
+
+  /// Statistics of an arbitrary triangle index buffer for a FIFO cache of \c _cache_size entries
+  static Report analyze(const Indices& _indices, unsigned int _cache_size = 16);
+
+
+private:
+
+  /// fan triangulate all undeleted faces into \c _tris
+  void triangulate(Indices& _tris) const;
+
+  /// the Tipsify pass, fills indices_ and clusters_
+  void tipsify(const Indices& _tris, unsigned int _cache_size);
+
+  /// sort the clusters by their orientation relative to the mesh center
+  void sort_clusters();
+
+
+private:
+
+  Mesh&                mesh_;
+  Indices              indices_;
+  std::vector<size_t>  clusters_;
+};
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_VERTEXCACHEOPTIMIZERT_C)
+#define OPENMESH_VERTEXCACHEOPTIMIZERT_TEMPLATES
+#include "VertexCacheOptimizerT_impl.hh"
+#endif
+//=============================================================================
+#endif // OPENMESH_VERTEXCACHEOPTIMIZERT_HH defined
+//=============================================================================
+
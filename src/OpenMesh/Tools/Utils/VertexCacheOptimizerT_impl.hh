@@ -0,0 +1,401 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2025, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+
+
+//=============================================================================
+//
+//  CLASS VertexCacheOptimizerT - IMPLEMENTATION
+//
+//=============================================================================
+
+#define OPENMESH_VERTEXCACHEOPTIMIZERT_C
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Tools/Utils/VertexCacheOptimizerT.hh>
+#include <OpenMesh/Core/Utils/vector_traits.hh>
+#include <algorithm>
+#include <cmath>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+
+  //== IMPLEMENTATION ==========================================================
+
+template <class Mesh>
+VertexCacheOptimizerT<Mesh>::
+VertexCacheOptimizerT(Mesh& _mesh) :
+    mesh_(_mesh)
+{
+
+}
+
+template <class Mesh>
+VertexCacheOptimizerT<Mesh>::
+~VertexCacheOptimizerT() {
+
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+size_t
+VertexCacheOptimizerT<Mesh>::
+optimize(unsigned int _cache_size, bool _overdraw)
+{
+  Indices tris;
+  triangulate(tris);
+
+  clear();
+  tipsify(tris, std::max(_cache_size, 3u));
+
+  if (_overdraw)
+    sort_clusters();
+
+  return indices_.size() / 3;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+size_t
+VertexCacheOptimizerT<Mesh>::
+unoptimized()
+{
+  clear();
+  triangulate(indices_);
+
+  clusters_.clear();
+  clusters_.push_back(0);
+  clusters_.push_back(indices_.size() / 3);
+
+  return indices_.size() / 3;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+VertexCacheOptimizerT<Mesh>::
+triangulate(Indices& _tris) const
+{
+  _tris.clear();
+  _tris.reserve(3 * mesh_.n_faces());
+
+  std::vector<Index> polygon;
+  for (auto fh : mesh_.faces())
+  {
+    polygon.clear();
+    for (auto vh : mesh_.fv_range(fh))
+      polygon.push_back(static_cast<Index>(vh.idx()));
+
+    for (size_t i = 1; i + 1 < polygon.size(); ++i)
+    {
+      _tris.push_back(polygon[0]);
+      _tris.push_back(polygon[i]);
+      _tris.push_back(polygon[i+1]);
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+VertexCacheOptimizerT<Mesh>::
+tipsify(const Indices& _tris, unsigned int _cache_size)
+{
+  const size_t n_t = _tris.size() / 3;
+  const size_t n_v = mesh_.n_vertices();
+  const int    k   = static_cast<int>(_cache_size);
+
+  // vertex -> triangles, stored compressed
+  std::vector<size_t> offset(n_v + 1, 0);
+  for (size_t i = 0; i < _tris.size(); ++i)
+    ++offset[_tris[i] + 1];
+  for (size_t v = 0; v < n_v; ++v)
+    offset[v+1] += offset[v];
+
+  std::vector<size_t> adjacent(_tris.size());
+  {
+    std::vector<size_t> fill(offset.begin(), offset.end() - 1);
+    for (size_t i = 0; i < _tris.size(); ++i)
+      adjacent[fill[_tris[i]]++] = i / 3;
+  }
+
+  // number of not yet emitted triangles per vertex
+  std::vector<int> live(n_v);
+  for (size_t v = 0; v < n_v; ++v)
+    live[v] = static_cast<int>(offset[v+1] - offset[v]);
+
+  std::vector<int>   stamp(n_v, 0);
+  std::vector<bool>  emitted(n_t, false);
+  std::vector<Index> dead_end;
+  std::vector<Index> candidates;
+
+  indices_.reserve(_tris.size());
+  clusters_.clear();
+
+  int    time   = k + 1;
+  size_t cursor = 0;
+
+  // next vertex with remaining triangles, first from the dead-end stack
+  // of recently used vertices, then in input order
+  auto skip_dead_end = [&]() -> int
+  {
+    while (!dead_end.empty())
+    {
+      const Index v = dead_end.back();
+      dead_end.pop_back();
+      if (live[v] > 0)
+        return static_cast<int>(v);
+    }
+    while (cursor < n_v)
+    {
+      if (live[cursor] > 0)
+        return static_cast<int>(cursor);
+      ++cursor;
+    }
+    return -1;
+  };
+
+  int fan = skip_dead_end();
+  while (fan >= 0)
+  {
+    // a jump starts a new cluster
+    clusters_.push_back(indices_.size() / 3);
+
+    while (fan >= 0)
+    {
+      // emit all remaining triangles around the fanning vertex
+      candidates.clear();
+      for (size_t a = offset[fan]; a < offset[fan+1]; ++a)
+      {
+        const size_t t = adjacent[a];
+        if (emitted[t])
+          continue;
+
+        for (int j = 0; j < 3; ++j)
+        {
+          const Index v = _tris[3*t + j];
+          indices_.push_back(v);
+          dead_end.push_back(v);
+          candidates.push_back(v);
+          --live[v];
+          if (time - stamp[v] > k)
+            stamp[v] = time++;
+        }
+        emitted[t] = true;
+      }
+
+      // prefer the oldest candidate that stays in the cache while its fan is emitted
+      int best = -1, best_priority = -1;
+      for (size_t c = 0; c < candidates.size(); ++c)
+      {
+        const Index v = candidates[c];
+        if (live[v] <= 0)
+          continue;
+
+        int priority = 0;
+        if (time - stamp[v] + 2 * live[v] <= k)
+          priority = time - stamp[v];
+        if (priority > best_priority)
+        {
+          best_priority = priority;
+          best = static_cast<int>(v);
+        }
+      }
+
+      fan = best;
+    }
+
+    fan = skip_dead_end();
+  }
+
+  clusters_.push_back(n_t);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+VertexCacheOptimizerT<Mesh>::
+sort_clusters()
+{
+  typedef typename Mesh::Point Point;
+  const size_t dim     = std::min<size_t>(3, vector_traits<Point>::size());
+  const size_t n_clust = clusters_.size() - 1;
+
+  if (n_clust < 2)
+    return;
+
+  auto position = [&](Index _v, double _p[3])
+  {
+    const Point& p = mesh_.point(typename Mesh::VertexHandle(static_cast<int>(_v)));
+    _p[0] = _p[1] = _p[2] = 0.0;
+    for (size_t k = 0; k < dim; ++k)
+      _p[k] = double(p[k]);
+  };
+
+  // mesh center
+  double center[3] = { 0.0, 0.0, 0.0 };
+  for (size_t i = 0; i < indices_.size(); ++i)
+  {
+    double p[3];
+    position(indices_[i], p);
+    for (int k = 0; k < 3; ++k)
+      center[k] += p[k];
+  }
+  for (int k = 0; k < 3; ++k)
+    center[k] /= double(indices_.size());
+
+  // clusters facing away from the center are drawn first
+  std::vector< std::pair<double, size_t> > keys(n_clust);
+  for (size_t c = 0; c < n_clust; ++c)
+  {
+    double centroid[3] = { 0.0, 0.0, 0.0 };
+    double normal[3]   = { 0.0, 0.0, 0.0 };
+    for (size_t t = clusters_[c]; t < clusters_[c+1]; ++t)
+    {
+      double p0[3], p1[3], p2[3];
+      position(indices_[3*t  ], p0);
+      position(indices_[3*t+1], p1);
+      position(indices_[3*t+2], p2);
+
+      const double d1[3] = { p1[0]-p0[0], p1[1]-p0[1], p1[2]-p0[2] };
+      const double d2[3] = { p2[0]-p0[0], p2[1]-p0[1], p2[2]-p0[2] };
+      normal[0] += d1[1]*d2[2] - d1[2]*d2[1];
+      normal[1] += d1[2]*d2[0] - d1[0]*d2[2];
+      normal[2] += d1[0]*d2[1] - d1[1]*d2[0];
+
+      for (int k = 0; k < 3; ++k)
+        centroid[k] += p0[k] + p1[k] + p2[k];
+    }
+
+    const double n_corners = 3.0 * double(clusters_[c+1] - clusters_[c]);
+    const double length = std::sqrt(normal[0]*normal[0] + normal[1]*normal[1] + normal[2]*normal[2]);
+
+    double key = 0.0;
+    if (length > 0.0)
+      for (int k = 0; k < 3; ++k)
+        key += (centroid[k] / n_corners - center[k]) * normal[k] / length;
+
+    keys[c] = std::make_pair(-key, c);
+  }
+  std::stable_sort(keys.begin(), keys.end());
+
+  // rebuild index buffer and cluster offsets
+  Indices             indices;
+  std::vector<size_t> clusters;
+  indices.reserve(indices_.size());
+  clusters.reserve(clusters_.size());
+
+  for (size_t i = 0; i < n_clust; ++i)
+  {
+    const size_t c = keys[i].second;
+    clusters.push_back(indices.size() / 3);
+    indices.insert(indices.end(), indices_.begin() + 3*clusters_[c], indices_.begin() + 3*clusters_[c+1]);
+  }
+  clusters.push_back(indices.size() / 3);
+
+  indices_.swap(indices);
+  clusters_.swap(clusters);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename VertexCacheOptimizerT<Mesh>::Report
+VertexCacheOptimizerT<Mesh>::
+analyze(const Indices& _indices, unsigned int _cache_size)
+{
+  Report report;
+  report.n_triangles  = _indices.size() / 3;
+  report.n_vertices   = 0;
+  report.cache_misses = 0;
+  report.acmr         = 0.0;
+  report.atvr         = 0.0;
+
+  if (_indices.empty())
+    return report;
+
+  const Index max_index = *std::max_element(_indices.begin(), _indices.end());
+
+  // FIFO cache: a vertex stays cached until _cache_size newer
+  // vertices were loaded
+  const size_t not_loaded = size_t(-1);
+  std::vector<size_t> loaded(size_t(max_index) + 1, not_loaded);
+
+  for (size_t i = 0; i < _indices.size(); ++i)
+  {
+    size_t& l = loaded[_indices[i]];
+    if (l == not_loaded)
+      ++report.n_vertices;
+    if (l == not_loaded || report.cache_misses - l > _cache_size)
+      l = report.cache_misses++;
+  }
+
+  report.acmr = double(report.cache_misses) / double(report.n_triangles);
+  report.atvr = double(report.cache_misses) / double(report.n_vertices);
+
+  return report;
+}
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/IO/AsciiOutBuffer.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+namespace {
+
+class OpenMeshAsciiOutBuffer : public testing::Test {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+        // Write some numbers to the stream directly and through the
+        // buffer and return both results
+        std::pair<std::string, std::string> format(std::ostringstream& _reference, std::ostringstream& _buffered) {
+
+            const double values[] = { 0.0, -0.0, 1.0, -1.5, 0.1, 1.0 / 3.0, 123456.789, 1e-7, 2.5e21,
+                                      std::numeric_limits<double>::max(),
+                                      std::numeric_limits<double>::min(),
+                                      std::numeric_limits<double>::infinity() };
+
+            OpenMesh::IO::AsciiOutBuffer buffer(_buffered, 64);
+
+            for (double d : values) {
+              _reference << d << ' ' << float(d) << '\n';
+              buffer.put(d);
+              buffer.put(' ');
+              buffer.put(float(d));
+              buffer.put('\n');
+            }
+
+            const OpenMesh::Vec3f v(0.25f, -7.0f, 1e10f);
+            _reference << v << ' ' << -17 << ' ' << 4000000000u << ' ' << std::numeric_limits<long long>::min() << '\n';
+            buffer.put(v);
+            buffer.put(' ');
+            buffer.put(-17);
+            buffer.put(' ');
+            buffer.put(4000000000u);
+            buffer.put(' ');
+            buffer.put(std::numeric_limits<long long>::min());
+            buffer.put('\n');
+
+            buffer.flush();
+            return std::make_pair(_reference.str(), _buffered.str());
+        }
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * The buffer formats numbers exactly like the stream
+ */
+TEST_F(OpenMeshAsciiOutBuffer, SameAsStream) {
+
+  for (int precision : { 0, 1, 6, 9, 17 }) {
+
+    std::ostringstream ref, buf;
+    ref.precision(precision);
+    buf.precision(precision);
+    std::pair<std::string, std::string> res = format(ref, buf);
+    EXPECT_EQ(res.first, res.second) << "Precision " << precision;
+
+    std::ostringstream ref_fixed, buf_fixed;
+    ref_fixed.precision(precision);
+    buf_fixed.precision(precision);
+    ref_fixed << std::fixed;
+    buf_fixed << std::fixed;
+    res = format(ref_fixed, buf_fixed);
+    EXPECT_EQ(res.first, res.second) << "Fixed, precision " << precision;
+
+    std::ostringstream ref_sci, buf_sci;
+    ref_sci.precision(precision);
+    buf_sci.precision(precision);
+    ref_sci << std::scientific;
+    buf_sci << std::scientific;
+    res = format(ref_sci, buf_sci);
+    EXPECT_EQ(res.first, res.second) << "Scientific, precision " << precision;
+  }
+
+  // Flags the buffer cannot reproduce itself
+  std::ostringstream ref, buf;
+  ref << std::showpos << std::uppercase;
+  buf << std::showpos << std::uppercase;
+  {
+    OpenMesh::IO::AsciiOutBuffer buffer(buf);
+    EXPECT_FALSE(buffer.native());
+  }
+  std::pair<std::string, std::string> res = format(ref, buf);
+  EXPECT_EQ(res.first, res.second);
+}
+
+/*
+ * Parallel formatting keeps the order of the records
+ */
+TEST_F(OpenMeshAsciiOutBuffer, FormatParallel) {
+
+  std::ostringstream ref, buf;
+
+  for (size_t i = 0; i < 1000; ++i)
+    ref << i << ' ' << std::sqrt(double(i)) << '\n';
+
+  // enough threads to run in parallel on any machine
+  OpenMesh::ThreadPool::set_global_threads(4);
+  {
+    OpenMesh::IO::AsciiOutBuffer buffer(buf);
+    OpenMesh::IO::format_parallel(buffer, 1000, [](OpenMesh::IO::AsciiOutBuffer& _buf, size_t _first, size_t _last) {
+      for (size_t i = _first; i < _last; ++i) {
+        _buf.put(i);
+        _buf.put(' ');
+        _buf.put(std::sqrt(double(i)));
+        _buf.put('\n');
+      }
+    }, 7, 4);
+  }
+  OpenMesh::ThreadPool::set_global_threads(0);
+
+  EXPECT_EQ(ref.str(), buf.str());
+}
+
+}
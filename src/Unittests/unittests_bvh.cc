@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/BVHT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+#include <algorithm>
+
+namespace {
+
+class OpenMeshBVH : public OpenMeshBase {
+
+    protected:
+
+        typedef OpenMesh::Utils::BVHT<Mesh> BVH;
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+        // Triangulated n x n height field
+        void create_grid(int _n) {
+            mesh_.clear();
+            std::vector<Mesh::VertexHandle> vhs;
+            for (int i = 0; i < _n; ++i)
+                for (int j = 0; j < _n; ++j)
+                    vhs.push_back(mesh_.add_vertex(Mesh::Point(float(i), float(j), float((i * j) % 5) * 0.5f)));
+            for (int i = 0; i + 1 < _n; ++i)
+                for (int j = 0; j + 1 < _n; ++j) {
+                    const int v = i * _n + j;
+                    mesh_.add_face(vhs[v], vhs[v + 1], vhs[v + _n + 1]);
+                    mesh_.add_face(vhs[v], vhs[v + _n + 1], vhs[v + _n]);
+                }
+        }
+
+        // Squared distance of _p to the segment [_a, _b]
+        static float sqr_segment_distance(const Mesh::Point& _p, const Mesh::Point& _a, const Mesh::Point& _b) {
+            const Mesh::Point d = _b - _a;
+            const float t = std::min(1.0f, std::max(0.0f, ((_p - _a) | d) / d.sqrnorm()));
+            return (_a + d * t - _p).sqrnorm();
+        }
+
+        // Brute force closest distance: projection into the triangle or the closest edge
+        float brute_force_sqr_distance(const Mesh::Point& _p) {
+            float best = std::numeric_limits<float>::max();
+            for (auto fh : mesh_.faces()) {
+                auto fv = mesh_.fv_iter(fh);
+                const Mesh::Point a = mesh_.point(*fv++), b = mesh_.point(*fv++), c = mesh_.point(*fv);
+                const Mesh::Point n = ((b - a) % (c - a)).normalized();
+                const Mesh::Point q = _p - n * ((_p - a) | n);
+                if ((((b - a) % (q - a)) | n) >= 0 && (((c - b) % (q - b)) | n) >= 0 && (((a - c) % (q - c)) | n) >= 0)
+                    best = std::min(best, (q - _p).sqrnorm());
+                best = std::min(best, sqr_segment_distance(_p, a, b));
+                best = std::min(best, sqr_segment_distance(_p, b, c));
+                best = std::min(best, sqr_segment_distance(_p, c, a));
+            }
+            return best;
+        }
+
+        // Compare the queries with brute force results
+        void check(const BVH& _bvh) {
+            for (int i = 0; i < 50; ++i) {
+                const Mesh::Point p(float(i % 7) * 2.3f - 1.0f, float(i % 11) * 1.7f - 1.0f, float(i % 5) - 1.0f);
+
+                const BVH::ClosestPoint cp = _bvh.closest_point(p);
+                ASSERT_TRUE(cp.face.is_valid());
+                EXPECT_NEAR(brute_force_sqr_distance(p), cp.sqr_distance, 1e-3f) << "Point " << i;
+                EXPECT_NEAR((cp.point - p).sqrnorm(), cp.sqr_distance, 1e-3f) << "Point " << i;
+
+                std::vector<std::pair<float, int> > dist;
+                for (auto vh : mesh_.vertices())
+                    dist.push_back(std::make_pair((mesh_.point(vh) - p).sqrnorm(), vh.idx()));
+                std::sort(dist.begin(), dist.end());
+                const std::vector<Mesh::VertexHandle> knn = _bvh.k_nearest_vertices(p, 5);
+                ASSERT_EQ(5u, knn.size());
+                for (size_t j = 0; j < knn.size(); ++j)
+                    EXPECT_FLOAT_EQ(dist[j].first, (mesh_.point(knn[j]) - p).sqrnorm()) << "Point " << i;
+
+                const Mesh::Point bmin = p - Mesh::Point(1.5f, 1.5f, 1.5f), bmax = p + Mesh::Point(1.5f, 1.5f, 1.5f);
+                std::vector<Mesh::FaceHandle> expected;
+                for (auto fh : mesh_.faces()) {
+                    bool overlap = true;
+                    Mesh::Point fmin = mesh_.point(*mesh_.fv_iter(fh)), fmax = fmin;
+                    for (auto vh : fh.vertices()) {
+                        fmin.minimize(mesh_.point(vh));
+                        fmax.maximize(mesh_.point(vh));
+                    }
+                    for (int k = 0; k < 3; ++k)
+                        overlap = overlap && !(fmax[k] < bmin[k] || fmin[k] > bmax[k]);
+                    if (overlap)
+                        expected.push_back(fh);
+                }
+                EXPECT_EQ(expected, _bvh.faces_in_box(bmin, bmax)) << "Point " << i;
+            }
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Closest point, k nearest vertices and box queries against brute force
+ */
+TEST_F(OpenMeshBVH, Queries) {
+
+  create_grid(20);
+
+  BVH bvh(mesh_);
+  EXPECT_EQ(0u, bvh.n_nodes());
+  EXPECT_FALSE(bvh.closest_point(Mesh::Point(0, 0, 0)).face.is_valid());
+
+  bvh.build();
+  EXPECT_EQ(mesh_.n_faces(), bvh.n_triangles());
+  EXPECT_GT(bvh.n_nodes(), 1u);
+  check(bvh);
+
+  // out of reach
+  EXPECT_FALSE(bvh.closest_point(Mesh::Point(5, 5, 20), 1.0f).face.is_valid());
+}
+
+/*
+ * Vertical rays hit the height field in the triangle below the origin
+ */
+TEST_F(OpenMeshBVH, Ray) {
+
+  create_grid(20);
+
+  BVH bvh(mesh_);
+  bvh.build();
+
+  for (int i = 0; i < 100; ++i) {
+    const float x = float(i % 19) + 0.3f, y = float((i * 7) % 19) + 0.6f;
+    const BVH::RayHit hit = bvh.intersect(Mesh::Point(x, y, 10), Mesh::Point(0, 0, -1));
+    ASSERT_TRUE(hit.face.is_valid()) << "Ray " << i;
+
+    // barycentric interpolation of the height in the hit triangle
+    auto fv = mesh_.fv_iter(hit.face);
+    const Mesh::Point a = mesh_.point(*fv++), b = mesh_.point(*fv++), c = mesh_.point(*fv);
+    const float det = (b[0] - a[0]) * (c[1] - a[1]) - (c[0] - a[0]) * (b[1] - a[1]);
+    const float u = ((x - a[0]) * (c[1] - a[1]) - (c[0] - a[0]) * (y - a[1])) / det;
+    const float v = ((b[0] - a[0]) * (y - a[1]) - (x - a[0]) * (b[1] - a[1])) / det;
+    EXPECT_GE(u, -1e-5f);
+    EXPECT_GE(v, -1e-5f);
+    EXPECT_LE(u + v, 1.0f + 1e-5f);
+    EXPECT_NEAR(a[2] + u * (b[2] - a[2]) + v * (c[2] - a[2]), hit.point[2], 1e-4f) << "Ray " << i;
+    EXPECT_NEAR(10.0f - hit.point[2], hit.t, 1e-4f) << "Ray " << i;
+  }
+
+  // misses: away from the grid, too short, pointing away
+  EXPECT_FALSE(bvh.intersect(Mesh::Point(-5, 5, 10), Mesh::Point(0, 0, -1)).face.is_valid());
+  EXPECT_FALSE(bvh.intersect(Mesh::Point(5.3f, 5.6f, 10), Mesh::Point(0, 0, -1), 5.0f).face.is_valid());
+  EXPECT_FALSE(bvh.intersect(Mesh::Point(5.3f, 5.6f, 10), Mesh::Point(0, 0, 1)).face.is_valid());
+}
+
+/*
+ * Refit after set_point, rebuild after topology changes
+ */
+TEST_F(OpenMeshBVH, Update) {
+
+  create_grid(20);
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+  mesh_.request_journal();
+
+  BVH bvh(mesh_);
+  bvh.build();
+  const size_t n_nodes = bvh.n_nodes();
+
+  for (int i = 0; i < 400; i += 13)
+    mesh_.set_point(Mesh::VertexHandle(i), mesh_.point(Mesh::VertexHandle(i)) + Mesh::Point(0.2f, -0.3f, 1.5f));
+  EXPECT_FALSE(bvh.update());
+  EXPECT_EQ(n_nodes, bvh.n_nodes());
+  check(bvh);
+
+  // full refit
+  for (auto vh : mesh_.vertices())
+    mesh_.point(vh)[2] *= 2.0f;
+  bvh.refit();
+  check(bvh);
+
+  // topology
+  mesh_.collapse(mesh_.halfedge_handle(Mesh::EdgeHandle(200), 0));
+  mesh_.delete_face(Mesh::FaceHandle(10), true);
+  EXPECT_TRUE(bvh.update());
+  EXPECT_EQ(mesh_.n_faces() - 3, bvh.n_triangles());
+  check(bvh);
+
+  mesh_.garbage_collection();
+  EXPECT_TRUE(bvh.update());
+  EXPECT_EQ(mesh_.n_faces(), bvh.n_triangles());
+  check(bvh);
+
+  mesh_.release_journal();
+}
+
+/*
+ * Parallel build, polygons and mesh to mesh distance
+ */
+TEST_F(OpenMeshBVH, ParallelBuild) {
+
+  create_grid(150);
+
+  OpenMesh::ThreadPool::set_global_threads(4);
+
+  BVH serial(mesh_), parallel(mesh_);
+  serial.build(1);
+  parallel.build();
+  EXPECT_EQ(serial.n_nodes(), parallel.n_nodes());
+  for (int i = 0; i < 200; ++i) {
+    const Mesh::Point p(float(i % 149) + 0.25f, float((i * 31) % 149) + 0.5f, float(i % 3));
+    const BVH::ClosestPoint a = serial.closest_point(p), b = parallel.closest_point(p);
+    EXPECT_EQ(a.face, b.face);
+    EXPECT_EQ(a.sqr_distance, b.sqr_distance);
+    EXPECT_EQ(serial.k_nearest_vertices(p, 3), parallel.k_nearest_vertices(p, 3));
+  }
+
+  // distance of a lifted copy
+  EXPECT_FLOAT_EQ(0.0f, parallel.max_distance(mesh_));
+  PolyMesh lifted;
+  for (auto vh : mesh_.vertices())
+    lifted.add_vertex(PolyMesh::Point(mesh_.point(vh)) + PolyMesh::Point(0, 0, 100));
+  float expected = 0.0f;
+  for (auto vh : lifted.vertices())
+    expected = std::max(expected, serial.closest_point(lifted.point(vh)).sqr_distance);
+  EXPECT_FLOAT_EQ(std::sqrt(expected), parallel.max_distance(lifted));
+  EXPECT_GT(parallel.max_distance(lifted), 99.0f);
+
+  OpenMesh::ThreadPool::set_global_threads(0);
+
+  // quads are split into two triangles
+  PolyMesh quads;
+  PolyMesh::VertexHandle v[4] = {
+    quads.add_vertex(PolyMesh::Point(0, 0, 0)), quads.add_vertex(PolyMesh::Point(1, 0, 0)),
+    quads.add_vertex(PolyMesh::Point(1, 1, 0)), quads.add_vertex(PolyMesh::Point(0, 1, 0)) };
+  quads.add_face(v[0], v[1], v[2], v[3]);
+  OpenMesh::Utils::BVHT<PolyMesh> quad_bvh(quads);
+  quad_bvh.build();
+  EXPECT_EQ(2u, quad_bvh.n_triangles());
+  EXPECT_EQ(PolyMesh::FaceHandle(0), quad_bvh.intersect(PolyMesh::Point(0.9f, 0.2f, 1), PolyMesh::Point(0, 0, -1)).face);
+  EXPECT_FLOAT_EQ(1.0f, quad_bvh.closest_point(PolyMesh::Point(0.5f, 0.5f, 1)).sqr_distance);
+}
+
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/Mesh/CSRAdjacency.hh>
+#include <OpenMesh/Core/Utils/Predicates.hh>
+
+namespace {
+
+class OpenMeshCSRAdjacency : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+        // Triangulated n x n grid, large enough to be built by several threads
+        void create_grid(int _n) {
+            mesh_.clear();
+            std::vector<Mesh::VertexHandle> vhs;
+            for (int i = 0; i < _n; ++i)
+                for (int j = 0; j < _n; ++j)
+                    vhs.push_back(mesh_.add_vertex(Mesh::Point(float(i), float(j), 0.0f)));
+            for (int i = 0; i + 1 < _n; ++i)
+                for (int j = 0; j + 1 < _n; ++j) {
+                    mesh_.add_face(vhs[i*_n+j], vhs[i*_n+j+1], vhs[(i+1)*_n+j+1]);
+                    mesh_.add_face(vhs[i*_n+j], vhs[(i+1)*_n+j+1], vhs[(i+1)*_n+j]);
+                }
+        }
+
+        // Compare the snapshot against the circulators of the mesh
+        void check(const OpenMesh::CSRAdjacency& _adj) {
+            ASSERT_EQ(mesh_.n_vertices(), _adj.n_vertices());
+            ASSERT_EQ(mesh_.n_edges(),    _adj.n_edges());
+            ASSERT_EQ(mesh_.n_faces(),    _adj.n_faces());
+
+            for (auto vh : mesh_.vertices()) {
+                EXPECT_EQ(mesh_.vv_range(vh).to_vector(), _adj.vv_range(vh).to_vector()) << "Wrong one-ring of vertex " << vh.idx();
+                EXPECT_EQ(mesh_.vf_range(vh).to_vector(), _adj.vf_range(vh).to_vector()) << "Wrong faces of vertex " << vh.idx();
+                EXPECT_EQ(mesh_.valence(vh), _adj.valence(vh));
+            }
+            for (auto fh : mesh_.faces())
+                EXPECT_EQ(mesh_.fv_range(fh).to_vector(), _adj.fv_range(fh).to_vector()) << "Wrong vertices of face " << fh.idx();
+            for (auto eh : mesh_.edges()) {
+                EXPECT_EQ(eh.v0(), _adj.ev_range(eh)[0]) << "Wrong v0 of edge " << eh.idx();
+                EXPECT_EQ(eh.v1(), _adj.ev_range(eh)[1]) << "Wrong v1 of edge " << eh.idx();
+            }
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Snapshot of a closed mesh
+ */
+TEST_F(OpenMeshCSRAdjacency, ClosedMesh) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube-minimal.obj");
+  ASSERT_TRUE(ok);
+
+  OpenMesh::CSRAdjacency adj(mesh_);
+  check(adj);
+
+  EXPECT_EQ(static_cast<const OpenMesh::PolyConnectivity*>(&mesh_), adj.mesh());
+  EXPECT_EQ(mesh_.n_halfedges(), adj.vv_indices().size());
+  EXPECT_EQ(3 * mesh_.n_faces(), adj.fv_indices().size());
+
+  adj.clear();
+  EXPECT_EQ(0u, adj.n_vertices());
+  EXPECT_EQ(0u, adj.n_faces());
+}
+
+/*
+ * Serial and parallel build of a mesh with boundary
+ */
+TEST_F(OpenMeshCSRAdjacency, ParallelBuild) {
+
+  create_grid(101);
+
+  OpenMesh::CSRAdjacency serial(mesh_, 1);
+  OpenMesh::CSRAdjacency parallel(mesh_, 4);
+
+  check(serial);
+  check(parallel);
+
+  EXPECT_EQ(serial.vv_offsets(), parallel.vv_offsets());
+  EXPECT_EQ(serial.vv_indices(), parallel.vv_indices());
+  EXPECT_EQ(serial.vf_indices(), parallel.vf_indices());
+  EXPECT_EQ(serial.fv_indices(), parallel.fv_indices());
+  EXPECT_EQ(serial.ev_indices(), parallel.ev_indices());
+
+  // corner vertex: two neighbors on the boundary, one across the diagonal
+  EXPECT_EQ(3u, parallel.valence(OpenMesh::VertexHandle(0)));
+  EXPECT_EQ(2u, parallel.vf_range(OpenMesh::VertexHandle(0)).size());
+}
+
+/*
+ * The ranges are smart ranges yielding smart handles
+ */
+TEST_F(OpenMeshCSRAdjacency, SmartRanges) {
+
+  create_grid(5);
+
+  OpenMesh::CSRAdjacency adj(mesh_);
+
+  // interior vertex of the grid
+  const OpenMesh::VertexHandle vh(12);
+  const Mesh::Point centroid = adj.vv_range(vh).avg([&](OpenMesh::VertexHandle _vh) { return mesh_.point(_vh); });
+  EXPECT_FLOAT_EQ(mesh_.point(vh)[0], centroid[0]);
+  EXPECT_FLOAT_EQ(mesh_.point(vh)[1], centroid[1]);
+
+  EXPECT_EQ(6u, adj.vf_range(vh).count_if([](OpenMesh::SmartFaceHandle _fh) { return _fh.valence() == 3; }));
+
+  size_t n_boundary = 0;
+  for (auto vh_adj : adj.vv_range(OpenMesh::VertexHandle(2)))
+    if (vh_adj.is_boundary())
+      ++n_boundary;
+  EXPECT_EQ(2u, n_boundary);
+}
+
+/*
+ * Deleted elements have no neighbors
+ */
+TEST_F(OpenMeshCSRAdjacency, DeletedElements) {
+
+  create_grid(5);
+
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+
+  // delete the one-ring of an interior vertex
+  const OpenMesh::VertexHandle vh(12);
+  mesh_.delete_vertex(vh);
+
+  OpenMesh::CSRAdjacency adj(mesh_);
+  check(adj);
+
+  EXPECT_TRUE(adj.vv_range(vh).empty());
+  EXPECT_TRUE(adj.vf_range(vh).empty());
+  for (auto fh : mesh_.all_faces().filtered(OpenMesh::Predicates::Deleted()))
+    EXPECT_EQ(0u, adj.valence(fh));
+  for (auto eh : mesh_.all_edges().filtered(OpenMesh::Predicates::Deleted()))
+    EXPECT_FALSE(adj.ev_range(eh)[0].is_valid());
+}
+
+}
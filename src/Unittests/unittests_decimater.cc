@@ -2,8 +2,11 @@
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
 #include <OpenMesh/Tools/Decimater/DecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/CollapsedNormalsT.hh>
 #include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
 #include <OpenMesh/Tools/Decimater/ModNormalDeviationT.hh>
+#include <OpenMesh/Tools/Decimater/ModNormalFlippingT.hh>
+#include <set>
 
 namespace {
 
@@ -158,6 +161,253 @@ TEST_F(OpenMeshDecimater, DecimateMeshExampleFromDoc) {
   EXPECT_EQ(9996u, mesh_.n_faces()) << "The number of faces after decimation is not correct!";
 }
 
+TEST_F(OpenMeshDecimater, DecimateMeshOptimalPlacement) {
+
+  typedef OpenMesh::Decimater::DecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Mesh >::Handle HModQuadric;
+  typedef OpenMesh::Decimater::ModNormalFlippingT< Mesh >::Handle HModNormalFlipping;
+
+  auto volume = [](const Mesh& _mesh) {
+    double v = 0.0;
+    for (auto fh : _mesh.faces()) {
+      auto fv = _mesh.cfv_iter(fh);
+      const OpenMesh::Vec3d p0 = OpenMesh::vector_cast<OpenMesh::Vec3d>(_mesh.point(*fv)); ++fv;
+      const OpenMesh::Vec3d p1 = OpenMesh::vector_cast<OpenMesh::Vec3d>(_mesh.point(*fv)); ++fv;
+      const OpenMesh::Vec3d p2 = OpenMesh::vector_cast<OpenMesh::Vec3d>(_mesh.point(*fv));
+      v += (p0 | (p1 % p2)) / 6.0;
+    }
+    return v;
+  };
+
+  // decimate a sphere with and without optimal placement
+  double error[2];
+  for (int i = 0; i < 2; ++i) {
+    Mesh mesh;
+    ASSERT_TRUE(OpenMesh::IO::read_mesh(mesh, "sphere840.ply"));
+    mesh.request_face_normals();
+    mesh.update_face_normals();
+    const double original = volume(mesh);
+
+    Decimater decimater(mesh);
+    HModQuadric hModQuadric;
+    HModNormalFlipping hModNormalFlipping;
+    decimater.add(hModQuadric);
+    decimater.add(hModNormalFlipping);
+    decimater.module(hModQuadric).set_optimal_placement(i == 1);
+    EXPECT_EQ(i == 1, decimater.module(hModQuadric).optimal_placement());
+    decimater.initialize();
+
+    EXPECT_EQ(322u, decimater.decimate_to(100)) << "The number of remove vertices is not correct!";
+    mesh.garbage_collection();
+    EXPECT_EQ(100u, mesh.n_vertices()) << "The number of vertices after decimation is not correct!";
+    EXPECT_EQ(196u, mesh.n_faces()) << "The number of faces after decimation is not correct!";
+
+    error[i] = std::abs(volume(mesh) - original) / original;
+  }
+
+  // halfedge collapses keep the vertices on the sphere and shrink it
+  EXPECT_LT(error[1], 0.5 * error[0]) << "Optimal placement did not reduce the error";
+}
+
+TEST_F(OpenMeshDecimater, DecimateMeshAttributeQuadrics) {
+
+  ASSERT_TRUE(OpenMesh::IO::read_mesh(mesh_, "sphere840.ply"));
+
+  typedef OpenMesh::Decimater::DecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Mesh >::Handle HModQuadric;
+
+  // texture coordinates linear in the position and the sphere normals
+  mesh_.request_vertex_texcoords2D();
+  mesh_.request_vertex_normals();
+  mesh_.request_face_normals();
+  mesh_.update_normals();
+  for (auto vh : mesh_.vertices()) {
+    const Mesh::Point p = mesh_.point(vh);
+    mesh_.set_texcoord2D(vh, Mesh::TexCoord2D(p[0] / 127.0, p[2] / 127.0));
+  }
+
+  Decimater decimater(mesh_);
+  HModQuadric hModQuadric;
+  decimater.add(hModQuadric);
+  decimater.module(hModQuadric).set_optimal_placement(true);
+  decimater.module(hModQuadric).add_attribute(mesh_.vertex_texcoords2D_pph(), 10.0);
+  decimater.module(hModQuadric).add_attribute(mesh_.vertex_normals_pph(), 10.0);
+  EXPECT_EQ(2u, decimater.module(hModQuadric).n_attributes());
+  decimater.initialize();
+
+  EXPECT_EQ(322u, decimater.decimate_to(100)) << "The number of remove vertices is not correct!";
+  mesh_.garbage_collection();
+
+  // the attributes of moved vertices follow their positions
+  for (auto vh : mesh_.vertices()) {
+    const Mesh::Point p = mesh_.point(vh);
+    const Mesh::Normal n = mesh_.normal(vh);
+    const Mesh::TexCoord2D t = mesh_.texcoord2D(vh);
+
+    EXPECT_NEAR(1.0, n.norm(), 1e-5) << "Normal of vertex " << vh.idx() << " is not normalized";
+    EXPECT_GT((n | p.normalized()), 0.95) << "Normal of vertex " << vh.idx() << " is wrong";
+    EXPECT_NEAR(p[0] / 127.0, t[0], 0.05) << "Texture coordinate of vertex " << vh.idx() << " is wrong";
+    EXPECT_NEAR(p[2] / 127.0, t[1], 0.05) << "Texture coordinate of vertex " << vh.idx() << " is wrong";
+  }
+}
+
+TEST_F(OpenMeshDecimater, DecimateMeshStatistics) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  typedef OpenMesh::Decimater::DecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Mesh >::Handle HModQuadric;
+  typedef OpenMesh::Decimater::ModNormalFlippingT< Mesh >::Handle HModNormalFlipping;
+
+  OpenMesh::Decimater::DecimaterStatistics statistics(1);
+
+  Decimater decimaterDBG(mesh_);
+  HModQuadric hModQuadricDBG;
+  HModNormalFlipping hModNormalFlippingDBG;
+  decimaterDBG.add( hModQuadricDBG );
+  decimaterDBG.add( hModNormalFlippingDBG );
+  decimaterDBG.set_statistics(&statistics);
+  decimaterDBG.initialize();
+  size_t removedVertices = decimaterDBG.decimate_to(5000);
+  decimaterDBG.mesh().garbage_collection();
+
+  EXPECT_EQ(5000u, mesh_.n_vertices()) << "The number of vertices after decimation is not correct!";
+
+  EXPECT_EQ(removedVertices, statistics.n_collapses()) << "Every collapse has to be counted";
+  EXPECT_EQ(removedVertices, statistics.errors().n())  << "Every collapse has to be in the histogram";
+  EXPECT_GE(statistics.n_candidates(), statistics.n_collapses());
+  EXPECT_GT(statistics.max_heap_size(), 0u);
+
+  std::vector<OpenMesh::Decimater::DecimaterStatistics::ModuleStatistics> modules = statistics.modules();
+  ASSERT_EQ(2u, modules.size());
+  EXPECT_EQ("NormalFlipping", modules[0].name);
+  EXPECT_FALSE(modules[0].priority);
+  EXPECT_EQ("Quadric", modules[1].name);
+  EXPECT_TRUE(modules[1].priority);
+  EXPECT_EQ(statistics.n_candidates(), modules[0].n_evaluations);
+  EXPECT_EQ(modules[0].n_evaluations - modules[0].n_rejected, modules[1].n_evaluations);
+  EXPECT_GT(modules[1].seconds, 0.0);
+
+  EXPECT_LE(statistics.errors().min(), statistics.errors().quantile(0.5));
+  EXPECT_LE(statistics.errors().quantile(0.5), statistics.errors().max());
+
+  const std::string json = statistics.json();
+  EXPECT_NE(std::string::npos, json.find("\"collapses\": " + std::to_string(removedVertices)));
+  EXPECT_NE(std::string::npos, json.find("\"Quadric\""));
+
+  statistics.reset();
+  EXPECT_EQ(0u, statistics.n_collapses());
+  EXPECT_EQ(0u, statistics.errors().n());
+  EXPECT_EQ(2u, statistics.modules().size());
+}
+
+TEST_F(OpenMeshDecimater, CollapsedNormals) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  typedef OpenMesh::Decimater::CollapseInfoT< Mesh >      CollapseInfo;
+  typedef OpenMesh::Decimater::CollapsedNormalsT< Mesh >  CollapsedNormals;
+  typedef OpenMesh::NormalConeT< Mesh::Normal >           NormalCone;
+
+  mesh_.request_face_normals();
+  mesh_.update_face_normals();
+
+  size_t n_faces = 0;
+  for (auto heh : mesh_.halfedges()) {
+    CollapseInfo ci(mesh_, heh);
+    // move every other collapse to the midpoint, which includes the faces of v1
+    if (heh.idx() % 2)
+      ci.p1 = (ci.p0 + ci.p1) * 0.5f;
+
+    const bool moved = (ci.p1 != mesh_.point(ci.v1));
+    std::set<Mesh::FaceHandle> expected;
+    for (auto fh : mesh_.vf_range(ci.v0))
+      expected.insert(fh);
+    if (moved)
+      for (auto fh : mesh_.vf_range(ci.v1))
+        expected.insert(fh);
+    expected.erase(ci.fl);
+    expected.erase(ci.fr);
+
+    std::set<Mesh::FaceHandle> found;
+    CollapsedNormals normals(mesh_, ci);
+    while (size_t n = normals.next()) {
+      ASSERT_LE(n, size_t(CollapsedNormals::chunk_size));
+      for (size_t i = 0; i < n; ++i) {
+        const Mesh::FaceHandle fh = normals.face(i);
+        EXPECT_TRUE(found.insert(fh).second) << "Face returned twice";
+
+        Mesh::Point p[3];
+        int j = 0;
+        for (auto vh : mesh_.fv_range(fh))
+          p[j++] = (vh == ci.v0 || vh == ci.v1) ? ci.p1 : mesh_.point(vh);
+        const Mesh::Normal n_expected = mesh_.Mesh::PolyMesh::calc_face_normal(p[0], p[1], p[2]);
+        EXPECT_EQ(n_expected, normals.normal(i));
+
+        // merged_angle() is the angle of merge() without the new center
+        NormalCone cone(mesh_.normal(fh));
+        cone.merge(NormalCone(n_expected));
+        const float merged = cone.merged_angle(cone.center_normal() | normals.normal(i));
+        cone.merge(NormalCone(normals.normal(i)));
+        EXPECT_NEAR(cone.angle(), merged, 1e-4f);
+      }
+    }
+    EXPECT_TRUE(expected == found) << "Wrong one-ring for halfedge " << heh.idx();
+    n_faces += found.size();
+  }
+
+  EXPECT_GT(n_faces, mesh_.n_halfedges());
+}
+
+/*
+ */
+TEST_F(OpenMeshDecimater, NormalDeviationBinaryMatchesContinuous) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "sphere840.ply");
+
+  ASSERT_TRUE(ok);
+
+  typedef OpenMesh::Decimater::DecimaterT< Mesh >                   Decimater;
+  typedef OpenMesh::Decimater::ModNormalDeviationT< Mesh >::Handle  HModNormalDeviation;
+  typedef OpenMesh::Decimater::CollapseInfoT< Mesh >                CollapseInfo;
+
+  Decimater decimater(mesh_);
+  HModNormalDeviation hModNormalDeviation;
+  decimater.add(hModNormalDeviation);
+  decimater.module(hModNormalDeviation).set_binary(false);
+  decimater.module(hModNormalDeviation).set_normal_deviation(30.0f);
+  decimater.initialize();
+
+  // grow the normal cones before comparing
+  decimater.decimate_to(300);
+
+  OpenMesh::Decimater::ModNormalDeviationT< Mesh >& mod = decimater.module(hModNormalDeviation);
+  size_t n_legal = 0, n_illegal = 0;
+  for (auto heh : mesh_.halfedges()) {
+    if (mesh_.status(mesh_.edge_handle(heh)).deleted() || !mesh_.is_collapse_ok(heh))
+      continue;
+
+    CollapseInfo ci(mesh_, heh);
+    mod.set_binary(false);
+    const float continuous = mod.collapse_priority(ci);
+    mod.set_binary(true);
+    const float binary = mod.collapse_priority(ci);
+
+    EXPECT_EQ(continuous < 0.0f, binary < 0.0f) << "Different decision for halfedge " << heh.idx();
+    if (binary < 0.0f)
+      ++n_illegal;
+    else
+      ++n_legal;
+  }
+
+  EXPECT_GT(n_legal,   0u);
+  EXPECT_GT(n_illegal, 0u);
+}
+
 class UnittestObserver : public OpenMesh::Decimater::Observer
 {
     size_t notifies_;
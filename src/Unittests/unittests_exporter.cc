@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/IO/exporter/ExporterT.hh>
+#include <OpenMesh/Core/IO/writer/OFFWriter.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+class OpenMeshExporter : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+class OpenMeshExporterPoly : public OpenMeshBasePoly {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Bulk access returns the same data as the single element functions
+ */
+TEST_F(OpenMeshExporter, BulkAccess) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube-minimal.obj");
+  ASSERT_TRUE(ok);
+
+  mesh_.request_vertex_colors();
+  mesh_.request_face_normals();
+  mesh_.update_normals();
+  for (auto vh : mesh_.vertices())
+    mesh_.set_color(vh, Mesh::Color(vh.idx(), 2 * vh.idx(), 255));
+
+  OpenMesh::IO::ExporterT<Mesh> exporter(mesh_);
+  const OpenMesh::IO::BaseExporter& be = exporter;
+
+  const size_t n_v = be.n_vertices();
+  const size_t n_f = be.n_faces();
+
+  // read in small chunks to cross chunk borders
+  OpenMesh::IO::BulkReaderT<OpenMesh::Vec3f>  points (be, &OpenMesh::IO::BaseExporter::points, n_v, 3);
+  OpenMesh::IO::BulkReaderT<OpenMesh::Vec3d>  pointsd(be, &OpenMesh::IO::BaseExporter::points, n_v, 3);
+  OpenMesh::IO::BulkReaderT<OpenMesh::Vec4uc> colors (be, &OpenMesh::IO::BaseExporter::colors, n_v, 3);
+  for (size_t i = 0; i < n_v; ++i)
+  {
+    const OpenMesh::VertexHandle vh = OpenMesh::VertexHandle(int(i));
+    EXPECT_EQ(be.point(vh),  points[i]);
+    EXPECT_EQ(be.pointd(vh), pointsd[i]);
+    EXPECT_EQ(be.colorA(vh), colors[i]);
+  }
+
+  // random access
+  EXPECT_EQ(be.point(OpenMesh::VertexHandle(1)), points[1]);
+
+  OpenMesh::IO::BulkReaderT<OpenMesh::Vec3f> normals(be, &OpenMesh::IO::BaseExporter::face_normals, n_f, 5);
+  OpenMesh::IO::FaceIndexReader faces(be, 5);
+  std::vector<OpenMesh::VertexHandle> vhandles;
+  for (size_t i = 0; i < n_f; ++i)
+  {
+    const OpenMesh::FaceHandle fh = OpenMesh::FaceHandle(int(i));
+    EXPECT_EQ(be.normal(fh), normals[i]);
+
+    const int* idx;
+    ASSERT_EQ(be.get_vhandles(fh, vhandles), faces.get(i, idx));
+    for (size_t j = 0; j < vhandles.size(); ++j)
+      EXPECT_EQ(vhandles[j].idx(), idx[j]);
+  }
+
+  // triangle fast path
+  std::vector<int> triangles(3 * n_f);
+  EXPECT_TRUE(be.triangle_indices(0, n_f, triangles.data()));
+  std::vector<size_t> offsets;
+  std::vector<int> indices;
+  be.face_indices(0, n_f, offsets, indices);
+  EXPECT_EQ(n_f + 1, offsets.size());
+  EXPECT_EQ(triangles, indices);
+}
+
+/*
+ * The triangle fast path leaves deleted faces to face_indices()
+ */
+TEST_F(OpenMeshExporter, TriangleIndicesDeletedFace) {
+
+  mesh_.clear();
+
+  Mesh::VertexHandle vhandle[4];
+  vhandle[0] = mesh_.add_vertex(Mesh::Point(0, 0, 0));
+  vhandle[1] = mesh_.add_vertex(Mesh::Point(1, 0, 0));
+  vhandle[2] = mesh_.add_vertex(Mesh::Point(1, 1, 0));
+  vhandle[3] = mesh_.add_vertex(Mesh::Point(0, 1, 0));
+  mesh_.add_face(vhandle[0], vhandle[1], vhandle[2]);
+  Mesh::FaceHandle fh = mesh_.add_face(vhandle[0], vhandle[2], vhandle[3]);
+
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_halfedge_status();
+  mesh_.request_face_status();
+
+  OpenMesh::IO::ExporterT<Mesh> exporter(mesh_);
+  const OpenMesh::IO::BaseExporter& be = exporter;
+
+  int triangles[6];
+  EXPECT_TRUE(be.triangle_indices(0, 2, triangles));
+
+  mesh_.delete_face(fh, false);
+  EXPECT_TRUE(be.triangle_indices(0, 1, triangles));
+  EXPECT_FALSE(be.triangle_indices(0, 2, triangles)) << "Deleted face reported as triangle";
+}
+
+/*
+ * Face indices of a polygonal mesh
+ */
+TEST_F(OpenMeshExporterPoly, BulkFaceIndices) {
+
+  mesh_.clear();
+
+  // Add some vertices
+  PolyMesh::VertexHandle vhandle[5];
+  vhandle[0] = mesh_.add_vertex(PolyMesh::Point(0, 0, 0));
+  vhandle[1] = mesh_.add_vertex(PolyMesh::Point(1, 0, 0));
+  vhandle[2] = mesh_.add_vertex(PolyMesh::Point(1, 1, 0));
+  vhandle[3] = mesh_.add_vertex(PolyMesh::Point(0, 1, 0));
+  vhandle[4] = mesh_.add_vertex(PolyMesh::Point(2, 0, 0));
+
+  // A quad and a triangle
+  mesh_.add_face(vhandle[0], vhandle[1], vhandle[2], vhandle[3]);
+  mesh_.add_face(vhandle[1], vhandle[4], vhandle[2]);
+
+  OpenMesh::IO::ExporterT<PolyMesh> exporter(mesh_);
+  const OpenMesh::IO::BaseExporter& be = exporter;
+
+  std::vector<size_t> offsets;
+  std::vector<int> indices;
+  be.face_indices(0, 2, offsets, indices);
+
+  ASSERT_EQ(3u, offsets.size());
+  EXPECT_EQ(0u, offsets[0]);
+  EXPECT_EQ(4u, offsets[1]);
+  EXPECT_EQ(7u, offsets[2]);
+
+  std::vector<int> triangles(6);
+  EXPECT_FALSE(be.triangle_indices(0, 2, triangles.data())) << "Quad reported as triangle";
+  EXPECT_TRUE(be.triangle_indices(1, 1, triangles.data()));
+  EXPECT_EQ(std::vector<int>(indices.begin() + 4, indices.end()), std::vector<int>(triangles.begin(), triangles.begin() + 3));
+
+  OpenMesh::IO::FaceIndexReader faces(be);
+  const int* idx;
+  EXPECT_EQ(4u, faces.get(0, idx));
+  EXPECT_EQ(3u, faces.get(1, idx));
+  EXPECT_EQ(4, idx[1]);
+}
+
+/*
+ * Exporter which records the threads reading its points
+ */
+class SerialExporter : public OpenMesh::IO::ExporterT<Mesh>
+{
+public:
+
+  explicit SerialExporter(const Mesh& _mesh)
+    : OpenMesh::IO::ExporterT<Mesh>(_mesh) {}
+
+  bool concurrent_access() const override { return false; }
+
+  using OpenMesh::IO::ExporterT<Mesh>::points;
+  void points(size_t _first, size_t _n, OpenMesh::Vec3f* _out) const override
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    threads_.insert(std::this_thread::get_id());
+    OpenMesh::IO::ExporterT<Mesh>::points(_first, _n, _out);
+  }
+
+  mutable std::mutex                mutex_;
+  mutable std::set<std::thread::id> threads_;
+};
+
+/*
+ * The ASCII writers read exporters without concurrent access from one thread
+ */
+TEST_F(OpenMeshExporter, SerialAccess) {
+
+  mesh_.clear();
+  for (int i = 0; i < 40000; ++i)
+    mesh_.add_vertex(Mesh::Point(float(i), 0, 0));
+
+  OpenMesh::ThreadPool::set_global_threads(4);
+
+  SerialExporter serial(mesh_);
+  std::ostringstream serial_out;
+  EXPECT_TRUE(OpenMesh::IO::OFFWriter().write(serial_out, serial, OpenMesh::IO::Options()));
+
+  OpenMesh::IO::ExporterT<Mesh> exporter(mesh_);
+  std::ostringstream out;
+  EXPECT_TRUE(OpenMesh::IO::OFFWriter().write(out, exporter, OpenMesh::IO::Options()));
+
+  OpenMesh::ThreadPool::set_global_threads(0);
+
+  EXPECT_FALSE(serial.threads_.empty());
+  EXPECT_EQ(1u, serial.threads_.size());
+  EXPECT_EQ(out.str(), serial_out.str());
+}
+
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/GeometryCacheT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+
+namespace {
+
+class OpenMeshGeometryCache : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+        // Triangulated n x n grid with some height variation
+        void create_grid(int _n) {
+            mesh_.clear();
+            std::vector<Mesh::VertexHandle> vhs;
+            for (int i = 0; i < _n; ++i)
+                for (int j = 0; j < _n; ++j)
+                    vhs.push_back(mesh_.add_vertex(Mesh::Point(float(i), float(j), float((i * j) % 5))));
+            for (int i = 0; i + 1 < _n; ++i)
+                for (int j = 0; j + 1 < _n; ++j) {
+                    const int v = i * _n + j;
+                    mesh_.add_face(vhs[v], vhs[v + 1], vhs[v + _n + 1]);
+                    mesh_.add_face(vhs[v], vhs[v + _n + 1], vhs[v + _n]);
+                }
+        }
+
+        // Compare all cached values with freshly computed ones
+        void check(OpenMesh::Utils::GeometryCacheT<Mesh>& _cache) {
+            for (auto fh : mesh_.faces()) {
+                EXPECT_EQ(mesh_.calc_face_normal(fh), _cache.normal(fh)) << "Face " << fh.idx();
+                EXPECT_EQ(mesh_.calc_face_centroid(fh), _cache.centroid(fh)) << "Face " << fh.idx();
+            }
+            Mesh reference = mesh_;
+            reference.request_face_normals();
+            reference.request_vertex_normals();
+            reference.update_normals();
+            for (auto vh : mesh_.vertices())
+                EXPECT_EQ(reference.normal(vh), _cache.normal(vh)) << "Vertex " << vh.idx();
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Values are computed lazily and match the mesh functions
+ */
+TEST_F(OpenMeshGeometryCache, Lazy) {
+
+  create_grid(10);
+
+  OpenMesh::Utils::GeometryCacheT<Mesh> cache(mesh_);
+  EXPECT_EQ(mesh_.n_faces(), cache.n_dirty_faces());
+  EXPECT_EQ(mesh_.n_vertices(), cache.n_dirty_vertices());
+
+  // (0,0,0), (0,1,0), (1,1,1)
+  const Mesh::FaceHandle fh(0);
+  EXPECT_NEAR(0.5 * std::sqrt(2.0), cache.area(fh), 1e-6);
+  EXPECT_EQ(mesh_.n_faces() - 1, cache.n_dirty_faces());
+
+  check(cache);
+  EXPECT_EQ(0u, cache.n_dirty_faces());
+  EXPECT_EQ(0u, cache.n_dirty_vertices());
+
+  // moving a vertex dirties its one ring only
+  const Mesh::VertexHandle vh(55);
+  mesh_.set_point(vh, mesh_.point(vh) + Mesh::Point(0, 0, 2));
+  EXPECT_EQ(mesh_.valence(vh), cache.n_dirty_faces());
+  EXPECT_EQ(mesh_.valence(vh) + 1, cache.n_dirty_vertices());
+  check(cache);
+
+  // writes through point() have to be announced
+  mesh_.point(vh) = Mesh::Point(5, 5, -1);
+  cache.invalidate(vh);
+  check(cache);
+}
+
+/*
+ * Parallel refresh after topology changes, the mesh normals are updated too
+ */
+TEST_F(OpenMeshGeometryCache, Refresh) {
+
+  create_grid(60);
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+  mesh_.request_face_normals();
+  mesh_.request_vertex_normals();
+
+  OpenMesh::ThreadPool::set_global_threads(4);
+  {
+    OpenMesh::Utils::GeometryCacheT<Mesh> cache(mesh_);
+    cache.refresh();
+    EXPECT_EQ(0u, cache.n_dirty_faces());
+
+    for (int i = 0; i < 3000; i += 37)
+      mesh_.set_point(Mesh::VertexHandle(i), mesh_.point(Mesh::VertexHandle(i)) * 1.1f);
+    for (int i = 200; i < 5000; i += 211) {
+      const Mesh::HalfedgeHandle heh = mesh_.halfedge_handle(Mesh::EdgeHandle(i), 0);
+      if (!mesh_.status(mesh_.edge_handle(heh)).deleted() && mesh_.is_collapse_ok(heh))
+        mesh_.collapse(heh);
+    }
+    if (!mesh_.status(Mesh::FaceHandle(1000)).deleted())
+      mesh_.delete_face(Mesh::FaceHandle(1000), true);
+    EXPECT_LT(cache.n_dirty_faces(), mesh_.n_faces() / 4);
+
+    cache.refresh();
+    EXPECT_EQ(0u, cache.n_dirty_faces());
+    EXPECT_EQ(0u, cache.n_dirty_vertices());
+
+    Mesh reference = mesh_;
+    reference.update_normals();
+    for (auto fh : mesh_.faces())
+      EXPECT_EQ(reference.normal(fh), mesh_.normal(fh)) << "Face " << fh.idx();
+    for (auto vh : mesh_.vertices())
+      EXPECT_EQ(reference.normal(vh), mesh_.normal(vh)) << "Vertex " << vh.idx();
+
+    // garbage collection invalidates everything
+    mesh_.garbage_collection();
+    EXPECT_EQ(mesh_.n_faces(), cache.n_dirty_faces());
+    check(cache);
+  }
+  OpenMesh::ThreadPool::set_global_threads(0);
+
+  EXPECT_FALSE(mesh_.has_journal());
+}
+
+}
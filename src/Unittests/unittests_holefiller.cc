@@ -2,6 +2,9 @@
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
 #include <OpenMesh/Tools/HoleFiller/HoleFillerT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+
+#include <cmath>
 
 namespace {
 
@@ -64,4 +67,90 @@ TEST_F(OpenMeshHoleFiller_Triangle,Triangle_Hole_Filling) {
 
 }
 
+/*
+ * Smoothing the fillings does not move the vertices of the input mesh
+ */
+TEST_F(OpenMeshHoleFiller_Triangle,Smoothing_Is_Local) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube_2holes.off");
+
+  ASSERT_TRUE(ok);
+
+  std::vector<Mesh::Point> points;
+  for (auto vh : mesh_.vertices())
+    points.push_back(mesh_.point(vh));
+
+  OpenMesh::HoleFiller::HoleFillerT<Mesh> filler(mesh_);
+  filler.fill_all_holes();
+
+  ASSERT_GT(mesh_.n_vertices(), points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(points[i], mesh_.point(Mesh::VertexHandle(int(i)))) << "Vertex " << i;
+
+  for (size_t i = points.size(); i < mesh_.n_vertices(); ++i) {
+    const Mesh::Point& p = mesh_.point(Mesh::VertexHandle(int(i)));
+    EXPECT_TRUE(std::isfinite(p[0]) && std::isfinite(p[1]) && std::isfinite(p[2])) << "Vertex " << i;
+  }
+}
+
+/*
+ * Many small holes filled in parallel give the same result as serially
+ */
+TEST_F(OpenMeshHoleFiller_Triangle,Parallel_Hole_Filling) {
+
+  // Grid with holes of one or four cells, two of them touch at a vertex
+  const int n = 30;
+  Mesh grid;
+  std::vector<Mesh::VertexHandle> vhs;
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      vhs.push_back(grid.add_vertex(Mesh::Point(float(i), float(j), float((i * j) % 7) * 0.2f)));
+  for (int i = 0; i + 1 < n; ++i)
+    for (int j = 0; j + 1 < n; ++j) {
+      const bool small_hole = (i % 6 == 3 && j % 6 == 3) || (i == 4 && j == 4);
+      const bool large_hole = (i % 12 >= 8 && i % 12 <= 9 && j % 12 >= 8 && j % 12 <= 9);
+      if (small_hole || large_hole)
+        continue;
+      const int v = i * n + j;
+      grid.add_face(vhs[v], vhs[v + 1], vhs[v + n + 1]);
+      grid.add_face(vhs[v], vhs[v + n + 1], vhs[v + n]);
+    }
+
+  size_t n_boundary = 0;
+  for (auto eh : grid.edges())
+    n_boundary += eh.is_boundary();
+  EXPECT_GT(n_boundary, 4u * (n - 1) + 100);
+
+  Mesh serial = grid;
+  {
+    OpenMesh::HoleFiller::HoleFillerT<Mesh> filler(serial);
+    filler.fill_all_holes(2, 1);
+  }
+
+  OpenMesh::ThreadPool::set_global_threads(4);
+  mesh_ = grid;
+  {
+    OpenMesh::HoleFiller::HoleFillerT<Mesh> filler(mesh_);
+    filler.fill_all_holes(2);
+  }
+  OpenMesh::ThreadPool::set_global_threads(0);
+
+  // the outer border is a hole as well
+  n_boundary = 0;
+  for (auto eh : mesh_.edges())
+    n_boundary += eh.is_boundary();
+  EXPECT_EQ(0u, n_boundary);
+
+  ASSERT_EQ(serial.n_vertices(), mesh_.n_vertices());
+  ASSERT_EQ(serial.n_faces(), mesh_.n_faces());
+  for (auto vh : mesh_.vertices())
+    EXPECT_EQ(serial.point(vh), mesh_.point(vh));
+  for (auto fh : mesh_.faces()) {
+    auto a = serial.fv_iter(fh), b = mesh_.fv_iter(fh);
+    EXPECT_EQ(*a, *b) << "Face " << fh.idx();
+  }
+}
+
 }
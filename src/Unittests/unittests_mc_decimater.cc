@@ -4,6 +4,7 @@
 #include <OpenMesh/Tools/Decimater/McDecimaterT.hh>
 #include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
 #include <OpenMesh/Tools/Decimater/ModNormalFlippingT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
 
 namespace {
 
@@ -157,4 +158,52 @@ TEST_F(OpenMeshMultipleChoiceDecimater, DecimateMeshStoppedByObserver) {
     EXPECT_EQ(14994u, mesh_.n_edges()) << "The number of edges after decimation is not correct!";
     EXPECT_EQ(9996u, mesh_.n_faces()) << "The number of faces after decimation is not correct!";
 }
+
+TEST_F(OpenMeshMultipleChoiceDecimater, DecimateMeshBatched) {
+
+  typedef OpenMesh::Decimater::McDecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Mesh >::Handle HModQuadric;
+  typedef OpenMesh::Decimater::ModNormalFlippingT< Mesh >::Handle HModNormalFlipping;
+
+  // decimate the same mesh with one and with four threads
+  Mesh meshes[2];
+  size_t removedVertices[2];
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_TRUE(OpenMesh::IO::read_mesh(meshes[i], "cube1.off"));
+
+    OpenMesh::ThreadPool::set_global_threads(i == 0 ? 1 : 4);
+    srand(42);
+
+    Decimater decimater(meshes[i]);
+    HModQuadric hModQuadric;
+    HModNormalFlipping hModNormalFlipping;
+    decimater.add(hModQuadric);
+    decimater.add(hModNormalFlipping);
+    decimater.initialize();
+    decimater.set_batch_size(64);
+    EXPECT_EQ(64u, decimater.batch_size());
+
+    removedVertices[i] = decimater.decimate_to(5000);
+    meshes[i].garbage_collection();
+  }
+  OpenMesh::ThreadPool::set_global_threads(0);
+
+  EXPECT_EQ(2526u, removedVertices[0]) << "The number of remove vertices is not correct!";
+  EXPECT_EQ(5000u, meshes[0].n_vertices()) << "The number of vertices after decimation is not correct!";
+  EXPECT_EQ(14994u, meshes[0].n_edges()) << "The number of edges after decimation is not correct!";
+  EXPECT_EQ(9996u, meshes[0].n_faces()) << "The number of faces after decimation is not correct!";
+
+  // the result must not depend on the number of threads
+  EXPECT_EQ(removedVertices[0], removedVertices[1]);
+  ASSERT_EQ(meshes[0].n_vertices(), meshes[1].n_vertices());
+  ASSERT_EQ(meshes[0].n_faces(), meshes[1].n_faces());
+  for (auto vh : meshes[0].vertices())
+    EXPECT_EQ(meshes[0].point(vh), meshes[1].point(vh)) << "Vertex " << vh.idx() << " differs";
+  for (auto fh : meshes[0].faces()) {
+    auto fv0 = meshes[0].cfv_iter(fh);
+    auto fv1 = meshes[1].cfv_iter(fh);
+    for (; fv0.is_valid(); ++fv0, ++fv1)
+      EXPECT_EQ(fv0->idx(), fv1->idx()) << "Face " << fh.idx() << " differs";
+  }
+}
 }
@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+#include <sstream>
+
+namespace {
+
+class OpenMeshMeshChecker : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+typedef OpenMesh::Utils::MeshCheckerT<Mesh> MeshChecker;
+typedef OpenMesh::Utils::MeshCheckReport    Report;
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * A valid mesh passes without violations
+ */
+TEST_F(OpenMeshMeshChecker, ValidMesh) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  OpenMesh::ThreadPool::set_global_threads(4);
+
+  Report report;
+  MeshChecker checker(mesh_);
+  EXPECT_TRUE(checker.check(report));
+  EXPECT_TRUE(report.ok());
+  EXPECT_TRUE(report.complete());
+  for (int i = 0; i < Report::N_VIOLATIONS; ++i)
+    EXPECT_EQ(0u, report.count(Report::Violation(i))) << Report::description(Report::Violation(i));
+
+  std::ostringstream log;
+  EXPECT_TRUE(checker.check(MeshChecker::CHECK_ALL, log));
+  EXPECT_TRUE(log.str().empty());
+
+  OpenMesh::ThreadPool::set_global_threads(0);
+}
+
+/*
+ * Two triangles sharing a single vertex are reported, but are no error
+ */
+TEST_F(OpenMeshMeshChecker, NonManifoldVertex) {
+
+  mesh_.clear();
+
+  Mesh::VertexHandle vhandle[5];
+  vhandle[0] = mesh_.add_vertex(Mesh::Point(0, 0, 0));
+  vhandle[1] = mesh_.add_vertex(Mesh::Point(1, 0, 0));
+  vhandle[2] = mesh_.add_vertex(Mesh::Point(1, 1, 0));
+  vhandle[3] = mesh_.add_vertex(Mesh::Point(-1, 0, 0));
+  vhandle[4] = mesh_.add_vertex(Mesh::Point(-1, -1, 0));
+
+  mesh_.add_face(vhandle[0], vhandle[1], vhandle[2]);
+  mesh_.add_face(vhandle[0], vhandle[3], vhandle[4]);
+
+  Report report;
+  MeshChecker checker(mesh_);
+  EXPECT_TRUE(checker.check(report));
+  ASSERT_EQ(1u, report.count(Report::VERTEX_NON_MANIFOLD));
+  EXPECT_EQ(0, report.samples(Report::VERTEX_NON_MANIFOLD)[0]);
+  EXPECT_EQ(0u, report.n_errors());
+}
+
+/*
+ * Corrupt the connectivity and check the reported violations
+ */
+TEST_F(OpenMeshMeshChecker, CorruptMesh) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  // a halfedge referencing the wrong face
+  const Mesh::HalfedgeHandle heh = mesh_.halfedge_handle(Mesh::FaceHandle(10));
+  mesh_.set_face_handle(heh, Mesh::FaceHandle(20));
+
+  // a vertex without outgoing halfedge, its halfedges become orphans
+  const Mesh::VertexHandle vh(100);
+  const size_t valence = mesh_.valence(vh);
+  mesh_.set_halfedge_handle(vh, Mesh::HalfedgeHandle());
+
+  // a vertex whose outgoing halfedge starts somewhere else, its halfedges
+  // are not found by circulating either
+  const Mesh::VertexHandle vh2(200);
+  const size_t valence2 = mesh_.valence(vh2);
+  mesh_.set_halfedge_handle(vh2, mesh_.opposite_halfedge_handle(mesh_.halfedge_handle(vh2)));
+
+  Report report(3);
+  MeshChecker checker(mesh_);
+  EXPECT_FALSE(checker.check(report));
+  EXPECT_TRUE(report.complete());
+
+  ASSERT_EQ(1u, report.count(Report::FACE_HALFEDGE));
+  EXPECT_EQ(10, report.samples(Report::FACE_HALFEDGE)[0]);
+
+  EXPECT_EQ(valence, report.count(Report::HALFEDGE_ISOLATED_VERTEX));
+  EXPECT_EQ(valence + valence2, report.count(Report::HALFEDGE_ORPHANED));
+  EXPECT_EQ(3u, report.samples(Report::HALFEDGE_ORPHANED).size());
+
+  EXPECT_EQ(1u, report.count(Report::VERTEX_HALFEDGE_FROM));
+  EXPECT_EQ(200, report.samples(Report::VERTEX_HALFEDGE_FROM)[0]);
+
+  // the samples do not depend on the number of threads
+  OpenMesh::ThreadPool::set_global_threads(4);
+  Report parallel(3);
+  EXPECT_FALSE(checker.check(parallel));
+  for (int i = 0; i < Report::N_VIOLATIONS; ++i) {
+    const Report::Violation v = Report::Violation(i);
+    EXPECT_EQ(report.count(v), parallel.count(v)) << Report::description(v);
+    EXPECT_EQ(report.samples(v), parallel.samples(v)) << Report::description(v);
+  }
+  OpenMesh::ThreadPool::set_global_threads(0);
+
+  // the stream output has a line per offending element, not only samples
+  std::ostringstream log;
+  EXPECT_FALSE(checker.check(MeshChecker::CHECK_ALL, log));
+  EXPECT_NE(std::string::npos, log.str().find("MeshChecker: face 10: "));
+  EXPECT_NE(std::string::npos, log.str().find("MeshChecker: vertex 200: "));
+
+  size_t n_orphaned = 0;
+  std::istringstream lines(log.str());
+  for (std::string line; std::getline(lines, line); )
+    if (line.find(Report::description(Report::HALFEDGE_ORPHANED)) != std::string::npos)
+      ++n_orphaned;
+  EXPECT_EQ(valence + valence2, n_orphaned);
+}
+
+/*
+ * Early exit stops at the first error
+ */
+TEST_F(OpenMeshMeshChecker, EarlyExit) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  for (int i = 0; i < 100; ++i)
+    mesh_.set_face_handle(mesh_.halfedge_handle(Mesh::FaceHandle(i)), Mesh::FaceHandle(i + 1));
+
+  Report report;
+  MeshChecker checker(mesh_);
+  checker.set_early_exit(true);
+  EXPECT_FALSE(checker.check(report, MeshChecker::CHECK_FACES));
+  EXPECT_FALSE(report.complete());
+  EXPECT_EQ(1u, report.n_errors());
+
+  std::ostringstream log;
+  report.write(log);
+  EXPECT_NE(std::string::npos, log.str().find("stopped"));
+
+  checker.set_early_exit(false);
+  EXPECT_FALSE(checker.check(report, MeshChecker::CHECK_FACES));
+  EXPECT_TRUE(report.complete());
+  EXPECT_EQ(100u, report.count(Report::FACE_HALFEDGE));
+}
+
+/*
+ * Without the PrevHalfedge attribute an open next cycle does not hang the checker
+ */
+struct NoPrevTraits : public OpenMesh::DefaultTraits
+{
+  HalfedgeAttributes(0);
+};
+typedef OpenMesh::TriMesh_ArrayKernelT<NoPrevTraits> NoPrevMesh;
+
+TEST_F(OpenMeshMeshChecker, NoPrevHalfedge) {
+
+  NoPrevMesh mesh;
+
+  NoPrevMesh::VertexHandle vhandle[4];
+  vhandle[0] = mesh.add_vertex(NoPrevMesh::Point(0, 0, 0));
+  vhandle[1] = mesh.add_vertex(NoPrevMesh::Point(1, 0, 0));
+  vhandle[2] = mesh.add_vertex(NoPrevMesh::Point(1, 1, 0));
+  vhandle[3] = mesh.add_vertex(NoPrevMesh::Point(0, 1, 0));
+
+  const NoPrevMesh::FaceHandle fh = mesh.add_face(vhandle[0], vhandle[1], vhandle[2]);
+  mesh.add_face(vhandle[0], vhandle[2], vhandle[3]);
+
+  OpenMesh::Utils::MeshCheckerT<NoPrevMesh> checker(mesh);
+  Report report;
+  EXPECT_TRUE(checker.check(report));
+
+  // h1 -> h2 -> h1 never returns to h0
+  const NoPrevMesh::HalfedgeHandle h0 = mesh.halfedge_handle(fh);
+  const NoPrevMesh::HalfedgeHandle h1 = mesh.next_halfedge_handle(h0);
+  const NoPrevMesh::HalfedgeHandle h2 = mesh.next_halfedge_handle(h1);
+  mesh.set_next_halfedge_handle(h2, h1);
+
+  EXPECT_FALSE(checker.check(report));
+  EXPECT_TRUE(report.complete());
+  EXPECT_LT(0u, report.count(Report::HALFEDGE_INVALID));
+}
+
+}
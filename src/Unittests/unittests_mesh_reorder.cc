@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/MeshReorderT.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <sstream>
+
+namespace {
+
+class OpenMeshMeshReorder : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+        // Mean index distance between the two vertices of an edge
+        double mean_edge_span() const {
+            double span = 0.0;
+            for (auto eh : mesh_.edges())
+                span += std::abs(eh.v0().idx() - eh.v1().idx());
+            return span / double(mesh_.n_edges());
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Shuffle a mesh, reorder it along the Hilbert curve and check that
+ * properties, connectivity and the reported remap stay consistent
+ */
+TEST_F(OpenMeshMeshReorder, ShuffleAndReorder) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "sphere840.ply");
+  ASSERT_TRUE(ok);
+
+  const size_t n_v = mesh_.n_vertices();
+  const size_t n_e = mesh_.n_edges();
+  const size_t n_f = mesh_.n_faces();
+
+  // Store the geometry of all elements in properties
+  OpenMesh::VPropHandleT<Mesh::Point> vpos;
+  OpenMesh::EPropHandleT<Mesh::Point> emid;
+  OpenMesh::FPropHandleT<Mesh::Point> fcenter;
+  mesh_.add_property(vpos);
+  mesh_.add_property(emid);
+  mesh_.add_property(fcenter);
+  for (auto vh : mesh_.vertices())
+    mesh_.property(vpos, vh) = mesh_.point(vh);
+  for (auto eh : mesh_.edges())
+    mesh_.property(emid, eh) = mesh_.calc_edge_midpoint(eh);
+  for (auto fh : mesh_.faces())
+    mesh_.property(fcenter, fh) = mesh_.calc_face_centroid(fh);
+
+  OpenMesh::Utils::MeshReorderT<Mesh> reorder(mesh_);
+  typedef OpenMesh::Utils::MeshReorderT<Mesh>::Remap Remap;
+
+  // Random vertex order
+  std::vector<Mesh::VertexHandle> order(mesh_.vertices().begin(), mesh_.vertices().end());
+  std::mt19937 rng(42);
+  std::shuffle(order.begin(), order.end(), rng);
+
+  Mesh::VertexHandle tracked_vh(17);
+  Mesh::FaceHandle   tracked_fh(100);
+  const Mesh::Point  tracked_point  = mesh_.point(tracked_vh);
+  const Mesh::Point  tracked_center = mesh_.calc_face_centroid(tracked_fh);
+  const Mesh::Point  first_point    = mesh_.point(order[0]);
+
+  Remap remap = reorder.reorder(order);
+  tracked_vh = remap.vertices[tracked_vh.idx()];
+  tracked_fh = remap.faces[tracked_fh.idx()];
+
+  EXPECT_EQ(Mesh::VertexHandle(0), remap.vertices[order[0].idx()]) << "Wrong vertex order";
+  EXPECT_EQ(first_point,    mesh_.point(Mesh::VertexHandle(0)))   << "Wrong vertex order";
+  EXPECT_EQ(tracked_point,  mesh_.point(tracked_vh))              << "Remap does not track the vertex";
+  EXPECT_EQ(tracked_center, mesh_.calc_face_centroid(tracked_fh)) << "Remap does not track the face";
+
+  const double shuffled_span = mean_edge_span();
+
+  // Sort along the Hilbert curve
+  remap = reorder.reorder();
+  EXPECT_EQ(tracked_point,  mesh_.point(remap.vertices[tracked_vh.idx()]));
+  EXPECT_EQ(tracked_center, mesh_.calc_face_centroid(remap.faces[tracked_fh.idx()]));
+
+  const double sorted_span = mean_edge_span();
+  EXPECT_LT(sorted_span, 0.5 * shuffled_span) << "Hilbert order should improve locality";
+
+  // Faces are ordered by their lowest vertex
+  int last_key = -1;
+  for (auto fh : mesh_.faces())
+  {
+    int key = int(n_v);
+    for (auto fv : fh.vertices())
+      key = std::min(key, fv.idx());
+    EXPECT_LE(last_key, key);
+    last_key = key;
+  }
+
+  // Nothing got lost and all properties moved with their elements
+  EXPECT_EQ(n_v, mesh_.n_vertices());
+  EXPECT_EQ(n_e, mesh_.n_edges());
+  EXPECT_EQ(n_f, mesh_.n_faces());
+
+  for (auto vh : mesh_.vertices())
+    EXPECT_EQ(mesh_.property(vpos, vh), mesh_.point(vh));
+  for (auto eh : mesh_.edges())
+    EXPECT_EQ(mesh_.property(emid, eh), mesh_.calc_edge_midpoint(eh));
+  for (auto fh : mesh_.faces())
+    EXPECT_EQ(mesh_.property(fcenter, fh), mesh_.calc_face_centroid(fh));
+
+  std::ostringstream log;
+  OpenMesh::Utils::MeshCheckerT<Mesh> checker(mesh_);
+  EXPECT_TRUE(checker.check(OpenMesh::Utils::MeshCheckerT<Mesh>::CHECK_ALL, log)) << log.str();
+}
+
+/*
+ * Reordering a mesh with boundary and deleted elements
+ */
+TEST_F(OpenMeshMeshReorder, BoundaryAndDeletedElements) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube-minimal.obj");
+  ASSERT_TRUE(ok);
+
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+
+  // Open the mesh
+  mesh_.delete_face(Mesh::FaceHandle(0), true);
+  mesh_.delete_face(Mesh::FaceHandle(5), true);
+
+  OpenMesh::Utils::MeshReorderT<Mesh> reorder(mesh_);
+  reorder.reorder(OpenMesh::Utils::MeshReorderT<Mesh>::Morton);
+
+  // Deleted faces and edges went to the end
+  EXPECT_TRUE(mesh_.status(Mesh::FaceHandle(int(mesh_.n_faces()) - 1)).deleted());
+  EXPECT_TRUE(mesh_.status(Mesh::FaceHandle(int(mesh_.n_faces()) - 2)).deleted());
+  EXPECT_FALSE(mesh_.status(Mesh::FaceHandle(0)).deleted());
+
+  std::ostringstream log;
+  OpenMesh::Utils::MeshCheckerT<Mesh> checker(mesh_);
+  EXPECT_TRUE(checker.check(OpenMesh::Utils::MeshCheckerT<Mesh>::CHECK_ALL, log)) << log.str();
+
+  // Removing the deleted elements still works
+  mesh_.garbage_collection();
+  EXPECT_EQ(10u, mesh_.n_faces());
+  EXPECT_TRUE(checker.check(OpenMesh::Utils::MeshCheckerT<Mesh>::CHECK_ALL, log)) << log.str();
+}
+
+/*
+ * Curve keys of huge, infinite and NaN coordinates
+ */
+TEST_F(OpenMeshMeshReorder, NonFiniteCoordinates) {
+
+  mesh_.clear();
+
+  const float big = std::numeric_limits<float>::max();
+  const float inf = std::numeric_limits<float>::infinity();
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+
+  // finite vertices along the x axis spanning the whole float range
+  const float x[5] = { big, -big, 0.5f * big, 0.0f, -0.5f * big };
+  for (int i = 0; i < 5; ++i)
+    mesh_.add_vertex(Mesh::Point(x[i], 0, 0));
+  mesh_.add_vertex(Mesh::Point(inf, 0, 0));
+  mesh_.add_vertex(Mesh::Point(nan, nan, nan));
+
+  OpenMesh::Utils::MeshReorderT<Mesh> reorder(mesh_);
+  const std::vector<Mesh::VertexHandle> order = reorder.curve_order(OpenMesh::Utils::MeshReorderT<Mesh>::Morton);
+  ASSERT_EQ(7u, order.size());
+
+  // the finite vertices are ordered by x, the others come last
+  const int expected[5] = { 1, 4, 3, 2, 0 };
+  for (int i = 0; i < 5; ++i)
+    EXPECT_EQ(expected[i], order[i].idx()) << "at " << i;
+  EXPECT_EQ(5, order[5].idx());
+  EXPECT_EQ(6, order[6].idx());
+}
+
+}
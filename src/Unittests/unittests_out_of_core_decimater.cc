@@ -0,0 +1,115 @@
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Decimater/OutOfCoreDecimater.hh>
+
+#include <cstdio>
+
+namespace {
+
+class OpenMeshOutOfCoreDecimater : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Decimate a mesh that is larger than the cluster budget, the result must be
+ * a closed mesh with the requested number of vertices
+ */
+TEST_F(OpenMeshOutOfCoreDecimater, DecimateFile) {
+
+  OpenMesh::Decimater::OutOfCoreDecimater decimater;
+  decimater.set_max_cluster_faces(4000);
+  decimater.set_max_normal_deviation(60.0);
+
+  bool ok = decimater.decimate("cube1.off", "cube1_out_of_core.off", 1000);
+
+  ASSERT_TRUE(ok);
+
+  EXPECT_GE(decimater.n_rounds(), 1u) << "The mesh was not decimated in clusters!";
+  EXPECT_GT(decimater.n_clusters(), 1u) << "The mesh was not split into clusters!";
+  EXPECT_LE(decimater.max_faces_in_memory(), 4000u) << "More faces than allowed were held in memory!";
+
+  ok = OpenMesh::IO::read_mesh(mesh_, "cube1_out_of_core.off");
+  std::remove("cube1_out_of_core.off");
+
+  ASSERT_TRUE(ok);
+
+  EXPECT_EQ(1000u, mesh_.n_vertices()) << "The number of vertices after decimation is not correct!";
+  EXPECT_EQ(1996u, mesh_.n_faces()) << "The number of faces after decimation is not correct!";
+
+  for (auto heh : mesh_.halfedges())
+    EXPECT_FALSE(mesh_.is_boundary(heh)) << "The decimated mesh has a boundary!";
+}
+
+/*
+ * A target that does not fit into the cluster budget is reached by a final
+ * pass over clusters, the result is streamed to the writer
+ */
+TEST_F(OpenMeshOutOfCoreDecimater, DecimateTargetLargerThanCluster) {
+
+  OpenMesh::Decimater::OutOfCoreDecimater decimater;
+  decimater.set_max_cluster_faces(1500);
+  decimater.set_max_rounds(2);
+
+  bool ok = decimater.decimate("cube1.off", "cube1_out_of_core.off", 1000);
+  ASSERT_TRUE(ok);
+
+  EXPECT_EQ(2u, decimater.n_rounds()) << "The number of rounds is not correct!";
+  EXPECT_LE(decimater.max_faces_in_memory(), 1500u) << "More faces than allowed were held in memory!";
+
+  ok = OpenMesh::IO::read_mesh(mesh_, "cube1_out_of_core.off");
+  std::remove("cube1_out_of_core.off");
+  ASSERT_TRUE(ok);
+
+  // the seams of the final pass are kept, the target is met approximately
+  EXPECT_NEAR(1000.0, double(mesh_.n_vertices()), 50.0) << "The number of vertices after decimation is not correct!";
+  EXPECT_EQ(2 * mesh_.n_vertices() - 4, mesh_.n_faces()) << "The decimated mesh is not a closed surface of genus 0!";
+
+  for (auto heh : mesh_.halfedges())
+    EXPECT_FALSE(mesh_.is_boundary(heh)) << "The decimated mesh has a boundary!";
+}
+
+/*
+ * Inputs that fit into a single cluster are decimated in core
+ */
+TEST_F(OpenMeshOutOfCoreDecimater, DecimateSmallFile) {
+
+  OpenMesh::Decimater::OutOfCoreDecimater decimater;
+
+  bool ok = decimater.decimate("cube1.off", "cube1_out_of_core.off", 5000);
+
+  ASSERT_TRUE(ok);
+
+  EXPECT_EQ(0u, decimater.n_rounds()) << "The mesh should not have been split!";
+
+  ok = OpenMesh::IO::read_mesh(mesh_, "cube1_out_of_core.off");
+  std::remove("cube1_out_of_core.off");
+
+  ASSERT_TRUE(ok);
+
+  EXPECT_EQ(5000u, mesh_.n_vertices()) << "The number of vertices after decimation is not correct!";
+}
+
+}
@@ -0,0 +1,287 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Decimater/DecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/ModProgMeshT.hh>
+#include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
+#include <OpenMesh/Tools/Utils/ProgressiveMesh.hh>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace {
+
+class OpenMeshProgressiveMesh : public OpenMeshBase {
+
+    protected:
+
+        typedef std::vector< std::vector<unsigned int> > FaceList;
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+        // Rotate the smallest index to the front, keeps the orientation
+        static std::vector<unsigned int> normalized(unsigned int _a, unsigned int _b, unsigned int _c) {
+            std::vector<unsigned int> f = { _a, _b, _c };
+            std::rotate(f.begin(), std::min_element(f.begin(), f.end()), f.end());
+            return f;
+        }
+
+        static FaceList faces(const OpenMesh::Utils::ProgressiveMesh& _pm) {
+            FaceList result;
+            for (size_t i = 0; i < _pm.n_faces(); ++i)
+                result.push_back(normalized(_pm.faces()[3*i], _pm.faces()[3*i+1], _pm.faces()[3*i+2]));
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        static FaceList faces(const Mesh& _mesh) {
+            FaceList result;
+            for (auto fh : _mesh.faces()) {
+                auto fv = _mesh.cfv_iter(fh);
+                const unsigned int a = fv->idx(); ++fv;
+                const unsigned int b = fv->idx(); ++fv;
+                result.push_back(normalized(a, b, fv->idx()));
+            }
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        // Triangulated n x n grid, decimated into a progressive mesh file
+        // and optionally into a compact one
+        void write_grid_pm(int _n, const std::string& _filename, const std::string& _compact_filename = "") {
+            mesh_.clear();
+            std::vector<Mesh::VertexHandle> vhs;
+            for (int i = 0; i < _n; ++i)
+                for (int j = 0; j < _n; ++j)
+                    vhs.push_back(mesh_.add_vertex(Mesh::Point(float(i), float(j), float((i * j) % 5) * 0.3f)));
+            for (int i = 0; i + 1 < _n; ++i)
+                for (int j = 0; j + 1 < _n; ++j) {
+                    const int v = i * _n + j;
+                    mesh_.add_face(vhs[v], vhs[v + 1], vhs[v + _n + 1]);
+                    mesh_.add_face(vhs[v], vhs[v + _n + 1], vhs[v + _n]);
+                }
+
+            OpenMesh::Decimater::DecimaterT<Mesh> decimater(mesh_);
+            OpenMesh::Decimater::ModProgMeshT<Mesh>::Handle hModProg;
+            OpenMesh::Decimater::ModQuadricT<Mesh>::Handle hModQuadric;
+            decimater.add(hModQuadric);
+            decimater.add(hModProg);
+            decimater.initialize();
+            decimater.decimate_to(10);
+            ASSERT_TRUE(decimater.module(hModProg).write(_filename));
+            if (!_compact_filename.empty()) {
+                ASSERT_TRUE(decimater.module(hModProg).write_compact(_compact_filename, 16, 64));
+            }
+        }
+
+        static std::string read_file(const std::string& _filename) {
+            std::ifstream ifs(_filename.c_str(), std::ios::binary);
+            std::stringstream ss;
+            ss << ifs.rdbuf();
+            return ss.str();
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Every level of detail matches replaying the vertex splits on a mesh
+ */
+TEST_F(OpenMeshProgressiveMesh, Levels) {
+
+  OpenMesh::Utils::ProgressiveMesh pm;
+  ASSERT_TRUE(pm.open("cube1.pm"));
+  EXPECT_EQ(4u, pm.n_base_vertices());
+  EXPECT_EQ(4u, pm.n_base_faces());
+  EXPECT_EQ(7522u, pm.n_details());
+  EXPECT_EQ(0u, pm.n_loaded_details());
+  EXPECT_TRUE(pm.streaming());
+
+  // reference: the base mesh refined by vertex splits
+  Mesh reference;
+  for (size_t i = 0; i < pm.n_base_vertices(); ++i)
+    reference.add_vertex(OpenMesh::vector_cast<Mesh::Point>(pm.points()[i]));
+  for (size_t i = 0; i < pm.n_base_faces(); ++i)
+    reference.add_face(Mesh::VertexHandle(pm.faces()[3*i]), Mesh::VertexHandle(pm.faces()[3*i+1]),
+                       Mesh::VertexHandle(pm.faces()[3*i+2]));
+
+  std::ifstream ifs("cube1.pm", std::ios::binary);
+  ifs.seekg(8 + 3 * 4 + pm.n_base_vertices() * 12 + pm.n_base_faces() * 12);
+
+  std::map<size_t, FaceList> levels;
+  levels[reference.n_vertices()] = faces(reference);
+  for (size_t i = 0; i < pm.n_details(); ++i) {
+    OpenMesh::Vec3f p;
+    unsigned int v1, vl, vr;
+    OpenMesh::IO::restore(ifs, p, false);
+    OpenMesh::IO::restore(ifs, v1, false);
+    OpenMesh::IO::restore(ifs, vl, false);
+    OpenMesh::IO::restore(ifs, vr, false);
+    const Mesh::VertexHandle v0 = reference.add_vertex(OpenMesh::vector_cast<Mesh::Point>(p));
+    reference.vertex_split(v0, Mesh::VertexHandle(v1), Mesh::VertexHandle(vl), Mesh::VertexHandle(vr));
+    if (i % 997 == 0 || i + 1 == pm.n_details())
+      levels[reference.n_vertices()] = faces(reference);
+  }
+
+  // refine in steps, records are streamed on demand
+  for (auto& level : levels) {
+    EXPECT_EQ(level.first, pm.set_n_vertices(level.first));
+    EXPECT_EQ(level.first - pm.n_base_vertices(), pm.n_loaded_details());
+    EXPECT_EQ(level.second, faces(pm)) << level.first << " vertices";
+  }
+  EXPECT_FALSE(pm.streaming());
+
+  // jump around
+  for (auto it = levels.rbegin(); it != levels.rend(); ++it) {
+    EXPECT_EQ(it->first, pm.set_n_vertices(it->first));
+    EXPECT_EQ(it->second, faces(pm)) << it->first << " vertices";
+  }
+  const size_t finest = levels.rbegin()->first;
+  EXPECT_EQ(finest, pm.set_n_vertices(finest));
+  EXPECT_EQ(levels[finest], faces(pm));
+
+  // clamped to the available range
+  EXPECT_EQ(pm.n_base_vertices(), pm.set_n_vertices(0));
+  EXPECT_EQ(pm.n_base_faces(), pm.n_faces());
+  EXPECT_EQ(finest, pm.set_n_vertices(finest + 100));
+}
+
+/*
+ * Streaming from a std::istream, conversion to a mesh
+ */
+TEST_F(OpenMeshProgressiveMesh, Stream) {
+
+  const std::string filename = "progressive_mesh_test_file.pm";
+  write_grid_pm(20, filename);
+
+  std::stringstream ss;
+  {
+    std::ifstream ifs(filename.c_str(), std::ios::binary);
+    ss << ifs.rdbuf();
+  }
+  remove(filename.c_str());
+
+  OpenMesh::Utils::ProgressiveMesh pm;
+  ASSERT_TRUE(pm.open(ss));
+  EXPECT_EQ(10u, pm.n_base_vertices());
+  EXPECT_EQ(390u, pm.n_details());
+
+  // explicit batches keep the level of detail
+  EXPECT_EQ(100u, pm.load(100));
+  EXPECT_EQ(10u, pm.n_vertices());
+  EXPECT_EQ(50u, pm.refine(50));
+  EXPECT_EQ(100u, pm.n_loaded_details());
+  EXPECT_EQ(290u, pm.load());
+  EXPECT_FALSE(pm.streaming());
+  EXPECT_EQ(50u, pm.n_vertices());
+
+  // the finest level is the original grid, up to the vertex order
+  EXPECT_EQ(400u, pm.refine(1000));
+  EXPECT_EQ(2u * 19u * 19u, pm.n_faces());
+
+  Mesh mesh;
+  pm.get_mesh(mesh);
+  EXPECT_EQ(400u, mesh.n_vertices());
+  EXPECT_EQ(pm.n_faces(), mesh.n_faces());
+  EXPECT_EQ(faces(pm), faces(mesh));
+
+  size_t n_boundary = 0;
+  for (auto eh : mesh.edges())
+    n_boundary += eh.is_boundary();
+  EXPECT_EQ(4u * 19u, n_boundary);
+
+  pm.coarsen(0);
+  pm.get_mesh(mesh);
+  EXPECT_EQ(10u, mesh.n_vertices());
+  EXPECT_EQ(pm.n_base_faces(), mesh.n_faces());
+
+  // broken input
+  std::stringstream broken("ProgMash");
+  EXPECT_FALSE(pm.open(broken));
+  EXPECT_EQ(0u, pm.n_vertices());
+  EXPECT_EQ(0u, pm.n_faces());
+}
+
+/*
+ * The compact format has the same connectivity, quantized positions, is
+ * much smaller and can be truncated after any block
+ */
+TEST_F(OpenMeshProgressiveMesh, Compact) {
+
+  const std::string filename = "progressive_mesh_test_file.pm";
+  const std::string compact_filename = "progressive_mesh_test_file_compact.pm";
+  write_grid_pm(40, filename, compact_filename);
+  const std::string raw = read_file(filename);
+  const std::string compact = read_file(compact_filename);
+  remove(filename.c_str());
+  remove(compact_filename.c_str());
+
+  EXPECT_LT(4 * compact.size(), raw.size()) << raw.size() << " vs " << compact.size() << " bytes";
+
+  std::stringstream raw_stream(raw), compact_stream(compact);
+  OpenMesh::Utils::ProgressiveMesh pm_raw, pm;
+  ASSERT_TRUE(pm_raw.open(raw_stream));
+  ASSERT_TRUE(pm.open(compact_stream));
+  EXPECT_EQ(pm_raw.n_base_vertices(), pm.n_base_vertices());
+  EXPECT_EQ(pm_raw.n_base_faces(), pm.n_base_faces());
+  EXPECT_EQ(1590u, pm.n_details());
+
+  // grid spacing of 16 bits over an extent of 39
+  const float eps = 39.0f / 65535.0f;
+  for (size_t n : { size_t(10), size_t(500), size_t(1600), size_t(200) }) {
+    EXPECT_EQ(n, pm_raw.set_n_vertices(n));
+    EXPECT_EQ(n, pm.set_n_vertices(n));
+    EXPECT_EQ(faces(pm_raw), faces(pm)) << n << " vertices";
+  }
+  EXPECT_FALSE(pm.streaming());
+
+  pm.set_n_vertices(1600);
+  pm_raw.set_n_vertices(1600);
+  float max_error = 0.0f;
+  for (size_t i = 0; i < pm.n_vertices(); ++i)
+    max_error = std::max(max_error, (pm.points()[i] - pm_raw.points()[i]).max_abs());
+  EXPECT_LE(max_error, 0.5f * eps * 1.01f);
+
+  // cut after the third block of 64 records: header (48 bytes), base mesh,
+  // block table and three blocks
+  unsigned int base_size(0), n_blocks(0), offset(0);
+  std::memcpy(&base_size, compact.data() + 44, 4);
+  std::memcpy(&n_blocks, compact.data() + 48 + base_size, 4);
+  std::memcpy(&offset, compact.data() + 48 + base_size + 4 + 3 * 4, 4);
+  EXPECT_EQ(25u, n_blocks);
+  const size_t cut = 48 + base_size + 4 + 4 * (n_blocks + 1) + offset;
+
+  std::stringstream truncated(compact.substr(0, cut));
+  ASSERT_TRUE(pm.open(truncated));
+  EXPECT_EQ(1590u, pm.n_details());
+  EXPECT_EQ(10u + 3u * 64u, pm.set_n_vertices(1600));
+  EXPECT_EQ(3u * 64u, pm.n_details());
+  EXPECT_FALSE(pm.streaming());
+  EXPECT_EQ(faces(pm), (pm_raw.set_n_vertices(10 + 3 * 64), faces(pm_raw)));
+
+  // invalid quantization
+  std::string broken = compact;
+  broken[20] = 0;
+  std::stringstream broken_stream(broken);
+  EXPECT_FALSE(pm.open(broken_stream));
+}
+
+}
@@ -852,5 +852,281 @@ TEST_F(OpenMeshProperties, MeshAssignment ) {
 
 }
 
+/*
+ * Meshes whose properties are allocated through ResourceAllocatorT
+ */
+struct ArenaTraits : public OpenMesh::DefaultTraits
+{
+  typedef OpenMesh::ResourceAllocatorT<char> PropertyAllocator;
+};
+typedef OpenMesh::TriMesh_ArrayKernelT<ArenaTraits> ArenaMesh;
+
+/* Copies a mesh with copy-on-write enabled and checks that the properties
+ * are shared until they are modified
+ */
+TEST_F(OpenMeshProperties, CopyOnWriteSnapshot ) {
+
+  // Meshes with default traits share their arrays as well
+  mesh_.clear();
+  const Mesh::VertexHandle vh = mesh_.add_vertex(Mesh::Point(0, 0, 0));
+  const Mesh& cmesh = mesh_;
+  {
+    Mesh deep(mesh_);
+    const Mesh& cdeep = deep;
+    EXPECT_NE(cmesh.property(cmesh.points_pph()).data(), cdeep.property(cdeep.points_pph()).data()) << "Copy shares property data without copy-on-write";
+    EXPECT_NE(&cmesh.vertex(vh), &cdeep.vertex(vh)) << "Copy shares connectivity without copy-on-write";
+  }
+  mesh_.set_copy_on_write(true);
+  EXPECT_TRUE(mesh_.copy_on_write());
+  {
+    Mesh shallow(mesh_);
+    const Mesh& cshallow = shallow;
+    EXPECT_EQ(cmesh.property(cmesh.points_pph()).data(), cshallow.property(cshallow.points_pph()).data());
+    EXPECT_EQ(&cmesh.vertex(vh), &cshallow.vertex(vh));
+    shallow.set_isolated(vh);
+    EXPECT_NE(&cmesh.vertex(vh), &cshallow.vertex(vh));
+    EXPECT_EQ(cmesh.property(cmesh.points_pph()).data(), cshallow.property(cshallow.points_pph()).data());
+  }
+  mesh_.set_copy_on_write(false);
+
+  ArenaMesh mesh;
+
+  // Add some vertices
+  ArenaMesh::VertexHandle vhandle[4];
+
+  vhandle[0] = mesh.add_vertex(ArenaMesh::Point(0, 0, 0));
+  vhandle[1] = mesh.add_vertex(ArenaMesh::Point(0, 1, 0));
+  vhandle[2] = mesh.add_vertex(ArenaMesh::Point(1, 1, 0));
+  vhandle[3] = mesh.add_vertex(ArenaMesh::Point(1, 0, 0));
+
+  // Add two faces
+  mesh.add_face(vhandle[2], vhandle[1], vhandle[0]);
+  mesh.add_face(vhandle[2], vhandle[0], vhandle[3]);
+
+  OpenMesh::VPropHandleT<int> intHandle;
+  mesh.add_property(intHandle, "intProp");
+  for (int i = 0; i < 4; ++i)
+    mesh.property(intHandle, vhandle[i]) = i;
+
+  EXPECT_FALSE(mesh.copy_on_write());
+  mesh.set_copy_on_write(true);
+  EXPECT_TRUE(mesh.copy_on_write());
+
+  ArenaMesh snapshot(mesh);
+  const ArenaMesh& cmanaged  = mesh;
+  const ArenaMesh& csnapshot = snapshot;
+  EXPECT_TRUE(snapshot.copy_on_write());
+
+  // The properties and the connectivity are shared directly after the copy
+  EXPECT_EQ(cmanaged.property(intHandle).data(),             csnapshot.property(intHandle).data());
+  EXPECT_EQ(cmanaged.property(cmanaged.points_pph()).data(), csnapshot.property(csnapshot.points_pph()).data());
+  EXPECT_EQ(&cmanaged.vertex(vhandle[0]),                    &csnapshot.vertex(vhandle[0]));
+  EXPECT_EQ(&cmanaged.face(cmanaged.face_handle(0)),         &csnapshot.face(csnapshot.face_handle(0)));
+
+  // Modify the points of the snapshot, only the points get duplicated
+  snapshot.set_point(vhandle[0], ArenaMesh::Point(5, 5, 5));
+  EXPECT_NE(cmanaged.property(cmanaged.points_pph()).data(), csnapshot.property(csnapshot.points_pph()).data());
+  EXPECT_EQ(cmanaged.property(intHandle).data(),             csnapshot.property(intHandle).data());
+  EXPECT_EQ(ArenaMesh::Point(0, 0, 0), cmanaged.point(vhandle[0]))  << "Original point modified through snapshot";
+  EXPECT_EQ(ArenaMesh::Point(5, 5, 5), csnapshot.point(vhandle[0])) << "Snapshot point not modified";
+
+  // Modify a custom property of the original
+  mesh.property(intHandle, vhandle[1]) = 42;
+  EXPECT_EQ(42, cmanaged.property(intHandle, vhandle[1]));
+  EXPECT_EQ(1,  csnapshot.property(intHandle, vhandle[1]))    << "Snapshot property modified through original";
+
+  // Topology changes of the snapshot do not affect the original
+  snapshot.add_vertex(ArenaMesh::Point(2, 2, 2));
+  snapshot.add_face(vhandle[3], vhandle[0], ArenaMesh::VertexHandle(4));
+  EXPECT_EQ(5u, snapshot.n_vertices());
+  EXPECT_EQ(3u, snapshot.n_faces());
+  EXPECT_EQ(4u, mesh.n_vertices());
+  EXPECT_EQ(2u, mesh.n_faces());
+  EXPECT_EQ(5u, snapshot.property(intHandle).n_elements());
+  EXPECT_EQ(4u, mesh.property(intHandle).n_elements());
+  EXPECT_NE(&cmanaged.face(cmanaged.face_handle(0)),         &csnapshot.face(csnapshot.face_handle(0)));
+  EXPECT_TRUE(mesh.is_valid_handle(mesh.halfedge_handle(vhandle[3])));
+
+  // Snapshots can be assigned as well and released in any order
+  ArenaMesh second;
+  second = snapshot;
+  snapshot.clear();
+  EXPECT_EQ(5u, second.n_vertices());
+  EXPECT_EQ(3, second.property(intHandle, vhandle[3]));
+  EXPECT_EQ(ArenaMesh::Point(5, 5, 5), second.point(vhandle[0]));
+
+  // Once the other owners are gone, writing takes the buffer over without a copy
+  const ArenaMesh& csecond = second;
+  const int* data = &csecond.property(intHandle, vhandle[0]);
+  {
+    const ArenaMesh third(second);
+    EXPECT_EQ(data, &third.property(intHandle, vhandle[0]));
+  }
+  second.property(intHandle, vhandle[0]) = 7;
+  EXPECT_EQ(data, &csecond.property(intHandle, vhandle[0])) << "Buffer copied although it was not shared anymore";
+}
+
+/*
+ * Allocate the properties of a mesh from an arena
+ */
+TEST_F(OpenMeshProperties, MemoryResourceArena) {
+
+  OpenMesh::ArenaMemoryResource arena(4096);
+
+  // Meshes with default traits keep std::vector storage and reject resources
+  {
+    Mesh mesh;
+    EXPECT_FALSE(mesh.set_memory_resource(&arena));
+    mesh.add_vertex(Mesh::Point(0, 0, 0));
+    EXPECT_EQ(nullptr, mesh.property(mesh.points_pph()).memory_resource());
+    EXPECT_EQ(0u, arena.bytes_allocated());
+  }
 
+  {
+    ArenaMesh mesh;
+    OpenMesh::VPropHandleT<int> intHandle;
+    mesh.add_property(intHandle, "intProp");
+
+    EXPECT_TRUE(mesh.set_memory_resource(&arena));
+    EXPECT_EQ(&arena, mesh.memory_resource());
+    EXPECT_EQ(&arena, mesh.property(mesh.points_pph()).memory_resource());
+    EXPECT_EQ(&arena, mesh.property(intHandle).memory_resource());
+
+    // Growth in new_vertex is served from the arena
+    const size_t before = arena.bytes_allocated();
+    std::vector<ArenaMesh::VertexHandle> vhandle;
+    for (int i = 0; i < 100; ++i)
+      vhandle.push_back(mesh.add_vertex(ArenaMesh::Point(float(i), float(i % 2), 0)));
+    EXPECT_GT(arena.bytes_allocated(), before + 100 * sizeof(ArenaMesh::Point));
+    for (int i = 0; i + 2 < 100; ++i)
+      if (i % 2 == 0)
+        mesh.add_face(vhandle[i], vhandle[i+1], vhandle[i+2]);
+      else
+        mesh.add_face(vhandle[i], vhandle[i+2], vhandle[i+1]);
+
+    // Properties and status flags added later use the arena as well
+    OpenMesh::FPropHandleT<double> doubleHandle;
+    mesh.add_property(doubleHandle, "doubleProp");
+    EXPECT_EQ(&arena, mesh.property(doubleHandle).memory_resource());
+    mesh.property(doubleHandle, mesh.face_handle(0)) = 2.5;
+
+    const size_t before_status = arena.bytes_allocated();
+    mesh.request_vertex_status();
+    EXPECT_EQ(&arena, mesh.property(mesh.vertex_status_pph()).memory_resource());
+    EXPECT_GE(arena.bytes_allocated(), before_status + 100 * sizeof(OpenMesh::Attributes::StatusInfo));
+
+    // The connectivity arrays live in the arena, too
+    const size_t before_faces = arena.bytes_allocated();
+    for (int i = 0; i < 10; ++i)
+      mesh.add_face(mesh.add_vertex(ArenaMesh::Point(float(i), 0, 1)),
+                    mesh.add_vertex(ArenaMesh::Point(float(i), 1, 1)),
+                    mesh.add_vertex(ArenaMesh::Point(float(i), 0, 2)));
+    EXPECT_GT(arena.bytes_allocated(), before_faces);
+    EXPECT_EQ(108u, mesh.n_faces());
+
+    // A copy does not point into the arena ...
+    ArenaMesh copy(mesh);
+    EXPECT_EQ(nullptr, copy.memory_resource());
+    EXPECT_NE(&arena, copy.property(intHandle).memory_resource());
+    EXPECT_NE(&arena, copy.property(copy.points_pph()).memory_resource());
+    EXPECT_EQ(2.5, copy.property(doubleHandle, copy.face_handle(0)));
+    EXPECT_EQ(130u, copy.n_vertices());
+
+    // ... and an assigned mesh keeps its own resource
+    OpenMesh::ArenaMemoryResource other;
+    ArenaMesh assigned;
+    assigned.set_memory_resource(&other);
+    assigned = mesh;
+    EXPECT_EQ(&other, assigned.memory_resource());
+    EXPECT_EQ(&other, assigned.property(doubleHandle).memory_resource());
+    EXPECT_EQ(2.5, assigned.property(doubleHandle, assigned.face_handle(0)));
+
+    // Moving back to the default resource keeps the data
+    mesh.set_memory_resource(nullptr);
+    EXPECT_NE(&arena, mesh.property(mesh.points_pph()).memory_resource());
+    EXPECT_EQ(ArenaMesh::Point(99, 1, 0), mesh.point(vhandle[99]));
+    EXPECT_EQ(108u, mesh.n_faces());
+    EXPECT_FALSE(mesh.status(vhandle[99]).tagged());
+
+    arena.release();
+    EXPECT_EQ(0u, arena.bytes_reserved());
+    EXPECT_EQ(ArenaMesh::Point(99, 1, 0), copy.point(vhandle[99]));
+    EXPECT_EQ(ArenaMesh::Point(99, 1, 0), assigned.point(vhandle[99]));
+  }
+}
+
+/*
+ * The property classes are selected at compile time, lookups with the wrong
+ * allocator are detected and PropertyManager works on both kinds of meshes
+ */
+TEST_F(OpenMeshProperties, MemoryResourceTypedAccess) {
+
+  static_assert(std::is_same<Mesh::PropertyType<int>, OpenMesh::PropertyT<int> >::value,
+                "Default traits have to use std::allocator");
+  static_assert(std::is_same<ArenaMesh::PropertyType<int>, OpenMesh::PropertyT<int, OpenMesh::ResourceAllocatorT<int> > >::value,
+                "Arena traits have to use ResourceAllocatorT");
+  static_assert(std::is_same<ArenaMesh::PropertyType<bool>, OpenMesh::PropertyT<bool> >::value,
+                "Bool properties have to use std::allocator");
+  static_assert(std::is_same<Mesh::PropertyType<OpenMesh::Attributes::StatusInfo>,
+                             OpenMesh::PropertyT<OpenMesh::Attributes::StatusInfo, OpenMesh::ResourceAllocatorT<OpenMesh::Attributes::StatusInfo> > >::value,
+                "Status flags have to use ResourceAllocatorT");
+
+  OpenMesh::ArenaMemoryResource arena;
+  ArenaMesh mesh;
+  mesh.set_memory_resource(&arena);
+
+  std::vector<ArenaMesh::VertexHandle> vhandle;
+  vhandle.push_back(mesh.add_vertex(ArenaMesh::Point(0, 0, 0)));
+  vhandle.push_back(mesh.add_vertex(ArenaMesh::Point(1, 0, 0)));
+  vhandle.push_back(mesh.add_vertex(ArenaMesh::Point(0, 1, 0)));
+  mesh.add_face(vhandle);
+
+  OpenMesh::VPropHandleT<int> intHandle;
+  mesh.add_property(intHandle, "intProp");
+  mesh.property(intHandle, vhandle[1]) = 2;
+  EXPECT_EQ(&arena, mesh.property(intHandle).memory_resource());
+
+  mesh.copy_property(intHandle, vhandle[1], vhandle[2]);
+  EXPECT_EQ(2, mesh.property(intHandle, vhandle[2]));
+
+  OpenMesh::MPropHandleT<int> descriptionHandle;
+  mesh.add_property(descriptionHandle, "description");
+  mesh.property(descriptionHandle) = 7;
+  EXPECT_EQ(7, mesh.mproperty(descriptionHandle)[0]);
+
+  // Smart handles work on the connectivity only
+  int sum = 0;
+  for (auto vh : mesh.faces().begin()->vertices())
+    sum += mesh.property(intHandle, vh) + vh.valence();
+  EXPECT_EQ(10, sum);
+
+  // Status flags are accessed by the connectivity kernel
+  mesh.request_vertex_status();
+  mesh.status(vhandle[0]).set_tagged(true);
+  EXPECT_TRUE(mesh.status(vhandle[0]).tagged());
+
+  // Typed lookups through the connectivity kernel do not know the traits
+  OpenMesh::PolyConnectivity& connectivity = mesh;
+  EXPECT_THROW(connectivity.property(intHandle), std::logic_error);
+  EXPECT_EQ(2, connectivity.property(intHandle, vhandle[2]));
+
+  // PropertyManager, also between meshes using different allocators
+  auto weight = OpenMesh::makeTemporaryProperty<OpenMesh::VertexHandle, double>(mesh);
+  weight.set_range(mesh.vertices(), 1.5);
+  auto flag = OpenMesh::getOrMakeProperty<OpenMesh::VertexHandle, bool>(mesh, "flag");
+  flag[vhandle[2]] = true;
+  EXPECT_TRUE(flag[vhandle[2]]);
+  auto existing = OpenMesh::getProperty<OpenMesh::VertexHandle, int>(mesh, "intProp");
+  EXPECT_EQ(2, existing[vhandle[1]]);
+
+  Mesh other;
+  other.add_vertex(Mesh::Point(0, 0, 0));
+  auto other_weight = OpenMesh::makeTemporaryProperty<OpenMesh::VertexHandle, double>(other);
+  other_weight[OpenMesh::VertexHandle(0)] = 4.0;
+  weight.swap(other_weight);
+  EXPECT_EQ(4.0, weight[vhandle[0]]);
+  EXPECT_EQ(0.0, weight[vhandle[2]]);
+  EXPECT_EQ(1.5, other_weight[OpenMesh::VertexHandle(0)]);
+  EXPECT_EQ(&arena, mesh.property(weight.getRawProperty()).memory_resource());
+}
 }
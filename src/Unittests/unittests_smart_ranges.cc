@@ -7,6 +7,8 @@
 
 #include <iostream>
 #include <chrono>
+#include <atomic>
+#include <stdexcept>
 
 namespace {
 
@@ -911,4 +913,66 @@ TEST_F(OpenMeshSmartRanges, MemberFunctionFunctor)
 
 }
 
+/* Parallel ranges have to give the same results as the serial ones, also
+ * with small blocks, deleted elements, filters and non-index ranges
+ */
+TEST_F(OpenMeshSmartRanges, Parallel)
+{
+  using namespace OpenMesh::Predicates;
+
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+
+  for (auto vh : mesh_.vertices())
+    mesh_.status(vh).set_selected(vh.idx() % 3 == 0);
+
+  auto pos    = [&](OpenMesh::VertexHandle vh) { return mesh_.point(vh); };
+  auto weight = [&](OpenMesh::VertexHandle vh) { return mesh_.point(vh)[0] + 2 * mesh_.point(vh)[1] + 4 * mesh_.point(vh)[2]; };
+
+  // blocks of 3 vertices on 4 threads
+  auto par = mesh_.vertices().par(4, 3);
+  EXPECT_EQ(3u, par.n_blocks());
+  EXPECT_EQ(mesh_.vertices().sum(pos),     par.sum(pos));
+  EXPECT_EQ(mesh_.vertices().avg(pos),     par.avg(pos));
+  EXPECT_EQ(mesh_.vertices().min(weight),  par.min(weight));
+  EXPECT_EQ(mesh_.vertices().max(weight),  par.max(weight));
+  EXPECT_EQ(mesh_.vertices().argmin(weight), par.argmin(weight));
+  EXPECT_EQ(mesh_.vertices().argmax(weight), par.argmax(weight));
+  EXPECT_EQ(mesh_.vertices().to_vector(),  par.to_vector());
+  EXPECT_EQ(mesh_.vertices().count_if(Selected()), par.count_if(Selected()));
+  EXPECT_TRUE(par.any_of(Selected()));
+  EXPECT_FALSE(par.all_of(Selected()));
+  EXPECT_TRUE(par.all_of([](OpenMesh::SmartVertexHandle vh) { return vh.valence() > 0; }));
+
+  std::atomic<int> n_visited(0);
+  par.for_each([&](OpenMesh::VertexHandle) { ++n_visited; });
+  EXPECT_EQ(static_cast<int>(mesh_.n_vertices()), n_visited);
+
+  // filters, also combined ones from Predicates.hh
+  EXPECT_EQ(mesh_.vertices().filtered(Selected()).to_vector(), par.filtered(Selected()).to_vector());
+  EXPECT_EQ(mesh_.vertices().filtered(!Selected()).sum(pos), par.filtered(!Selected()).sum(pos));
+  EXPECT_EQ(mesh_.vertices().filtered(Selected() && !Boundary()).count_if(Selected()),
+            par.filtered(Selected()).filtered(!Boundary()).count_if(Selected()));
+
+  // deleted faces are skipped, also at the start of blocks
+  mesh_.delete_face(OpenMesh::FaceHandle(0), false);
+  mesh_.delete_face(OpenMesh::FaceHandle(3), false);
+  for (size_t grain = 1; grain < 6; ++grain)
+  {
+    EXPECT_EQ(mesh_.faces().to_vector(), mesh_.faces().par(4, grain).to_vector()) << "Wrong faces for grain " << grain;
+    EXPECT_EQ(mesh_.all_faces().to_vector(), mesh_.all_faces().par(4, grain).to_vector()) << "Wrong faces for grain " << grain;
+  }
+
+  // ranges which are walked to split them
+  for (auto vh : mesh_.vertices())
+    EXPECT_EQ(vh.vertices().to_vector(), vh.vertices().par(2, 2).to_vector());
+  EXPECT_EQ(mesh_.faces().filtered(Selected()).to_vector(), mesh_.faces().filtered(Selected()).par(2, 1).to_vector());
+
+  // exceptions are passed to the caller
+  EXPECT_THROW(par.for_each([](OpenMesh::VertexHandle vh) { if (vh.idx() == 5) throw std::runtime_error("test"); }),
+               std::runtime_error);
+}
+
+
 }
@@ -2,6 +2,7 @@
 #include <Unittests/unittests_common.hh>
 #include <iostream>
 #include <OpenMesh/Tools/SmartTagger/SmartTaggerT.hh>
+#include <OpenMesh/Tools/SmartTagger/SmartBitTaggerT.hh>
 
 namespace {
     
@@ -249,4 +250,100 @@ TEST_F(OpenMeshSmartTagger, SmartTaggerFaces) {
 
 }
 
+/* Checks SmartBitTagger and the bulk status operations on vertices
+ */
+TEST_F(OpenMeshSmartTagger, SmartBitTaggerVertices) {
+
+  mesh_.clear();
+  mesh_.request_vertex_status();
+
+  // More than two words of vertices
+  std::vector<Mesh::VertexHandle> vhandle;
+  for (int i = 0; i < 150; ++i)
+    vhandle.push_back(mesh_.add_vertex(Mesh::Point(float(i), 0, 0)));
+
+  // Select every third vertex
+  for (int i = 0; i < 150; i += 3)
+    mesh_.status(vhandle[i]).set_selected(true);
+
+  EXPECT_EQ(50u, mesh_.count_status_bits(OpenMesh::VertexHandle(), OpenMesh::Attributes::SELECTED));
+  EXPECT_TRUE(mesh_.any_status_bits(OpenMesh::VertexHandle(), OpenMesh::Attributes::SELECTED));
+  EXPECT_FALSE(mesh_.any_status_bits(OpenMesh::VertexHandle(), OpenMesh::Attributes::FEATURE));
+
+  OpenMesh::SmartBitTaggerVT< Mesh > tagger(mesh_);
+  EXPECT_EQ(0u, tagger.n_tagged()) << "Vertices should be untagged after init!";
+
+  tagger.tag_status(OpenMesh::Attributes::SELECTED);
+  EXPECT_EQ(50u, tagger.n_tagged());
+  EXPECT_TRUE(tagger.is_tagged(vhandle[0]));
+  EXPECT_FALSE(tagger.is_tagged(vhandle[64]));
+  EXPECT_TRUE(tagger.is_tagged(vhandle[129]));
+
+  // Visit order is ascending and covers exactly the tagged vertices
+  std::vector<int> visited;
+  tagger.for_each_tagged([&](Mesh::VertexHandle _vh) { visited.push_back(_vh.idx()); });
+  ASSERT_EQ(50u, visited.size());
+  for (size_t i = 0; i < visited.size(); ++i)
+    EXPECT_EQ(int(3 * i), visited[i]);
+
+  // Bulk clear a range of the selection
+  mesh_.set_status_bits(OpenMesh::VertexHandle(), OpenMesh::Attributes::SELECTED, false, 0, 75);
+  EXPECT_EQ(25u, mesh_.count_status_bits(OpenMesh::VertexHandle(), OpenMesh::Attributes::SELECTED));
+  EXPECT_FALSE(mesh_.status(vhandle[72]).selected());
+  EXPECT_TRUE(mesh_.status(vhandle[75]).selected());
+
+  size_t n_selected = 0;
+  mesh_.for_each_status_bits(OpenMesh::VertexHandle(), OpenMesh::Attributes::SELECTED,
+                             [&](Mesh::VertexHandle _vh) { EXPECT_GE(_vh.idx(), 75); ++n_selected; });
+  EXPECT_EQ(25u, n_selected);
+
+  // Single tags, tag_all and untag_all
+  tagger.untag_all();
+  EXPECT_EQ(0u, tagger.n_tagged());
+  tagger.set_tag(vhandle[149]);
+  EXPECT_TRUE(tagger.is_tagged(vhandle[149]));
+  tagger.set_tag(vhandle[149], false);
+  EXPECT_FALSE(tagger.is_tagged(vhandle[149]));
+  tagger.tag_all();
+  EXPECT_EQ(150u, tagger.n_tagged());
+
+  // Vertices added later on are untagged until tagged explicitly
+  Mesh::VertexHandle vh = mesh_.add_vertex(Mesh::Point(0, 1, 0));
+  for (int i = 0; i < 100; ++i)
+    vh = mesh_.add_vertex(Mesh::Point(0, 1, 0));
+  EXPECT_FALSE(tagger.is_tagged(vh));
+  tagger.set_tag(vh);
+  EXPECT_TRUE(tagger.is_tagged(vh));
+  EXPECT_EQ(151u, tagger.n_tagged());
+}
+
+/* Checks SmartTagger on a mesh whose properties are allocated from an arena
+ */
+struct ArenaTraits : public OpenMesh::DefaultTraits
+{
+  typedef OpenMesh::ResourceAllocatorT<char> PropertyAllocator;
+};
+
+TEST_F(OpenMeshSmartTagger, SmartTaggerArenaMesh) {
+
+  typedef OpenMesh::TriMesh_ArrayKernelT<ArenaTraits> ArenaMesh;
+
+  OpenMesh::ArenaMemoryResource arena;
+  ArenaMesh mesh;
+  mesh.set_memory_resource(&arena);
+
+  ArenaMesh::VertexHandle vhandle[3];
+  for (int i = 0; i < 3; ++i)
+    vhandle[i] = mesh.add_vertex(ArenaMesh::Point(float(i), 0, 0));
+
+  OpenMesh::SmartTaggerVT<ArenaMesh> tagger(mesh);
+
+  tagger.set_tag(vhandle[1]);
+  EXPECT_FALSE(tagger.is_tagged(vhandle[0]));
+  EXPECT_TRUE(tagger.is_tagged(vhandle[1]));
+
+  tagger.untag_all();
+  EXPECT_FALSE(tagger.is_tagged(vhandle[1]));
+}
+
 }
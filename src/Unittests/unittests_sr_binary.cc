@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/IO/BinaryOutBuffer.hh>
 #include <iostream>
 #include <list>
 #include <stdint.h>
@@ -84,5 +85,61 @@ TEST_F(OpenMeshSRBinary, StringStoreRestore) {
 }
 
 
+/* Check that the buffered binary output writes the same bytes as
+ * the binary serializer, with and without swapping the byte order
+ */
+TEST_F(OpenMeshSRBinary, BufferedOutput) {
+
+  for (int swap = 0; swap < 2; ++swap)
+  {
+    std::stringstream reference("");
+    std::stringstream buffered("");
+
+    {
+      // small capacity to write across several flushes
+      OpenMesh::IO::BinaryOutBuffer buffer(buffered, swap != 0, 64);
+
+      std::vector<float> floats;
+      for (int i = 0; i < 100; ++i)
+      {
+        const short s = short(i * 3 + 1);
+        const int   n = i * 100003;
+        const double d = i * 0.123456789;
+        const OpenMesh::Vec3f v(1.0f * i, 0.5f * i, -1.0f * i);
+
+        OpenMesh::IO::binary<short>::store(reference, s, swap != 0);
+        OpenMesh::IO::binary<int>::store(reference, n, swap != 0);
+        OpenMesh::IO::binary<double>::store(reference, d, swap != 0);
+        OpenMesh::IO::binary<OpenMesh::Vec3f>::store(reference, v, swap != 0);
+
+        EXPECT_EQ(2u,  buffer.put(s));
+        EXPECT_EQ(4u,  buffer.put(n));
+        EXPECT_EQ(8u,  buffer.put(d));
+        EXPECT_EQ(12u, buffer.put(v));
+
+        floats.push_back(float(i) / 7.0f);
+      }
+
+      // arrays larger than the buffer
+      for (size_t i = 0; i < floats.size(); ++i)
+        OpenMesh::IO::binary<float>::store(reference, floats[i], swap != 0);
+      EXPECT_EQ(4 * floats.size(), buffer.put(floats.data(), floats.size()));
+
+      // values larger than the buffer
+      struct Large { unsigned char bytes[80]; } large[2];
+      for (size_t i = 0; i < sizeof(large); ++i)
+        large[i / 80].bytes[i % 80] = static_cast<unsigned char>(i);
+      for (size_t i = 0; i < 2; ++i)
+        for (size_t j = 0; j < 80; ++j)
+          reference.put(char(large[i].bytes[swap ? 79 - j : j]));
+      EXPECT_EQ(sizeof(large), buffer.put(large, 2));
+
+      EXPECT_TRUE(buffer.flush());
+    }
+
+    EXPECT_EQ(reference.str(), buffered.str()) << "Swap: " << swap;
+  }
+}
+
 
 }
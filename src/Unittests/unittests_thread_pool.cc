@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+
+#include <atomic>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace {
+
+class OpenMeshThreadPool : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Every index is visited exactly once, in blocks of the given size
+ */
+TEST_F(OpenMeshThreadPool, Blocks) {
+
+  OpenMesh::ThreadPool pool(4);
+  EXPECT_EQ(4u, pool.n_threads());
+
+  std::vector<std::atomic<int>> visited(10007);
+  for (auto& v : visited)
+    v = 0;
+
+  std::atomic<int> n_blocks(0);
+  pool.parallel_for(visited.size(), 100, [&](size_t _first, size_t _last) {
+    EXPECT_EQ(0u, _first % 100);
+    EXPECT_TRUE(_last == _first + 100 || _last == visited.size());
+    for (size_t i = _first; i < _last; ++i)
+      ++visited[i];
+    ++n_blocks;
+  });
+
+  EXPECT_EQ(101, n_blocks);
+  for (size_t i = 0; i < visited.size(); ++i)
+    EXPECT_EQ(1, visited[i]) << "Index " << i;
+
+  // empty ranges never call the function
+  pool.parallel_for(0, 100, [](size_t, size_t) { FAIL(); });
+}
+
+/*
+ * Nested loops run serially on the calling thread
+ */
+TEST_F(OpenMeshThreadPool, Nested) {
+
+  OpenMesh::ThreadPool pool(4);
+
+  std::atomic<size_t> sum(0);
+  pool.parallel_for(16, 1, [&](size_t _first, size_t) {
+    EXPECT_EQ(1u, pool.max_threads());
+    pool.parallel_for(100, 10, [&](size_t _f, size_t _l) {
+      for (size_t i = _f; i < _l; ++i)
+        sum += _first * 100 + i;
+    });
+  });
+
+  EXPECT_EQ(1600u * 1599u / 2u, sum);
+}
+
+/*
+ * The first exception thrown by the loop body is passed to the caller
+ */
+TEST_F(OpenMeshThreadPool, Exceptions) {
+
+  OpenMesh::ThreadPool pool(4);
+
+  EXPECT_THROW(pool.parallel_for(1000, 10, [](size_t _first, size_t) {
+    if (_first == 500)
+      throw std::runtime_error("block 50");
+  }), std::runtime_error);
+
+  // the pool is still usable
+  std::atomic<size_t> n(0);
+  pool.parallel_for(1000, 10, [&](size_t _first, size_t _last) { n += _last - _first; });
+  EXPECT_EQ(1000u, n);
+}
+
+/*
+ * Thread limits nest, the smallest one wins
+ */
+TEST_F(OpenMeshThreadPool, ThreadLimit) {
+
+  OpenMesh::ThreadPool pool(4);
+
+  EXPECT_EQ(4u, pool.max_threads());
+  EXPECT_EQ(2u, pool.max_threads(2));
+  EXPECT_EQ(0u, OpenMesh::ThreadLimit::current());
+
+  {
+    OpenMesh::ThreadLimit limit(3);
+    EXPECT_EQ(3u, pool.max_threads());
+    EXPECT_EQ(2u, pool.max_threads(2));
+
+    {
+      OpenMesh::ThreadLimit inner(8);
+      EXPECT_EQ(3u, OpenMesh::ThreadLimit::current());
+    }
+    {
+      OpenMesh::ThreadLimit inner(1);
+      EXPECT_EQ(1u, pool.max_threads());
+    }
+    EXPECT_EQ(3u, OpenMesh::ThreadLimit::current());
+  }
+
+  EXPECT_EQ(0u, OpenMesh::ThreadLimit::current());
+}
+
+/*
+ * The global pool runs serially unless OPENMESH_NUM_THREADS or
+ * set_global_threads() asks for more threads
+ */
+TEST_F(OpenMeshThreadPool, GlobalDefault) {
+
+  OpenMesh::ThreadPool::set_global_threads(0);
+  const char* env = std::getenv("OPENMESH_NUM_THREADS");
+  if (!env || std::strtoul(env, nullptr, 10) == 0) {
+    EXPECT_EQ(1u, OpenMesh::ThreadPool::global().n_threads());
+  }
+
+  OpenMesh::ThreadPool::set_global_threads(3);
+  EXPECT_EQ(3u, OpenMesh::ThreadPool::global().n_threads());
+  EXPECT_EQ(&OpenMesh::ThreadPool::global(), &OpenMesh::ThreadPool::global());
+
+  OpenMesh::ThreadPool::set_global_threads(0);
+}
+
+/*
+ * Normals computed on several threads match the serial ones
+ */
+TEST_F(OpenMeshThreadPool, UpdateNormals) {
+
+  const int n = 101;
+  std::vector<Mesh::VertexHandle> vhs;
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      vhs.push_back(mesh_.add_vertex(Mesh::Point(float(i), float(j), float((i * j) % 7))));
+  for (int i = 0; i + 1 < n; ++i)
+    for (int j = 0; j + 1 < n; ++j) {
+      const int v = i * n + j;
+      mesh_.add_face(vhs[v], vhs[v + 1], vhs[v + n + 1]);
+      mesh_.add_face(vhs[v], vhs[v + n + 1], vhs[v + n]);
+    }
+
+  mesh_.request_face_normals();
+  mesh_.request_vertex_normals();
+
+  {
+    OpenMesh::ThreadLimit limit(1);
+    mesh_.update_normals();
+  }
+  Mesh serial = mesh_;
+
+  OpenMesh::ThreadPool::set_global_threads(4);
+  mesh_.update_normals();
+  OpenMesh::ThreadPool::set_global_threads(0);
+
+  for (auto fh : mesh_.faces())
+    EXPECT_EQ(serial.normal(fh), mesh_.normal(fh));
+  for (auto vh : mesh_.vertices())
+    EXPECT_EQ(serial.normal(vh), mesh_.normal(vh));
+}
+
+}
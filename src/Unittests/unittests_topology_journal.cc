@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+
+#include <algorithm>
+
+namespace {
+
+class OpenMeshTopologyJournal : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+        // Triangulated n x n grid with some height variation
+        void create_grid(int _n) {
+            mesh_.clear();
+            std::vector<Mesh::VertexHandle> vhs;
+            for (int i = 0; i < _n; ++i)
+                for (int j = 0; j < _n; ++j)
+                    vhs.push_back(mesh_.add_vertex(Mesh::Point(float(i), float(j), float((i * j) % 5))));
+            for (int i = 0; i + 1 < _n; ++i)
+                for (int j = 0; j + 1 < _n; ++j) {
+                    const int v = i * _n + j;
+                    mesh_.add_face(vhs[v], vhs[v + 1], vhs[v + _n + 1]);
+                    mesh_.add_face(vhs[v], vhs[v + _n + 1], vhs[v + _n]);
+                }
+        }
+
+        // Entries of the given kind since _pos
+        std::vector<OpenMesh::TopologyJournal::Entry> entries(OpenMesh::TopologyJournal::Position _pos, int _kind) {
+            std::vector<OpenMesh::TopologyJournal::Entry> result;
+            mesh_.journal().for_each(_pos, [&](const OpenMesh::TopologyJournal::Entry& _e) {
+                if (_e.kind == _kind)
+                    result.push_back(_e);
+            });
+            return result;
+        }
+
+        // Flags of the entry of element _idx since _pos, 0 if not recorded
+        int flags(OpenMesh::TopologyJournal::Position _pos, int _kind, int _idx) {
+            int result = 0;
+            for (const auto& e : entries(_pos, _kind))
+                if (e.idx == _idx)
+                    result |= e.flags;
+            return result;
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * A flip only records the elements around the flipped edge
+ */
+TEST_F(OpenMeshTopologyJournal, RecordFlip) {
+
+  create_grid(10);
+  EXPECT_FALSE(mesh_.has_journal());
+
+  mesh_.request_journal();
+  EXPECT_TRUE(mesh_.has_journal());
+
+  const OpenMesh::TopologyJournal::Position pos = mesh_.journal().checkpoint();
+  EXPECT_EQ(0u, mesh_.journal().size(pos));
+
+  // interior diagonal
+  const Mesh::HalfedgeHandle heh = mesh_.find_halfedge(Mesh::VertexHandle(44), Mesh::VertexHandle(55));
+  ASSERT_TRUE(heh.is_valid());
+  const Mesh::EdgeHandle eh = mesh_.edge_handle(heh);
+  const Mesh::FaceHandle f0 = mesh_.face_handle(heh);
+  const Mesh::FaceHandle f1 = mesh_.opposite_face_handle(heh);
+  ASSERT_TRUE(mesh_.is_flip_ok(eh));
+  mesh_.flip(eh);
+
+  EXPECT_EQ(OpenMesh::TopologyJournal::TOUCHED, flags(pos, OpenMesh::TopologyJournal::EDGE, eh.idx()));
+  EXPECT_EQ(OpenMesh::TopologyJournal::TOUCHED, flags(pos, OpenMesh::TopologyJournal::FACE, f0.idx()));
+  EXPECT_EQ(OpenMesh::TopologyJournal::TOUCHED, flags(pos, OpenMesh::TopologyJournal::FACE, f1.idx()));
+
+  // the two faces, their five edges and four vertices
+  EXPECT_EQ(2u, entries(pos, OpenMesh::TopologyJournal::FACE).size());
+  EXPECT_EQ(5u, entries(pos, OpenMesh::TopologyJournal::EDGE).size());
+  EXPECT_EQ(4u, entries(pos, OpenMesh::TopologyJournal::VERTEX).size());
+
+  mesh_.release_journal();
+  EXPECT_FALSE(mesh_.has_journal());
+  EXPECT_FALSE(mesh_.journal().valid(pos));
+}
+
+/*
+ * Creations and deletions are flagged, elements appear once per section
+ */
+TEST_F(OpenMeshTopologyJournal, CreateAndDelete) {
+
+  create_grid(5);
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+  mesh_.request_journal();
+
+  OpenMesh::TopologyJournal& journal = mesh_.journal();
+  const OpenMesh::TopologyJournal::Position pos0 = journal.checkpoint();
+
+  const Mesh::VertexHandle vh = mesh_.add_vertex(Mesh::Point(0, 0, 1));
+  EXPECT_EQ(OpenMesh::TopologyJournal::CREATED | OpenMesh::TopologyJournal::TOUCHED,
+            flags(pos0, OpenMesh::TopologyJournal::VERTEX, vh.idx()));
+
+  const Mesh::FaceHandle fh(0);
+  mesh_.delete_face(fh, false);
+  EXPECT_EQ(OpenMesh::TopologyJournal::DELETED, flags(pos0, OpenMesh::TopologyJournal::FACE, fh.idx()));
+
+  // the boundary edge of the corner face 0 is deleted with it
+  size_t n_deleted = 0;
+  for (const auto& e : entries(pos0, OpenMesh::TopologyJournal::EDGE))
+    if (e.flags & OpenMesh::TopologyJournal::DELETED) {
+      EXPECT_TRUE(mesh_.status(Mesh::EdgeHandle(e.idx)).deleted());
+      ++n_deleted;
+    }
+  EXPECT_EQ(1u, n_deleted);
+
+  // one entry per element and section
+  const size_t n = journal.size(pos0);
+  mesh_.set_point(vh, Mesh::Point(0, 0, 2));
+  EXPECT_EQ(n, journal.size(pos0));
+
+  const OpenMesh::TopologyJournal::Position pos1 = journal.checkpoint();
+  mesh_.set_point(vh, Mesh::Point(0, 0, 3));
+  EXPECT_EQ(n + 1, journal.size(pos0));
+  EXPECT_EQ(1u, journal.size(pos1));
+
+  // truncating invalidates older positions only
+  journal.truncate(pos1);
+  EXPECT_FALSE(journal.valid(pos0));
+  EXPECT_TRUE(journal.valid(pos1));
+
+  // garbage collection changes handles and invalidates all positions
+  mesh_.garbage_collection();
+  EXPECT_FALSE(journal.valid(pos1));
+  EXPECT_TRUE(journal.valid(journal.checkpoint()));
+}
+
+/*
+ * Incremental normal updates give the same normals as a full update
+ */
+TEST_F(OpenMeshTopologyJournal, UpdateNormals) {
+
+  create_grid(30);
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+  mesh_.request_face_normals();
+  mesh_.request_vertex_normals();
+  mesh_.request_halfedge_normals();
+  mesh_.request_journal();
+
+  mesh_.update_normals();
+  OpenMesh::TopologyJournal::Position pos = mesh_.journal().checkpoint();
+
+  // move some vertices and flip some edges
+  mesh_.set_point(Mesh::VertexHandle(100), Mesh::Point(3, 10, 7));
+  mesh_.set_point(Mesh::VertexHandle(401), Mesh::Point(13, 11, -2));
+  for (int i = 1000; i < 1500; i += 131)
+    if (mesh_.is_flip_ok(Mesh::EdgeHandle(i)))
+      mesh_.flip(Mesh::EdgeHandle(i));
+
+  // the edits touch a small part of the mesh only
+  EXPECT_LT(mesh_.journal().size(pos), mesh_.n_edges() / 4);
+
+  Mesh reference = mesh_;
+  reference.update_normals();
+  pos = mesh_.update_normals(pos);
+
+  for (auto fh : mesh_.faces())
+    EXPECT_EQ(reference.normal(fh), mesh_.normal(fh)) << "Face " << fh.idx();
+  for (auto vh : mesh_.vertices())
+    EXPECT_EQ(reference.normal(vh), mesh_.normal(vh)) << "Vertex " << vh.idx();
+  for (auto heh : mesh_.halfedges())
+    EXPECT_EQ(reference.normal(heh), mesh_.normal(heh)) << "Halfedge " << heh.idx();
+
+  // collapse some edges. update_halfedge_normals() does not skip deleted
+  // halfedges, so compare face and vertex normals only.
+  mesh_.release_halfedge_normals();
+  size_t n_collapsed = 0;
+  for (int i = 200; i < 800; i += 97) {
+    const Mesh::HalfedgeHandle heh = mesh_.halfedge_handle(Mesh::EdgeHandle(i), 0);
+    if (!mesh_.status(mesh_.edge_handle(heh)).deleted() && mesh_.is_collapse_ok(heh)) {
+      mesh_.collapse(heh);
+      ++n_collapsed;
+    }
+  }
+  EXPECT_GT(n_collapsed, 0u);
+
+  reference = mesh_;
+  reference.update_normals();
+  pos = mesh_.update_normals(pos);
+
+  for (auto fh : mesh_.faces())
+    EXPECT_EQ(reference.normal(fh), mesh_.normal(fh)) << "Face " << fh.idx();
+  for (auto vh : mesh_.vertices())
+    EXPECT_EQ(reference.normal(vh), mesh_.normal(vh)) << "Vertex " << vh.idx();
+
+  // after a garbage collection everything is recomputed
+  mesh_.garbage_collection();
+  EXPECT_FALSE(mesh_.journal().valid(pos));
+  for (auto vh : mesh_.vertices())
+    mesh_.set_normal(vh, Mesh::Normal(0, 0, 0));
+  mesh_.update_normals(pos);
+  reference = mesh_;
+  reference.update_normals();
+  for (auto vh : mesh_.vertices())
+    EXPECT_EQ(reference.normal(vh), mesh_.normal(vh)) << "Vertex " << vh.idx();
+}
+
+/*
+ * Incremental normal updates compute the vertex normals from the geometry
+ * if the mesh has no face normals
+ */
+TEST_F(OpenMeshTopologyJournal, UpdateNormalsWithoutFaceNormals) {
+
+  create_grid(20);
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+  mesh_.request_vertex_normals();
+  mesh_.release_face_normals();
+  mesh_.request_journal();
+  ASSERT_FALSE(mesh_.has_face_normals());
+
+  for (auto vh : mesh_.vertices())
+    mesh_.set_normal(vh, Mesh::Normal(0, 0, 0));
+  OpenMesh::TopologyJournal::Position pos = mesh_.journal().checkpoint();
+
+  // only the neighborhood of the moved vertex is updated
+  const Mesh::VertexHandle moved(150);
+  mesh_.set_point(moved, Mesh::Point(9, 10, 4));
+  pos = mesh_.update_normals(pos);
+
+  for (auto vh : mesh_.vertices()) {
+    bool near = (vh == moved);
+    for (auto vv : mesh_.vv_range(vh))
+      near = near || (vv == moved);
+    if (near)
+      EXPECT_EQ(mesh_.calc_normal(vh), mesh_.normal(vh)) << "Vertex " << vh.idx();
+    else
+      EXPECT_EQ(Mesh::Normal(0, 0, 0), mesh_.normal(vh)) << "Vertex " << vh.idx();
+  }
+  EXPECT_NE(Mesh::Normal(0, 0, 0), mesh_.normal(moved));
+
+  // an invalid position recomputes all vertex normals
+  mesh_.garbage_collection();
+  EXPECT_FALSE(mesh_.journal().valid(pos));
+  mesh_.update_normals(pos);
+  for (auto vh : mesh_.vertices())
+    EXPECT_EQ(mesh_.calc_normal(vh), mesh_.normal(vh)) << "Vertex " << vh.idx();
+}
+
+}
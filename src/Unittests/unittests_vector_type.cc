@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/Geometry/VectorBatchT.hh>
 #include <iostream>
 #include <list>
 
@@ -435,4 +436,69 @@ TEST_F(OpenMeshVectorTest, Test_simple_0_constructor) {
 
 
 
+template <typename Vec>
+void check_batch_operations() {
+
+  typedef typename Vec::value_type Scalar;
+
+  // 11 vectors to cover both the vectorized blocks and the remainder,
+  // one of them zero to check the normalize_cond semantics
+  std::vector<Vec> a, b;
+  for (int i = 0; i < 11; ++i) {
+    Vec va, vb;
+    for (size_t j = 0; j < Vec::size(); ++j) {
+      va[j] = Scalar(1.5 * i - 2.25 * j + 0.125);
+      vb[j] = Scalar(0.75 * j * j - 0.5 * i + 3.0);
+    }
+    a.push_back(i == 5 ? Vec(Scalar(0)) : va);
+    b.push_back(vb);
+  }
+
+  std::vector<Scalar> dots(a.size());
+  OpenMesh::dot_n(a.data(), b.data(), dots.data(), a.size());
+
+  std::vector<Vec> normalized = a;
+  OpenMesh::normalize_n(normalized.data(), normalized.size());
+
+  for (size_t i = 0; i < a.size(); ++i) {
+    EXPECT_EQ((a[i] | b[i]), dots[i]) << "Wrong dot product at " << i;
+    EXPECT_EQ(Vec(a[i]).normalize_cond(), normalized[i]) << "Wrong normalization at " << i;
+  }
+}
+
+template <typename Vec>
+void check_batch_cross() {
+
+  std::vector<Vec> a, b;
+  for (int i = 0; i < 11; ++i) {
+    a.push_back(Vec(1.5 * i, -2.0 + i, 0.25 * i * i));
+    b.push_back(Vec(3.0 - i, 0.5 * i, 1.0 + 0.125 * i));
+  }
+
+  std::vector<Vec> crosses(a.size());
+  OpenMesh::cross_n(a.data(), b.data(), crosses.data(), a.size());
+
+  for (size_t i = 0; i < a.size(); ++i)
+    EXPECT_EQ(a[i] % b[i], crosses[i]) << "Wrong cross product at " << i;
+
+  // in place
+  OpenMesh::cross_n(a.data(), b.data(), a.data(), a.size());
+  EXPECT_EQ(crosses, a) << "Wrong in place cross product";
+}
+
+/* Batch operations have to give the same results as the single vector ones
+ */
+TEST_F(OpenMeshVectorTest, BatchOperations) {
+
+  check_batch_operations<OpenMesh::Vec3f>();
+  check_batch_operations<OpenMesh::Vec4f>();
+  check_batch_operations<OpenMesh::Vec3d>();
+  check_batch_operations<OpenMesh::Vec4d>();
+  check_batch_operations<OpenMesh::Vec2f>();
+
+  check_batch_cross<OpenMesh::Vec3f>();
+  check_batch_cross<OpenMesh::Vec3d>();
+}
+
+
 }
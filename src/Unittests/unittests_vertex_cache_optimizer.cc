@@ -0,0 +1,108 @@
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/VertexCacheOptimizerT.hh>
+#include <algorithm>
+#include <array>
+
+namespace {
+
+class OpenMeshVertexCacheOptimizer : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Cache statistics of a hand made index buffer
+ */
+TEST_F(OpenMeshVertexCacheOptimizer, Analyze) {
+
+  typedef OpenMesh::VertexCacheOptimizerT<Mesh> Optimizer;
+
+  // quad as two triangles
+  Optimizer::Indices indices = { 0, 1, 2,  0, 2, 3 };
+
+  Optimizer::Report report = Optimizer::analyze(indices, 16);
+  EXPECT_EQ(2u, report.n_triangles);
+  EXPECT_EQ(4u, report.n_vertices);
+  EXPECT_EQ(4u, report.cache_misses);
+  EXPECT_DOUBLE_EQ(2.0, report.acmr);
+  EXPECT_DOUBLE_EQ(1.0, report.atvr);
+
+  // a FIFO cache of size three has evicted vertex 0 when it is used again
+  indices = { 0, 1, 2,  1, 2, 3,  0, 2, 3 };
+  report = Optimizer::analyze(indices, 3);
+  EXPECT_EQ(5u, report.cache_misses);
+  EXPECT_DOUBLE_EQ(1.25, report.atvr);
+}
+
+/*
+ * Optimize a mesh and check that the index buffer contains each
+ * triangle exactly once and got more cache friendly
+ */
+TEST_F(OpenMeshVertexCacheOptimizer, Optimize) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  OpenMesh::VertexCacheOptimizerT<Mesh> optimizer(mesh_);
+
+  EXPECT_EQ(mesh_.n_faces(), optimizer.unoptimized());
+  const OpenMesh::VertexCacheOptimizerT<Mesh>::Report before = optimizer.report();
+  const OpenMesh::VertexCacheOptimizerT<Mesh>::Indices original = optimizer.indices();
+
+  EXPECT_EQ(mesh_.n_faces(), optimizer.optimize(16));
+  EXPECT_TRUE(optimizer.is_valid()) << "Indices not computed!";
+  const OpenMesh::VertexCacheOptimizerT<Mesh>::Report after = optimizer.report();
+
+  EXPECT_EQ(mesh_.n_faces(), after.n_triangles);
+  EXPECT_EQ(mesh_.n_vertices(), after.n_vertices);
+  EXPECT_LT(after.acmr, before.acmr) << "Optimized order should have less cache misses";
+  EXPECT_LT(after.acmr, 0.8);
+  EXPECT_GE(after.atvr, 1.0);
+
+  // Clusters partition the triangles
+  const std::vector<size_t>& clusters = optimizer.clusters();
+  ASSERT_LE(2u, clusters.size());
+  EXPECT_EQ(0u, clusters.front());
+  EXPECT_EQ(mesh_.n_faces(), clusters.back());
+  EXPECT_TRUE(std::is_sorted(clusters.begin(), clusters.end()));
+
+  // Same triangles with the same orientation, only the order differs
+  auto normalized = [](const OpenMesh::VertexCacheOptimizerT<Mesh>::Indices& _indices)
+  {
+    std::vector< std::array<unsigned int, 3> > tris;
+    for (size_t i = 0; i < _indices.size(); i += 3)
+    {
+      std::array<unsigned int, 3> t = {{ _indices[i], _indices[i+1], _indices[i+2] }};
+      std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+      tris.push_back(t);
+    }
+    std::sort(tris.begin(), tris.end());
+    return tris;
+  };
+  EXPECT_TRUE(normalized(original) == normalized(optimizer.indices())) << "Triangles changed";
+}
+}
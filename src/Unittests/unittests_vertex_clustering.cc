@@ -0,0 +1,173 @@
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Decimater/VertexClusteringT.hh>
+#include <OpenMesh/Core/Utils/ThreadPool.hh>
+
+namespace {
+
+class OpenMeshVertexClustering : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * Check that the rebuilt connectivity is consistent: the halfedges of each
+ * face form a loop and the vertex circulators reach every edge
+ */
+void check_connectivity(const Mesh& _mesh)
+{
+  for (auto heh : _mesh.halfedges())
+  {
+    EXPECT_EQ(_mesh.to_vertex_handle(heh), _mesh.from_vertex_handle(_mesh.next_halfedge_handle(heh)))
+        << "Halfedges are not linked correctly!";
+    EXPECT_EQ(heh, _mesh.prev_halfedge_handle(_mesh.next_halfedge_handle(heh)))
+        << "Previous halfedge is not correct!";
+  }
+
+  size_t valence_sum = 0;
+  for (auto vh : _mesh.vertices())
+  {
+    valence_sum += vh.valence();
+    if (vh.is_boundary()) {
+      EXPECT_TRUE(_mesh.is_boundary(_mesh.halfedge_handle(vh))) << "Boundary vertex does not start at the boundary!";
+    }
+  }
+  EXPECT_EQ(2 * _mesh.n_edges(), valence_sum) << "Vertex circulators do not reach all edges!";
+
+  for (auto fh : _mesh.faces())
+    EXPECT_EQ(3u, fh.valence()) << "Face is not a triangle!";
+}
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ */
+TEST_F(OpenMeshVertexClustering, DecimateMesh) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  OpenMesh::Decimater::VertexClusteringT<Mesh> clustering(mesh_);
+  size_t removedVertices = clustering.decimate(16);
+  mesh_.garbage_collection();
+
+  EXPECT_EQ(6174u, removedVertices) << "The number of removed vertices is not correct!";
+  EXPECT_EQ(1352u, mesh_.n_vertices()) << "The number of vertices after clustering is not correct!";
+  EXPECT_EQ(2700u, mesh_.n_faces()) << "The number of faces after clustering is not correct!";
+
+  check_connectivity(mesh_);
+}
+
+/*
+ * Locked vertices stay where they are
+ */
+TEST_F(OpenMeshVertexClustering, KeepLockedVertices) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  mesh_.request_vertex_status();
+  Mesh::Point locked_point = mesh_.point(Mesh::VertexHandle(100));
+  mesh_.status(Mesh::VertexHandle(100)).set_locked(true);
+  mesh_.status(Mesh::VertexHandle(101)).set_locked(true);
+
+  {
+    OpenMesh::Decimater::VertexClusteringT<Mesh> clustering(mesh_);
+    clustering.decimate(8);
+    mesh_.garbage_collection();
+  }
+
+  size_t n_locked = 0;
+  bool found = false;
+  for (auto vh : mesh_.vertices())
+    if (mesh_.status(vh).locked())
+    {
+      ++n_locked;
+      found = found || mesh_.point(vh) == locked_point;
+    }
+
+  EXPECT_EQ(2u, n_locked) << "Locked vertices were removed!";
+  EXPECT_TRUE(found) << "Locked vertex was moved!";
+
+  check_connectivity(mesh_);
+
+  mesh_.release_vertex_status();
+}
+
+/*
+ */
+TEST_F(OpenMeshVertexClustering, DecimateToVertices) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  OpenMesh::Decimater::VertexClusteringT<Mesh> clustering(mesh_);
+  EXPECT_EQ(1352u, clustering.n_clusters(16)) << "The number of clusters is not correct!";
+
+  clustering.decimate_to(1000);
+  mesh_.garbage_collection();
+
+  EXPECT_LE(mesh_.n_vertices(), 1000u) << "The number of vertices after clustering is not correct!";
+  EXPECT_GT(mesh_.n_vertices(), 800u) << "The number of vertices after clustering is not correct!";
+
+  check_connectivity(mesh_);
+}
+
+/*
+ * The result does not depend on the number of threads
+ */
+TEST_F(OpenMeshVertexClustering, DecimateMeshParallel) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  Mesh serial = mesh_;
+  {
+    OpenMesh::ThreadLimit limit(1);
+    OpenMesh::Decimater::VertexClusteringT<Mesh> clustering(serial);
+    clustering.decimate(32);
+    serial.garbage_collection();
+  }
+
+  OpenMesh::ThreadPool::set_global_threads(4);
+  {
+    OpenMesh::Decimater::VertexClusteringT<Mesh> clustering(mesh_);
+    clustering.decimate(32);
+    mesh_.garbage_collection();
+  }
+  OpenMesh::ThreadPool::set_global_threads(0);
+
+  ASSERT_EQ(serial.n_vertices(), mesh_.n_vertices()) << "The number of vertices differs!";
+  ASSERT_EQ(serial.n_faces(), mesh_.n_faces()) << "The number of faces differs!";
+
+  for (auto vh : mesh_.vertices())
+    EXPECT_EQ(serial.point(OpenMesh::VertexHandle(vh.idx())), mesh_.point(vh)) << "Positions differ!";
+
+  check_connectivity(mesh_);
+}
+
+}